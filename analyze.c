@@ -0,0 +1,224 @@
+/*
+ * analyze.c
+ *
+ *  Kinematic model for the job pre-flight. Each move gets a trapezoid:
+ *  it accelerates from its entry speed, cruises at the programmed
+ *  feedrate clipped to the axis limits, and slows down to the speed of the
+ *  corner to the next move. The corner speed follows the junction
+ *  deviation rule, the speed at which the head leaves the path by no more
+ *  than junction_dev. Jerk is not modelled, at print speeds it adds
+ *  little to a trapezoid.
+ *
+ *  The last ANALYZE_LOOKAHEAD moves are kept, the newest one ends at rest
+ *  and a backward pass lowers the corner speeds the moves before it
+ *  cannot brake from in time. The pass stops at the first corner it does
+ *  not change, on a typical job that is after a move or two.
+ */
+
+/*===========================================================================*/
+/* Job analyzer.                                                             */
+/*===========================================================================*/
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "analyze.h"
+
+void analyze_init(analyze_t *a, const analyze_limits_t *lim)
+{
+	memset(a, 0, sizeof(*a));
+	a->lim = *lim;
+}
+
+/*
+ * Position change without motion, G92 and homing.
+ */
+void analyze_set_position(analyze_t *a, const int32_t pos[ANALYZE_AXES])
+{
+	memcpy(a->pos, pos, sizeof(a->pos));
+}
+
+#define RING_MASK       (ANALYZE_LOOKAHEAD - 1)
+
+/*
+ * Times the oldest move from a->entry to the entry of the next one and
+ * drops it from the ring.
+ */
+static void _retire(analyze_t *a)
+{
+	const analyze_move_t *m = &a->ring[a->head & RING_MASK];
+	float v0 = a->entry, vc = m->v, v_exit, reach, d_acc, d_dec, vp, t;
+
+	v_exit = a->n > 1 ? a->ring[(a->head + 1) & RING_MASK].entry : 0.0f;
+	/* what the move can accelerate to over its length */
+	reach = sqrtf(v0 * v0 + 2.0f * m->a * m->len);
+	if(v_exit > reach)
+		v_exit = reach;
+
+	d_acc = (vc * vc - v0 * v0) / (2.0f * m->a);
+	d_dec = (vc * vc - v_exit * v_exit) / (2.0f * m->a);
+	if(d_acc + d_dec <= m->len)
+		t = (vc - v0) / m->a + (vc - v_exit) / m->a + (m->len - d_acc - d_dec) / vc;
+	else
+	{
+		/* never reaches the cruise speed */
+		vp = sqrtf((2.0f * m->a * m->len + v0 * v0 + v_exit * v_exit) * 0.5f);
+		t = (vp - v0) / m->a + (vp - v_exit) / m->a;
+	}
+	a->us += (uint64_t)(t * 1000000.0f);
+	a->us_nominal += (uint64_t)(m->len / vc * 1000000.0f);
+	a->entry = v_exit;
+	a->head++;
+	a->n--;
+}
+
+/*
+ * Highest speed through the corner from the newest move into m.
+ */
+static float _junction(const analyze_t *a, const analyze_move_t *m)
+{
+	const analyze_move_t *p = &a->ring[(a->head + a->n - 1) & RING_MASK];
+	float cos_theta, sin_half, acc, v;
+
+	if(a->n == 0)
+		return 0.0f;
+	/* extruder only moves start and end at rest */
+	if((p->u[0] == 0.0f && p->u[1] == 0.0f && p->u[2] == 0.0f) ||
+		(m->u[0] == 0.0f && m->u[1] == 0.0f && m->u[2] == 0.0f))
+		return 0.0f;
+
+	v = p->v < m->v ? p->v : m->v;
+	cos_theta = -(p->u[0] * m->u[0] + p->u[1] * m->u[1] + p->u[2] * m->u[2]);
+	if(cos_theta < -0.999999f)
+		return v;           /* straight on */
+	if(cos_theta > 0.999999f)
+		return 0.0f;        /* reversal */
+
+	acc = p->a < m->a ? p->a : m->a;
+	sin_half = sqrtf(0.5f * (1.0f - cos_theta));
+	v = fminf(v, sqrtf(acc * a->lim.junction_dev * sin_half / (1.0f - sin_half)));
+	return v;
+}
+
+/*
+ * Backward pass from the newest move, which has to be able to stop.
+ */
+static void _backward(analyze_t *a)
+{
+	analyze_move_t *m;
+	float v = 0.0f, e;
+	uint32_t i;
+
+	for(i = a->n; i-- > 1; )
+	{
+		m = &a->ring[(a->head + i) & RING_MASK];
+		e = sqrtf(v * v + 2.0f * m->a * m->len);
+		if(e > m->entry_max)
+			e = m->entry_max;
+		if(e == m->entry && i < a->n - 1)
+			break;
+		m->entry = e;
+		v = e;
+	}
+}
+
+static void _extend(int32_t *min, int32_t *max, const int32_t *pos, bool *valid)
+{
+	int i;
+
+	for(i = 0; i < 3; i++)
+	{
+		if(!*valid || pos[i] < min[i])
+			min[i] = pos[i];
+		if(!*valid || pos[i] > max[i])
+			max[i] = pos[i];
+	}
+	*valid = true;
+}
+
+/*
+ * Move to pos at feedrate f, both in gcode units like _param_t.
+ */
+void analyze_move(analyze_t *a, const int32_t pos[ANALYZE_AXES], int32_t f)
+{
+	analyze_move_t m;
+	float d[ANALYZE_AXES], len, lim, v;
+	int i;
+
+	for(i = 0; i < ANALYZE_AXES; i++)
+		d[i] = (float)(pos[i] - a->pos[i]);
+
+	if(d[3] > 0.0f)
+		a->extruded += pos[3] - a->pos[3];
+	else
+		a->retracted += a->pos[3] - pos[3];
+	_extend(a->min, a->max, a->pos, &a->extents);
+	_extend(a->min, a->max, pos, &a->extents);
+	if(d[3] > 0.0f && (d[0] != 0.0f || d[1] != 0.0f))
+	{
+		/* a layer starts with the first extrusion at a new height */
+		if(!a->part || pos[2] > a->layer_z)
+		{
+			a->layers++;
+			a->layer_z = pos[2];
+		}
+		_extend(a->part_min, a->part_max, a->pos, &a->part);
+		_extend(a->part_min, a->part_max, pos, &a->part);
+	}
+	memcpy(a->pos, pos, sizeof(a->pos));
+	if(f <= 0)
+		return;
+	if(f > a->max_f)
+		a->max_f = f;
+
+	len = sqrtf(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]);
+	if(len == 0.0f)
+	{
+		len = fabsf(d[3]);
+		if(len == 0.0f)
+			return;
+		m.u[0] = m.u[1] = m.u[2] = 0.0f;
+	}
+	else
+	{
+		for(i = 0; i < 3; i++)
+			m.u[i] = d[i] / len;
+	}
+	a->moves++;
+
+	/* the axis that gets to its limit first sets the limit of the move */
+	v = (float)f / 60.0f;
+	m.a = 0.0f;
+	for(i = 0; i < ANALYZE_AXES; i++)
+	{
+		if(d[i] == 0.0f)
+			continue;
+		lim = len / fabsf(d[i]);
+		if(a->lim.vmax[i] * lim < v)
+			v = a->lim.vmax[i] * lim;
+		if(m.a == 0.0f || a->lim.amax[i] * lim < m.a)
+			m.a = a->lim.amax[i] * lim;
+	}
+	m.len = len;
+	m.v = v;
+	if(v > a->max_v)
+		a->max_v = v;
+
+	m.entry_max = _junction(a, &m);
+	m.entry = 0.0f;
+	if(a->n == ANALYZE_LOOKAHEAD)
+		_retire(a);
+	a->ring[(a->head + a->n) & RING_MASK] = m;
+	a->n++;
+	_backward(a);
+}
+
+/*
+ * The last move ends at rest.
+ */
+void analyze_finish(analyze_t *a)
+{
+	while(a->n > 0)
+		_retire(a);
+	a->entry = 0.0f;
+}
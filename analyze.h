@@ -0,0 +1,76 @@
+/*
+ * analyze.h
+ *
+ *  Job pre-flight: print time with acceleration, extents, extrusion and
+ *  layers from the moves of a job. Plain C, the analyze command feeds it
+ *  from the card and it runs on a PC as well.
+ */
+
+#ifndef ANALYZE_H_
+#define ANALYZE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define ANALYZE_AXES        4       /* X, Y, Z, E */
+#define ANALYZE_CHUNK       4096    /* bytes per read of the command */
+#define ANALYZE_JUNCTION    50      /* junction deviation, gcode units */
+#define ANALYZE_LOOKAHEAD   32      /* moves, power of two */
+
+/*
+ * Machine limits in gcode units, the caller takes them from the axis
+ * table.
+ */
+typedef struct
+{
+	float vmax[ANALYZE_AXES];   /* units/s */
+	float amax[ANALYZE_AXES];   /* units/s2 */
+	float junction_dev;         /* units, how far a corner may be cut */
+} analyze_limits_t;
+
+/*
+ * Moves wait in a lookahead ring like in a firmware planner and are timed
+ * when they drop out of it.
+ */
+typedef struct
+{
+	float len;                  /* units */
+	float v;                    /* cruise, units/s */
+	float a;                    /* units/s2 */
+	float u[3];                 /* direction, zero for extruder only moves */
+	float entry_max;            /* corner to the move before */
+	float entry;                /* entry_max, or less to brake in time */
+} analyze_move_t;
+
+typedef struct
+{
+	analyze_limits_t lim;
+	int32_t pos[ANALYZE_AXES];  /* gcode units */
+	analyze_move_t ring[ANALYZE_LOOKAHEAD];
+	uint32_t head;              /* oldest move */
+	uint32_t n;
+	float entry;                /* speed the oldest move starts at */
+
+	uint64_t us;                /* estimate with acceleration */
+	uint64_t us_nominal;        /* at the programmed feedrates */
+	uint32_t moves;
+	uint32_t layers;
+	int32_t layer_z;
+	bool extents;               /* min/max valid */
+	bool part;                  /* part_min/part_max valid */
+	int32_t min[3];             /* everything the head visits */
+	int32_t max[3];
+	int32_t part_min[3];        /* extruding moves */
+	int32_t part_max[3];
+	int64_t extruded;           /* units of filament */
+	int64_t retracted;
+	int32_t max_f;              /* highest programmed feedrate, units/min */
+	float max_v;                /* highest cruise after the axis limits */
+} analyze_t;
+
+void analyze_init(analyze_t *a, const analyze_limits_t *lim);
+void analyze_move(analyze_t *a, const int32_t pos[ANALYZE_AXES], int32_t f);
+void analyze_set_position(analyze_t *a, const int32_t pos[ANALYZE_AXES]);
+void analyze_finish(analyze_t *a);
+
+#endif /* ANALYZE_H_ */
@@ -415,7 +415,8 @@
  * @details User fields added to the end of the @p thread_t structure.
  */
 #define CH_CFG_THREAD_EXTRA_FIELDS                                          \
-  /* Add threads custom fields here.*/
+  /* Add threads custom fields here.*/                                      \
+  uint8_t               io_class;   /* ioq_class_t of its card requests */
 
 /**
  * @brief   Threads initialization hook.
@@ -426,6 +427,7 @@
  */
 #define CH_CFG_THREAD_INIT_HOOK(tp) {                                       \
   /* Add threads initialization code here.*/                                \
+  (tp)->io_class = 1;               /* IOQ_CLASS_FS */                      \
 }
 
 /**
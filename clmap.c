@@ -0,0 +1,285 @@
+/*
+ * clmap.c
+ *
+ *  Summary map of free clusters. A bitmap of a 32 GB card is 128 KB, too
+ *  much for this part, so the map keeps a free count per group of FAT
+ *  sectors instead (1 << shift sectors per entry, 8 KB in the CCM). A
+ *  count is 32 bit, a group of the largest FAT32 volume holds more than
+ *  64K clusters. volume.c fills it during its FAT scan and
+ *  keeps it current from the FAT write hook.
+ *
+ *  To place a long write the summary picks the groups with the most free
+ *  clusters, only those FAT sectors are turned into a word bitmap and the
+ *  runs are found a word at a time with CTZ. The result goes into
+ *  last_clust, where FatFs starts looking when it creates a new chain.
+ */
+
+/*===========================================================================*/
+/* Free cluster map.                                                         */
+/*===========================================================================*/
+#include <string.h>
+
+#include "ch.h"
+#include "hal.h"
+
+#include "chprintf.h"
+
+#include "ff.h"
+#include "diskio.h"
+#include "fat.h"
+#include "clmap.h"
+#include "memmap.h"
+
+/* widest case, FAT16 has 256 clusters per sector */
+#define BITMAP_WORDS        (CLMAP_WINDOW * (MMCSD_BLOCK_SIZE / 2) / 32)
+
+static uint32_t summary[CLMAP_ENTRIES] CCM_DATA;
+static uint32_t bitmap[BITMAP_WORDS] CCM_DATA;
+static uint8_t fat_buf[MMCSD_BLOCK_SIZE] CCM_DATA;
+static uint32_t map_entries;
+static uint32_t map_per;            /* clusters per FAT sector */
+static uint8_t map_shift;
+static volatile bool map_ready;
+static clmap_stats_t stats;
+
+/*
+ * Called by volume.c with the volume lock held, before the scan.
+ */
+void clmap_reset(const FATFS *fs)
+{
+	map_ready = false;
+	map_per = (fs->fs_type == FS_FAT32) ? MMCSD_BLOCK_SIZE / 4 : MMCSD_BLOCK_SIZE / 2;
+	map_shift = 0;
+	while((fs->fsize >> map_shift) > CLMAP_ENTRIES)
+		map_shift++;
+	map_entries = (fs->fsize + (1U << map_shift) - 1) >> map_shift;
+	memset(summary, 0, sizeof(summary));
+}
+
+void clmap_add(uint32_t fsect, int32_t delta)
+{
+	uint32_t e = fsect >> map_shift;
+
+	if(e < map_entries)
+		summary[e] = (uint32_t)(summary[e] + delta);
+}
+
+void clmap_done(void)
+{
+	map_ready = true;
+}
+
+void clmap_invalidate(void)
+{
+	map_ready = false;
+}
+
+bool clmap_ready(void)
+{
+	return map_ready;
+}
+
+/*
+ * Bitmap of the FAT sectors [fsect, fsect + n), bit set for a free
+ * cluster. A FAT sector FatFs has not written back yet is taken from its
+ * window.
+ */
+static bool _build_bitmap(FATFS *fs, uint32_t fsect, uint32_t n)
+{
+	uint32_t s, i, first, base = fsect * map_per;
+	const uint8_t *p;
+
+	memset(bitmap, 0, (n * map_per + 31) / 32 * 4);
+	for(s = 0; s < n; s++)
+	{
+		if(fs->wflag && fs->winsect == fs->fatbase + fsect + s)
+		{
+			p = fs->win;
+		}
+		else
+		{
+			if(disk_read(fs->drv, fat_buf, fs->fatbase + fsect + s, 1) != RES_OK)
+				return false;
+			p = fat_buf;
+		}
+		stats.sectors_read++;
+		first = (fsect + s) * map_per;
+		for(i = 0; i < map_per && first + i < fs->n_fatent; i++)
+		{
+			bool free = (map_per == MMCSD_BLOCK_SIZE / 4) ?
+				(LD_DWORD(p + i * 4) & 0x0FFFFFFF) == 0 : LD_WORD(p + i * 2) == 0;
+			if(free && first + i >= 2)
+				bitmap[(first + i - base) / 32] |= 1U << ((first + i - base) % 32);
+		}
+	}
+	return true;
+}
+
+/*
+ * First run of at least need set bits, else the longest one. Whole words
+ * are skipped, inside a word the run edges come from CTZ.
+ */
+static uint32_t _find_run(uint32_t nbits, uint32_t need, uint32_t *start)
+{
+	uint32_t i, w, x, pos, n, run = 0, run_start = 0, best = 0;
+
+	*start = 0;
+	for(i = 0; i < (nbits + 31) / 32; i++)
+	{
+		w = bitmap[i];
+		if(w == 0xFFFFFFFFU)
+		{
+			if(run == 0)
+				run_start = i * 32;
+			run += 32;
+			continue;
+		}
+		for(pos = 0; pos < 32; pos += n)
+		{
+			x = w >> pos;
+			if(x & 1)
+			{
+				n = (~x == 0) ? 32 - pos : (uint32_t)__builtin_ctz(~x);
+				if(n > 32 - pos)
+					n = 32 - pos;
+				if(run == 0)
+					run_start = i * 32 + pos;
+				run += n;
+				continue;
+			}
+			n = (x == 0) ? 32 - pos : (uint32_t)__builtin_ctz(x);
+			if(run > best)
+			{
+				best = run;
+				*start = run_start;
+				if(best >= need)
+					return best;
+			}
+			run = 0;
+		}
+	}
+	if(run > best)
+	{
+		best = run;
+		*start = run_start;
+	}
+	return best;
+}
+
+/*
+ * Start cluster of a free run of need clusters, or of the longest run in
+ * the emptiest part of the volume, 0 when nothing was found. The volume
+ * lock must be held.
+ */
+uint32_t clmap_find(FATFS *fs, uint32_t need, uint32_t *run)
+{
+	uint32_t e, full, best_e, len, start, fsect, n, got, group_max;
+
+	*run = 0;
+	if(!map_ready)
+		return 0;
+	stats.searches++;
+	group_max = map_per << map_shift;
+
+	/* consecutive completely free groups make the run without any reads */
+	for(e = 0, full = 0; e < map_entries; e++)
+	{
+		full = (summary[e] == group_max) ? full + 1 : 0;
+		if(full * group_max >= need)
+		{
+			start = (e + 1 - full) * group_max;
+			*run = full * group_max;
+			if(start < 2)
+				start = 2;
+			stats.hits++;
+			stats.last_start = start;
+			stats.last_run = *run;
+			return start;
+		}
+	}
+
+	/* otherwise look inside the group with the most free clusters */
+	for(e = 0, best_e = 0; e < map_entries; e++)
+		if(summary[e] > summary[best_e])
+			best_e = e;
+	if(summary[best_e] == 0)
+		return 0;
+
+	start = 0;
+	for(fsect = best_e << map_shift; fsect < ((best_e + 1) << map_shift) &&
+		fsect < fs->fsize; fsect += n)
+	{
+		n = CLMAP_WINDOW;
+		if(n > fs->fsize - fsect)
+			n = fs->fsize - fsect;
+		if(!_build_bitmap(fs, fsect, n))
+			return 0;
+		len = _find_run(n * map_per, need, &got);
+		if(len > *run)
+		{
+			*run = len;
+			start = fsect * map_per + got;
+		}
+		if(*run >= need)
+		{
+			stats.hits++;
+			break;
+		}
+	}
+	stats.last_start = start;
+	stats.last_run = *run;
+	return start;
+}
+
+/*
+ * Before a long write to an empty file: points FatFs at a free run big
+ * enough for bytes so the file comes out contiguous. FR_OK also when no
+ * hint could be given, FatFs then allocates as usual.
+ */
+FRESULT clmap_prepare(FIL *fp, uint32_t bytes)
+{
+	FATFS *fs = fp->fs;
+	uint32_t need, start, run;
+
+	if(fp->sclust != 0 || !map_ready || fs->fs_type == FS_FAT12)
+		return FR_OK;
+	need = (bytes + fs->csize * MMCSD_BLOCK_SIZE - 1) / (fs->csize * MMCSD_BLOCK_SIZE);
+	if(need < 2)
+		return FR_OK;
+
+	ff_req_grant(fs->sobj);
+	start = clmap_find(fs, need, &run);
+	if(start >= 2 && start < fs->n_fatent)
+		fs->last_clust = start - 1;
+	ff_rel_grant(fs->sobj);
+	return FR_OK;
+}
+
+void cmd_clmap(BaseSequentialStream *chp, int argc, char *argv[])
+{
+	uint32_t e, full = 0, empty = 0, group_max;
+
+	(void)argv;
+	if(argc > 0)
+	{
+		chprintf(chp, "Usage: clmap\r\n");
+		return;
+	}
+	if(!map_ready)
+	{
+		chprintf(chp, "clmap: not built yet\r\n");
+		return;
+	}
+	group_max = map_per << map_shift;
+	for(e = 0; e < map_entries; e++)
+	{
+		full += summary[e] == group_max;
+		empty += summary[e] == 0;
+	}
+	chprintf(chp, "%lu groups of %lu clusters, %lu free, %lu full\r\n",
+		map_entries, group_max, full, empty);
+	chprintf(chp, "searches %lu found %lu, FAT sectors read %lu\r\n",
+		stats.searches, stats.hits, stats.sectors_read);
+	chprintf(chp, "last run %lu clusters at %lu\r\n",
+		stats.last_run, stats.last_start);
+}
@@ -0,0 +1,34 @@
+/*
+ * clmap.h
+ *
+ *  Summary map of free clusters, used to find contiguous extents without
+ *  walking the FAT.
+ */
+
+#ifndef CLMAP_H_
+#define CLMAP_H_
+
+#include "ff.h"
+
+#define CLMAP_ENTRIES       2048    /* summary entries, 4 bytes each */
+#define CLMAP_WINDOW        16      /* FAT sectors turned into a bitmap at once */
+
+typedef struct
+{
+	uint32_t searches;
+	uint32_t hits;              /* a run of the requested length was found */
+	uint32_t sectors_read;      /* FAT sectors read to build bitmaps */
+	uint32_t last_start;
+	uint32_t last_run;
+} clmap_stats_t;
+
+void clmap_reset(const FATFS *fs);
+void clmap_add(uint32_t fsect, int32_t delta);
+void clmap_done(void);
+void clmap_invalidate(void);
+bool clmap_ready(void);
+uint32_t clmap_find(FATFS *fs, uint32_t need, uint32_t *run);
+FRESULT clmap_prepare(FIL *fp, uint32_t bytes);
+void cmd_clmap(BaseSequentialStream *chp, int argc, char *argv[]);
+
+#endif /* CLMAP_H_ */
@@ -0,0 +1,186 @@
+/*
+ * coalesce.c
+ *
+ *  Merges runs of short, nearly colinear moves into one planner block.
+ *  Slicers break curves and even straight lines into many tiny G1 moves,
+ *  each one costs a planner block and its acceleration limits.
+ *
+ *  A move joins the pending block when
+ *
+ *  - it has the feedrate of the block and a length,
+ *  - its direction is within cfg.angle of the move before it,
+ *  - its extrusion per unit of length is within cfg.erate percent of the
+ *    block so far, travels only join travels,
+ *  - every end point of the block stays within cfg.deviation of the new
+ *    chord from the start of the block.
+ *
+ *  The block then runs as one straight move from its start to the end of
+ *  the last move with the summed extrusion. No kernel calls.
+ */
+
+/*===========================================================================*/
+/* Move coalescing.                                                          */
+/*===========================================================================*/
+#include <string.h>
+#include <math.h>
+
+#include "coalesce.h"
+
+#define DEG2RAD(d)      ((d) * 3.14159265f / 180.0f)
+
+typedef struct
+{
+	float x;
+	float y;
+	float z;
+} vec_t;
+
+static vec_t _sub(const coalesce_pt_t *a, const coalesce_pt_t *b)
+{
+	vec_t v = {(float)(a->x - b->x), (float)(a->y - b->y), (float)(a->z - b->z)};
+
+	return v;
+}
+
+static float _dot(vec_t a, vec_t b)
+{
+	return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+/*
+ * Distance of p from the line through the origin along chord.
+ */
+static float _distance(vec_t chord, float len, vec_t p)
+{
+	vec_t c = {
+		chord.y * p.z - chord.z * p.y,
+		chord.z * p.x - chord.x * p.z,
+		chord.x * p.y - chord.y * p.x
+	};
+
+	return sqrtf(_dot(c, c)) / len;
+}
+
+/*
+ * Whether pt can join the pending block, the worst deviation with it in
+ * *dev.
+ */
+static bool _fits(coalesce_t *c, const coalesce_pt_t *pt, float len, float *dev)
+{
+	const coalesce_pt_t *last = &c->pts[c->n - 1];
+	const coalesce_pt_t *prev = c->n > 1 ? &c->pts[c->n - 2] : &c->start;
+	vec_t a, b, chord;
+	float rate, rate_new, chord_len, d;
+	uint32_t i;
+
+	if(c->n >= COALESCE_MAX_MOVES || pt->f != last->f)
+		return false;
+
+	a = _sub(last, prev);
+	b = _sub(pt, last);
+	if(_dot(a, b) < c->cos_min * sqrtf(_dot(a, a)) * len)
+		return false;
+
+	rate = c->de / c->path;
+	rate_new = (float)(pt->e - last->e) / len;
+	if(fabsf(rate_new - rate) > fabsf(rate) * c->cfg.erate / 100.0f)
+		return false;
+
+	chord = _sub(pt, &c->start);
+	chord_len = sqrtf(_dot(chord, chord));
+	*dev = c->deviation;
+	for(i = 0; i < c->n; i++)
+	{
+		d = _distance(chord, chord_len, _sub(&c->pts[i], &c->start));
+		if(d > (float)c->cfg.deviation)
+			return false;
+		if(d > *dev)
+			*dev = d;
+	}
+	return true;
+}
+
+void coalesce_init(coalesce_t *c, coalesce_emit_t emit, void *ctx)
+{
+	static const coalesce_cfg_t defaults = {
+		true, COALESCE_ANGLE, COALESCE_ERATE, COALESCE_DEVIATION
+	};
+
+	memset(c, 0, sizeof(*c));
+	c->emit = emit;
+	c->ctx = ctx;
+	coalesce_config(c, &defaults);
+}
+
+/*
+ * Takes effect with the next block.
+ */
+void coalesce_config(coalesce_t *c, const coalesce_cfg_t *cfg)
+{
+	c->cfg = *cfg;
+	c->cos_min = cosf(DEG2RAD(cfg->angle));
+}
+
+/*
+ * Drops a pending block, the next move starts at origin.
+ */
+void coalesce_reset(coalesce_t *c, const coalesce_pt_t *origin)
+{
+	c->start = *origin;
+	c->n = 0;
+}
+
+void coalesce_push(coalesce_t *c, const coalesce_pt_t *pt)
+{
+	const coalesce_pt_t *from;
+	vec_t v;
+	float len, dev = 0.0f;
+
+	c->stats.moves++;
+	from = c->n ? &c->pts[c->n - 1] : &c->start;
+	v = _sub(pt, from);
+	len = sqrtf(_dot(v, v));
+
+	if(c->n && len > 0.0f && _fits(c, pt, len, &dev))
+	{
+		c->pts[c->n++] = *pt;
+		c->path += len;
+		c->de += (float)(pt->e - from->e);
+		c->deviation = dev;
+		c->stats.merged++;
+		return;
+	}
+
+	coalesce_flush(c);
+	if(!c->cfg.enabled || len == 0.0f)
+	{
+		/* e only moves go as they are */
+		c->emit(pt, 1, c->ctx);
+		c->stats.blocks++;
+		c->start = *pt;
+		return;
+	}
+	c->pts[0] = *pt;
+	c->n = 1;
+	c->path = len;
+	c->de = (float)(pt->e - c->start.e);
+	c->deviation = 0.0f;
+}
+
+/*
+ * Emits the pending block, at the end of a job or before anything that
+ * must not be reordered with the moves.
+ */
+void coalesce_flush(coalesce_t *c)
+{
+	if(c->n == 0)
+		return;
+	c->emit(&c->pts[c->n - 1], c->n, c->ctx);
+	c->stats.blocks++;
+	if(c->n > c->stats.max_moves)
+		c->stats.max_moves = c->n;
+	if(c->deviation > c->stats.max_deviation)
+		c->stats.max_deviation = c->deviation;
+	c->start = c->pts[c->n - 1];
+	c->n = 0;
+}
@@ -0,0 +1,73 @@
+/*
+ * coalesce.h
+ *
+ *  Merges runs of short, nearly colinear moves into one planner block.
+ *  Plain C, planner.c runs it on the job and it runs on a PC as well.
+ */
+
+#ifndef COALESCE_H_
+#define COALESCE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define COALESCE_MAX_MOVES  16      /* moves in one block */
+
+/* defaults */
+#define COALESCE_ANGLE      5.0f    /* degrees between consecutive moves */
+#define COALESCE_ERATE      5.0f    /* percent change of extrusion per mm */
+#define COALESCE_DEVIATION  10      /* gcode units off the original path */
+
+/*
+ * A move target, absolute and in gcode units like _param_t.
+ */
+typedef struct
+{
+	int32_t x;
+	int32_t y;
+	int32_t z;
+	int32_t e;
+	int32_t f;
+} coalesce_pt_t;
+
+typedef struct
+{
+	bool enabled;
+	float angle;                /* degrees */
+	float erate;                /* percent */
+	int32_t deviation;          /* gcode units */
+} coalesce_cfg_t;
+
+typedef struct
+{
+	uint32_t moves;             /* pushed */
+	uint32_t blocks;            /* emitted */
+	uint32_t merged;            /* moves folded into a previous one */
+	uint32_t max_moves;         /* most moves in one block */
+	float max_deviation;        /* gcode units */
+} coalesce_stats_t;
+
+typedef void (*coalesce_emit_t)(const coalesce_pt_t *pt, uint32_t moves, void *ctx);
+
+typedef struct
+{
+	coalesce_cfg_t cfg;
+	float cos_min;
+	coalesce_emit_t emit;
+	void *ctx;
+	coalesce_pt_t start;        /* where the pending block starts */
+	coalesce_pt_t pts[COALESCE_MAX_MOVES];  /* its moves so far */
+	uint32_t n;
+	float path;                 /* length along the moves */
+	float de;
+	float deviation;            /* of the pending block */
+	coalesce_stats_t stats;
+} coalesce_t;
+
+void coalesce_init(coalesce_t *c, coalesce_emit_t emit, void *ctx);
+void coalesce_config(coalesce_t *c, const coalesce_cfg_t *cfg);
+void coalesce_reset(coalesce_t *c, const coalesce_pt_t *origin);
+void coalesce_push(coalesce_t *c, const coalesce_pt_t *pt);
+void coalesce_flush(coalesce_t *c);
+
+#endif /* COALESCE_H_ */
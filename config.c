@@ -0,0 +1,499 @@
+/*
+ * config.c
+ *
+ *  config.ini is read after each mount. It has an INI layout, one section
+ *  per axis and one each for the coalescer and the planner:
+ *
+ *      [x]
+ *      steps_per_mm = 80
+ *      max_velocity = 300      ; mm/s
+ *      max_accel = 3000        ; mm/s2
+ *      jerk = 100000           ; mm/s3
+ *      invert = 0
+ *      [coalesce]
+ *      enabled = 1
+ *      angle = 5               ; degrees
+ *      erate = 5               ; percent
+ *      deviation = 0.01        ; mm
+ *      [planner]
+ *      speed = 100             ; dry run, percent
+ *
+ *  Missing keys take their default. A file with an unknown key or a value
+ *  out of range is rejected as a whole and the settings stay as they were,
+ *  half applied settings are worse than the old ones.
+ *
+ *  Older firmware read the axis sections alone from machine.ini. Without a
+ *  config.ini that file is read in its place, next to one it is ignored
+ *  and the config command says so.
+ *
+ *  The parsed settings are written to config.bin together with a hash of
+ *  config.ini. As long as the hash matches the next mount reads the struct
+ *  back instead of parsing the text. Numbers go through the fixed point
+ *  reader of the G-code parser, no float and no heap.
+ */
+
+/*===========================================================================*/
+/* Configuration.                                                            */
+/*===========================================================================*/
+#include <stddef.h>
+#include <string.h>
+
+#include "ch.h"
+#include "hal.h"
+
+#include "chprintf.h"
+
+#include "config.h"
+#include "coalesce.h"
+#include "planner.h"
+#include "job.h"
+#include "filetab.h"
+#include "clmap.h"
+#include "pools.h"
+#include "memmap.h"
+
+#define FNV_OFFSET      0x811C9DC5UL
+#define FNV_PRIME       0x01000193UL
+
+typedef enum
+{
+	CFG_FX = 0,                 /* decimal, x GCODE_UOM */
+	CFG_INT,
+	CFG_BOOL                    /* one byte */
+} config_type_t;
+
+typedef struct
+{
+	const char *name;
+	uint16_t offset;            /* in the section */
+	uint8_t type;
+	int32_t min;
+	int32_t max;
+} config_key_t;
+
+typedef struct
+{
+	const char *name;
+	uint16_t base;              /* of the section in config_t */
+	const config_key_t *keys;
+} config_section_t;
+
+#define AXIS_KEY(n, f, t, lo, hi) {n, offsetof(machine_axis_cfg_t, f), t, lo, hi}
+#define KEY(n, f, t, lo, hi)      {n, offsetof(config_t, f), t, lo, hi}
+#define AXIS_BASE(i)    (offsetof(config_t, axes) + (i) * sizeof(machine_axis_cfg_t))
+
+static const config_key_t axis_keys[] =
+{
+	AXIS_KEY("steps_per_mm", steps_per_mm, CFG_FX,
+		MACHINE_SPM_MIN * GCODE_UOM, MACHINE_SPM_MAX * GCODE_UOM),
+	AXIS_KEY("max_velocity", vmax, CFG_FX,
+		(int32_t)(MACHINE_V_MIN * GCODE_UOM), MACHINE_V_MAX * GCODE_UOM),
+	AXIS_KEY("max_accel", amax, CFG_FX,
+		MACHINE_A_MIN * GCODE_UOM, MACHINE_A_MAX * GCODE_UOM),
+	AXIS_KEY("jerk", jerk, CFG_FX,
+		MACHINE_J_MIN * GCODE_UOM, MACHINE_J_MAX * GCODE_UOM),
+	AXIS_KEY("invert", invert, CFG_BOOL, 0, 1),
+	{NULL, 0, 0, 0, 0}
+};
+
+static const config_key_t coalesce_keys[] =
+{
+	KEY("enabled", coalesce, CFG_BOOL, 0, 1),
+	KEY("angle", coalesce_angle, CFG_FX, 0, 90 * GCODE_UOM),
+	KEY("erate", coalesce_erate, CFG_FX, 0, 100 * GCODE_UOM),
+	KEY("deviation", coalesce_dev, CFG_FX, 0, GCODE_UOM),
+	{NULL, 0, 0, 0, 0}
+};
+
+static const config_key_t planner_keys[] =
+{
+	KEY("speed", speed, CFG_INT, 0, 1000),
+	{NULL, 0, 0, 0, 0}
+};
+
+static const config_section_t sections[] =
+{
+	{"x", AXIS_BASE(AXIS_X), axis_keys},
+	{"y", AXIS_BASE(AXIS_Y), axis_keys},
+	{"z", AXIS_BASE(AXIS_Z), axis_keys},
+	{"e", AXIS_BASE(AXIS_E), axis_keys},
+	{"coalesce", 0, coalesce_keys},
+	{"planner", 0, planner_keys},
+	{NULL, 0, NULL}
+};
+
+static const config_t config_defaults =
+{
+	{
+		MACHINE_AXIS_CFG(MACHINE_X),
+		MACHINE_AXIS_CFG(MACHINE_Y),
+		MACHINE_AXIS_CFG(MACHINE_Z),
+		MACHINE_AXIS_CFG(MACHINE_E)
+	},
+	1,
+	(int32_t)(COALESCE_ANGLE * GCODE_UOM),
+	(int32_t)(COALESCE_ERATE * GCODE_UOM),
+	COALESCE_DEVIATION,
+	100
+};
+
+config_t config CCM_DATA;
+config_status_t config_status CCM_DATA;
+
+static MUTEX_DECL(cfg_mtx);    /* mount thread and shell */
+
+/*
+ * FNV-1a, start with hash 0 and feed it the data in any number of pieces.
+ */
+uint32_t config_hash(uint32_t hash, const void *data, size_t len)
+{
+	const uint8_t *p = data;
+
+	if(hash == 0)
+		hash = FNV_OFFSET;
+	while(len--)
+		hash = (hash ^ *p++) * FNV_PRIME;
+	return hash;
+}
+
+static int32_t _get(const config_t *c, uint16_t offset, uint8_t type)
+{
+	const uint8_t *p = (const uint8_t *)c + offset;
+	int32_t v;
+
+	if(type == CFG_BOOL)
+		return *p;
+	memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+static void _set(config_t *c, uint16_t offset, uint8_t type, int32_t v)
+{
+	uint8_t *p = (uint8_t *)c + offset;
+
+	if(type == CFG_BOOL)
+		*p = (uint8_t)v;
+	else
+		memcpy(p, &v, sizeof(v));
+}
+
+/*
+ * Every value in range, config.bin could come from another build.
+ */
+static bool _check(const config_t *c)
+{
+	const config_section_t *sp;
+	const config_key_t *kp;
+	int32_t v;
+
+	for(sp = sections; sp->name != NULL; sp++)
+		for(kp = sp->keys; kp->name != NULL; kp++)
+		{
+			v = _get(c, sp->base + kp->offset, kp->type);
+			if(v < kp->min || v > kp->max)
+				return false;
+		}
+	return true;
+}
+
+/*
+ * One line of config.ini into c, *spp tracks the section. Returns false
+ * for anything not understood or out of range.
+ */
+static bool _parse_line(char *line, config_t *c, const config_section_t **spp)
+{
+	const config_section_t *sp;
+	const config_key_t *kp;
+	char *p, *val, *end;
+	int32_t v;
+
+	for(p = line; *p != '\0'; p++)
+		if(*p == ';' || *p == '#' || *p == '\r' || *p == '\n')
+		{
+			*p = '\0';
+			break;
+		}
+	while(p > line && (p[-1] == ' ' || p[-1] == '\t'))
+		*--p = '\0';
+	for(p = line; *p == ' ' || *p == '\t'; p++)
+		;
+	if(*p == '\0')
+		return true;
+
+	if(*p == '[')
+	{
+		end = strchr(p, ']');
+		if(end == NULL || end[1] != '\0')
+			return false;
+		*end = '\0';
+		for(sp = sections; sp->name != NULL; sp++)
+			if(!strcmp(p + 1, sp->name))
+			{
+				*spp = sp;
+				return true;
+			}
+		return false;
+	}
+	if(*spp == NULL)
+		return false;
+
+	val = strchr(p, '=');
+	if(val == NULL)
+		return false;
+	for(end = val; end > p && (end[-1] == ' ' || end[-1] == '\t'); end--)
+		;
+	*end = '\0';
+	for(kp = (*spp)->keys; kp->name != NULL; kp++)
+		if(!strcmp(p, kp->name))
+			break;
+	if(kp->name == NULL)
+		return false;
+
+	for(val++; *val == ' ' || *val == '\t'; val++)
+		;
+	v = gcode_strtofx(val, &end, kp->type == CFG_FX ? GCODE_UOM : 1);
+	if(end == val || *end != '\0' || v < kp->min || v > kp->max)
+		return false;
+	_set(c, (*spp)->base + kp->offset, kp->type, v);
+	return true;
+}
+
+/*
+ * Reads config.bin into c, true if it was made from the config.ini with
+ * ini_hash and is intact.
+ */
+static bool _read_bin(config_t *c, uint32_t ini_hash)
+{
+	config_hdr_t hdr;
+	FIL *fp;
+	UINT br;
+	bool ok;
+
+	fp = filetab_open(CONFIG_BIN, FA_READ, NULL);
+	if(fp == NULL)
+		return false;
+	ok = f_read(fp, &hdr, sizeof(hdr), &br) == FR_OK && br == sizeof(hdr) &&
+		hdr.magic == CONFIG_MAGIC && hdr.version == CONFIG_VERSION &&
+		hdr.size == sizeof(config_t) && hdr.ini_hash == ini_hash &&
+		f_read(fp, c, sizeof(*c), &br) == FR_OK && br == sizeof(*c) &&
+		config_hash(0, c, sizeof(*c)) == hdr.hash;
+	filetab_close(fp);
+	return ok && _check(c);
+}
+
+static FRESULT _write_bin(const config_t *c, uint32_t ini_hash)
+{
+	config_hdr_t hdr;
+	FRESULT fr, cfr;
+	FIL *fp;
+	UINT bw;
+
+	hdr.magic = CONFIG_MAGIC;
+	hdr.version = CONFIG_VERSION;
+	hdr.size = sizeof(config_t);
+	hdr.ini_hash = ini_hash;
+	hdr.hash = config_hash(0, c, sizeof(*c));
+
+	fp = filetab_open(CONFIG_BIN, FA_WRITE | FA_CREATE_ALWAYS, &fr);
+	if(fp == NULL)
+		return fr;
+	clmap_prepare(fp, sizeof(hdr) + sizeof(*c));
+	fr = f_write(fp, &hdr, sizeof(hdr), &bw);
+	if(fr == FR_OK && bw == sizeof(hdr))
+		fr = f_write(fp, c, sizeof(*c), &bw);
+	if(fr == FR_OK && bw != sizeof(*c))
+		fr = FR_DENIED;
+	cfr = filetab_close(fp);
+	return fr != FR_OK ? fr : cfr;
+}
+
+/*
+ * Hands the settings to the modules that use them.
+ */
+static void _apply(const config_t *c)
+{
+	machine_axis_cfg_t axes[MACHINE_AXES];
+	coalesce_cfg_t co;
+
+	memcpy(axes, c->axes, sizeof(axes));
+	machine_set(axes);
+	co.enabled = c->coalesce != 0;
+	co.angle = (float)c->coalesce_angle / GCODE_UOM;
+	co.erate = (float)c->coalesce_erate / GCODE_UOM;
+	co.deviation = c->coalesce_dev;
+	planner_set_coalesce(&co);
+	planner_set_speed((uint32_t)c->speed);
+	config = *c;
+}
+
+void config_init(void)
+{
+	memset(&config_status, 0, sizeof(config_status));
+	config_status.file = CONFIG_INI;
+	config_status.fr = FR_NO_FILE;
+	config_status.bin_fr = FR_OK;
+	memcpy(&config, &config_defaults, sizeof(config));
+}
+
+/*
+ * Reads config.ini, or config.bin when that was made from the same
+ * config.ini, and applies it. Without a config.ini machine.ini is read
+ * instead, without either the defaults apply.
+ * FR_INVALID_PARAMETER is a config.ini that does not parse, the settings
+ * are left alone then.
+ */
+FRESULT config_load(void)
+{
+	const config_section_t *sp = NULL;
+	config_t c;
+	char line[CONFIG_LINE_MAX];
+	uint32_t start, hash = 0, n = 0, bad = 0;
+	FRESULT fr = FR_OK;
+	FILINFO fno;
+	uint8_t *buf;
+	FIL *fp;
+	UINT br;
+
+	chMtxLock(&cfg_mtx);
+	start = chSysGetRealtimeCounterX();
+	config_status.loads++;
+	config_status.file = CONFIG_INI;
+	fno.lfname = NULL;
+	fno.lfsize = 0;
+	fp = filetab_open(CONFIG_INI, FA_READ, &fr);
+	config_status.shadowed = fp != NULL && f_stat(CONFIG_MACHINE_INI, &fno) == FR_OK;
+	if(fp == NULL && fr == FR_NO_FILE)
+	{
+		fp = filetab_open(CONFIG_MACHINE_INI, FA_READ, &fr);
+		if(fp != NULL)
+			config_status.file = CONFIG_MACHINE_INI;
+	}
+	if(fp == NULL)
+	{
+		if(fr == FR_NO_FILE)
+		{
+			_apply(&config_defaults);
+			config_status.source = CONFIG_DEFAULTS;
+		}
+		goto out;
+	}
+
+	buf = (uint8_t *)sector_alloc();
+	if(buf == NULL)
+	{
+		filetab_close(fp);
+		fr = FR_NOT_ENOUGH_CORE;
+		goto out;
+	}
+	do
+	{
+		fr = f_read(fp, buf, POOL_SECTOR_SIZE, &br);
+		hash = config_hash(hash, buf, br);
+	} while(fr == FR_OK && br == POOL_SECTOR_SIZE);
+	sector_free((char *)buf);
+	if(fr != FR_OK)
+	{
+		filetab_close(fp);
+		goto out;
+	}
+
+	if(_read_bin(&c, hash))
+	{
+		filetab_close(fp);
+		config_status.source = CONFIG_CACHED;
+		_apply(&c);
+		goto out;
+	}
+
+	/* changed or never parsed */
+	config_status.parses++;
+	memcpy(&c, &config_defaults, sizeof(c));
+	fr = f_lseek(fp, 0);
+	while(fr == FR_OK && f_gets(line, sizeof(line), fp) != NULL)
+	{
+		n++;
+		if(!_parse_line(line, &c, &sp) && bad == 0)
+			bad = n;
+	}
+	if(fr == FR_OK && f_error(fp))
+		fr = FR_DISK_ERR;
+	filetab_close(fp);
+	if(fr == FR_OK && bad != 0)
+		fr = FR_INVALID_PARAMETER;
+	if(fr != FR_OK)
+		goto out;
+
+	config_status.source = CONFIG_PARSED;
+	_apply(&c);
+	config_status.bin_fr = _write_bin(&c, hash);
+out:
+	config_status.fr = fr;
+	config_status.line = bad;
+	config_status.ini_hash = hash;
+	config_status.load_us = (chSysGetRealtimeCounterX() - start) /
+		(STM32_SYSCLK / 1000000);
+	chMtxUnlock(&cfg_mtx);
+	return fr;
+}
+
+/*===========================================================================*/
+/* Shell command.                                                            */
+/*===========================================================================*/
+
+void cmd_config(BaseSequentialStream *chp, int argc, char *argv[])
+{
+	static const char * const sources[] = {"defaults", "parsed", "cached"};
+	static const char axis_names[MACHINE_AXES] = {'X', 'Y', 'Z', 'E'};
+	const config_status_t *st = &config_status;
+	const machine_axis_t *ap;
+	int i;
+
+	if(argc == 1 && !strcmp(argv[0], "reload"))
+	{
+		/* the axis limits would change under the queued blocks */
+		if(job_state() != JOB_IDLE)
+		{
+			chprintf(chp, "config: a job is running, see job\r\n");
+			return;
+		}
+		config_load();
+	}
+	else if(argc > 0)
+	{
+		chprintf(chp, "Usage: config [reload]\r\n");
+		return;
+	}
+
+	chprintf(chp, "%s: %s", st->file, sources[st->source]);
+	if(st->fr == FR_INVALID_PARAMETER)
+		chprintf(chp, ", rejected at line %lu", st->line);
+	else if(st->fr != FR_OK && st->fr != FR_NO_FILE)
+		chprintf(chp, ", error %d", st->fr);
+	chprintf(chp, ", hash %08lx, %lu us\r\n", st->ini_hash, st->load_us);
+	chprintf(chp, "%lu loads, %lu parsed", st->loads, st->parses);
+	if(st->bin_fr != FR_OK)
+		chprintf(chp, ", %s not written, error %d", CONFIG_BIN, st->bin_fr);
+	chprintf(chp, "\r\n");
+	if(st->shadowed)
+		chprintf(chp, "%s ignored, move its axis sections to %s\r\n",
+			CONFIG_MACHINE_INI, CONFIG_INI);
+
+#ifdef MACHINE_FIXED
+	chprintf(chp, "axes built in\r\n");
+#endif
+	chprintf(chp, "axis   steps/mm   mm/s   mm/s2    mm/s3  inv\r\n");
+	for(i = 0; i < MACHINE_AXES; i++)
+	{
+		ap = &machine_axes[i];
+		chprintf(chp, "   %c %10.3f %6.1f %7ld %8ld  %s\r\n", axis_names[i],
+			(double)ap->cfg.steps_per_mm / GCODE_UOM,
+			(double)ap->cfg.vmax / GCODE_UOM, ap->cfg.amax / GCODE_UOM,
+			ap->cfg.jerk / GCODE_UOM, ap->cfg.invert ? "yes" : "no");
+	}
+	chprintf(chp, "coalesce %s, angle %.1f deg, erate %.1f%%, deviation %ld um\r\n",
+		config.coalesce ? "on" : "off",
+		(double)config.coalesce_angle / GCODE_UOM,
+		(double)config.coalesce_erate / GCODE_UOM,
+		config.coalesce_dev * 1000 / GCODE_UOM);
+	chprintf(chp, "planner dry run at %ld%%\r\n", config.speed);
+}
@@ -0,0 +1,76 @@
+/*
+ * config.h
+ *
+ *  Machine settings from config.ini on the card, cached in binary form in
+ *  config.bin.
+ */
+
+#ifndef CONFIG_H_
+#define CONFIG_H_
+
+#include "ff.h"
+#include "machine.h"
+
+#define CONFIG_INI          "config.ini"
+#define CONFIG_BIN          "config.bin"
+#define CONFIG_MACHINE_INI  "machine.ini"   /* axis table of older firmware */
+#define CONFIG_LINE_MAX     64
+#define CONFIG_MAGIC        0x31474643UL    /* "CFG1" */
+#define CONFIG_VERSION      1               /* bump with any change to config_t */
+
+/*
+ * Everything config.ini can set, in gcode units like the rest of the
+ * firmware. Packed, config.bin holds the struct as it is in memory.
+ */
+typedef struct __attribute__((packed))
+{
+	machine_axis_cfg_t axes[MACHINE_AXES];
+	uint8_t coalesce;           /* on/off */
+	int32_t coalesce_angle;     /* degrees x GCODE_UOM */
+	int32_t coalesce_erate;     /* percent x GCODE_UOM */
+	int32_t coalesce_dev;       /* gcode units */
+	int32_t speed;              /* dry run, percent */
+} config_t;
+
+/*
+ * config.bin is this header followed by config_t.
+ */
+typedef struct
+{
+	uint32_t magic;
+	uint16_t version;
+	uint16_t size;              /* sizeof(config_t) */
+	uint32_t ini_hash;          /* of the config.ini it was parsed from */
+	uint32_t hash;              /* of the config_t that follows */
+} config_hdr_t;
+
+typedef enum
+{
+	CONFIG_DEFAULTS = 0,        /* no config.ini */
+	CONFIG_PARSED,              /* config.ini parsed, config.bin rewritten */
+	CONFIG_CACHED               /* config.bin matched config.ini */
+} config_source_t;
+
+typedef struct
+{
+	config_source_t source;
+	const char *file;           /* config.ini or machine.ini in its place */
+	bool shadowed;              /* machine.ini ignored next to config.ini */
+	FRESULT fr;                 /* last load */
+	FRESULT bin_fr;             /* last config.bin write */
+	uint32_t line;              /* first rejected line, 0 if none */
+	uint32_t ini_hash;
+	uint32_t load_us;
+	uint32_t loads;
+	uint32_t parses;
+} config_status_t;
+
+extern config_t config;
+extern config_status_t config_status;
+
+void config_init(void);
+FRESULT config_load(void);
+uint32_t config_hash(uint32_t hash, const void *data, size_t len);
+void cmd_config(BaseSequentialStream *chp, int argc, char *argv[]);
+
+#endif /* CONFIG_H_ */
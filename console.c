@@ -0,0 +1,274 @@
+/*
+ * console.c
+ *
+ *  Buffered console output. Messages are formatted into a ring buffer and
+ *  written out by a low priority thread, when the buffer is full new
+ *  messages are dropped so the caller never waits on the console.
+ */
+
+/*===========================================================================*/
+/* Console output.                                                           */
+/*===========================================================================*/
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "ch.h"
+#include "hal.h"
+
+#include "chprintf.h"
+#include "memstreams.h"
+#include "shell.h"
+
+#include "console.h"
+#include "memmap.h"
+
+static BaseSequentialStream *con_chp;
+
+/*
+ * The console thread and the shell share the stream, each write to it is
+ * made under con_mtx. con_midline is set while the last byte out was not
+ * the end of a line, console output then starts on a line of its own.
+ */
+static MUTEX_DECL(con_mtx);
+static bool con_midline;
+
+/*
+ * Ring buffer, head is only moved by writers under lock, tail only by the
+ * output thread once the bytes have gone out.
+ */
+static uint8_t con_buf[CON_BUFFER_SIZE] CCM_DATA;
+static volatile uint32_t con_head;
+static volatile uint32_t con_tail;
+static volatile uint32_t con_dropped;
+static uint32_t con_written;
+
+static con_level_t con_level = CON_LVL_INFO;
+static void (*con_report)(BaseSequentialStream *chp);
+static uint32_t con_period_ms;
+
+static BSEMAPHORE_DECL(con_sem, true);
+
+static void _console_put(const uint8_t *msg, uint32_t n)
+{
+	uint32_t head, first;
+
+	chSysLock();
+	head = con_head;
+	if(CON_BUFFER_SIZE - (head - con_tail) < n)
+	{
+		con_dropped++;
+		chSysUnlock();
+		return;
+	}
+	first = CON_BUFFER_SIZE - (head % CON_BUFFER_SIZE);
+	if(first > n)
+		first = n;
+	memcpy(&con_buf[head % CON_BUFFER_SIZE], msg, first);
+	memcpy(con_buf, msg + first, n - first);
+	con_head = head + n;
+	chBSemSignalI(&con_sem);
+	chSchRescheduleS();
+	chSysUnlock();
+}
+
+/*
+ * Writes to the stream, con_mtx held.
+ */
+static void _console_write(const uint8_t *bp, size_t n)
+{
+	if(n == 0)
+		return;
+	chSequentialStreamWrite(con_chp, bp, n);
+	con_midline = bp[n - 1] != '\n';
+}
+
+/*
+ * Writes everything buffered so far, in contiguous chunks of up to
+ * CON_PACKET_SIZE bytes, con_mtx held.
+ */
+static void _console_drain(void)
+{
+	uint32_t tail, n;
+
+	while((tail = con_tail) != con_head)
+	{
+		n = con_head - tail;
+		if(n > CON_BUFFER_SIZE - (tail % CON_BUFFER_SIZE))
+			n = CON_BUFFER_SIZE - (tail % CON_BUFFER_SIZE);
+		if(n > CON_PACKET_SIZE)
+			n = CON_PACKET_SIZE;
+
+		_console_write(&con_buf[tail % CON_BUFFER_SIZE], n);
+		con_tail = tail + n;
+		con_written += n;
+	}
+}
+
+static CCM_DATA THD_WORKING_AREA(waConsole, 512);
+static THD_FUNCTION(console_thread, arg) {
+	systime_t last = chVTGetSystemTime();
+	uint32_t dropped, reported = 0;
+	msg_t msg;
+	(void)arg;
+
+	chRegSetThreadName("console");
+	while(true)
+	{
+		msg = chBSemWaitTimeout(&con_sem, con_period_ms ? MS2ST(con_period_ms) : TIME_INFINITE);
+
+		/* let a few messages pile up so they go out as one packet */
+		if(msg == MSG_OK)
+			chThdSleepMilliseconds(CON_FLUSH_MS);
+
+		chMtxLock(&con_mtx);
+		if(con_midline && con_tail != con_head)
+			_console_write((const uint8_t *)"\r\n", 2);
+		_console_drain();
+
+		/* straight to the stream, both are wanted at any level */
+		dropped = con_dropped;
+		if(dropped != reported)
+		{
+			if(con_midline)
+				_console_write((const uint8_t *)"\r\n", 2);
+			chprintf(con_chp, "[console: %lu messages dropped]\r\n", dropped - reported);
+			con_midline = false;
+			reported = dropped;
+		}
+		if(con_report && con_period_ms &&
+			!chVTIsSystemTimeWithinX(last, last + MS2ST(con_period_ms)))
+		{
+			last = chVTGetSystemTime();
+			if(con_midline)
+				_console_write((const uint8_t *)"\r\n", 2);
+			con_report(con_chp);
+			con_midline = false;
+		}
+		chMtxUnlock(&con_mtx);
+	}
+}
+
+/*
+ * The stream handed to the shell, writes go out under con_mtx and reads
+ * come straight from the underlying stream.
+ */
+static size_t _shell_write(void *ip, const uint8_t *bp, size_t n)
+{
+	(void)ip;
+	chMtxLock(&con_mtx);
+	_console_write(bp, n);
+	chMtxUnlock(&con_mtx);
+	return n;
+}
+
+static size_t _shell_read(void *ip, uint8_t *bp, size_t n)
+{
+	(void)ip;
+	return chSequentialStreamRead(con_chp, bp, n);
+}
+
+static msg_t _shell_put(void *ip, uint8_t b)
+{
+	_shell_write(ip, &b, 1);
+	return MSG_OK;
+}
+
+static msg_t _shell_get(void *ip)
+{
+	(void)ip;
+	return chSequentialStreamGet(con_chp);
+}
+
+static const struct BaseSequentialStreamVMT con_shell_vmt = {
+	_shell_write, _shell_read, _shell_put, _shell_get
+};
+
+BaseSequentialStream console_shell = {&con_shell_vmt};
+
+void console_init(BaseSequentialStream *chp)
+{
+	con_chp = chp;
+	chThdCreateStatic(waConsole, sizeof(waConsole), LOWPRIO, console_thread, NULL);
+}
+
+/*
+ * Formats a message and queues it, never blocks. Messages above the
+ * current level are discarded before formatting.
+ */
+void console_printf(con_level_t level, const char *fmt, ...)
+{
+	MemoryStream ms;
+	uint8_t msg[CON_LINE_MAX];
+	va_list ap;
+
+	if(level > con_level || !con_chp)
+		return;
+
+	msObjectInit(&ms, msg, sizeof(msg), 0);
+	va_start(ap, fmt);
+	chvprintf((BaseSequentialStream *)&ms, fmt, ap);
+	va_end(ap);
+
+	_console_put(msg, ms.eos);
+}
+
+void console_set_level(con_level_t level)
+{
+	con_level = level > CON_LEVEL_MAX ? CON_LEVEL_MAX : level;
+}
+
+/*
+ * Summary reporter, called from the console thread every summary period
+ * and expected to print aggregate counters to chp with chprintf(), they do
+ * not go through the level filter. NULL removes it.
+ */
+void console_summary(void (*report)(BaseSequentialStream *chp))
+{
+	con_report = report;
+}
+
+/*
+ * Summary mode is on when the period is not zero, producers check it to
+ * skip their per event output.
+ */
+void console_set_period(uint32_t period_ms)
+{
+	chSysLock();
+	con_period_ms = period_ms;
+	chBSemSignalI(&con_sem);
+	chSchRescheduleS();
+	chSysUnlock();
+}
+
+bool console_summary_mode(void)
+{
+	return con_period_ms != 0;
+}
+
+void cmd_log(BaseSequentialStream *chp, int argc, char *argv[]) {
+	static const char *levels[] = {"error", "warn", "info", "debug"};
+	unsigned i = 0;
+
+	if(argc >= 1)
+	{
+		for(i = 0; i < sizeof(levels) / sizeof(levels[0]); i++)
+			if(!strcmp(argv[0], levels[i]))
+				break;
+	}
+	if(argc > 2 || i == sizeof(levels) / sizeof(levels[0]))
+	{
+		chprintf(chp, "Usage: log [error|warn|info|debug] [summary ms]\r\n");
+		chprintf(chp, "       summary ms of 0 prints every event\r\n");
+		return;
+	}
+	if(argc >= 1)
+		console_set_level((con_level_t)i);
+	if(argc == 2)
+		console_set_period(atoi(argv[1]));
+
+	chprintf(chp, "level   : %s (max %s)\r\n", levels[con_level], levels[CON_LEVEL_MAX]);
+	chprintf(chp, "summary : %lu ms\r\n", con_period_ms);
+	chprintf(chp, "written : %lu bytes\r\n", con_written);
+	chprintf(chp, "dropped : %lu messages\r\n", (uint32_t)con_dropped);
+}
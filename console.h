@@ -0,0 +1,60 @@
+/*
+ * console.h
+ *
+ *  Buffered console output. Messages are formatted into a ring buffer and
+ *  written out by a low priority thread, when the buffer is full new
+ *  messages are dropped so the caller never waits on the console.
+ */
+
+#ifndef CONSOLE_H_
+#define CONSOLE_H_
+
+#define CON_LVL_ERROR       0
+#define CON_LVL_WARN        1
+#define CON_LVL_INFO        2
+#define CON_LVL_DEBUG       3
+
+typedef uint8_t con_level_t;
+
+/*
+ * Messages above this level are compiled out.
+ */
+#if !defined(CON_LEVEL_MAX)
+#define CON_LEVEL_MAX       CON_LVL_DEBUG
+#endif
+
+#define CON_BUFFER_SIZE     2048    /* ring buffer, power of two */
+#define CON_LINE_MAX        96      /* longest single message */
+#define CON_PACKET_SIZE     256     /* largest write to the stream */
+#define CON_FLUSH_MS        10      /* time allowed for a packet to fill */
+
+#define CON_ERR(...)        console_printf(CON_LVL_ERROR, __VA_ARGS__)
+#define CON_WARN(...)       console_printf(CON_LVL_WARN, __VA_ARGS__)
+
+#if CON_LEVEL_MAX >= CON_LVL_INFO
+#define CON_INFO(...)       console_printf(CON_LVL_INFO, __VA_ARGS__)
+#else
+#define CON_INFO(...)       do { } while(0)
+#endif
+
+#if CON_LEVEL_MAX >= CON_LVL_DEBUG
+#define CON_DBG(...)        console_printf(CON_LVL_DEBUG, __VA_ARGS__)
+#else
+#define CON_DBG(...)        do { } while(0)
+#endif
+
+/*
+ * Stream for the shell, shares the console stream without breaking into
+ * its messages.
+ */
+extern BaseSequentialStream console_shell;
+
+void console_init(BaseSequentialStream *chp);
+void console_printf(con_level_t level, const char *fmt, ...);
+void console_set_level(con_level_t level);
+void console_summary(void (*report)(BaseSequentialStream *chp));
+void console_set_period(uint32_t period_ms);
+bool console_summary_mode(void);
+void cmd_log(BaseSequentialStream *chp, int argc, char *argv[]);
+
+#endif /* CONSOLE_H_ */
@@ -0,0 +1,116 @@
+/*
+ * diskio.c
+ *
+ *  FatFs disk interface on SDCD1 through the sector cache, replaces the
+ *  fatfs_diskio.c binding.
+ */
+
+/*===========================================================================*/
+/* FatFs disk interface.                                                     */
+/*===========================================================================*/
+#include "ch.h"
+#include "hal.h"
+
+#include "ff.h"
+#include "diskio.h"
+#include "ffsync.h"
+#include "sdcache.h"
+#include "volume.h"
+
+#define SDC_DRIVE   0
+
+DSTATUS disk_initialize(BYTE pdrv) {
+  DSTATUS stat;
+
+  if (pdrv != SDC_DRIVE)
+    return STA_NOINIT;
+  stat = 0;
+  if (blkGetDriverState(&SDCD1) != BLK_READY)
+    stat |= STA_NOINIT;
+  if (sdcIsWriteProtected(&SDCD1))
+    stat |= STA_PROTECT;
+  /* the cache was dropped by volume_mount() when the card was connected */
+  return stat;
+}
+
+DSTATUS disk_status(BYTE pdrv) {
+  DSTATUS stat;
+
+  if (pdrv != SDC_DRIVE)
+    return STA_NOINIT;
+  stat = 0;
+  if (blkGetDriverState(&SDCD1) != BLK_READY)
+    stat |= STA_NOINIT;
+  if (sdcIsWriteProtected(&SDCD1))
+    stat |= STA_PROTECT;
+  return stat;
+}
+
+DRESULT disk_read(BYTE pdrv, BYTE *buff, DWORD sector, UINT count) {
+
+  if (pdrv != SDC_DRIVE)
+    return RES_PARERR;
+  if (blkGetDriverState(&SDCD1) != BLK_READY)
+    return RES_NOTRDY;
+  if (sdcache_read(buff, sector, count))
+    return RES_ERROR;
+  return RES_OK;
+}
+
+#if _USE_WRITE
+DRESULT disk_write(BYTE pdrv, const BYTE *buff, DWORD sector, UINT count) {
+  UINT i;
+
+  if (pdrv != SDC_DRIVE)
+    return RES_PARERR;
+  if (blkGetDriverState(&SDCD1) != BLK_READY)
+    return RES_NOTRDY;
+  if (sdcIsWriteProtected(&SDCD1))
+    return RES_WRPRT;
+  for (i = 0; i < count; i++)
+    volume_fat_write(sector + i, buff + i * MMCSD_BLOCK_SIZE);
+  if (sdcache_write(buff, sector, count))
+    return RES_ERROR;
+  return RES_OK;
+}
+#endif /* _USE_WRITE */
+
+#if _USE_IOCTL
+DRESULT disk_ioctl(BYTE pdrv, BYTE cmd, void *buff) {
+  bool held, err;
+
+  if (pdrv != SDC_DRIVE)
+    return RES_PARERR;
+  switch (cmd) {
+  case CTRL_SYNC:
+    /* last thing f_sync() does, other threads may use the volume while
+       the cache writes back, f_mkfs() calls it without the volume */
+    held = ffsync_yield(pdrv);
+    err = sdcache_sync();
+    if (held)
+      ffsync_reclaim(pdrv);
+    if (err)
+      return RES_ERROR;
+    return RES_OK;
+  case GET_SECTOR_COUNT:
+    *((DWORD *)buff) = mmcsdGetCardCapacity(&SDCD1);
+    return RES_OK;
+  case GET_SECTOR_SIZE:
+    *((WORD *)buff) = MMCSD_BLOCK_SIZE;
+    return RES_OK;
+  case GET_BLOCK_SIZE:
+    *((DWORD *)buff) = 256; /* 512b blocks in one erase block */
+    return RES_OK;
+  default:
+    return RES_PARERR;
+  }
+}
+#endif /* _USE_IOCTL */
+
+/*
+ * No RTC on the board, a fixed valid timestamp, 2015-01-01 00:00.
+ */
+DWORD get_fattime(void) {
+
+  return ((DWORD)(2015 - 1980) << 25) | ((DWORD)1 << 21) | ((DWORD)1 << 16);
+}
@@ -21,27 +21,44 @@
 
 #include "usbcfg.h"
 #include "fat.h"
+#include "pools.h"
+#include "filetab.h"
+#include "volume.h"
+#include "job.h"
 
 #include "ff.h"
 
-/* Generic large buffer.*/
-static char fbuff[1024];
+/*
+ * The volume. Its window is a SDIO DMA target, but R0.10b keeps it inside
+ * FATFS so the whole object would have to go to .dmabuf, which is not
+ * cleared at startup. It stays in .bss, zeroed before the first mount and
+ * in SRAM as the linker script checks, volume_init() checks the window.
+ */
+FATFS SDC_FS;
 
 /*
  * Scan Files in a path and print them to the character stream.
  */
 FRESULT scan_files(BaseSequentialStream *chp, char *path) {
 	FRESULT res = FR_OK;
-	FILINFO fno;
+	FILINFO *fip;
 	DIR dir;
 	int fyear,fmonth,fday,fhour,fminute,fsecond;
 
 	int i;
 	char *fn;
 
+	/*
+	 * One entry per directory level, the pool bounds the recursion.
+	 */
+	fip = filinfo_alloc();
+	if (fip == NULL) {
+		chprintf(chp, "FS: %s/ too deep\r\n", path);
+		return FR_NOT_ENOUGH_CORE;
+	}
 #if _USE_LFN
-	fno.lfname = 0;
-	fno.lfsize = 0;
+	fip->lfname = 0;
+	fip->lfsize = 0;
 #endif
 	/*
 	 * Open the Directory.
@@ -56,32 +73,32 @@ FRESULT scan_files(BaseSequentialStream *chp, char *path) {
 			/*
 			 * Read the Directory.
 			 */
-			res = f_readdir(&dir, &fno);
+			res = f_readdir(&dir, fip);
 			/*
 			 * If the directory read failed or the
 			 */
-			if (res != FR_OK || fno.fname[0] == 0) {
+			if (res != FR_OK || fip->fname[0] == 0) {
 				break;
 			}
 			/*
 			 * If the directory or file begins with a '.' (hidden), continue
 			 */
-			if (fno.fname[0] == '.') {
+			if (fip->fname[0] == '.') {
 				continue;
 			}
-			fn = fno.fname;
+			fn = fip->fname;
 			/*
 			 * Extract the date.
 			 */
-			fyear = ((0b1111111000000000&fno.fdate) >> 9)+1980;
-			fmonth= (0b0000000111100000&fno.fdate) >> 5;
-			fday  = (0b0000000000011111&fno.fdate);
+			fyear = ((0b1111111000000000&fip->fdate) >> 9)+1980;
+			fmonth= (0b0000000111100000&fip->fdate) >> 5;
+			fday  = (0b0000000000011111&fip->fdate);
 			/*
 			 * Extract the time.
 			 */
-			fhour   = (0b1111100000000000&fno.ftime) >> 11;
-			fminute = (0b0000011111100000&fno.ftime) >> 5;
-			fsecond = (0b0000000000011111&fno.ftime)*2;
+			fhour   = (0b1111100000000000&fip->ftime) >> 11;
+			fminute = (0b0000011111100000&fip->ftime) >> 5;
+			fsecond = (0b0000000000011111&fip->ftime)*2;
 			/*
 			 * Print date and time of the file.
 			 */
@@ -89,7 +106,11 @@ FRESULT scan_files(BaseSequentialStream *chp, char *path) {
 			/*
 			 * If the 'file' is a directory.
 			 */
-			if (fno.fattrib & AM_DIR) {
+			if (fip->fattrib & AM_DIR) {
+				if (i + 1 + strlen(fn) >= POOL_SECTOR_SIZE) {
+					chprintf(chp, "<DIR> %s/%s/ path too long\r\n", path, fn);
+					continue;
+				}
 				/*
 				 * Add a slash to the end of the path
 				 */
@@ -117,26 +138,34 @@ FRESULT scan_files(BaseSequentialStream *chp, char *path) {
 	} else {
 		chprintf(chp, "FS: f_opendir() failed\r\n");
 	}
+	filinfo_free(fip);
 	return res;
 }
 
 void cmd_mount(BaseSequentialStream *chp, int argc, char *argv[]) {
 	FRESULT err;
-	DIR dir;
-	(void)argc;
-	(void)argv;
+
+	if (argc > 1 || (argc == 1 && strcmp(argv[0], "lazy") &&
+			strcmp(argv[0], "prefetch"))) {
+		chprintf(chp, "Usage: mount [lazy|prefetch]\r\n");
+		return;
+	}
 	/*
-	 * Attempt to mount the drive.
+	 * The mode takes effect on the next mount.
 	 */
-	err = f_mount(&SDC_FS, "", 0);
+	if (argc == 1)
+		volume_set_prefetch(!strcmp(argv[0], "prefetch"));
+	/*
+	 * The mount manager normally has the card mounted already, this turns
+	 * auto mount back on after unmount and reports the state.
+	 */
+	volume_set_auto(true);
+	err = volume_mount();
 	if (err != FR_OK) {
-		chprintf(chp, "FS: f_mount() failed. Is the SD card inserted?\r\n");
+		chprintf(chp, "FS: mount failed. Is the SD card inserted?\r\n");
 		verbose_error(chp, err);
-		return;
 	}
-	chprintf(chp, "FS: f_mount() succeeded\r\n");
-	palSetPad(GPIOD, GPIOD_LED6);
-	sdcConnect(&SDCD1);
+	volume_print(chp);
 }
 
 void cmd_mkfs(BaseSequentialStream *chp, int argc, char *argv[]) {
@@ -147,6 +176,10 @@ void cmd_mkfs(BaseSequentialStream *chp, int argc, char *argv[]) {
 		chprintf(chp, "       Formats partition [partition]\r\n");
 		return;
 	}
+	if (job_state() != JOB_IDLE) {
+		chprintf(chp, "FS: a job is running, see job\r\n");
+		return;
+	}
 	partition=atoi(argv[0]);
 	chprintf(chp, "FS: f_mkfs(%d,0,0) Started\r\n",partition);
 	err = f_mkfs(partition, 0, 0);
@@ -156,62 +189,77 @@ void cmd_mkfs(BaseSequentialStream *chp, int argc, char *argv[]) {
 		return;
 	}
 	chprintf(chp, "FS: f_mkfs() Finished\r\n");
+	volume_mounted();
 	return;
 }
 
 void cmd_unmount(BaseSequentialStream *chp, int argc, char *argv[]) {
-	FRESULT err;
 	(void)argc;
 	(void)argv;
 
-	palClearPad(GPIOD, GPIOD_LED6);
-	sdcDisconnect(&SDCD1);
-	err = f_mount(0, "", 0);
-	if (err != FR_OK) {
-		chprintf(chp, "FS: f_mount() unmount failed\r\n");
-		verbose_error(chp, err);
+	/*
+	 * Stays unmounted until the next mount command, so the card can be
+	 * pulled safely. Not under a running job, it would lose its file.
+	 */
+	if (job_state() != JOB_IDLE) {
+		chprintf(chp, "FS: a job is running, see job\r\n");
 		return;
 	}
+	if (volume_unmount() != FR_OK) {
+		chprintf(chp, "FS: files are open, not unmounted\r\n");
+		return;
+	}
+	chprintf(chp, "FS: unmounted, safe to remove the card\r\n");
 	return;
 }
 
 void cmd_free(BaseSequentialStream *chp, int argc, char *argv[]) {
-	FRESULT err;
 	uint32_t clusters;
-	FATFS *fsp;
+	uint64_t bytes;
 	(void)argc;
 	(void)argv;
 
-	err = f_getfree("/", &clusters, &fsp);
-	if (err != FR_OK) {
-		chprintf(chp, "FS: f_getfree() failed\r\n");
+	/*
+	 * The count is kept by volume.c, this never scans the FAT.
+	 */
+	if (!volume_free_clusters(&clusters)) {
+		if (volume_state() == VOL_COUNTING)
+			chprintf(chp, "FS: free space is still being counted\r\n");
+		else
+			chprintf(chp, "FS: not mounted\r\n");
 		return;
 	}
 	/*
 	 * Print the number of free clusters and size free in B, KiB and MiB.
 	 */
+	bytes = (uint64_t)clusters * SDC_FS.csize * MMCSD_BLOCK_SIZE;
 	chprintf(chp,"FS: %lu free clusters\r\n    %lu sectors per cluster\r\n",
 		clusters, (uint32_t)SDC_FS.csize);
-	chprintf(chp,"%lu B free\r\n",
-		clusters * (uint32_t)SDC_FS.csize * (uint32_t)MMCSD_BLOCK_SIZE);
-	chprintf(chp,"%lu KB free\r\n",
-		(clusters * (uint32_t)SDC_FS.csize * (uint32_t)MMCSD_BLOCK_SIZE)/(1024));
-	chprintf(chp,"%lu MB free\r\n",
-		(clusters * (uint32_t)SDC_FS.csize * (uint32_t)MMCSD_BLOCK_SIZE)/(1024*1024));
+	if (bytes < 0x100000000ULL)
+		chprintf(chp,"%lu B free\r\n", (uint32_t)bytes);
+	chprintf(chp,"%lu KB free\r\n", (uint32_t)(bytes / 1024));
+	chprintf(chp,"%lu MB free\r\n", (uint32_t)(bytes / (1024 * 1024)));
 }
 
 void cmd_tree(BaseSequentialStream *chp, int argc, char *argv[]) {
+	char *path;
 	(void)argv;
 	(void)argc;
 	/*
-	 * Set the file path buffer to 0
+	 * Path buffer from the sector pool, set to 0
 	 */
-	memset(fbuff,0,sizeof(fbuff));
-	scan_files(chp, fbuff);
+	path = sector_alloc();
+	if (path == NULL) {
+		chprintf(chp, "FS: no free buffer\r\n");
+		return;
+	}
+	memset(path,0,POOL_SECTOR_SIZE);
+	scan_files(chp, path);
+	sector_free(path);
 }
 
 void cmd_hello(BaseSequentialStream *chp, int argc, char *argv[]) {
-	FIL fsrc;   /* file object */
+	FIL *fsrc;   /* file object */
 	FRESULT err;
 	int written;
 	(void)argv;
@@ -223,13 +271,20 @@ void cmd_hello(BaseSequentialStream *chp, int argc, char *argv[]) {
 		chprintf(chp, "       Creates hello.txt with 'Hello World'\r\n");
 		return;
 	}
+	fsrc = filetab_fil_alloc();
+	if (fsrc == NULL) {
+		chprintf(chp, "FS: no free file object\r\n");
+		return;
+	}
 	/*
 	 * Open the text file
 	 */
-	err = f_open(&fsrc, "hello.txt", FA_READ | FA_WRITE | FA_CREATE_ALWAYS);
+	filetab_evict("hello.txt");
+	err = f_open(fsrc, "hello.txt", FA_READ | FA_WRITE | FA_CREATE_ALWAYS);
 	if (err != FR_OK) {
 		chprintf(chp, "FS: f_open(\"hello.txt\") failed.\r\n");
 		verbose_error(chp, err);
+		fil_free(fsrc);
 		return;
 	} else {
 		chprintf(chp, "FS: f_open(\"hello.txt\") succeeded\r\n");
@@ -237,7 +292,7 @@ void cmd_hello(BaseSequentialStream *chp, int argc, char *argv[]) {
 	/*
 	 * Write text to the file.
 	 */
-	written = f_puts ("Hello World", &fsrc);
+	written = f_puts ("Hello World", fsrc);
 	if (written == -1) {
 		chprintf(chp, "FS: f_puts(\"Hello World\",\"hello.txt\") failed\r\n");
 	} else {
@@ -246,7 +301,8 @@ void cmd_hello(BaseSequentialStream *chp, int argc, char *argv[]) {
 	/*
 	 * Close the file
 	 */
-	f_close(&fsrc);
+	f_close(fsrc);
+	fil_free(fsrc);
 }
 
 void cmd_mkdir(BaseSequentialStream *chp, int argc, char *argv[]) {
@@ -327,9 +383,9 @@ void cmd_getlabel(BaseSequentialStream *chp, int argc, char *argv[]) {
  */
 void cmd_cat(BaseSequentialStream *chp, int argc, char *argv[]) {
 	FRESULT err;
-	FIL fsrc;   /* file object */
-	char Buffer[255];
-	UINT ByteToRead=sizeof(Buffer);
+	FIL *fsrc;   /* file object */
+	char *Buffer;
+	UINT ByteToRead=POOL_SECTOR_SIZE;
 	UINT ByteRead;
 	/*
 	 * Print usage
@@ -339,14 +395,24 @@ void cmd_cat(BaseSequentialStream *chp, int argc, char *argv[]) {
 		chprintf(chp, "       Echos filename (no spaces)\r\n");
 		return;
 	}
+	/*
+	 * Sector buffer from the pool, the file from the handle table so a
+	 * repeated cat reuses the open file.
+	 */
+	fsrc = NULL;
+	Buffer = sector_alloc();
+	if (Buffer == NULL) {
+		chprintf(chp, "FS: no free buffer\r\n");
+		goto out;
+	}
 	/*
 	 * Attempt to open the file, error out if it fails.
 	 */
-	err=f_open(&fsrc, argv[0], FA_READ);
-	if (err != FR_OK) {
+	fsrc = filetab_open(argv[0], FA_READ, &err);
+	if (fsrc == NULL) {
 		chprintf(chp, "FS: f_open(%s) failed.\r\n",argv[0]);
 		verbose_error(chp, err);
-		return;
+		goto out;
 	}
 	/*
 	 * Do while the number of bytes read is equal to the number of bytes to read
@@ -354,68 +420,69 @@ void cmd_cat(BaseSequentialStream *chp, int argc, char *argv[]) {
 	 */
 	do {
 		/*
-		 * Clear the buffer.
+		 * Read the file, a whole sector lands straight in the buffer.
 		 */
-		memset(Buffer,0,sizeof(Buffer));
-		/*
-		 * Read the file.
-		 */
-		err=f_read(&fsrc,Buffer,ByteToRead,&ByteRead);
+		err=f_read(fsrc,Buffer,ByteToRead,&ByteRead);
 		if (err != FR_OK) {
 			chprintf(chp, "FS: f_read() failed\r\n");
 			verbose_error(chp, err);
-			f_close(&fsrc);
-			return;
+			break;
 		}
-		chprintf(chp, "%s", Buffer);
+		chSequentialStreamWrite(chp, (uint8_t *)Buffer, ByteRead);
 	} while (ByteRead>=ByteToRead);
 	chprintf(chp,"\r\n");
 	/*
-	 * Close the file.
+	 * Give the file back.
 	 */
-	f_close(&fsrc);
+	filetab_close(fsrc);
+out:
+	sector_free(Buffer);
 	return;
 }
 
-/* This function mounts the volume, reads a file and unmounts the volume */
+/* This function reads a file from the mounted volume */
 
 void cmd_bentest(BaseSequentialStream *chp, int argc, char *argv[]) {
 
-	FIL fil;
-	char line[82];
-	FRESULT fr, err;
+	FIL *fil;
+	char *line;
+	FRESULT fr;
+
+	fil = filetab_fil_alloc();
+	line = sector_alloc();
+	if (fil == NULL || line == NULL) {
+		chprintf(chp, "FS: no free file object or buffer\r\n");
+		sector_free(line);
+		fil_free(fil);
+		return;
+	}
 
 	chprintf(chp, "Attempting to read out message.txt\r\n");
-	
-        palSetPad(GPIOD, GPIOD_LED6);
-        sdcConnect(&SDCD1);
 
-	/* Register work area to the default drive */
-	f_mount(&SDC_FS, "", 0);
+	/* The mount manager keeps the volume mounted */
+	if (volume_mount() != FR_OK) {
+		chprintf(chp, "FS: no card, or unmounted\r\n");
+		sector_free(line);
+		fil_free(fil);
+		return;
+	}
 
 	/* Open a file */
-	fr = f_open(&fil, "TEST~1.GCO", FA_READ);
+	filetab_evict("TEST~1.GCO");
+	fr = f_open(fil, "TEST~1.GCO", FA_READ);
 //	if(fr)
 //		return (int)fr;
 
 
 
 	/* Read all lines and display it */
-	while(f_gets(line, sizeof(line), &fil))
+	while(f_gets(line, POOL_SECTOR_SIZE, fil))
 		chprintf(chp, "%s\r\n", line);
 
 	/* Close the file */
-	f_close(&fil);
-
-	palClearPad(GPIOD, GPIOD_LED6);
-	sdcDisconnect(&SDCD1);
-	err = f_mount(0, "", 0);
-	if (err != FR_OK) {
-		chprintf(chp, "FS: f_mount() unmount failed\r\n");
-		verbose_error(chp, err);
-		return;
-	}
-
+	f_close(fil);
+	sector_free(line);
+	fil_free(fil);
 
 //	return;
 
@@ -14,7 +14,7 @@
  * @brief FS object.
  */
 
-static FATFS SDC_FS;
+extern FATFS SDC_FS;
 FRESULT scan_files(BaseSequentialStream *chp, char *path);
 void cmd_mount(BaseSequentialStream *chp, int argc, char *argv[]);
 void cmd_unmount(BaseSequentialStream *chp, int argc, char *argv[]);
@@ -185,15 +185,18 @@
 / System Configurations
 /---------------------------------------------------------------------------*/
 
-#define _FS_LOCK    0   /* 0:Disable or >=1:Enable */
+#define _FS_LOCK    16  /* 0:Disable or >=1:Enable */
 /* To enable file lock control feature, set _FS_LOCK to non-zero value.
 /  The value defines how many files/sub-directories can be opened simultaneously
 /  with file lock control. This feature uses bss _FS_LOCK * 12 bytes. */
 
 
-#define _FS_REENTRANT   0               /* 0:Disable or 1:Enable */
+#define _FS_REENTRANT   1               /* 0:Disable or 1:Enable */
 #define _FS_TIMEOUT     MS2ST(1000)     /* Timeout period in unit of time tick */
-#define _SYNC_t         semaphore_t*    /* O/S dependent sync object type. e.g. HANDLE, OS_EVENT*, ID, SemaphoreHandle_t and etc.. */
+#define _SYNC_t         mutex_t*        /* O/S dependent sync object type. e.g. HANDLE, OS_EVENT*, ID, SemaphoreHandle_t and etc.. */
+/* CHIBIOS FIX: The volume lock is a mutex so a low priority writer holding it
+/  inherits the priority of the job reader, see ffsync.c. ChibiOS mutexes
+/  have no timeout so _FS_TIMEOUT is not used. */
 /* The _FS_REENTRANT option switches the re-entrancy (thread safe) of the FatFs module.
 /
 /   0: Disable re-entrancy. _FS_TIMEOUT and _SYNC_t have no effect.
@@ -0,0 +1,141 @@
+/*
+ * ffsync.c
+ *
+ *  FatFs OS glue, replaces the fatfs_syscall.c binding. Volumes are guarded
+ *  by mutexes rather than semaphores so a thread holding the volume
+ *  inherits the priority of the threads waiting on it.
+ */
+
+/*===========================================================================*/
+/* FatFs OS glue.                                                            */
+/*===========================================================================*/
+#include <string.h>
+
+#include "ch.h"
+#include "hal.h"
+
+#include "ff.h"
+#include "ffsync.h"
+#include "pools.h"
+
+ffsync_stats_t ffsync_stats;
+
+#if _FS_REENTRANT
+static mutex_t ff_mtx[_VOLUMES];
+static bool ff_mtx_ready[_VOLUMES];
+
+/*
+ * f_mount() creates the sync object on every mount. The mutex is set up
+ * once only, a remount must not reset it under a thread that waits on it.
+ */
+int ff_cre_syncobj(BYTE vol, _SYNC_t *sobj) {
+
+  *sobj = &ff_mtx[vol];
+  if (!ff_mtx_ready[vol]) {
+    chMtxObjectInit(*sobj);
+    ff_mtx_ready[vol] = true;
+  }
+  return TRUE;
+}
+
+int ff_del_syncobj(_SYNC_t sobj) {
+
+  (void)sobj;
+  return TRUE;
+}
+
+/*
+ * Never times out, _FS_TIMEOUT has no mutex equivalent.
+ */
+int ff_req_grant(_SYNC_t sobj) {
+  rtcnt_t start, cycles;
+
+  start = chSysGetRealtimeCounterX();
+  if (chMtxTryLock(sobj)) {
+    cycles = chSysGetRealtimeCounterX() - start;
+  }
+  else {
+    chMtxLock(sobj);
+    cycles = chSysGetRealtimeCounterX() - start;
+    ffsync_stats.contended++;
+    ffsync_stats.contended_cycles += cycles;
+  }
+  /* updated with the lock held */
+  ffsync_stats.grants++;
+  ffsync_stats.cycles += cycles;
+  return TRUE;
+}
+
+void ff_rel_grant(_SYNC_t sobj) {
+
+  chMtxUnlock(sobj);
+}
+
+/*
+ * Gives volume vol up while the calling thread waits for the card, false
+ * when it does not hold it or has taken another mutex since. Only for
+ * points where FatFs has nothing half done, like CTRL_SYNC at the end of
+ * f_sync(). ffsync_reclaim() takes it back.
+ */
+bool ffsync_yield(BYTE vol) {
+  thread_t *self = chThdGetSelfX();
+
+  /* chMtxUnlock() gives up the mutex the thread took last, see chmtx.c */
+  if (!ff_mtx_ready[vol] || ff_mtx[vol].m_owner != self ||
+      self->p_mtxlist != &ff_mtx[vol])
+    return false;
+  chMtxUnlock(&ff_mtx[vol]);
+  return true;
+}
+
+void ffsync_reclaim(BYTE vol) {
+
+  ff_req_grant(&ff_mtx[vol]);
+}
+
+/*
+ * The most urgent io_class of the threads waiting for volume vol, or cls
+ * when none is more urgent. The holder issues its card requests in it, the
+ * I/O side of the priority inheritance the mutex gives.
+ */
+uint8_t ffsync_waiter_class(BYTE vol, uint8_t cls) {
+  const thread_t *tp;
+
+  if (!ff_mtx_ready[vol])
+    return cls;
+  chSysLock();
+  for (tp = ff_mtx[vol].m_queue.p_next;
+       tp != (const thread_t *)&ff_mtx[vol].m_queue; tp = tp->p_next) {
+    if (tp->io_class < cls)
+      cls = tp->io_class;
+  }
+  chSysUnlock();
+  return cls;
+}
+#endif /* _FS_REENTRANT */
+
+#if _USE_LFN == 3
+/*
+ * The only thing FatFs allocates is the LFN buffer, taken and given back
+ * with the volume locked. It comes from a pool so no file system call
+ * needs the heap.
+ */
+void *ff_memalloc(UINT size) {
+
+  if(size > POOL_LFN_SIZE)
+    return NULL;
+  return pool_alloc(&lfn_pool);
+}
+
+void ff_memfree(void *mblock) {
+
+  pool_free(&lfn_pool, mblock);
+}
+#endif /* _USE_LFN == 3 */
+
+void ffsync_reset_stats(void) {
+
+  chSysLock();
+  memset(&ffsync_stats, 0, sizeof(ffsync_stats));
+  chSysUnlock();
+}
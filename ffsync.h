@@ -0,0 +1,31 @@
+/*
+ * ffsync.h
+ *
+ *  FatFs OS glue, replaces the fatfs_syscall.c binding.
+ */
+
+#ifndef FFSYNC_H_
+#define FFSYNC_H_
+
+/*
+ * Volume lock statistics, cycles are counted from the lock request to the
+ * grant.
+ */
+typedef struct
+{
+	uint32_t grants;
+	uint32_t contended;
+	uint64_t cycles;
+	uint64_t contended_cycles;
+} ffsync_stats_t;
+
+extern ffsync_stats_t ffsync_stats;
+
+void ffsync_reset_stats(void);
+#if _FS_REENTRANT
+bool ffsync_yield(BYTE vol);
+void ffsync_reclaim(BYTE vol);
+uint8_t ffsync_waiter_class(BYTE vol, uint8_t cls);
+#endif
+
+#endif /* FFSYNC_H_ */
@@ -0,0 +1,349 @@
+/*
+ * filetab.c
+ *
+ *  Table of open file handles. Closing a handle keeps the file open so the
+ *  next open of the same path and mode gets it back, sector buffer
+ *  included. Idle handles are closed least recently used first, or by
+ *  filetab_evict() before the file is opened elsewhere.
+ */
+
+/*===========================================================================*/
+/* File handle table.                                                        */
+/*===========================================================================*/
+#include <string.h>
+
+#include "ch.h"
+#include "hal.h"
+
+#include "chprintf.h"
+
+#include "ff.h"
+#include "filetab.h"
+#include "pools.h"
+
+typedef struct
+{
+	FIL *fil;                   /* NULL when the slot is free */
+	char path[FILETAB_PATH_MAX];
+	BYTE mode;
+	bool busy;                  /* handed out, not just cached */
+	uint32_t stamp;             /* last use, for LRU */
+} filetab_slot_t;
+
+static filetab_slot_t slots[FILETAB_SLOTS];
+static filetab_stats_t stats;
+static uint32_t filetab_clock;
+static MUTEX_DECL(filetab_mtx);
+
+/*
+ * Modes a cached handle can serve without reopening. FA_CREATE_NEW has to
+ * fail on an existing file so it always goes to f_open().
+ */
+static inline bool _reusable(BYTE mode)
+{
+	return !(mode & FA_CREATE_NEW);
+}
+
+static filetab_slot_t *_find(const FIL *fp)
+{
+	int i;
+
+	for(i = 0; i < FILETAB_SLOTS; i++)
+		if(slots[i].fil == fp)
+			return &slots[i];
+	return NULL;
+}
+
+/*
+ * Closes an idle handle, the FIL stays with the slot.
+ */
+static void _evict(filetab_slot_t *sp)
+{
+	f_close(sp->fil);
+	sp->path[0] = '\0';
+	sp->mode = 0;
+	stats.evictions++;
+}
+
+static filetab_slot_t *_lru_idle(const char *path)
+{
+	filetab_slot_t *lru = NULL;
+	int i;
+
+	for(i = 0; i < FILETAB_SLOTS; i++)
+	{
+		if(!slots[i].fil || slots[i].busy || !slots[i].path[0])
+			continue;
+		if(path && strcmp(slots[i].path, path))
+			continue;
+		if(!lru || (int32_t)(slots[i].stamp - lru->stamp) < 0)
+			lru = &slots[i];
+	}
+	return lru;
+}
+
+/*
+ * Returns an open file positioned at the start, or NULL with the reason in
+ * *frp. The handle must be given back with filetab_close().
+ */
+FIL *filetab_open(const char *path, BYTE mode, FRESULT *frp)
+{
+	filetab_slot_t *sp = NULL;
+	FRESULT fr = FR_OK;
+	int i;
+
+	chMtxLock(&filetab_mtx);
+	stats.opens++;
+
+	/* cached handle of the same file */
+	if(_reusable(mode) && strlen(path) < FILETAB_PATH_MAX)
+	{
+		for(i = 0; i < FILETAB_SLOTS; i++)
+		{
+			if(slots[i].fil && !slots[i].busy && slots[i].mode == mode &&
+				!strcmp(slots[i].path, path))
+			{
+				sp = &slots[i];
+				fr = f_lseek(sp->fil, 0);
+				if(fr == FR_OK && (mode & FA_CREATE_ALWAYS))
+					fr = f_truncate(sp->fil);
+				if(fr != FR_OK)
+				{
+					_evict(sp);
+					sp = NULL;
+					break;
+				}
+				sp->busy = true;
+				sp->stamp = ++filetab_clock;
+				stats.hits++;
+				goto out;
+			}
+		}
+	}
+
+	/* a free slot with a pool FIL, else recycle the oldest idle handle */
+	for(i = 0; i < FILETAB_SLOTS && !sp; i++)
+	{
+		if(slots[i].fil && !slots[i].busy && !slots[i].path[0])
+			sp = &slots[i];
+	}
+	for(i = 0; i < FILETAB_SLOTS && !sp; i++)
+	{
+		if(!slots[i].fil && (slots[i].fil = fil_alloc()) != NULL)
+			sp = &slots[i];
+	}
+	if(!sp && (sp = _lru_idle(NULL)) != NULL)
+		_evict(sp);
+	if(!sp)
+	{
+		fr = FR_TOO_MANY_OPEN_FILES;
+		goto out;
+	}
+
+	fr = f_open(sp->fil, path, mode);
+	if(fr == FR_LOCKED)
+	{
+		/* idle handles of the same file in another mode hold the lock */
+		filetab_slot_t *ip;
+
+		while((ip = _lru_idle(path)) != NULL)
+			_evict(ip);
+		fr = f_open(sp->fil, path, mode);
+	}
+	if(fr != FR_OK)
+	{
+		fil_free(sp->fil);
+		sp->fil = NULL;
+		sp = NULL;
+		goto out;
+	}
+	if(_reusable(mode) && strlen(path) < FILETAB_PATH_MAX)
+		strcpy(sp->path, path);
+	else
+		sp->path[0] = '\0';
+	sp->mode = mode;
+	sp->busy = true;
+	sp->stamp = ++filetab_clock;
+
+out:
+	if(!sp)
+		stats.fails++;
+	chMtxUnlock(&filetab_mtx);
+	if(frp)
+		*frp = fr;
+	return sp ? sp->fil : NULL;
+}
+
+/*
+ * Gives a handle back. Written data is synced, the file stays open unless
+ * it cannot be reused.
+ */
+FRESULT filetab_close(FIL *fp)
+{
+	filetab_slot_t *sp;
+	FRESULT fr = FR_OK;
+
+	if(fp == NULL)
+		return FR_INVALID_OBJECT;
+	chMtxLock(&filetab_mtx);
+	sp = _find(fp);
+	if(sp == NULL || !sp->busy)
+	{
+		chMtxUnlock(&filetab_mtx);
+		return FR_INVALID_OBJECT;
+	}
+	if(sp->path[0])
+	{
+		if(sp->mode & FA_WRITE)
+			fr = f_sync(fp);
+	}
+	else
+	{
+		fr = f_close(fp);
+		fil_free(fp);
+		sp->fil = NULL;
+	}
+	sp->busy = false;
+	sp->stamp = ++filetab_clock;
+	chMtxUnlock(&filetab_mtx);
+	return fr;
+}
+
+/*
+ * Closes every idle handle and returns the FILs to the pool, needed before
+ * the volume goes away. Handles in use are left alone.
+ */
+FRESULT filetab_flush(void)
+{
+	FRESULT fr = FR_OK;
+	int i;
+
+	chMtxLock(&filetab_mtx);
+	for(i = 0; i < FILETAB_SLOTS; i++)
+	{
+		if(!slots[i].fil || slots[i].busy)
+		{
+			if(slots[i].busy)
+				fr = FR_LOCKED;
+			continue;
+		}
+		if(slots[i].path[0])
+			f_close(slots[i].fil);
+		fil_free(slots[i].fil);
+		slots[i].fil = NULL;
+		slots[i].path[0] = '\0';
+	}
+	chMtxUnlock(&filetab_mtx);
+	return fr;
+}
+
+/*
+ * Closes the idle handles of path. An idle handle keeps its FatFs lock, so
+ * whoever opens, unlinks or renames a file outside the table calls this
+ * first. FR_LOCKED when the file is in use through the table.
+ */
+FRESULT filetab_evict(const char *path)
+{
+	FRESULT fr = FR_OK;
+	int i;
+
+	chMtxLock(&filetab_mtx);
+	for(i = 0; i < FILETAB_SLOTS; i++)
+	{
+		if(!slots[i].fil || strcmp(slots[i].path, path))
+			continue;
+		if(slots[i].busy)
+			fr = FR_LOCKED;
+		else
+			_evict(&slots[i]);
+	}
+	chMtxUnlock(&filetab_mtx);
+	return fr;
+}
+
+/*
+ * A FIL for a caller outside the table, given back with fil_free(). When
+ * the pool has run out the least recently used idle handle is closed and
+ * gives up its FIL.
+ */
+FIL *filetab_fil_alloc(void)
+{
+	filetab_slot_t *sp;
+	FIL *fp;
+
+	fp = fil_alloc();
+	if(fp)
+		return fp;
+	chMtxLock(&filetab_mtx);
+	sp = _lru_idle(NULL);
+	if(sp)
+	{
+		_evict(sp);
+		fp = sp->fil;
+		sp->fil = NULL;
+	}
+	chMtxUnlock(&filetab_mtx);
+	return fp;
+}
+
+/*
+ * True while a file is open, through the table or with a FIL of its own.
+ */
+bool filetab_busy(void)
+{
+	uint32_t held = 0;
+	bool busy = false;
+	int i;
+
+	chMtxLock(&filetab_mtx);
+	for(i = 0; i < FILETAB_SLOTS; i++)
+	{
+		held += slots[i].fil != NULL;
+		busy |= slots[i].busy;
+	}
+	busy |= fil_pool.used > held;
+	chMtxUnlock(&filetab_mtx);
+	return busy;
+}
+
+void cmd_files(BaseSequentialStream *chp, int argc, char *argv[])
+{
+	filetab_slot_t snap[FILETAB_SLOTS];
+	uint32_t size[FILETAB_SLOTS];
+	filetab_stats_t st;
+	int i;
+
+	(void)argv;
+	if(argc > 0)
+	{
+		if(argc == 1 && !strcmp(argv[0], "flush"))
+		{
+			if(filetab_flush() != FR_OK)
+				chprintf(chp, "files in use were left open\r\n");
+			return;
+		}
+		chprintf(chp, "Usage: files [flush]\r\n");
+		return;
+	}
+
+	/* a slow console must not hold up opens */
+	chMtxLock(&filetab_mtx);
+	st = stats;
+	memcpy(snap, slots, sizeof(snap));
+	for(i = 0; i < FILETAB_SLOTS; i++)
+		size[i] = slots[i].fil && slots[i].path[0] ? (uint32_t)f_size(slots[i].fil) : 0;
+	chMtxUnlock(&filetab_mtx);
+
+	chprintf(chp, "slot state mode size     path\r\n");
+	for(i = 0; i < FILETAB_SLOTS; i++)
+	{
+		if(!snap[i].fil)
+			chprintf(chp, "%4d free\r\n", i);
+		else
+			chprintf(chp, "%4d %-5s 0x%02x %8lu %s\r\n", i,
+				snap[i].busy ? "busy" : "idle", snap[i].mode, size[i],
+				snap[i].path[0] ? snap[i].path : "-");
+	}
+	chprintf(chp, "opens %lu hits %lu evictions %lu failed %lu\r\n",
+		st.opens, st.hits, st.evictions, st.fails);
+}
@@ -0,0 +1,36 @@
+/*
+ * filetab.h
+ *
+ *  Table of open file handles. Closing a handle keeps the file open so the
+ *  next open of the same path and mode gets it back, sector buffer
+ *  included. Idle handles are closed least recently used first, or by
+ *  filetab_evict() before the file is opened elsewhere.
+ */
+
+#ifndef FILETAB_H_
+#define FILETAB_H_
+
+#include "ff.h"
+
+#ifndef FILETAB_SLOTS
+#define FILETAB_SLOTS       4       /* handles, idle or in use */
+#endif
+#define FILETAB_PATH_MAX    32      /* longer paths are opened but never reused */
+
+typedef struct
+{
+	uint32_t opens;
+	uint32_t hits;
+	uint32_t evictions;
+	uint32_t fails;
+} filetab_stats_t;
+
+FIL *filetab_open(const char *path, BYTE mode, FRESULT *frp);
+FRESULT filetab_close(FIL *fp);
+FRESULT filetab_flush(void);
+FRESULT filetab_evict(const char *path);
+FIL *filetab_fil_alloc(void);
+bool filetab_busy(void);
+void cmd_files(BaseSequentialStream *chp, int argc, char *argv[]);
+
+#endif /* FILETAB_H_ */
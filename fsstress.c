@@ -0,0 +1,205 @@
+/*
+ * fsstress.c
+ *
+ *  Concurrent FatFs access test. Readers loop over a shared file while
+ *  writers create their own, every byte is checked against a pattern, then
+ *  the volume lock statistics from ffsync.c are reported.
+ */
+
+/*===========================================================================*/
+/* FatFs stress test.                                                        */
+/*===========================================================================*/
+#include <string.h>
+
+#include "ch.h"
+#include "hal.h"
+#include "chprintf.h"
+
+#include "ff.h"
+#include "fat.h"
+#include "ffsync.h"
+#include "pools.h"
+#include "filetab.h"
+#include "fsstress.h"
+#include "clmap.h"
+
+typedef struct {
+	int id;                     /* file number, 0 is the shared file */
+	bool write;
+	uint32_t bytes;
+	uint32_t errors;
+	FRESULT fr;
+} stress_arg_t;
+
+static inline uint8_t _pattern(int id, uint32_t ofs) {
+
+	return (uint8_t)(ofs * 7 + (uint32_t)id * 31 + (ofs >> 9));
+}
+
+static void _stress_name(char *name, int id) {
+
+	strcpy(name, "STRESS0.DAT");
+	name[6] = (char)('0' + id);
+}
+
+static FRESULT _stress_write(FIL *fil, char *buff, int id) {
+	char name[13];
+	uint32_t ofs, i;
+	UINT bw;
+	FRESULT fr;
+
+	_stress_name(name, id);
+	filetab_evict(name);
+	fr = f_open(fil, name, FA_WRITE | FA_CREATE_ALWAYS);
+	if (fr != FR_OK)
+		return fr;
+	clmap_prepare(fil, FSSTRESS_SIZE);
+	for (ofs = 0; ofs < FSSTRESS_SIZE && fr == FR_OK; ofs += POOL_SECTOR_SIZE) {
+		for (i = 0; i < POOL_SECTOR_SIZE; i++)
+			buff[i] = (char)_pattern(id, ofs + i);
+		fr = f_write(fil, buff, POOL_SECTOR_SIZE, &bw);
+		if (fr == FR_OK && bw != POOL_SECTOR_SIZE)
+			fr = FR_DENIED;
+	}
+	f_close(fil);
+	return fr;
+}
+
+static FRESULT _stress_verify(FIL *fil, char *buff, int id, uint32_t *errors) {
+	char name[13];
+	uint32_t ofs, i;
+	UINT br;
+	FRESULT fr;
+
+	_stress_name(name, id);
+	filetab_evict(name);
+	fr = f_open(fil, name, FA_READ);
+	if (fr != FR_OK)
+		return fr;
+	for (ofs = 0; ofs < FSSTRESS_SIZE; ofs += br) {
+		fr = f_read(fil, buff, POOL_SECTOR_SIZE, &br);
+		if (fr != FR_OK || br == 0)
+			break;
+		for (i = 0; i < br; i++)
+			if ((uint8_t)buff[i] != _pattern(id, ofs + i))
+				(*errors)++;
+	}
+	if (fr == FR_OK && ofs != FSSTRESS_SIZE)
+		(*errors)++;
+	f_close(fil);
+	return fr;
+}
+
+static THD_FUNCTION(stress_thread, arg) {
+	stress_arg_t *sa = arg;
+	FIL *fil;
+	char *buff;
+	int n;
+
+	chRegSetThreadName(sa->write ? "fswriter" : "fsreader");
+	fil = filetab_fil_alloc();
+	buff = sector_alloc();
+	if (fil == NULL || buff == NULL) {
+		sa->fr = FR_NOT_ENOUGH_CORE;
+		goto out;
+	}
+	if (sa->write) {
+		sa->fr = _stress_write(fil, buff, sa->id);
+		if (sa->fr == FR_OK)
+			sa->fr = _stress_verify(fil, buff, sa->id, &sa->errors);
+		sa->bytes = 2 * FSSTRESS_SIZE;
+	}
+	else {
+		for (n = 0; n < FSSTRESS_LOOPS && sa->fr == FR_OK; n++) {
+			sa->fr = _stress_verify(fil, buff, sa->id, &sa->errors);
+			sa->bytes += FSSTRESS_SIZE;
+		}
+	}
+out:
+	sector_free(buff);
+	fil_free(fil);
+}
+
+void cmd_fsstress(BaseSequentialStream *chp, int argc, char *argv[]) {
+	stress_arg_t args[FSSTRESS_READERS + FSSTRESS_WRITERS];
+	thread_t *tp[FSSTRESS_READERS + FSSTRESS_WRITERS];
+	FIL *fil;
+	char *buff;
+	systime_t start, elapsed;
+	uint32_t bytes = 0, errors = 0;
+	ffsync_stats_t st;
+	int i, n = 0;
+	FRESULT fr;
+
+	(void)argv;
+	if (argc > 0) {
+		chprintf(chp, "Usage: fsstress\r\n");
+		return;
+	}
+	if (SDC_FS.fs_type == 0) {
+		chprintf(chp, "FS: not mounted\r\n");
+		return;
+	}
+
+	/* shared file for the readers */
+	fil = filetab_fil_alloc();
+	buff = sector_alloc();
+	if (fil == NULL || buff == NULL) {
+		chprintf(chp, "FS: no free file object or buffer\r\n");
+		sector_free(buff);
+		fil_free(fil);
+		return;
+	}
+	fr = _stress_write(fil, buff, 0);
+	sector_free(buff);
+	fil_free(fil);
+	if (fr != FR_OK) {
+		chprintf(chp, "FS: cannot create STRESS0.DAT\r\n");
+		verbose_error(chp, fr);
+		return;
+	}
+
+	memset(args, 0, sizeof(args));
+	for (i = 0; i < FSSTRESS_READERS + FSSTRESS_WRITERS; i++) {
+		args[i].write = i >= FSSTRESS_READERS;
+		args[i].id = args[i].write ? i - FSSTRESS_READERS + 1 : 0;
+	}
+
+	ffsync_reset_stats();
+	start = chVTGetSystemTimeX();
+	for (i = 0; i < FSSTRESS_READERS + FSSTRESS_WRITERS; i++) {
+		tp[n] = chThdCreateFromHeap(NULL, FSSTRESS_WA_SIZE, NORMALPRIO,
+				stress_thread, &args[i]);
+		if (tp[n] == NULL) {
+			chprintf(chp, "FS: out of memory for thread %d\r\n", i);
+			break;
+		}
+		n++;
+	}
+	for (i = 0; i < n; i++)
+		chThdWait(tp[i]);
+	elapsed = chVTGetSystemTimeX() - start;
+	st = ffsync_stats;
+
+	for (i = 0; i < n; i++) {
+		chprintf(chp, "%s %d: %lu bytes, %lu mismatches",
+				args[i].write ? "writer" : "reader", i,
+				args[i].bytes, args[i].errors);
+		if (args[i].fr != FR_OK)
+			chprintf(chp, ", %s", fresult_str(args[i].fr));
+		chprintf(chp, "\r\n");
+		bytes += args[i].bytes;
+		errors += args[i].errors + (args[i].fr != FR_OK);
+	}
+	chprintf(chp, "%lu bytes in %lu ms, %s\r\n", bytes,
+			(uint32_t)ST2MS(elapsed), errors ? "FAILED" : "OK");
+	chprintf(chp, "Lock: %lu grants, %lu contended\r\n",
+			st.grants, st.contended);
+	if (st.grants > st.contended)
+		chprintf(chp, "Lock: %lu cycles per uncontended grant\r\n",
+				(uint32_t)((st.cycles - st.contended_cycles) /
+				(st.grants - st.contended)));
+	if (st.contended)
+		chprintf(chp, "Lock: %lu cycles average wait when contended\r\n",
+				(uint32_t)(st.contended_cycles / st.contended));
+}
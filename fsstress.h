@@ -0,0 +1,18 @@
+/*
+ * fsstress.h
+ *
+ *  Concurrent FatFs access test.
+ */
+
+#ifndef FSSTRESS_H_
+#define FSSTRESS_H_
+
+#define FSSTRESS_SIZE       (16 * 1024)     /* bytes per test file */
+#define FSSTRESS_LOOPS      8               /* read passes per reader */
+#define FSSTRESS_READERS    2
+#define FSSTRESS_WRITERS    2
+#define FSSTRESS_WA_SIZE    THD_WORKING_AREA_SIZE(1024)
+
+void cmd_fsstress(BaseSequentialStream *chp, int argc, char *argv[]);
+
+#endif /* FSSTRESS_H_ */
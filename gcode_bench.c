@@ -0,0 +1,437 @@
+/*
+ * gcode_bench.c
+ *
+ *  Parser and motion kernel benchmarks and the fixed point motion profile
+ *  check, run from the shell.
+ */
+
+/*===========================================================================*/
+/* GCODE Benchmarks.                                                         */
+/*===========================================================================*/
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "ch.h"
+#include "hal.h"
+
+#include "chprintf.h"
+#include "shell.h"
+
+#include "gcode_parser.h"
+#include "gcode_bench.h"
+#include "scurve.h"
+#include "shaper.h"
+#include "profref.h"
+#include "memmap.h"
+
+/*
+ * Typical words out of a sliced file, the letter is skipped by the kernels
+ * the same way gcode_line() does.
+ */
+static const char * const _bench_words[] = {
+	"X123.456", "Y-12.5", "Z0.2", "E0.03321", "F1800",
+	"X87.112", "Y101.904", "E2.46731", "F7800.000", "Z10"
+};
+#define _BENCH_NWORDS   (sizeof(_bench_words) / sizeof(_bench_words[0]))
+
+/*
+ * Moves in gcode units, lengths from sub-mm infill up to long travels.
+ */
+static const int32_t _bench_moves[][4] = {
+	/*   dx       dy      dz      f  */
+	{   412,    -87,      0, 1800000 },
+	{ 25000,  12500,      0, 7800000 },
+	{   -33,     41,      0, 1200000 },
+	{     0,      0,    200,  600000 },
+	{ -1500,  -2250,      0, 3000000 },
+	{   120,    120,      0, 2400000 }
+};
+#define _BENCH_NMOVES   (sizeof(_bench_moves) / sizeof(_bench_moves[0]))
+
+/* Keeps the kernels from being optimised away. */
+static volatile int32_t _bench_sink;
+
+static uint32_t _isqrt64(uint64_t v)
+{
+	uint64_t res = 0;
+	uint64_t bit = (uint64_t)1 << 62;
+
+	while(bit > v)
+		bit >>= 2;
+
+	while(bit)
+	{
+		if(v >= res + bit)
+		{
+			v -= res + bit;
+			res = (res >> 1) + bit;
+		}
+		else
+			res >>= 1;
+		bit >>= 2;
+	}
+	return (uint32_t)res;
+}
+
+static void _parse_double(void)
+{
+	unsigned i;
+
+	for(i = 0; i < _BENCH_NWORDS; i++)
+		_bench_sink = (int32_t)(strtod(_bench_words[i] + 1, NULL) * GCODE_UOM + 0.5);
+}
+
+static void _parse_float(void)
+{
+	unsigned i;
+
+	for(i = 0; i < _BENCH_NWORDS; i++)
+		_bench_sink = GCODE_UNITS(strtof(_bench_words[i] + 1, NULL));
+}
+
+static void _parse_fixed(void)
+{
+	unsigned i;
+
+	for(i = 0; i < _BENCH_NWORDS; i++)
+		_bench_sink = gcode_strtofx(_bench_words[i] + 1, NULL, GCODE_UOM);
+}
+
+/*
+ * Move length and duration in microseconds, the per block work of a
+ * planner before any look-ahead.
+ */
+static void _plan_float(void)
+{
+	unsigned i;
+	float dx, dy, dz, len;
+
+	for(i = 0; i < _BENCH_NMOVES; i++)
+	{
+		dx = (float)_bench_moves[i][0];
+		dy = (float)_bench_moves[i][1];
+		dz = (float)_bench_moves[i][2];
+		len = sqrtf(dx * dx + dy * dy + dz * dz);
+		_bench_sink = (int32_t)(len * 60000000.0f / (float)_bench_moves[i][3]);
+	}
+}
+
+static void _plan_fixed(void)
+{
+	unsigned i;
+	int64_t dx, dy, dz;
+	uint32_t len;
+
+	for(i = 0; i < _BENCH_NMOVES; i++)
+	{
+		dx = _bench_moves[i][0];
+		dy = _bench_moves[i][1];
+		dz = _bench_moves[i][2];
+		len = _isqrt64((uint64_t)(dx * dx + dy * dy + dz * dz));
+		_bench_sink = (int32_t)(((uint64_t)len * 60000000U) / (uint32_t)_bench_moves[i][3]);
+	}
+}
+
+/*
+ * Word layout, the old _cmd_data_t[_MAX_ARGS] array scanned per letter
+ * against the letter indexed slots of _gcode_words_t.
+ */
+static const char _bench_line[] = "G1 X123.456 Y-12.5 Z0.2 E0.03321 F1800";
+
+static int _legacy_lex(char *line, _cmd_data_t *cmd_data)
+{
+	char *token, *ptr = NULL;
+	int argc = 0;
+
+	memset(cmd_data, 0, sizeof(_cmd_data_t) * _MAX_ARGS);
+
+	token = strtok_r(line, _WHITESPACE, &ptr);
+	cmd_data[argc].cmd_ltr = token[0];
+	cmd_data[argc].ival = strtol(token+1, NULL, 10);
+	argc++;
+
+	while(argc < _MAX_ARGS)
+	{
+		token = strtok_r(NULL, _WHITESPACE, &ptr);
+		if(!token)
+			break;
+		cmd_data[argc].cmd_ltr = token[0];
+		if(strchr(token+1, '.'))
+		{
+			cmd_data[argc].fval = strtof(token+1, NULL);
+			cmd_data[argc].is_float = true;
+		}
+		else
+			cmd_data[argc].ival = strtol(token+1, NULL, 10);
+		argc++;
+	}
+	return argc;
+}
+
+static int32_t _legacy_get(int argc, const _cmd_data_t *cmd_data, char ltr)
+{
+	int i;
+
+	for(i = 1; i < argc; i++)
+	{
+		if(cmd_data[i].cmd_ltr == ltr)
+		{
+			if(cmd_data[i].is_float)
+				return GCODE_UNITS(cmd_data[i].fval);
+			return GCODE_UNITS(cmd_data[i].ival);
+		}
+	}
+	return -1;
+}
+
+static _cmd_data_t _bench_cmd_data[_MAX_ARGS];
+static int _bench_argc;
+static _gcode_words_t _bench_words_slots;
+
+static void _words_lex_legacy(void)
+{
+	char line[sizeof(_bench_line)];
+
+	memcpy(line, _bench_line, sizeof(line));
+	_bench_argc = _legacy_lex(line, _bench_cmd_data);
+}
+
+static void _words_lex_slots(void)
+{
+	char line[sizeof(_bench_line)];
+
+	memcpy(line, _bench_line, sizeof(line));
+	gcode_lex(line, &_bench_words_slots);
+}
+
+static void _words_get_legacy(void)
+{
+	_bench_sink = _legacy_get(_bench_argc, _bench_cmd_data, 'X');
+	_bench_sink = _legacy_get(_bench_argc, _bench_cmd_data, 'Y');
+	_bench_sink = _legacy_get(_bench_argc, _bench_cmd_data, 'Z');
+	_bench_sink = _legacy_get(_bench_argc, _bench_cmd_data, 'E');
+	_bench_sink = _legacy_get(_bench_argc, _bench_cmd_data, 'F');
+}
+
+static void _words_get_slots(void)
+{
+	const _gcode_words_t *w = &_bench_words_slots;
+
+	_bench_sink = (w->mask & GCODE_WORD('X')) ? GCODE_VAL(w, 'X') : -1;
+	_bench_sink = (w->mask & GCODE_WORD('Y')) ? GCODE_VAL(w, 'Y') : -1;
+	_bench_sink = (w->mask & GCODE_WORD('Z')) ? GCODE_VAL(w, 'Z') : -1;
+	_bench_sink = (w->mask & GCODE_WORD('E')) ? GCODE_VAL(w, 'E') : -1;
+	_bench_sink = (w->mask & GCODE_WORD('F')) ? GCODE_VAL(w, 'F') : -1;
+}
+
+static const struct
+{
+	const char *name;
+	void (*kernel)(void);
+	unsigned ops;
+} _bench_kernels[] = {
+	{"parse double", _parse_double, _BENCH_NWORDS},
+	{"parse float",  _parse_float,  _BENCH_NWORDS},
+	{"parse fixed",  _parse_fixed,  _BENCH_NWORDS},
+	{"plan float",   _plan_float,   _BENCH_NMOVES},
+	{"plan fixed",   _plan_fixed,   _BENCH_NMOVES},
+	{"lex legacy",   _words_lex_legacy, 1},
+	{"lex slots",    _words_lex_slots,  1},
+	{"get legacy",   _words_get_legacy, 5},
+	{"get slots",    _words_get_slots,  5}
+};
+
+/*
+ * Times each kernel with the cycle counter. Soft and hard float are
+ * compared by running this on a USE_FPU=no and a USE_FPU=hard build.
+ */
+void cmd_gcodebench(BaseSequentialStream *chp, int argc, char *argv[])
+{
+	unsigned k, n;
+	rtcnt_t start, cycles;
+	(void)argv;
+
+	if(argc > 0)
+	{
+		chprintf(chp, "Usage: gcodebench\r\n");
+		return;
+	}
+
+#if CORTEX_USE_FPU
+	chprintf(chp, "float: hardware FPU\r\n");
+#else
+	chprintf(chp, "float: software\r\n");
+#endif
+	chprintf(chp, "kernel         cycles/op\r\n");
+
+	for(k = 0; k < sizeof(_bench_kernels) / sizeof(_bench_kernels[0]); k++)
+	{
+		start = chSysGetRealtimeCounterX();
+		for(n = 0; n < GCODE_BENCH_ITERATIONS; n++)
+			_bench_kernels[k].kernel();
+		cycles = chSysGetRealtimeCounterX() - start;
+
+		chprintf(chp, "%-14s %9lu\r\n", _bench_kernels[k].name,
+			(uint32_t)(cycles / (GCODE_BENCH_ITERATIONS * _bench_kernels[k].ops)));
+	}
+}
+
+/*===========================================================================*/
+/* Motion profile check.                                                     */
+/*===========================================================================*/
+
+static scurve_t _prof_curve CCM_DATA;
+static shaper_t _prof_shaper CCM_DATA;
+
+static profref_t _prof_plan CCM_DATA;
+static profref_t _prof_ref CCM_DATA;
+
+/*
+ * Deviation allowed from the ideal profile in mm, the rounded plan may lead
+ * or lag it by the phase time rounding and a shaper by half a tick of its
+ * delays. Against the rounded plan itself the bound is GCODE_PROFILE_TOL_NM.
+ */
+static double _prof_tol(bool shaped)
+{
+	return GCODE_PROFILE_TOL_NM * 1e-6 + _prof_ref.v_peak *
+		(PROFREF_ROUND_TICKS + (shaped ? 0.5 : 0.0)) / GCODE_PROFILE_RATE;
+}
+
+static bool _check_shaper(BaseSequentialStream *chp, shaper_type_t type,
+	const char *name, float freq)
+{
+	scurve_t *s = &_prof_curve;
+	shaper_t *sh = &_prof_shaper;
+	double amp[SHAPER_IMPULSES], delay[SHAPER_IMPULSES], ref, out, err;
+	double worst = 0.0, ideal = 0.0;
+	rtcnt_t start, cycles;
+	uint32_t n, i, k, ticks;
+	scurve_t copy;
+
+	if(!shaper_init(sh, type, freq, GCODE_PROFILE_DAMPING, GCODE_PROFILE_RATE, 0))
+	{
+		chprintf(chp, "%-6s below %lu Hz, not enough history\r\n", name,
+			(uint32_t)(GCODE_PROFILE_RATE / SHAPER_HISTORY));
+		return false;
+	}
+	k = profref_impulses(type, (double)freq, (double)GCODE_PROFILE_DAMPING, amp, delay);
+	ticks = s->ticks + shaper_delay(sh) + 1;
+
+	/* timed pass, the same curve again from a copy */
+	copy = *s;
+	start = chSysGetRealtimeCounterX();
+	for(n = 0; n < ticks; n++)
+		_bench_sink = shaper_step(sh, scurve_step(&copy, NULL));
+	cycles = chSysGetRealtimeCounterX() - start;
+
+	shaper_init(sh, type, freq, GCODE_PROFILE_DAMPING, GCODE_PROFILE_RATE, 0);
+	copy = *s;
+	for(n = 0; n < ticks; n++)
+	{
+		out = (double)shaper_step(sh, scurve_step(&copy, NULL)) / Q16_ONE;
+
+		/* the shaper's own amplitudes and delays in ticks */
+		ref = 0.0;
+		for(i = 0; i < sh->n; i++)
+			ref += (double)sh->amp[i] / Q16_ONE * profref_pos(&_prof_plan,
+				((double)n - sh->delay[i]) / GCODE_PROFILE_RATE, NULL);
+		err = fabs(out - ref);
+		if(err > worst)
+			worst = err;
+
+		ref = 0.0;
+		for(i = 0; i < k; i++)
+			ref += amp[i] * profref_pos(&_prof_ref,
+				(double)n / GCODE_PROFILE_RATE - delay[i], NULL);
+		err = fabs(out - ref);
+		if(err > ideal)
+			ideal = err;
+	}
+	chprintf(chp, "%-6s delays %lu/%lu/%lu ticks, error %lu nm, from ideal %lu nm, "
+		"%lu cycles/tick\r\n", name, sh->delay[0], sh->delay[1],
+		sh->n > 2 ? sh->delay[2] : 0, (uint32_t)(worst * 1e6),
+		(uint32_t)(ideal * 1e6), (uint32_t)(cycles / ticks));
+	return worst <= GCODE_PROFILE_TOL_NM * 1e-6 && ideal <= _prof_tol(true);
+}
+
+/*
+ * Plans one move, runs it tick by tick through the Q16.16 S-curve and the
+ * shapers and compares with the same plan in double, rounded phase times
+ * included. The deviation from the ideal profile, which the reference
+ * plans on its own without rounding, is checked apart.
+ */
+void cmd_profile(BaseSequentialStream *chp, int argc, char *argv[])
+{
+	float len = 50.0f, v = 150.0f, a = 3000.0f, j = 100000.0f, freq = 40.0f;
+	scurve_t *s = &_prof_curve;
+	scurve_t copy;
+	double ref, vref, err, worst = 0.0, vworst = 0.0, ideal = 0.0;
+	rtcnt_t start, cycles;
+	uint32_t n;
+	q16_t pos = 0, vel;
+	bool ok;
+
+	if(argc > 5)
+	{
+		chprintf(chp, "Usage: profile [mm] [mm/s] [mm/s2] [mm/s3] [Hz]\r\n");
+		return;
+	}
+	if(argc > 0)
+		len = strtof(argv[0], NULL);
+	if(argc > 1)
+		v = strtof(argv[1], NULL);
+	if(argc > 2)
+		a = strtof(argv[2], NULL);
+	if(argc > 3)
+		j = strtof(argv[3], NULL);
+	if(argc > 4)
+		freq = strtof(argv[4], NULL);
+
+	if(!scurve_plan(s, len, 0.0f, 0.0f, v, a, j, GCODE_PROFILE_RATE) || s->ticks == 0)
+	{
+		chprintf(chp, "profile: cannot plan that move\r\n");
+		return;
+	}
+	profref_curve(&_prof_plan, s);
+	profref_plan(&_prof_ref, len, 0.0, 0.0, v, a, j);
+
+	copy = *s;
+	start = chSysGetRealtimeCounterX();
+	for(n = 0; n < s->ticks; n++)
+		_bench_sink = scurve_step(&copy, NULL);
+	cycles = chSysGetRealtimeCounterX() - start;
+
+	copy = *s;
+	for(n = 0; n < s->ticks; n++)
+	{
+		pos = scurve_step(&copy, &vel);
+		ref = profref_pos(&_prof_plan, (double)n / GCODE_PROFILE_RATE, &vref);
+		err = fabs((double)pos / Q16_ONE - ref);
+		if(err > worst)
+			worst = err;
+		err = fabs((double)vel / Q16_ONE - vref);
+		if(err > vworst)
+			vworst = err;
+		ref = profref_pos(&_prof_ref, (double)n / GCODE_PROFILE_RATE, NULL);
+		err = fabs((double)pos / Q16_ONE - ref);
+		if(err > ideal)
+			ideal = err;
+	}
+	pos = scurve_step(&copy, NULL);
+
+	chprintf(chp, "s-curve %lu ticks at %u Hz (%lu ms), peak %lu mm/s\r\n",
+		s->ticks, GCODE_PROFILE_RATE, s->ticks * 1000 / GCODE_PROFILE_RATE,
+		(uint32_t)s->v_peak);
+	chprintf(chp, "s-curve error %lu nm, velocity %lu um/s, from ideal %lu nm, "
+		"end %ld nm, %lu cycles/tick\r\n", (uint32_t)(worst * 1e6),
+		(uint32_t)(vworst * 1e3), (uint32_t)(ideal * 1e6),
+		(int32_t)((Q16_TO_F(pos) - len) * 1e6f), (uint32_t)(cycles / s->ticks));
+	ok = worst <= GCODE_PROFILE_TOL_NM * 1e-6 && ideal <= _prof_tol(false);
+	ok &= _check_shaper(chp, SHAPER_ZV, "zv", freq);
+	ok &= _check_shaper(chp, SHAPER_MZV, "mzv", freq);
+	chprintf(chp, "%s, tolerance %u nm, from ideal %lu nm, %lu nm shaped\r\n",
+		ok ? "pass" : "FAIL", GCODE_PROFILE_TOL_NM,
+		(uint32_t)(_prof_tol(false) * 1e6), (uint32_t)(_prof_tol(true) * 1e6));
+}
@@ -0,0 +1,20 @@
+/*
+ * gcode_bench.h
+ *
+ *  Parser and motion kernel benchmarks, run from the shell.
+ */
+
+#ifndef GCODE_BENCH_H_
+#define GCODE_BENCH_H_
+
+#define GCODE_BENCH_ITERATIONS  1000
+
+/* profile check */
+#define GCODE_PROFILE_RATE       10000   /* ticks per second */
+#define GCODE_PROFILE_DAMPING    0.1f
+#define GCODE_PROFILE_TOL_NM     1000
+
+void cmd_gcodebench(BaseSequentialStream *chp, int argc, char *argv[]);
+void cmd_profile(BaseSequentialStream *chp, int argc, char *argv[]);
+
+#endif /* GCODE_BENCH_H_ */
@@ -0,0 +1,404 @@
+/*
+ * gcode_line.c
+ *
+ *  One line of G-code: comment and checksum stripping, the lexer, the
+ *  fixed point number reader and the command handlers that turn a line
+ *  into the modal state and position of _param_t. Plain C without kernel
+ *  calls, the job, analyze and the host tests all go through it.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "gcode_line.h"
+
+/*===========================================================================*/
+/* Command handlers.                                                         */
+/*===========================================================================*/
+
+/* Move / Travel Move, missing axes and feedrate are inherited. */
+static _gcode_error_t _g_move(const _gcode_words_t *words, _param_t *param)
+{
+	if(words->mask & GCODE_WORD('X'))
+		param->x = (param->rel_pos ? param->x : 0) + GCODE_VAL(words, 'X');
+	if(words->mask & GCODE_WORD('Y'))
+		param->y = (param->rel_pos ? param->y : 0) + GCODE_VAL(words, 'Y');
+	if(words->mask & GCODE_WORD('Z'))
+		param->z = (param->rel_pos ? param->z : 0) + GCODE_VAL(words, 'Z');
+	if(words->mask & GCODE_WORD('E'))
+		param->e = (param->rel_e ? param->e : 0) + GCODE_VAL(words, 'E');
+	if(words->mask & GCODE_WORD('F'))
+		param->f = GCODE_VAL(words, 'F');
+
+	param->move = true;
+	return GCODE_OK;
+}
+
+/* Home Axis, no axis given homes all of them. */
+static _gcode_error_t _g_home(const _gcode_words_t *words, _param_t *param)
+{
+	uint32_t axes = words->mask & GCODE_XYZE;
+
+	if(!axes)
+		axes = GCODE_XYZE & ~GCODE_WORD('E');
+
+	if(axes & GCODE_WORD('X'))
+		param->x = 0;
+	if(axes & GCODE_WORD('Y'))
+		param->y = 0;
+	if(axes & GCODE_WORD('Z'))
+		param->z = 0;
+	return GCODE_OK;
+}
+
+/* Accepted, nothing to do on this machine. */
+static _gcode_error_t _gcode_nop(const _gcode_words_t *words, _param_t *param)
+{
+	(void)words;
+	(void)param;
+	return GCODE_OK;
+}
+
+/* Use absolute coordinates */
+static _gcode_error_t _g_absolute(const _gcode_words_t *words, _param_t *param)
+{
+	(void)words;
+	param->rel_pos = false;
+	param->rel_e = false;
+	return GCODE_OK;
+}
+
+/* Use relative coordinates */
+static _gcode_error_t _g_relative(const _gcode_words_t *words, _param_t *param)
+{
+	(void)words;
+	param->rel_pos = true;
+	param->rel_e = true;
+	return GCODE_OK;
+}
+
+/* Set current position */
+static _gcode_error_t _g_set_position(const _gcode_words_t *words, _param_t *param)
+{
+	if(words->mask & GCODE_WORD('X'))
+		param->x = GCODE_VAL(words, 'X');
+	if(words->mask & GCODE_WORD('Y'))
+		param->y = GCODE_VAL(words, 'Y');
+	if(words->mask & GCODE_WORD('Z'))
+		param->z = GCODE_VAL(words, 'Z');
+	if(words->mask & GCODE_WORD('E'))
+		param->e = GCODE_VAL(words, 'E');
+	return GCODE_OK;
+}
+
+/* Extruder absolute / relative */
+static _gcode_error_t _m_e_absolute(const _gcode_words_t *words, _param_t *param)
+{
+	(void)words;
+	param->rel_e = false;
+	return GCODE_OK;
+}
+
+static _gcode_error_t _m_e_relative(const _gcode_words_t *words, _param_t *param)
+{
+	(void)words;
+	param->rel_e = true;
+	return GCODE_OK;
+}
+
+/* Set hotend temperature, M104 returns at once and M109 waits. */
+static _gcode_error_t _m_hotend_temp(const _gcode_words_t *words, _param_t *param)
+{
+	if(words->mask & GCODE_WORD('S'))
+		param->target_temp[0] = GCODE_INT(words, 'S');
+	return GCODE_OK;
+}
+
+static _gcode_error_t _m_fan_on(const _gcode_words_t *words, _param_t *param)
+{
+	param->fan = !(words->mask & GCODE_WORD('S')) || (GCODE_INT(words, 'S') > 0);
+	return GCODE_OK;
+}
+
+static _gcode_error_t _m_fan_off(const _gcode_words_t *words, _param_t *param)
+{
+	(void)words;
+	param->fan = false;
+	return GCODE_OK;
+}
+
+/* Select tool, the tool number is the command code. */
+static _gcode_error_t _t_select(const _gcode_words_t *words, _param_t *param)
+{
+	param->ext_id = words->code;
+	return GCODE_OK;
+}
+
+/*
+ * Dispatch tables, indexed by command number so the lookup costs the same
+ * however many commands are supported. Unused numbers have no handler.
+ * This stands in for a sorted table searched by number: with G and M
+ * numbers below a few hundred an index beats a binary search, at the cost
+ * of the unused entries, 8 bytes each. The tables are const and live in
+ * flash, 744 bytes for G and 1768 bytes for M, of which 11 entries are
+ * used, no RAM.
+ */
+static const _gcode_cmd_t _gcode_g_cmds[GCODE_G_MAX] = {
+	[0]  = {_g_move,         GCODE_XYZE | GCODE_WORD('F')},
+	[1]  = {_g_move,         GCODE_XYZE | GCODE_WORD('F')},
+	[4]  = {_gcode_nop,      GCODE_WORD('P') | GCODE_WORD('S')},
+	[21] = {_gcode_nop,      0},
+	[28] = {_g_home,         GCODE_XYZE | GCODE_WORD('W')},
+	[29] = {_gcode_nop,      0},
+	[90] = {_g_absolute,     0},
+	[91] = {_g_relative,     0},
+	[92] = {_g_set_position, GCODE_XYZE}
+};
+
+static const _gcode_cmd_t _gcode_m_cmds[GCODE_M_MAX] = {
+	[82]  = {_m_e_absolute,  0},
+	[83]  = {_m_e_relative,  0},
+	[84]  = {_gcode_nop,     GCODE_XYZE | GCODE_WORD('S')},
+	[104] = {_m_hotend_temp, GCODE_WORD('S') | GCODE_WORD('T')},
+	[105] = {_gcode_nop,     0},
+	[106] = {_m_fan_on,      GCODE_WORD('P') | GCODE_WORD('S')},
+	[107] = {_m_fan_off,     GCODE_WORD('P')},
+	[109] = {_m_hotend_temp, GCODE_WORD('R') | GCODE_WORD('S') | GCODE_WORD('T')},
+	[140] = {_gcode_nop,     GCODE_WORD('S')},
+	[190] = {_gcode_nop,     GCODE_WORD('R') | GCODE_WORD('S')},
+	[220] = {_gcode_nop,     GCODE_WORD('S')}
+};
+
+static const _gcode_cmd_t _gcode_t_cmd = {_t_select, 0};
+
+static const _gcode_cmd_t *_gcode_lookup(char ltr, long code)
+{
+	const _gcode_cmd_t *cmd = NULL;
+
+	if(code < 0)
+		return NULL;
+
+	if(ltr == 'G' && code < GCODE_G_MAX)
+		cmd = &_gcode_g_cmds[code];
+	else if(ltr == 'M' && code < GCODE_M_MAX)
+		cmd = &_gcode_m_cmds[code];
+	else if(ltr == 'T' && code < GCODE_T_MAX)
+		cmd = &_gcode_t_cmd;
+
+	if(cmd && !cmd->handler)
+		cmd = NULL;
+	return cmd;
+}
+
+/*===========================================================================*/
+/* Line processing.                                                          */
+/*===========================================================================*/
+
+/*
+ * Pre-pass run on every line before lexing. Drops ';' and '(...)'
+ * comments, surrounding whitespace and line endings, checks and removes an
+ * optional N<line> prefix with *<checksum> suffix. As in Marlin and
+ * RepRap a '*' is only a checksum on a line that starts with N, elsewhere
+ * it is text like M117 50*2. Works in place in a single pass, *linep is
+ * moved to the first character of the command.
+ */
+_gcode_error_t gcode_strip(char **linep)
+{
+	char *p = *linep;
+	char *out;
+	uint8_t cs = 0;
+	int depth = 0;
+	bool numbered;
+
+	while(*p == ' ' || *p == '\t')
+		p++;
+	*linep = out = p;
+	numbered = *p == 'N' || *p == 'n';
+
+	for(; *p && *p != ';' && *p != '\r' && *p != '\n'; p++)
+	{
+		if(*p == '*' && !depth && numbered)
+		{
+			if(cs != (uint8_t)strtol(p+1, NULL, 10))
+				return GCODE_CHECKSUM;
+			break;
+		}
+		cs ^= (uint8_t)*p;
+
+		if(*p == '(')
+			depth++;
+		else if(*p == ')' && depth)
+			depth--;
+		else if(!depth)
+			*out++ = *p;
+	}
+
+	while(out > *linep && (out[-1] == ' ' || out[-1] == '\t'))
+		out--;
+	*out = 0;
+
+	/* line number, only useful to a host doing resends */
+	p = *linep;
+	if(*p == 'N' || *p == 'n')
+	{
+		while(*++p >= '0' && *p <= '9')
+			;
+		while(*p == ' ' || *p == '\t')
+			p++;
+		*linep = p;
+	}
+
+	return **linep ? GCODE_OK : GCODE_EMPTY;
+}
+
+/*
+ * Splits a line into its command and words. Spaces between words are
+ * optional, lower case letters are accepted and a word without a number
+ * (G28 W) reads as 0. The line ends at a CR or LF as well, f_gets() leaves
+ * the LF in.
+ */
+_gcode_error_t gcode_lex(const char *line, _gcode_words_t *words)
+{
+	const char *p = line;
+	char *end;
+	char ltr;
+
+	words->mask = 0;
+	words->code = -1;
+
+	while(*p == ' ' || *p == '\t')
+		p++;
+
+	words->cmd_ltr = *p & ~0x20;
+	if(words->cmd_ltr < 'A' || words->cmd_ltr > 'Z')
+		return GCODE_UNSUPPORTED;
+
+	words->code = strtol(p+1, &end, 10);
+	if(end == p+1)
+		return GCODE_UNSUPPORTED;
+	p = end;
+
+	/* sub-codes such as M862.3 are not used */
+	if(*p == '.')
+		while(*++p >= '0' && *p <= '9')
+			;
+
+	while(*p && *p != '\r' && *p != '\n')
+	{
+		if(*p == ' ' || *p == '\t')
+		{
+			p++;
+			continue;
+		}
+
+		ltr = *p & ~0x20;
+		if(ltr < 'A' || ltr > 'Z')
+			return GCODE_BAD_WORD;
+
+		if(words->mask & GCODE_WORD(ltr))
+			return GCODE_DUP_WORD;
+
+		words->mask |= GCODE_WORD(ltr);
+		GCODE_VAL(words, ltr) = gcode_strtofx(p+1, &end, GCODE_UOM);
+		p = end;
+	}
+
+	return GCODE_OK;
+}
+
+/*
+ * Parses one line and runs its handler. param carries the modal state
+ * between lines and holds the resulting position, param->move is set when
+ * the line was a move.
+ */
+_gcode_error_t gcode_line(char *line, _param_t *param)
+{
+	_gcode_words_t words;
+	const _gcode_cmd_t *cmd;
+	_gcode_error_t err;
+
+	param->move = false;
+
+	err = gcode_strip(&line);
+	if(err != GCODE_OK)
+		return err;
+
+	/* the command is looked up even when its words do not lex, M117 text */
+	err = gcode_lex(line, &words);
+	cmd = _gcode_lookup(words.cmd_ltr, words.code);
+	if(!cmd)
+		return GCODE_UNSUPPORTED;
+	if(err != GCODE_OK)
+		return err;
+
+	if(words.mask & ~cmd->words)
+		return GCODE_BAD_WORD;
+
+	return cmd->handler(&words, param);
+}
+
+/*
+ * Fixed point number reader, converts a decimal string straight to an
+ * integer scaled by scale (a power of 10, e.g. GCODE_UOM) without going
+ * through float. Digits beyond the scale are rounded, endptr works as in
+ * strtol(). A number that does not fit in int32_t once scaled is not
+ * read at all, *endptr is left at str and 0 returned.
+ */
+int32_t gcode_strtofx(const char *str, char **endptr, int32_t scale)
+{
+	const char *p = str;
+	bool neg = false;
+	bool over = false;
+	int32_t ipart = 0;
+	int32_t fpart = 0;
+	int32_t fscale = scale;
+	int64_t v;
+
+	while(*p == ' ' || *p == '\t')
+		p++;
+
+	if(*p == '-' || *p == '+')
+		neg = (*p++ == '-');
+
+	while(*p >= '0' && *p <= '9')
+	{
+		if(ipart > (INT32_MAX - (*p - '0')) / 10)
+			over = true;
+		else
+			ipart = ipart * 10 + (*p - '0');
+		p++;
+	}
+
+	if(*p == '.')
+	{
+		p++;
+		while(*p >= '0' && *p <= '9')
+		{
+			if(fscale > 1)
+			{
+				fscale /= 10;
+				fpart += (*p - '0') * fscale;
+			}
+			else if(fscale == 1)
+			{
+				/* first digit past the scale decides the rounding */
+				if(*p >= '5')
+					fpart++;
+				fscale = 0;
+			}
+			p++;
+		}
+	}
+
+	v = (int64_t)ipart * scale + fpart;
+	if(over || v > INT32_MAX)
+	{
+		if(endptr)
+			*endptr = (char *)str;
+		return 0;
+	}
+	if(endptr)
+		*endptr = (char *)p;
+
+	return neg ? -(int32_t)v : (int32_t)v;
+}
@@ -0,0 +1,113 @@
+/*
+ * gcode_line.h
+ *
+ *  One line of G-code to words, values and position, in gcode units.
+ */
+
+#ifndef GCODE_LINE_H_
+#define GCODE_LINE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef struct
+{
+//	gmech_move_t *blk_ptr;
+	int	blk_index;
+	
+	int ext_id;
+	bool rel_pos;       /* G90/G91, modal */
+	bool rel_e;         /* M82/M83, modal */
+	bool fan;
+	bool move;          /* set when the last line produced a move */
+
+	int32_t x;
+	int32_t y;
+	int32_t z;
+	int32_t e;
+	int32_t f;
+
+	int32_t curr_temp[1];
+	int32_t target_temp[1];
+
+	char *from;
+} _param_t;
+
+#define GMECH_UOM 1000 // distance is specified in 1000th of mm
+
+#define GCODE_UOM   GMECH_UOM
+
+#define GCODE_LINE_MAX  82
+
+/*
+ * Single precision only, a double here is done in software even with
+ * USE_FPU=hard.
+ */
+#define FXPT(dx,p)  (int32_t) ((float)(dx)*(float)(p)+0.5f)
+#define GCODE_UNITS(dx)  FXPT(dx, GCODE_UOM)   /*  convert to gcode units */
+
+/*!!!!!!!!!!DO NOT change order of the axis unless you know what you are doing!!!!!!!!!!!*/
+typedef enum
+{
+        GCODE_OK,
+        GCODE_ERROR,
+        GCODE_UNSUPPORTED,      /* no handler for the command */
+        GCODE_BAD_WORD,         /* word not accepted by the command */
+        GCODE_DUP_WORD,         /* same word given twice */
+        GCODE_EMPTY,            /* nothing left after stripping comments */
+        GCODE_CHECKSUM          /* N...*cs checksum mismatch */
+} _gcode_error_t;
+
+/*
+ * Words present on a line, one bit per letter.
+ */
+#define GCODE_WORD(ltr)     (1UL << ((ltr) - 'A'))
+#define GCODE_XYZE          (GCODE_WORD('X') | GCODE_WORD('Y') | GCODE_WORD('Z') | GCODE_WORD('E'))
+
+#define GCODE_NWORDS        26
+
+/*
+ * A lexed line. Each word lands in the slot of its letter so handlers read
+ * it in O(1), values are in gcode units.
+ */
+typedef struct
+{
+	char cmd_ltr;
+	long code;
+	uint32_t mask;                  /* letters present, GCODE_WORD() */
+	int32_t val[GCODE_NWORDS];      /* indexed by letter - 'A' */
+} _gcode_words_t;
+
+#define GCODE_VAL(w, ltr)   ((w)->val[(ltr) - 'A'])
+
+/*
+ * Value of word ltr rounded to an integer, for S, P, T and friends.
+ */
+static inline int32_t GCODE_INT(const _gcode_words_t *w, char ltr)
+{
+	int32_t v = GCODE_VAL(w, ltr);
+
+	return (v + (v < 0 ? -(GCODE_UOM / 2) : GCODE_UOM / 2)) / GCODE_UOM;
+}
+
+typedef _gcode_error_t (*_gcode_handler_t)(const _gcode_words_t *words, _param_t *param);
+
+/*
+ * Dispatch table entry, the tables are indexed by the command number.
+ */
+typedef struct
+{
+	_gcode_handler_t handler;
+	uint32_t words;     /* words the handler accepts */
+} _gcode_cmd_t;
+
+#define GCODE_G_MAX     93
+#define GCODE_M_MAX     221
+#define GCODE_T_MAX     4
+
+int32_t gcode_strtofx(const char *str, char **endptr, int32_t scale);
+_gcode_error_t gcode_strip(char **linep);
+_gcode_error_t gcode_lex(const char *line, _gcode_words_t *words);
+_gcode_error_t gcode_line(char *line, _param_t *param);
+
+#endif /* GCODE_LINE_H_ */
@@ -22,67 +22,189 @@
 #include "usbcfg.h"
 #include "fat.h"
 #include "gcode_parser.h"
+#include "console.h"
+#include "pools.h"
+#include "memmap.h"
+#include "filetab.h"
+#include "clmap.h"
+#include "volume.h"
+#include "planner.h"
+#include "jobstream.h"
+#include "machine.h"
+#include "analyze.h"
+#include "progress.h"
+#include "job.h"
 
 #include "ff.h"
 
-// Fat FS file object
-FIL fil;
+// Job file, from the handle table
+static FIL *fil;
 
-void cmd_gcodetest(BaseSequentialStream *chp, int argc, char *argv[]) {
-	FIL debugfil;
-	char line[82];
-	_gcode_error_t retval;
-	_param_t parsedline;
-	char debugbuff[128];
+// Counters of the running job, printed in summary mode
+static _gcode_stats_t gcode_stats CCM_DATA;
 
+static void _gcode_summary(BaseSequentialStream *chp)
+{
+	chprintf(chp, "lines %lu moves %lu unsupported %lu errors %lu starved %lu\r\n",
+		gcode_stats.lines, gcode_stats.moves, gcode_stats.unsupported,
+		gcode_stats.errors, planner_stats.starved);
+}
 
-	memset(&parsedline, 0, sizeof(_param_t));
+/*
+ * Runs a job on the job thread, see job.c. Returns how it ended.
+ */
+progress_state_t gcode_run(BaseSequentialStream *chp, const char *name)
+{
+	FIL *debugfil;
+	char *line;
+	_gcode_error_t retval;
+	_param_t *parsedline;
+	char *debugbuff;
+	size_t len;
+	bool skip = false;
+	progress_state_t state = PROGRESS_FAILED;
+
+	/*
+	 * Everything big comes from the pools rather than the job stack.
+	 */
+	line = sector_alloc();
+	debugbuff = sector_alloc();
+	parsedline = move_alloc();
+	if(!line || !debugbuff || !parsedline)
+	{
+		chprintf(chp, "gcodetest: out of pool objects, see mem\r\n");
+		goto out;
+	}
 
-	retval = _open_job(chp, "SIMPLE~1.GCO");	
+	memset(parsedline, 0, sizeof(_param_t));
+	memset(&gcode_stats, 0, sizeof(gcode_stats));
+	console_summary(_gcode_summary);
 
-	f_open(&debugfil, "output.log", FA_READ | FA_WRITE | FA_CREATE_ALWAYS);
+	retval = _open_job(chp, name);
 
-	
+	debugfil = filetab_open("output.log", FA_READ | FA_WRITE | FA_CREATE_ALWAYS, NULL);
 
 	if(retval == GCODE_OK)
 	{
-		while(f_gets(line, sizeof(line), &fil))
-		{	
+		// The log gets a line per move, less than the job itself
+		if(debugfil)
+			clmap_prepare(debugfil, f_size(fil));
+
+		// Read ahead paced by the motion queue, see jobstream.c
+		jobstream_open(fil);
+		progress_begin(name, f_size(fil));
+		planner_begin();
+		state = PROGRESS_RUNNING;
+		while(jobstream_gets(line, GCODE_LINE_MAX))
+		{
+			// Waits here while paused
+			if(!job_checkpoint())
+			{
+				state = PROGRESS_ABORTED;
+				break;
+			}
+
+			// Lines longer than the buffer come in pieces, the first piece
+			// is only usable when the cut falls inside a comment.
+			len = strlen(line);
+			if(skip)
+			{
+				skip = (len > 0) && (line[len-1] != '\n') && !jobstream_eof();
+				continue;
+			}
+			if((len > 0) && (line[len-1] != '\n') && !jobstream_eof())
+			{
+				skip = true;
+				if(!strchr(line, ';'))
+					continue;
+			}
+
 			// process the line!
-			_process_line(chp, (char *)&line, &parsedline);
+			gcode_stats.lines++;
+			progress_consumed(jobstream_tell(), gcode_stats.lines);
+			retval = gcode_line(line, parsedline);
+			if(retval == GCODE_UNSUPPORTED)
+				gcode_stats.unsupported++;
+			else if(retval != GCODE_OK && retval != GCODE_EMPTY)
+			{
+				gcode_stats.errors++;
+				CON_WARN("line %lu: error %d\r\n", gcode_stats.lines, retval);
+			}
+			if(retval != GCODE_OK || !parsedline->move)
+				continue;
+			gcode_stats.moves++;
+
 			// parsedline will contain move object.
-			chprintf(chp, "MOVE READY:\r\n");
-			chprintf(chp, "             X[%ld]\r\n", parsedline.x);
-			chprintf(chp, "             Y[%ld]\r\n", parsedline.y);
-			chprintf(chp, "             Z[%ld]\r\n", parsedline.z);
-			chprintf(chp, "             E[%ld]\r\n", parsedline.e);
-			chprintf(chp, "             F[%ld]\r\n", parsedline.f);
-
-			sprintf(&debugbuff, "%ld, %ld\n", parsedline.x, parsedline.y);
-			f_puts(&debugbuff, &debugfil);
+			if(!console_summary_mode())
+				CON_DBG("MOVE X[%ld] Y[%ld] Z[%ld] E[%ld] F[%ld]\r\n",
+					parsedline->x, parsedline->y, parsedline->z,
+					parsedline->e, parsedline->f);
+
+			planner_push(parsedline);
+
+			sprintf(debugbuff, "%ld, %ld\n", parsedline->x, parsedline->y);
+			if(debugfil)
+				f_puts(debugbuff, debugfil);
 		}
+		if(state == PROGRESS_ABORTED)
+			planner_abort();
+		else
+		{
+			planner_end();
+			state = job_aborted() ? PROGRESS_ABORTED : PROGRESS_DONE;
+		}
+		if(jobstream_close() != FR_OK && state == PROGRESS_DONE)
+		{
+			state = PROGRESS_FAILED;
+			CON_ERR("FS: reading the job file failed\r\n");
+		}
+		if(state == PROGRESS_ABORTED)
+			CON_WARN("job aborted at line %lu\r\n", gcode_stats.lines);
+		progress_end(state);
 	}
 
-	f_close(&debugfil);
+	filetab_close(debugfil);
+
+	console_summary(NULL);
+	_gcode_summary(chp);
 
 	retval = _close_job(chp);
+out:
+	move_free(parsedline);
+	sector_free(debugbuff);
+	sector_free(line);
+	return state;
+}
 
+/*
+ * Starts the test job and returns, status and job follow it.
+ */
+void cmd_gcodetest(BaseSequentialStream *chp, int argc, char *argv[])
+{
+	(void)argv;
+	if(argc > 0)
+	{
+		chprintf(chp, "Usage: gcodetest\r\n");
+		return;
+	}
+	if(!job_start(chp, "SIMPLE~1.GCO"))
+		chprintf(chp, "gcodetest: a job is running, see job\r\n");
 }
 
-_gcode_error_t _open_job(BaseSequentialStream *chp, char *filename)
+_gcode_error_t _open_job(BaseSequentialStream *chp, const char *filename)
 {
 	FRESULT fr;
-	// Mount the volume and open the specified file	
+	// The mount manager keeps the volume mounted, just open the file
 	chprintf(chp, "attempting to read job file\r\n");
 
-	palSetPad(GPIOD, GPIOD_LED6);
-	sdcConnect(&SDCD1);
-
-	/* Register work area to the default drive */
-	f_mount(&SDC_FS, "", 0);
-	
-	fr = f_open(&fil, filename, FA_READ);
+	fr = volume_mount();
 	if(fr != FR_OK) {
+		chprintf(chp, "FS: no card, or unmounted\r\n");
+		return GCODE_ERROR;
+	}
+
+	fil = filetab_open(filename, FA_READ, &fr);
+	if(fil == NULL) {
 		chprintf(chp, "FS: f_open() cannot open file %s\r\n", filename);
 		return GCODE_ERROR;
 	}
@@ -94,229 +216,170 @@ _gcode_error_t _close_job(BaseSequentialStream *chp)
 {
 	FRESULT err;
 
-	f_close(&fil);
-	
-	palClearPad(GPIOD, GPIOD_LED6);
-	sdcDisconnect(&SDCD1);
-	err = f_mount(0, "", 0);
+	// The volume stays mounted and warm for the next job
+	if(fil == NULL)
+		return GCODE_OK;
+	err = filetab_close(fil);
+	fil = NULL;
 	if(err != FR_OK) {
-		chprintf(chp, "FS: f_mount() unmount failed!\r\n");
+		chprintf(chp, "FS: closing the job file failed!\r\n");
 		verbose_error(chp, err);
 		return GCODE_ERROR;
 	}
 
-	f_close(&fil);
-
 	return GCODE_OK;
 }
 
-static _gcode_error_t _process_line(BaseSequentialStream *chp, char *line, _param_t *param)
-{
-	char *token, *ptr = NULL;
-	_cmd_data_t cmd_data[_MAX_ARGS];
-//	_param_t param;
-	int argc = 0;
-
-	memset(param, 0, sizeof(_param_t));
-
-//	chprintf(chp, "Processing line [%s]\r\n", line);
-//#define DEBUG_PROCESS_LINE
-
-	memset((char *) &cmd_data[0], 0, sizeof(cmd_data));
-
-	if((line[0] == 'G') || (line[0] == 'M'))
-	{
-		token = strtok_r(line, _WHITESPACE, &ptr);
-
-		cmd_data[argc].cmd_ltr = token[0];
-		cmd_data[argc].ival = strtol(token+1, NULL, 10);
+/*===========================================================================*/
+/* Job analysis.                                                             */
+/*===========================================================================*/
 
-		argc++;
-#ifdef DEBUG_PROCESS_LINE
-		chprintf(chp, "Line Start -> ");
-#endif
+static uint32_t an_buf[ANALYZE_CHUNK / sizeof(uint32_t)] DMA_DATA;
+static analyze_t an CCM_DATA;
 
-		while(token && (argc < _MAX_ARGS))
-		{
-			token = strtok_r(NULL, _WHITESPACE, &ptr);
-			
-			if(!token)
-				break;
+static void _analyze_line(char *line, _param_t *param, uint32_t *errors)
+{
+	int32_t pos[ANALYZE_AXES];
+	_gcode_error_t err;
+
+	err = gcode_line(line, param);
+	if(err != GCODE_OK && err != GCODE_EMPTY && err != GCODE_UNSUPPORTED)
+		(*errors)++;
+	pos[0] = param->x;
+	pos[1] = param->y;
+	pos[2] = param->z;
+	pos[3] = param->e;
+	if(err == GCODE_OK && param->move)
+		analyze_move(&an, pos, param->f > 0 ? param->f : PLANNER_DEFAULT_F);
+	else
+		analyze_set_position(&an, pos);
+}
 
-			cmd_data[argc].cmd_ltr = token[0];
+static void _print_hms(BaseSequentialStream *chp, uint64_t us)
+{
+	uint32_t s = (uint32_t)(us / 1000000);
 
+	chprintf(chp, "%luh%02lum%02lus", s / 3600, s / 60 % 60, s % 60);
+}
 
-			if(strchr(token+1, '.'))
-			{
-				cmd_data[argc].dval = strtod(token+1, NULL);
-				cmd_data[argc].is_float = true;
-#ifdef DEBUG_PROCESS_LINE
-//				chprintf(chp, "%c = %.06f ", cmd_data[argc].cmd_ltr, cmd_data[argc].dval);
-#endif
-			}
-			else
-			{
-				cmd_data[argc].ival = strtol(token+1, NULL, 10);
-#ifdef DEBUG_PROCESS_LINE
-//				chprintf(chp, "%c = %d ", cmd_data[argc].cmd_ltr, cmd_data[argc].ival);
-#endif
-			}
+/*
+ * Runs a job file through the parser and the kinematic model of
+ * analyze.c without moving anything. The file is read in whole sectors
+ * and each line is copied once, into the line buffer.
+ */
+void cmd_analyze(BaseSequentialStream *chp, int argc, char *argv[])
+{
+	analyze_limits_t lim;
+	_param_t *param = NULL;
+	char *line = NULL;
+	const char *p, *end;
+	uint32_t bytes = 0, lines = 0, errors = 0, len = 0, ms;
+	systime_t start;
+	bool skip = false;
+	FRESULT fr;
+	FIL *fp;
+	UINT br;
+	int i;
 
+	if(argc != 1)
+	{
+		chprintf(chp, "Usage: analyze <file>\r\n");
+		return;
+	}
+	if(volume_mount() != FR_OK)
+	{
+		chprintf(chp, "FS: no card, or unmounted\r\n");
+		return;
+	}
+	fp = filetab_open(argv[0], FA_READ, &fr);
+	if(fp == NULL)
+	{
+		chprintf(chp, "FS: f_open() cannot open file %s\r\n", argv[0]);
+		return;
+	}
+	line = sector_alloc();
+	param = move_alloc();
+	if(!line || !param)
+	{
+		chprintf(chp, "analyze: out of pool objects, see mem\r\n");
+		goto out;
+	}
+	memset(param, 0, sizeof(*param));
 
-			argc++;
-		}
-#ifdef DEBUG_PROCESS_LINE
-		chprintf(chp, "\r\n");
-#endif
+	for(i = 0; i < ANALYZE_AXES; i++)
+	{
+		lim.vmax[i] = (float)machine_axes[i].cfg.vmax;
+		lim.amax[i] = (float)machine_axes[i].cfg.amax;
+	}
+	lim.junction_dev = ANALYZE_JUNCTION;
+	analyze_init(&an, &lim);
 
-		if(argc >= _MAX_ARGS)
-		{
-			chprintf(chp, "MAX ARGS reached, dropping cmd: %s\r\n", line);
-			//result = GCODE_ERROR;
-		}
-		else
+	start = chVTGetSystemTimeX();
+	do
+	{
+		fr = f_read(fp, an_buf, sizeof(an_buf), &br);
+		if(fr != FR_OK)
+			break;
+		bytes += br;
+		for(p = (const char *)an_buf, end = p + br; p < end; p++)
 		{
-			switch(cmd_data[0].cmd_ltr)
+			if(*p != '\n')
 			{
-				case 'G':
-					switch(cmd_data[0].ival)
-					{
-						/* Move / Travel Move */
-						case 0:
-						case 1:
-							param->x = (double)-1;
-							param->y = (double)-1;
-							param->z = (double)-1;
-							param->e = (double)-1;
-							param->f = (double)-1;
-							_get_xyzef(chp, argc, cmd_data, param);
-
-
-							// Inherit feedrate and positions from last values if
-							// undefined.
-							
-							if(param->f == (double)-1)
-								param->f = _curr_feedrate;
-							else
-								_curr_feedrate = param->f;
-
-							if(param->x == (double)-1)
-								param->x = _curr_x;
-							else
-								_curr_x = param->x;
-
-							if(param->y == (double)-1)
-								param->y = _curr_y;
-							else
-								_curr_y = param->y;
-
-							if(param->z == (double)-1)
-								param->z = _curr_z;
-							else
-								_curr_z = param->z;
-
-							if(param->e == (double)-1)
-								param->e = _curr_e;
-							else
-								_curr_e = param->e;
-							break;
-						/* Home Axis */
-						case 28:
-							break;
-						/* Auto Level Build Platform */
-						case 29:
-							break;
-						/* Use absolute coordinates */
-						case 90:
-							break;
-						/* Use relative coordinates */
-						case 91:
-							break;
-						/* Set current position */
-						case 92:
-							break;
-						default:
-							break;
-						
-					}
-					break;
-				case 'M':
-					break;
-				default:
-					break;
+				/* overlong lines are only usable when cut in a comment */
+				if(len < GCODE_LINE_MAX - 1)
+					line[len++] = *p;
+				else
+					skip = true;
+				continue;
 			}
+			line[len] = 0;
+			if(!skip || strchr(line, ';'))
+				_analyze_line(line, param, &errors);
+			lines++;
+			len = 0;
+			skip = false;
 		}
-
-
-		return(GCODE_OK);
-	}
-	else
+	} while(br == sizeof(an_buf));
+	if(len > 0 && fr == FR_OK)
 	{
-
-		chprintf(chp, "UNSUPPORTED cmd: %d\r\n", line);		
-
+		line[len] = 0;
+		if(!skip || strchr(line, ';'))
+			_analyze_line(line, param, &errors);
+		lines++;
 	}
-	return(GCODE_OK);
-}
+	analyze_finish(&an);
+	ms = ST2MS(chVTGetSystemTimeX() - start);
 
-static _gcode_error_t _get_xyzef(BaseSequentialStream *chp, int argc, _cmd_data_t *cmd_data, _param_t *param)
-{
-	int i;
-
-	for(i = 1; i < argc; i++)
+	if(fr != FR_OK)
 	{
-		switch(cmd_data[i].cmd_ltr)
-		{
-			case 'X':
-				if(!param->rel_pos)
-					param->x = 0;
-
-				if(cmd_data[i].is_float)
-					param->x += GCODE_UNITS(cmd_data[i].dval);
-				else
-					param->x += GCODE_UNITS(cmd_data[i].ival);
-				break;
-			case 'Y':
-				if(!param->rel_pos)
-					param->y = 0;
-
-				if(cmd_data[i].is_float)
-					param->y += GCODE_UNITS(cmd_data[i].dval);
-				else
-					param->y += GCODE_UNITS(cmd_data[i].ival);
-				break;
-			case 'Z':
-				if(!param->rel_pos)
-					param->z = 0;
-				
-				if(cmd_data[i].is_float)
-					param->z += GCODE_UNITS(cmd_data[i].dval);
-				else
-					param->z += GCODE_UNITS(cmd_data[i].ival);
-				break;
-			case 'E':
-				if(!param->rel_pos)
-					param->e = 0;
-
-				if(cmd_data[i].is_float)
-					param->e += GCODE_UNITS(cmd_data[i].dval);
-				else
-					param->e += GCODE_UNITS(cmd_data[i].ival);
-				break;
-			case 'F':
-				if(cmd_data[i].is_float)
-					param->f = GCODE_UNITS(cmd_data[i].dval);
-				else
-					param->f = GCODE_UNITS(cmd_data[i].ival);
-				break;
-			case 'S':
-				if(cmd_data[i].is_float)
-					param->target_temp[0] = FXPT(cmd_data[1].dval, 1);
-				else
-					param->target_temp[0] = FXPT(cmd_data[1].ival, 1);
-			default:
-				break;
-		}
+		chprintf(chp, "FS: reading %s failed\r\n", argv[0]);
+		verbose_error(chp, fr);
+		goto out;
 	}
-	return(GCODE_OK);
+	chprintf(chp, "%lu bytes, %lu lines, %lu moves, %lu errors in %lu ms (%lu KB/s)\r\n",
+		bytes, lines, an.moves, errors, ms, ms ? bytes / ms : 0);
+	chprintf(chp, "time ");
+	_print_hms(chp, an.us);
+	chprintf(chp, " with acceleration, ");
+	_print_hms(chp, an.us_nominal);
+	chprintf(chp, " at the programmed feedrates\r\n");
+	if(an.part)
+		chprintf(chp, "part X %.2f..%.2f Y %.2f..%.2f Z %.2f..%.2f mm, %lu layers\r\n",
+			(double)an.part_min[0] / GCODE_UOM, (double)an.part_max[0] / GCODE_UOM,
+			(double)an.part_min[1] / GCODE_UOM, (double)an.part_max[1] / GCODE_UOM,
+			(double)an.part_min[2] / GCODE_UOM, (double)an.part_max[2] / GCODE_UOM,
+			an.layers);
+	if(an.extents)
+		chprintf(chp, "head X %.2f..%.2f Y %.2f..%.2f Z %.2f..%.2f mm\r\n",
+			(double)an.min[0] / GCODE_UOM, (double)an.max[0] / GCODE_UOM,
+			(double)an.min[1] / GCODE_UOM, (double)an.max[1] / GCODE_UOM,
+			(double)an.min[2] / GCODE_UOM, (double)an.max[2] / GCODE_UOM);
+	chprintf(chp, "filament %.1f mm, retracted %.1f mm\r\n",
+		(double)an.extruded / GCODE_UOM, (double)an.retracted / GCODE_UOM);
+	chprintf(chp, "max feedrate %ld mm/min, %.1f mm/s after the axis limits\r\n",
+		an.max_f / GCODE_UOM, (double)an.max_v / GCODE_UOM);
+out:
+	move_free(param);
+	sector_free(line);
+	filetab_close(fp);
 }
@@ -0,0 +1,272 @@
+/*
+ * ioq.c
+ *
+ *  Card request queue. Dispatch order:
+ *
+ *  - a request past its deadline, the earliest deadline first, so log
+ *    writes are delayed but never starved,
+ *  - else the oldest request of the lowest class, job reads overtake
+ *    queued writes,
+ *  - but never ahead of an older request it overlaps where either one
+ *    writes, that one is moved up instead.
+ *
+ *  A write collects queued writes of the sectors before and after it into
+ *  one multi block command of up to IOQ_BURST sectors.
+ *
+ *  Not thread safe and no kernel calls, the caller locks around everything
+ *  but ioq_run(), which only touches the requests of the batch.
+ */
+
+/*===========================================================================*/
+/* Request queue.                                                            */
+/*===========================================================================*/
+#include <string.h>
+
+#include "ioq.h"
+
+#define AFTER(a, b)     ((int32_t)((a) - (b)) > 0)
+
+static bool _overlap(const ioq_req_t *a, const ioq_req_t *b)
+{
+	return a->sector < b->sector + b->count && b->sector < a->sector + a->count;
+}
+
+/*
+ * The oldest queued request rp has to wait for, NULL if none.
+ */
+static ioq_req_t *_blocker(ioq_t *q, ioq_req_t *rp)
+{
+	ioq_req_t *bp;
+
+	for(bp = q->head; bp != NULL && bp != rp; bp = bp->next)
+		if((bp->op == IOQ_WRITE || rp->op == IOQ_WRITE) && _overlap(bp, rp))
+			return bp;
+	return NULL;
+}
+
+static void _unlink(ioq_t *q, ioq_req_t *rp)
+{
+	ioq_req_t **pp;
+
+	for(pp = &q->head; *pp != rp; pp = &(*pp)->next)
+		;
+	*pp = rp->next;
+	rp->next = NULL;
+}
+
+static void _dispatch(ioq_t *q, ioq_req_t *rp, uint32_t now)
+{
+	ioq_class_stats_t *sp = &q->stats.cls[rp->cls];
+	uint32_t wait = now - rp->queued;
+
+	_unlink(q, rp);
+	rp->state = IOQ_ACTIVE;
+	sp->dispatched++;
+	sp->wait_total += wait;
+	if(wait > sp->wait_max)
+		sp->wait_max = wait;
+	if(AFTER(now, rp->deadline))
+		sp->late++;
+}
+
+/*
+ * A queued write that continues the batch at either end, NULL if none.
+ */
+static ioq_req_t *_neighbour(ioq_t *q)
+{
+	ioq_req_t *rp;
+
+	for(rp = q->head; rp != NULL; rp = rp->next)
+	{
+		if(rp->op != IOQ_WRITE || q->bcount + rp->count > IOQ_BURST)
+			continue;
+		if(rp->sector != q->bsector + q->bcount &&
+			rp->sector + rp->count != q->bsector)
+			continue;
+		if(_blocker(q, rp) == NULL)
+			return rp;
+	}
+	return NULL;
+}
+
+static void _coalesce(ioq_t *q, uint32_t now)
+{
+	ioq_req_t *rp;
+
+	while(q->nbatch < IOQ_BURST && (rp = _neighbour(q)) != NULL)
+	{
+		_dispatch(q, rp, now);
+		if(rp->sector < q->bsector)
+		{
+			memmove(&q->batch[1], &q->batch[0], q->nbatch * sizeof(q->batch[0]));
+			q->batch[0] = rp;
+			q->bsector = rp->sector;
+		}
+		else
+		{
+			q->batch[q->nbatch] = rp;
+		}
+		q->nbatch++;
+		q->bcount += rp->count;
+		q->stats.merged++;
+	}
+	if(q->nbatch > 1)
+		q->stats.coalesced++;
+}
+
+void ioq_init(ioq_t *q, const ioq_dev_t *dev, const uint32_t *deadline,
+	uint8_t *staging)
+{
+	memset(q, 0, sizeof(*q));
+	q->dev = dev;
+	q->deadline = deadline;
+	q->staging = staging;
+}
+
+void ioq_submit(ioq_t *q, ioq_req_t *rp, uint32_t now)
+{
+	ioq_req_t **pp;
+
+	if(rp->cls >= IOQ_NCLASSES)
+		rp->cls = IOQ_CLASS_FS;
+	if(rp->op == IOQ_WRITE && rp->cls < IOQ_CLASS_WRITE)
+		rp->cls = IOQ_CLASS_WRITE;
+	rp->next = NULL;
+	rp->seq = ++q->seq;
+	rp->queued = now;
+	rp->deadline = now + q->deadline[rp->cls];
+	rp->state = IOQ_QUEUED;
+	rp->err = false;
+	for(pp = &q->head; *pp != NULL; pp = &(*pp)->next)
+		;
+	*pp = rp;
+
+	q->stats.cls[rp->cls].submitted++;
+	if(++q->stats.depth > q->stats.depth_max)
+		q->stats.depth_max = q->stats.depth;
+}
+
+/*
+ * A queued write of just this sector whose buffer the queue owns, the
+ * caller may give it newer data instead of queueing another one.
+ */
+ioq_req_t *ioq_find_write(ioq_t *q, uint32_t sector)
+{
+	ioq_req_t *rp;
+
+	for(rp = q->head; rp != NULL; rp = rp->next)
+		if(rp->op == IOQ_WRITE && (rp->flags & IOQ_F_ASYNC) &&
+			rp->sector == sector && rp->count == 1)
+			return rp;
+	return NULL;
+}
+
+/*
+ * Takes the next command off the queue into the batch, returns the number
+ * of requests in it, 0 when the queue is empty.
+ */
+uint32_t ioq_next(ioq_t *q, uint32_t now)
+{
+	ioq_req_t *rp, *pick = NULL, *late = NULL, *bp;
+
+	if(q->head == NULL)
+		return 0;
+	for(rp = q->head; rp != NULL; rp = rp->next)
+	{
+		if(AFTER(now, rp->deadline))
+		{
+			if(late == NULL || AFTER(late->deadline, rp->deadline))
+				late = rp;
+		}
+		else if(pick == NULL || rp->cls < pick->cls)
+		{
+			pick = rp;
+		}
+	}
+	if(late != NULL)
+		pick = late;
+	while((bp = _blocker(q, pick)) != NULL)
+	{
+		pick = bp;
+		q->stats.ordered++;
+	}
+	if(pick->op == IOQ_READ)
+	{
+		for(rp = q->head; rp != pick; rp = rp->next)
+		{
+			if(rp->op == IOQ_WRITE)
+			{
+				q->stats.preempted++;
+				break;
+			}
+		}
+	}
+
+	_dispatch(q, pick, now);
+	q->batch[0] = pick;
+	q->nbatch = 1;
+	q->bsector = pick->sector;
+	q->bcount = pick->count;
+	if(pick->op == IOQ_WRITE)
+		_coalesce(q, now);
+	q->stats.commands++;
+	return q->nbatch;
+}
+
+/*
+ * Runs the batch on the device, without the lock. The requests are off
+ * the queue and nobody else touches them until ioq_complete().
+ */
+bool ioq_run(ioq_t *q)
+{
+	ioq_req_t *rp = q->batch[0];
+	uint32_t i;
+
+	if(rp->op == IOQ_READ)
+		return q->dev->read(rp->sector, rp->buf, rp->count);
+	if(q->nbatch == 1)
+		return q->dev->write(rp->sector, rp->buf, rp->count);
+	for(i = 0; i < q->nbatch; i++)
+	{
+		rp = q->batch[i];
+		memcpy(q->staging + (rp->sector - q->bsector) * IOQ_SECTOR_SIZE,
+			rp->buf, rp->count * IOQ_SECTOR_SIZE);
+	}
+	return q->dev->write(q->bsector, q->staging, q->bcount);
+}
+
+void ioq_complete(ioq_t *q, bool err)
+{
+	uint32_t i;
+
+	for(i = 0; i < q->nbatch; i++)
+	{
+		q->batch[i]->err = err;
+		q->batch[i]->state = IOQ_DONE;
+	}
+	q->stats.depth -= q->nbatch;
+	q->nbatch = 0;
+}
+
+/*
+ * Fails every queued request without running it, for a device that has
+ * gone away. The batch, if any, is left to ioq_complete(). Returns the
+ * number of requests failed.
+ */
+uint32_t ioq_cancel(ioq_t *q)
+{
+	ioq_req_t *rp;
+	uint32_t n = 0;
+
+	while((rp = q->head) != NULL)
+	{
+		q->head = rp->next;
+		rp->next = NULL;
+		rp->err = true;
+		rp->state = IOQ_DONE;
+		n++;
+	}
+	q->stats.depth -= n;
+	q->stats.cancelled += n;
+	return n;
+}
@@ -0,0 +1,115 @@
+/*
+ * ioq.h
+ *
+ *  Card request queue with priority classes, deadlines and write
+ *  coalescing. Plain C without the kernel, iosched.c runs it against the
+ *  card and a simulated device can run it on a PC.
+ */
+
+#ifndef IOQ_H_
+#define IOQ_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define IOQ_SECTOR_SIZE     512
+#define IOQ_BURST           8       /* sectors in one coalesced write */
+
+/*
+ * Lower classes go first. A thread picks its class, see iosched_set_class(),
+ * writes are never above IOQ_CLASS_WRITE.
+ */
+typedef enum
+{
+	IOQ_CLASS_JOB = 0,          /* job file reads */
+	IOQ_CLASS_FS,               /* everything else, the default */
+	IOQ_CLASS_WRITE,            /* log and checkpoint writes */
+	IOQ_CLASS_BG,               /* background scans */
+	IOQ_NCLASSES
+} ioq_class_t;
+
+typedef enum
+{
+	IOQ_READ = 0,
+	IOQ_WRITE
+} ioq_op_t;
+
+typedef enum
+{
+	IOQ_IDLE = 0,
+	IOQ_QUEUED,
+	IOQ_ACTIVE,
+	IOQ_DONE
+} ioq_state_t;
+
+#define IOQ_F_ASYNC         0x01    /* nobody waits, the queue owns buf */
+
+typedef struct ioq_req
+{
+	struct ioq_req *next;
+	uint32_t sector;
+	uint32_t count;
+	uint8_t *buf;
+	uint32_t seq;
+	uint32_t queued;            /* time of submission */
+	uint32_t deadline;
+	uint8_t op;
+	uint8_t cls;
+	uint8_t flags;
+	uint8_t state;
+	bool err;
+} ioq_req_t;
+
+typedef struct
+{
+	bool (*read)(uint32_t sector, uint8_t *buf, uint32_t count);
+	bool (*write)(uint32_t sector, const uint8_t *buf, uint32_t count);
+} ioq_dev_t;
+
+typedef struct
+{
+	uint32_t submitted;
+	uint32_t dispatched;
+	uint32_t wait_total;        /* submission to dispatch */
+	uint32_t wait_max;
+	uint32_t late;              /* dispatched after the deadline */
+} ioq_class_stats_t;
+
+typedef struct
+{
+	ioq_class_stats_t cls[IOQ_NCLASSES];
+	uint32_t depth;
+	uint32_t depth_max;
+	uint32_t commands;
+	uint32_t coalesced;         /* write commands made of several requests */
+	uint32_t merged;            /* requests that rode along in one */
+	uint32_t overwritten;       /* queued writes given newer data */
+	uint32_t preempted;         /* reads dispatched ahead of older writes */
+	uint32_t ordered;           /* older overlapping requests moved up */
+	uint32_t cancelled;         /* failed without reaching the device */
+} ioq_stats_t;
+
+typedef struct
+{
+	const ioq_dev_t *dev;
+	const uint32_t *deadline;   /* per class, in the unit of now */
+	uint8_t *staging;           /* IOQ_BURST sectors for coalesced writes */
+	ioq_req_t *head;            /* queued, oldest first */
+	ioq_req_t *batch[IOQ_BURST];
+	uint32_t nbatch;
+	uint32_t bsector;
+	uint32_t bcount;
+	uint32_t seq;
+	ioq_stats_t stats;
+} ioq_t;
+
+void ioq_init(ioq_t *q, const ioq_dev_t *dev, const uint32_t *deadline,
+	uint8_t *staging);
+void ioq_submit(ioq_t *q, ioq_req_t *rp, uint32_t now);
+ioq_req_t *ioq_find_write(ioq_t *q, uint32_t sector);
+uint32_t ioq_next(ioq_t *q, uint32_t now);
+bool ioq_run(ioq_t *q);
+void ioq_complete(ioq_t *q, bool err);
+uint32_t ioq_cancel(ioq_t *q);
+
+#endif /* IOQ_H_ */
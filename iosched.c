@@ -0,0 +1,383 @@
+/*
+ * iosched.c
+ *
+ *  Card I/O scheduler. Every transfer of the sector cache is a request on
+ *  the queue of ioq.c and a worker thread runs them, so a job read does not
+ *  sit behind a burst of log write-backs for up to the 250 ms a card may
+ *  take per write.
+ *
+ *  Reads and direct writes wait for their request. Write-back of single
+ *  cached sectors is queued from a slot that takes a copy of the data, the
+ *  cache line is free at once and iosched_flush() waits for the card. A
+ *  write-behind that fails is kept on its slot until the thread that
+ *  queued it asks with iosched_write_failed(), and the next flush reports
+ *  it as well.
+ *
+ *  Each thread carries its class in io_class, see chconf.h.
+ */
+
+/*===========================================================================*/
+/* I/O scheduler.                                                            */
+/*===========================================================================*/
+#include <string.h>
+
+#include "ch.h"
+#include "hal.h"
+
+#include "chprintf.h"
+
+#include "iosched.h"
+#include "sddev.h"
+#include "memmap.h"
+
+#define SECTOR_WORDS    (IOQ_SECTOR_SIZE / sizeof(uint32_t))
+
+static const ioq_dev_t ios_dev = {sddev_read, sddev_write};
+static uint32_t ios_deadline[IOQ_NCLASSES] CCM_DATA;
+
+static ioq_t ios_q CCM_DATA;
+static ioq_req_t slot_req[IOSCHED_SLOTS] CCM_DATA;
+static uint32_t slot_buf[IOSCHED_SLOTS][SECTOR_WORDS] DMA_DATA;
+static uint32_t ios_staging[IOQ_BURST][SECTOR_WORDS] DMA_DATA;
+
+static MUTEX_DECL(ios_mtx);
+static CONDVAR_DECL(ios_work);
+static CONDVAR_DECL(ios_done);
+static bool ios_paused CCM_DATA;
+static bool ios_busy CCM_DATA;
+static bool ios_write_err CCM_DATA;     /* a failure nobody flushed was lost */
+static uint32_t ios_failed CCM_DATA;    /* slots with a failure to report */
+
+/* failures of a slot not reported yet, to its thread and to a flush */
+#define SLOT_ERR_OWNER  0x01
+#define SLOT_ERR_FLUSH  0x02
+
+static thread_t *slot_owner[IOSCHED_SLOTS] CCM_DATA;    /* compared only */
+static uint8_t slot_err[IOSCHED_SLOTS] CCM_DATA;
+
+static const char * const class_names[IOQ_NCLASSES] = {"job", "fs", "write", "bg"};
+
+static CCM_DATA THD_WORKING_AREA(waIosched, 768);
+static THD_FUNCTION(iosched_thread, arg)
+{
+	ioq_req_t *rp;
+	uint32_t i;
+	bool err;
+
+	(void)arg;
+	chRegSetThreadName("iosched");
+	chMtxLock(&ios_mtx);
+	while(true)
+	{
+		while(ios_paused || !ioq_next(&ios_q, chVTGetSystemTimeX()))
+			chCondWait(&ios_work);
+		ios_busy = true;
+		chMtxUnlock(&ios_mtx);
+
+		err = ioq_run(&ios_q);
+
+		chMtxLock(&ios_mtx);
+		for(i = 0; i < ios_q.nbatch && err; i++)
+		{
+			rp = ios_q.batch[i];
+			if(rp->flags & IOQ_F_ASYNC)
+			{
+				slot_err[rp - slot_req] = SLOT_ERR_OWNER | SLOT_ERR_FLUSH;
+				ios_failed++;
+			}
+		}
+		ioq_complete(&ios_q, err);
+		ios_busy = false;
+		chCondBroadcast(&ios_done);
+	}
+}
+
+/*
+ * Queues rp and waits for it, with ios_mtx held.
+ */
+static bool _submit_wait(ioq_req_t *rp)
+{
+	ioq_submit(&ios_q, rp, chVTGetSystemTimeX());
+	chCondSignal(&ios_work);
+	while(rp->state != IOQ_DONE)
+		chCondWait(&ios_done);
+	return rp->err;
+}
+
+static bool _transfer(ioq_op_t op, uint32_t sector, uint8_t *buf, uint32_t count)
+{
+	ioq_req_t req;
+	bool err;
+
+	memset(&req, 0, sizeof(req));
+	req.op = op;
+	req.cls = chThdGetSelfX()->io_class;
+	req.sector = sector;
+	req.count = count;
+	req.buf = buf;
+	chMtxLock(&ios_mtx);
+	err = _submit_wait(&req);
+	chMtxUnlock(&ios_mtx);
+	return err;
+}
+
+static void _clear_err(uint32_t i, uint8_t bits)
+{
+	if(slot_err[i] && !(slot_err[i] &= ~bits))
+		ios_failed--;
+}
+
+/*
+ * A slot whose failure was reported is free, one that still has a failure
+ * to report is taken only when there is nothing else. What a flush did not
+ * see yet goes to the next flush then, its thread is not told.
+ */
+static ioq_req_t *_free_slot(void)
+{
+	uint32_t i;
+	int failed = -1;
+
+	for(i = 0; i < IOSCHED_SLOTS; i++)
+	{
+		if(slot_req[i].state != IOQ_IDLE && slot_req[i].state != IOQ_DONE)
+			continue;
+		if(!slot_err[i])
+			return &slot_req[i];
+		if(failed < 0)
+			failed = i;
+	}
+	if(failed < 0)
+		return NULL;
+	if(slot_err[failed] & SLOT_ERR_FLUSH)
+		ios_write_err = true;
+	_clear_err(failed, SLOT_ERR_OWNER | SLOT_ERR_FLUSH);
+	return &slot_req[failed];
+}
+
+void iosched_init(void)
+{
+	uint32_t i;
+
+	ios_deadline[IOQ_CLASS_JOB] = MS2ST(IOSCHED_JOB_MS);
+	ios_deadline[IOQ_CLASS_FS] = MS2ST(IOSCHED_FS_MS);
+	ios_deadline[IOQ_CLASS_WRITE] = MS2ST(IOSCHED_WRITE_MS);
+	ios_deadline[IOQ_CLASS_BG] = MS2ST(IOSCHED_BG_MS);
+	ioq_init(&ios_q, &ios_dev, ios_deadline, (uint8_t *)ios_staging);
+	memset(slot_req, 0, sizeof(slot_req));
+	memset(slot_owner, 0, sizeof(slot_owner));
+	memset(slot_err, 0, sizeof(slot_err));
+	for(i = 0; i < IOSCHED_SLOTS; i++)
+	{
+		slot_req[i].buf = (uint8_t *)slot_buf[i];
+		slot_req[i].flags = IOQ_F_ASYNC;
+	}
+	ios_paused = false;
+	ios_busy = false;
+	ios_write_err = false;
+	ios_failed = 0;
+	chThdCreateStatic(waIosched, sizeof(waIosched), NORMALPRIO + 2,
+		iosched_thread, NULL);
+}
+
+/*
+ * Sets the class of the calling thread's requests, returns the old one.
+ */
+ioq_class_t iosched_set_class(ioq_class_t cls)
+{
+	thread_t *tp = chThdGetSelfX();
+	ioq_class_t old = (ioq_class_t)tp->io_class;
+
+	tp->io_class = cls;
+	return old;
+}
+
+/*
+ * Buffers must be DMA safe, see memmap.h.
+ */
+bool iosched_read(uint32_t sector, uint8_t *buf, uint32_t count)
+{
+	return _transfer(IOQ_READ, sector, buf, count);
+}
+
+bool iosched_write(uint32_t sector, const uint8_t *buf, uint32_t count)
+{
+	return _transfer(IOQ_WRITE, sector, (uint8_t *)buf, count);
+}
+
+/*
+ * Queues a copy of one sector and returns. A queued write of the same
+ * sector just takes the new data, and becomes the caller's. Waits for a
+ * slot when all are queued.
+ */
+void iosched_write_behind(uint32_t sector, const uint8_t *buf)
+{
+	ioq_req_t *rp;
+
+	chMtxLock(&ios_mtx);
+	if((rp = ioq_find_write(&ios_q, sector)) != NULL)
+	{
+		memcpy(rp->buf, buf, IOQ_SECTOR_SIZE);
+		slot_owner[rp - slot_req] = chThdGetSelfX();
+		ios_q.stats.overwritten++;
+		chMtxUnlock(&ios_mtx);
+		return;
+	}
+	while((rp = _free_slot()) == NULL)
+		chCondWait(&ios_done);
+	memcpy(rp->buf, buf, IOQ_SECTOR_SIZE);
+	rp->op = IOQ_WRITE;
+	rp->cls = chThdGetSelfX()->io_class;
+	rp->sector = sector;
+	rp->count = 1;
+	slot_owner[rp - slot_req] = chThdGetSelfX();
+	ioq_submit(&ios_q, rp, chVTGetSystemTimeX());
+	chCondSignal(&ios_work);
+	chMtxUnlock(&ios_mtx);
+}
+
+/*
+ * Reports and clears the failure of write-behind the calling thread
+ * queued, the write itself returned long ago. Cheap while nothing failed.
+ */
+bool iosched_write_failed(void)
+{
+	thread_t *self = chThdGetSelfX();
+	uint32_t i;
+	bool err = false;
+
+	if(ios_failed == 0)
+		return false;
+	chMtxLock(&ios_mtx);
+	for(i = 0; i < IOSCHED_SLOTS; i++)
+	{
+		if((slot_err[i] & SLOT_ERR_OWNER) && slot_owner[i] == self)
+		{
+			_clear_err(i, SLOT_ERR_OWNER);
+			err = true;
+		}
+	}
+	chMtxUnlock(&ios_mtx);
+	return err;
+}
+
+/*
+ * Waits until the write-behind queued so far is on the card. Reports a
+ * failure of any write-behind no flush reported yet, whoever queued it.
+ */
+bool iosched_flush(void)
+{
+	uint32_t i, ticket;
+	bool pending, err;
+
+	chMtxLock(&ios_mtx);
+	ticket = ios_q.seq;
+	do
+	{
+		pending = false;
+		for(i = 0; i < IOSCHED_SLOTS && !pending; i++)
+			pending = (slot_req[i].state == IOQ_QUEUED ||
+				slot_req[i].state == IOQ_ACTIVE) &&
+				(int32_t)(slot_req[i].seq - ticket) <= 0;
+		if(pending)
+			chCondWait(&ios_done);
+	} while(pending);
+	err = ios_write_err;
+	ios_write_err = false;
+	for(i = 0; i < IOSCHED_SLOTS; i++)
+	{
+		if(slot_err[i] & SLOT_ERR_FLUSH)
+		{
+			_clear_err(i, SLOT_ERR_FLUSH);
+			err = true;
+		}
+	}
+	chMtxUnlock(&ios_mtx);
+	return err;
+}
+
+/*
+ * Stops dispatching once the running command is done, for commands to
+ * the card outside the data path.
+ */
+void iosched_pause(void)
+{
+	chMtxLock(&ios_mtx);
+	ios_paused = true;
+	while(ios_busy)
+		chCondWait(&ios_done);
+	chMtxUnlock(&ios_mtx);
+}
+
+void iosched_resume(void)
+{
+	chMtxLock(&ios_mtx);
+	ios_paused = false;
+	chCondSignal(&ios_work);
+	chMtxUnlock(&ios_mtx);
+}
+
+/*
+ * Fails everything queued, for a card that is gone, call it paused.
+ * Waiting readers and writers get an error, queued write-behind is dropped
+ * without a report, there is nothing left to write it to.
+ */
+uint32_t iosched_cancel(void)
+{
+	uint32_t n;
+
+	chMtxLock(&ios_mtx);
+	n = ioq_cancel(&ios_q);
+	chCondBroadcast(&ios_done);
+	chMtxUnlock(&ios_mtx);
+	return n;
+}
+
+/*===========================================================================*/
+/* Shell command.                                                            */
+/*===========================================================================*/
+
+void cmd_iosched(BaseSequentialStream *chp, int argc, char *argv[])
+{
+	ioq_stats_t st;
+	uint32_t i, used = 0;
+	ioq_class_stats_t *cp;
+
+	if(argc == 1 && !strcmp(argv[0], "reset"))
+	{
+		chMtxLock(&ios_mtx);
+		i = ios_q.stats.depth;
+		memset(&ios_q.stats, 0, sizeof(ios_q.stats));
+		ios_q.stats.depth = i;
+		chMtxUnlock(&ios_mtx);
+		return;
+	}
+	if(argc > 0)
+	{
+		chprintf(chp, "Usage: iosched [reset]\r\n");
+		return;
+	}
+
+	chMtxLock(&ios_mtx);
+	st = ios_q.stats;
+	for(i = 0; i < IOSCHED_SLOTS; i++)
+		if(slot_req[i].state == IOQ_QUEUED || slot_req[i].state == IOQ_ACTIVE)
+			used++;
+	chMtxUnlock(&ios_mtx);
+
+	chprintf(chp, "class  deadline  requests  avg wait  max wait  late\r\n");
+	for(i = 0; i < IOQ_NCLASSES; i++)
+	{
+		cp = &st.cls[i];
+		chprintf(chp, "%-5s  %5lu ms  %8lu  %5lu ms  %5lu ms  %4lu\r\n",
+			class_names[i], ST2MS(ios_deadline[i]), cp->dispatched,
+			cp->dispatched ? ST2MS(cp->wait_total / cp->dispatched) : 0,
+			ST2MS(cp->wait_max), cp->late);
+	}
+	chprintf(chp, "queue depth %lu, max %lu, write-behind slots %lu/%u\r\n",
+		st.depth, st.depth_max, used, IOSCHED_SLOTS);
+	chprintf(chp, "commands %lu, coalesced %lu (%lu requests merged), "
+		"overwritten %lu\r\n", st.commands, st.coalesced, st.merged,
+		st.overwritten);
+	chprintf(chp, "reads ahead of writes %lu, reordered for overlap %lu, "
+		"cancelled %lu\r\n", st.preempted, st.ordered, st.cancelled);
+}
@@ -0,0 +1,32 @@
+/*
+ * iosched.h
+ *
+ *  Card I/O scheduler, runs the request queue of ioq.c on its own thread.
+ */
+
+#ifndef IOSCHED_H_
+#define IOSCHED_H_
+
+#include "ioq.h"
+
+#define IOSCHED_SLOTS       16      /* sectors of queued write-behind */
+
+/* deadlines per class */
+#define IOSCHED_JOB_MS      20
+#define IOSCHED_FS_MS       100
+#define IOSCHED_WRITE_MS    500
+#define IOSCHED_BG_MS       2000
+
+void iosched_init(void);
+ioq_class_t iosched_set_class(ioq_class_t cls);
+bool iosched_read(uint32_t sector, uint8_t *buf, uint32_t count);
+bool iosched_write(uint32_t sector, const uint8_t *buf, uint32_t count);
+void iosched_write_behind(uint32_t sector, const uint8_t *buf);
+bool iosched_write_failed(void);
+bool iosched_flush(void);
+void iosched_pause(void);
+void iosched_resume(void);
+uint32_t iosched_cancel(void);
+void cmd_iosched(BaseSequentialStream *chp, int argc, char *argv[]);
+
+#endif /* IOSCHED_H_ */
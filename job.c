@@ -0,0 +1,209 @@
+/*
+ * job.c
+ *
+ *  Jobs run on their own thread so the shell stays usable while one runs.
+ *  The thread sits above the shell, so status, mem and threads get the CPU
+ *  only when the job waits for the card or the planner, which it does most
+ *  of the time, and never take it from the job.
+ *
+ *  The job thread calls job_checkpoint() once per line. Pausing holds the
+ *  planner after the block it is on, the job thread then stops on the full
+ *  queue or at its next line. Aborting drops the queued blocks and makes
+ *  the next checkpoint fail, the job thread closes the file and ends the
+ *  job. The checkpoint only takes the lock while the job is paused or
+ *  aborted.
+ */
+
+/*===========================================================================*/
+/* Job thread.                                                               */
+/*===========================================================================*/
+#include <string.h>
+
+#include "ch.h"
+#include "hal.h"
+
+#include "chprintf.h"
+
+#include "job.h"
+#include "gcode_parser.h"
+#include "planner.h"
+#include "progress.h"
+#include "memmap.h"
+
+/* zeroed at startup, the job starts idle */
+static volatile job_state_t job_st;
+static volatile bool job_abort_req;
+static BaseSequentialStream *job_chp;
+static char job_name[PROGRESS_NAME_MAX];
+
+static MUTEX_DECL(job_mtx);
+static CONDVAR_DECL(job_cv);
+
+static CCM_DATA THD_WORKING_AREA(waJob, 1536);
+static THD_FUNCTION(job_thread, arg)
+{
+	(void)arg;
+	chRegSetThreadName("job");
+	while(true)
+	{
+		chMtxLock(&job_mtx);
+		while(job_st == JOB_IDLE)
+			chCondWait(&job_cv);
+		chMtxUnlock(&job_mtx);
+
+		gcode_run(job_chp, job_name);
+
+		chMtxLock(&job_mtx);
+		job_st = JOB_IDLE;
+		job_abort_req = false;
+		chMtxUnlock(&job_mtx);
+	}
+}
+
+void job_init(void)
+{
+	chThdCreateStatic(waJob, sizeof(waJob), JOB_PRIO, job_thread, NULL);
+}
+
+/*
+ * Hands the job to the thread, false when one is running. Output that is
+ * not job output, like a file that cannot be opened, goes to chp.
+ */
+bool job_start(BaseSequentialStream *chp, const char *name)
+{
+	bool ok;
+
+	chMtxLock(&job_mtx);
+	ok = job_st == JOB_IDLE;
+	if(ok)
+	{
+		strncpy(job_name, name, sizeof(job_name) - 1);
+		job_chp = chp;
+		job_abort_req = false;
+		progress_hold_reset();
+		job_st = JOB_RUNNING;
+		chCondSignal(&job_cv);
+	}
+	chMtxUnlock(&job_mtx);
+	return ok;
+}
+
+bool job_pause(void)
+{
+	bool ok;
+
+	chMtxLock(&job_mtx);
+	ok = job_st == JOB_RUNNING && !job_abort_req;
+	if(ok)
+	{
+		job_st = JOB_PAUSED;
+		planner_hold(true);
+		progress_hold(true);
+	}
+	chMtxUnlock(&job_mtx);
+	return ok;
+}
+
+bool job_resume(void)
+{
+	bool ok;
+
+	chMtxLock(&job_mtx);
+	ok = job_st == JOB_PAUSED;
+	if(ok)
+	{
+		job_st = JOB_RUNNING;
+		progress_hold(false);
+		planner_hold(false);
+		chCondBroadcast(&job_cv);
+	}
+	chMtxUnlock(&job_mtx);
+	return ok;
+}
+
+/*
+ * The job ends at its next line or as soon as a push waiting for space
+ * gets it, the blocks already queued are dropped.
+ */
+bool job_abort(void)
+{
+	bool ok;
+
+	chMtxLock(&job_mtx);
+	ok = job_st != JOB_IDLE && !job_abort_req;
+	if(ok)
+	{
+		job_abort_req = true;
+		if(job_st == JOB_PAUSED)
+		{
+			job_st = JOB_RUNNING;
+			progress_hold(false);
+			planner_hold(false);
+		}
+		planner_flush();
+		chCondBroadcast(&job_cv);
+	}
+	chMtxUnlock(&job_mtx);
+	return ok;
+}
+
+job_state_t job_state(void)
+{
+	return job_st;
+}
+
+/*
+ * Job thread, between lines: waits while paused, false once aborted.
+ */
+bool job_checkpoint(void)
+{
+	bool go;
+
+	if(job_st == JOB_RUNNING && !job_abort_req)
+		return true;
+	chMtxLock(&job_mtx);
+	while(job_st == JOB_PAUSED && !job_abort_req)
+		chCondWait(&job_cv);
+	go = !job_abort_req;
+	chMtxUnlock(&job_mtx);
+	return go;
+}
+
+/*
+ * Job thread, for an abort that came after the last checkpoint.
+ */
+bool job_aborted(void)
+{
+	return job_abort_req;
+}
+
+/*===========================================================================*/
+/* Shell command.                                                            */
+/*===========================================================================*/
+
+void cmd_job(BaseSequentialStream *chp, int argc, char *argv[])
+{
+	static const char * const states[] = {"idle", "running", "paused"};
+	bool ok;
+
+	if(argc == 0)
+	{
+		chprintf(chp, "job: %s%s\r\n", states[job_state()],
+			job_abort_req ? ", aborting" : "");
+		return;
+	}
+	if(argc == 1 && !strcmp(argv[0], "pause"))
+		ok = job_pause();
+	else if(argc == 1 && !strcmp(argv[0], "resume"))
+		ok = job_resume();
+	else if(argc == 1 && !strcmp(argv[0], "abort"))
+		ok = job_abort();
+	else
+	{
+		chprintf(chp, "Usage: job [pause|resume|abort]\r\n");
+		return;
+	}
+	if(!ok)
+		chprintf(chp, "job: cannot %s, job is %s\r\n", argv[0],
+			states[job_state()]);
+}
@@ -0,0 +1,31 @@
+/*
+ * job.h
+ *
+ *  Job thread and its control from the shell.
+ */
+
+#ifndef JOB_H_
+#define JOB_H_
+
+#include "progress.h"
+
+#define JOB_PRIO        (NORMALPRIO + 1)    /* above the shell, below the card */
+
+typedef enum
+{
+	JOB_IDLE = 0,
+	JOB_RUNNING,
+	JOB_PAUSED
+} job_state_t;
+
+void job_init(void);
+bool job_start(BaseSequentialStream *chp, const char *name);
+bool job_pause(void);
+bool job_resume(void);
+bool job_abort(void);
+job_state_t job_state(void);
+bool job_checkpoint(void);
+bool job_aborted(void);
+void cmd_job(BaseSequentialStream *chp, int argc, char *argv[]);
+
+#endif /* JOB_H_ */
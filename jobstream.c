@@ -0,0 +1,202 @@
+/*
+ * jobstream.c
+ *
+ *  Job file reader paced by the motion queue. Before each read the
+ *  occupancy of the planner picks the mode:
+ *
+ *  - below JOBSTREAM_LOW the queue is about to run dry, read the largest
+ *    chunk as a job class request and raise the job thread one level,
+ *    up to the card thread, until the queue has recovered,
+ *  - from JOBSTREAM_HIGH on the queue is nearly full, wait until it drops
+ *    below that and then read the smallest chunk, the card is left to the
+ *    log and checkpoint writes meanwhile,
+ *  - in between, a medium chunk at the normal class and priority.
+ *
+ *  Chunks are whole sectors into a DMA safe buffer so FatFs reads them
+ *  with one multi block command, no FIL window copy.
+ */
+
+/*===========================================================================*/
+/* Job streamer.                                                             */
+/*===========================================================================*/
+#include <string.h>
+#include <stdlib.h>
+
+#include "ch.h"
+#include "hal.h"
+
+#include "chprintf.h"
+
+#include "jobstream.h"
+#include "iosched.h"
+#include "memmap.h"
+
+static const char * const mode_names[JOBSTREAM_NMODES] = {"boost", "normal", "backoff"};
+
+static uint32_t js_buf[JOBSTREAM_CHUNK_MAX / sizeof(uint32_t)] DMA_DATA;
+static FIL *js_fil CCM_DATA;
+static uint32_t js_pos CCM_DATA;
+static uint32_t js_len CCM_DATA;
+static bool js_end CCM_DATA;            /* file read to the end or failed */
+static FRESULT js_err CCM_DATA;
+static tprio_t js_prio CCM_DATA;        /* of the job thread at open */
+
+jobstream_stats_t jobstream_stats CCM_DATA;
+
+static void _fill(void)
+{
+	static const uint32_t chunk[JOBSTREAM_NMODES] = {
+		JOBSTREAM_CHUNK_MAX, JOBSTREAM_CHUNK, JOBSTREAM_CHUNK_MIN
+	};
+	jobstream_mode_t mode;
+	ioq_class_t io_class;
+	uint32_t depth, ms;
+	systime_t start;
+	UINT br;
+
+	depth = planner_depth();
+	if(depth < JOBSTREAM_LOW)
+	{
+		mode = JOBSTREAM_BOOST;
+		chThdSetPriority(JOBSTREAM_BOOST_PRIO);
+		io_class = iosched_set_class(IOQ_CLASS_JOB);
+	}
+	else
+	{
+		mode = depth < JOBSTREAM_HIGH ? JOBSTREAM_NORMAL : JOBSTREAM_BACKOFF;
+		if(mode == JOBSTREAM_BACKOFF)
+			planner_wait_below(JOBSTREAM_HIGH);
+		chThdSetPriority(js_prio);
+		io_class = iosched_set_class(IOQ_CLASS_FS);
+	}
+
+	start = chVTGetSystemTimeX();
+	js_err = f_read(js_fil, js_buf, chunk[mode], &br);
+	ms = ST2MS(chVTGetSystemTimeX() - start);
+	iosched_set_class(io_class);
+
+	jobstream_stats.reads[mode]++;
+	jobstream_stats.bytes[mode] += br;
+	jobstream_stats.read_ms += ms;
+	if(ms > jobstream_stats.read_max_ms)
+		jobstream_stats.read_max_ms = ms;
+
+	js_pos = 0;
+	js_len = (js_err == FR_OK) ? br : 0;
+	js_end = (js_len < chunk[mode]);
+}
+
+/*
+ * The counters live in the CCM, which is not cleared at startup.
+ */
+void jobstream_init(void)
+{
+	memset(&jobstream_stats, 0, sizeof(jobstream_stats));
+}
+
+void jobstream_open(FIL *fp)
+{
+	js_fil = fp;
+	js_pos = 0;
+	js_len = 0;
+	js_end = false;
+	js_err = FR_OK;
+	js_prio = chThdGetPriorityX();
+	memset(&jobstream_stats, 0, sizeof(jobstream_stats));
+}
+
+/*
+ * Same contract as f_gets() with _USE_STRFUNC 2: the line with its '\n',
+ * '\r' dropped, at most len - 1 characters, NULL when nothing is left.
+ */
+char *jobstream_gets(char *line, int len)
+{
+	char *p = line, c;
+
+	while(p < line + len - 1)
+	{
+		if(js_pos == js_len)
+		{
+			if(js_end)
+				break;
+			_fill();
+			if(js_len == 0)
+				break;
+		}
+		c = ((char *)js_buf)[js_pos++];
+		if(c == '\r')
+			continue;
+		*p++ = c;
+		if(c == '\n')
+			break;
+	}
+	*p = 0;
+	return p == line ? NULL : line;
+}
+
+/*
+ * File offset of the first byte jobstream_gets() has not handed out.
+ */
+uint32_t jobstream_tell(void)
+{
+	return f_tell(js_fil) - (js_len - js_pos);
+}
+
+bool jobstream_eof(void)
+{
+	return js_pos == js_len && js_end;
+}
+
+/*
+ * Puts the job thread back to its priority, returns the first read error.
+ */
+FRESULT jobstream_close(void)
+{
+	chThdSetPriority(js_prio);
+	js_fil = NULL;
+	return js_err;
+}
+
+/*===========================================================================*/
+/* Shell command.                                                            */
+/*===========================================================================*/
+
+void cmd_stream(BaseSequentialStream *chp, int argc, char *argv[])
+{
+	planner_stats_t ps = planner_stats;
+	jobstream_stats_t js = jobstream_stats;
+	uint32_t reads = 0;
+	int i;
+
+	if(argc == 1 && !strcmp(argv[0], "reset"))
+	{
+		planner_reset_stats();
+		memset(&jobstream_stats, 0, sizeof(jobstream_stats));
+		return;
+	}
+	if(argc == 2 && !strcmp(argv[0], "speed"))
+	{
+		planner_set_speed(atoi(argv[1]));
+		return;
+	}
+	if(argc > 0)
+	{
+		chprintf(chp, "Usage: stream [reset|speed <percent>]\r\n");
+		return;
+	}
+
+	chprintf(chp, "planner: %lu queued, %lu executed, %lu held to axis limits, "
+		"dry run at %lu%%\r\n", ps.queued, ps.executed, ps.limited,
+		planner_speed());
+	chprintf(chp, "  starved %lu times for %lu ms, lowest depth %lu/%u, "
+		"full %lu times, %lu dropped by aborts\r\n", ps.starved, ps.starved_ms,
+		ps.min_depth, PLANNER_BLOCKS, ps.full_waits, ps.dropped);
+	for(i = 0; i < JOBSTREAM_NMODES; i++)
+	{
+		chprintf(chp, "%-8s %6lu reads %8lu bytes\r\n", mode_names[i],
+			js.reads[i], js.bytes[i]);
+		reads += js.reads[i];
+	}
+	chprintf(chp, "read time avg %lu ms, max %lu ms\r\n",
+		reads ? js.read_ms / reads : 0, js.read_max_ms);
+}
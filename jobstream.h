@@ -0,0 +1,51 @@
+/*
+ * jobstream.h
+ *
+ *  Job file reader paced by the motion queue.
+ */
+
+#ifndef JOBSTREAM_H_
+#define JOBSTREAM_H_
+
+#include "ff.h"
+#include "planner.h"
+#include "job.h"
+
+#define JOBSTREAM_CHUNK_MAX     4096    /* read size when boosted */
+#define JOBSTREAM_CHUNK         2048
+#define JOBSTREAM_CHUNK_MIN     512     /* read size when backed off */
+
+/* planner blocks, below LOW reads are boosted, from HIGH on they back off */
+#define JOBSTREAM_LOW           (PLANNER_BLOCKS / 4)
+#define JOBSTREAM_HIGH          (PLANNER_BLOCKS * 3 / 4)
+
+/* above the job thread, level with the card thread and below the planner */
+#define JOBSTREAM_BOOST_PRIO    (JOB_PRIO + 1)
+
+typedef enum
+{
+	JOBSTREAM_BOOST = 0,
+	JOBSTREAM_NORMAL,
+	JOBSTREAM_BACKOFF,
+	JOBSTREAM_NMODES
+} jobstream_mode_t;
+
+typedef struct
+{
+	uint32_t reads[JOBSTREAM_NMODES];
+	uint32_t bytes[JOBSTREAM_NMODES];
+	uint32_t read_ms;           /* time spent in f_read() */
+	uint32_t read_max_ms;
+} jobstream_stats_t;
+
+extern jobstream_stats_t jobstream_stats;
+
+void jobstream_init(void);
+void jobstream_open(FIL *fp);
+char *jobstream_gets(char *line, int len);
+uint32_t jobstream_tell(void);
+bool jobstream_eof(void);
+FRESULT jobstream_close(void);
+void cmd_stream(BaseSequentialStream *chp, int argc, char *argv[]);
+
+#endif /* JOBSTREAM_H_ */
@@ -0,0 +1,56 @@
+/*
+ * machine.c
+ *
+ *  Axis table. config.c checks the ranges and hands over all axes at once,
+ *  the table is never half updated.
+ */
+
+/*===========================================================================*/
+/* Machine table.                                                            */
+/*===========================================================================*/
+#include <string.h>
+
+#include "ch.h"
+#include "hal.h"
+
+#include "machine.h"
+
+#ifndef MACHINE_FIXED
+machine_axis_t machine_axes[MACHINE_AXES] =
+{
+	MACHINE_AXIS(MACHINE_X),
+	MACHINE_AXIS(MACHINE_Y),
+	MACHINE_AXIS(MACHINE_Z),
+	MACHINE_AXIS(MACHINE_E)
+};
+#endif
+
+/*
+ * Works out the reciprocals of a validated axis.
+ */
+void machine_apply(const machine_axis_cfg_t *cfg, machine_axis_t *axis)
+{
+	axis->cfg = *cfg;
+	axis->to_steps = MACHINE_TO_STEPS(cfg->steps_per_mm);
+	axis->to_units = MACHINE_TO_UNITS(cfg->steps_per_mm);
+	axis->us_per_unit = MACHINE_US_PER_UNIT(cfg->vmax);
+}
+
+/*
+ * Replaces the table, the job thread reads it without a lock.
+ */
+void machine_set(const machine_axis_cfg_t cfg[MACHINE_AXES])
+{
+#ifdef MACHINE_FIXED
+	(void)cfg;
+#else
+	machine_axis_t tab[MACHINE_AXES];
+	int i;
+
+	for(i = 0; i < MACHINE_AXES; i++)
+		machine_apply(&cfg[i], &tab[i]);
+	chSysLock();
+	memcpy(machine_axes, tab, sizeof(tab));
+	chSysUnlock();
+#endif
+}
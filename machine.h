@@ -0,0 +1,141 @@
+/*
+ * machine.h
+ *
+ *  Per axis mechanics: steps per mm, velocity, acceleration and jerk
+ *  limits and direction inversion, set from config.ini by config.c. The
+ *  conversions the planner and the step generator run per move are
+ *  multiplications by reciprocals worked out when the table is set.
+ *
+ *  Build with UDEFS=-DMACHINE_FIXED to compile the defaults in as
+ *  constants instead, the conversions then fold into the callers and the
+ *  axis sections of the config are ignored.
+ */
+
+#ifndef MACHINE_H_
+#define MACHINE_H_
+
+#include "gcode_parser.h"
+
+typedef enum
+{
+	AXIS_X = 0,
+	AXIS_Y,
+	AXIS_Z,
+	AXIS_E,
+	MACHINE_AXES
+} machine_axis_id_t;
+
+/* defaults, mm based: steps/mm, mm/s, mm/s2, mm/s3, inverted */
+#define MACHINE_X           80,     300,    3000,   100000, 0
+#define MACHINE_Y           80,     300,    3000,   100000, 0
+#define MACHINE_Z           400,    10,     200,    10000,  0
+#define MACHINE_E           95,     50,     5000,   100000, 0
+
+/* accepted ranges, mm based */
+#define MACHINE_SPM_MIN     1
+#define MACHINE_SPM_MAX     10000
+#define MACHINE_V_MIN       0.1f
+#define MACHINE_V_MAX       2000
+#define MACHINE_A_MIN       1
+#define MACHINE_A_MAX       100000
+#define MACHINE_J_MIN       1
+#define MACHINE_J_MAX       1000000
+
+/*
+ * As in the config, everything in gcode units.
+ */
+typedef struct
+{
+	int32_t steps_per_mm;       /* x GCODE_UOM */
+	int32_t vmax;               /* units/s */
+	int32_t amax;               /* units/s2 */
+	int32_t jerk;               /* units/s3 */
+	bool invert;
+} machine_axis_cfg_t;
+
+typedef struct
+{
+	machine_axis_cfg_t cfg;
+	int32_t to_steps;           /* steps per unit, Q8.24 */
+	int32_t to_units;           /* units per step, Q16.16 */
+	int32_t us_per_unit;        /* at vmax, Q16.16 */
+} machine_axis_t;
+
+/*
+ * Derived values, constant expressions so the fixed table is worked out by
+ * the compiler. The only divisions are here.
+ */
+#define MACHINE_TO_STEPS(spm)   ((int32_t)((((int64_t)(spm) << 24) + \
+	(int64_t)GCODE_UOM * GCODE_UOM / 2) / ((int64_t)GCODE_UOM * GCODE_UOM)))
+#define MACHINE_TO_UNITS(spm)   ((int32_t)(((((int64_t)GCODE_UOM * GCODE_UOM) \
+	<< 16) + (spm) / 2) / (spm)))
+#define MACHINE_US_PER_UNIT(v)  ((int32_t)(((1000000LL << 16) + (v) / 2) / (v)))
+
+#define _MACHINE_AXIS_CFG(spm, v, a, j, inv) \
+	{(int32_t)((spm) * GCODE_UOM), (int32_t)((v) * GCODE_UOM), \
+		(int32_t)((a) * GCODE_UOM), (int32_t)((j) * GCODE_UOM), (inv)}
+#define _MACHINE_AXIS(spm, v, a, j, inv) \
+	{ \
+		_MACHINE_AXIS_CFG(spm, v, a, j, inv), \
+		MACHINE_TO_STEPS((int32_t)((spm) * GCODE_UOM)), \
+		MACHINE_TO_UNITS((int32_t)((spm) * GCODE_UOM)), \
+		MACHINE_US_PER_UNIT((int32_t)((v) * GCODE_UOM)) \
+	}
+#define MACHINE_AXIS(...)       _MACHINE_AXIS(__VA_ARGS__)
+#define MACHINE_AXIS_CFG(...)   _MACHINE_AXIS_CFG(__VA_ARGS__)
+
+#ifdef MACHINE_FIXED
+static const machine_axis_t machine_axes[MACHINE_AXES] =
+{
+	MACHINE_AXIS(MACHINE_X),
+	MACHINE_AXIS(MACHINE_Y),
+	MACHINE_AXIS(MACHINE_Z),
+	MACHINE_AXIS(MACHINE_E)
+};
+#else
+extern machine_axis_t machine_axes[MACHINE_AXES];
+#endif
+
+/*
+ * Position in gcode units to steps, rounded.
+ */
+static inline int32_t machine_to_steps(machine_axis_id_t axis, int32_t pos)
+{
+	return (int32_t)(((int64_t)pos * machine_axes[axis].to_steps +
+		(1 << 23)) >> 24);
+}
+
+static inline int32_t machine_to_units(machine_axis_id_t axis, int32_t steps)
+{
+	return (int32_t)(((int64_t)steps * machine_axes[axis].to_units +
+		(1 << 15)) >> 16);
+}
+
+/*
+ * Shortest time for dist units on one axis, at its maximum velocity.
+ */
+static inline uint32_t machine_min_us(machine_axis_id_t axis, uint32_t dist)
+{
+	return (uint32_t)(((uint64_t)dist * (uint32_t)machine_axes[axis].us_per_unit)
+		>> 16);
+}
+
+/*
+ * Direction bits of the axes with a positive step count, inverted axes
+ * flipped.
+ */
+static inline uint32_t machine_dir_bits(uint32_t positive)
+{
+	uint32_t inv = 0;
+	int i;
+
+	for(i = 0; i < MACHINE_AXES; i++)
+		if(machine_axes[i].cfg.invert)
+			inv |= 1UL << i;
+	return positive ^ inv;
+}
+
+void machine_apply(const machine_axis_cfg_t *cfg, machine_axis_t *axis);
+void machine_set(const machine_axis_cfg_t cfg[MACHINE_AXES]);
+
+#endif /* MACHINE_H_ */
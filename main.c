@@ -29,12 +29,37 @@
 #include "usbcfg.h"
 #include "fat.h"
 #include "gcode_parser.h"
+#include "gcode_bench.h"
+#include "console.h"
+#include "pools.h"
+#include "memmap.h"
+#include "fsstress.h"
+#include "filetab.h"
+#include "sdcache.h"
+#include "volume.h"
+#include "clmap.h"
+#include "sdbench.h"
+#include "sddev.h"
+#include "iosched.h"
+#include "planner.h"
+#include "jobstream.h"
+#include "config.h"
+#include "progress.h"
+#include "job.h"
 
 /*===========================================================================*/
 /* Command line related.                                                     */
 /*===========================================================================*/
 
-#define SHELL_WA_SIZE   THD_WORKING_AREA_SIZE(2048)
+/*
+ * With CORTEX_USE_FPU the port saves s16-s31 on every context switch and
+ * lazily stacks s0-s15 on exceptions, THD_WORKING_AREA_SIZE() accounts for
+ * both so any thread may use float.
+ */
+#if CORTEX_USE_FPU && defined(__arm__) && !defined(__ARM_FP)
+#error "CORTEX_USE_FPU requires -mfpu, check USE_FPU in the Makefile"
+#endif
+
 #define TEST_WA_SIZE    THD_WORKING_AREA_SIZE(256)
 
 
@@ -49,6 +74,7 @@ static void cmd_mem(BaseSequentialStream *chp, int argc, char *argv[]) {
 	chprintf(chp, "core free memory : %u bytes\r\n", chCoreGetStatusX());
 	chprintf(chp, "heap fragments   : %u\r\n", n);
 	chprintf(chp, "heap free total  : %u bytes\r\n", size);
+	pools_print(chp);
 }
 
 static void cmd_threads(BaseSequentialStream *chp, int argc, char *argv[]) {
@@ -76,7 +102,7 @@ static void cmd_stringtest(BaseSequentialStream *chp, int argc, char *argv[]) {
 	char str[30] = "20300.1232";
 	char *ptr;
 	long ret1;
-	double ret2;
+	float ret2;
 	char *token;
 
 	/* This function is a simple test of the string functions required for gcode_parse */
@@ -85,9 +111,9 @@ static void cmd_stringtest(BaseSequentialStream *chp, int argc, char *argv[]) {
 
 	chprintf(chp, "number [%ld]\r\n", ret1);
 
-	ret2 = strtod(str, NULL);
+	ret2 = strtof(str, NULL);
 
-	chprintf(chp, "number [%f]\r\n", ret2);
+	chprintf(chp, "number [%f]\r\n", (double)ret2);
 
 	token = strtok_r(str, _WHITESPACE, &ptr);	
 
@@ -108,10 +134,33 @@ static const ShellCommand commands[] = {
 	{"threads", cmd_threads},
 	{"stringtest", cmd_stringtest},
 	{"gcodetest", cmd_gcodetest},
+	{"analyze", cmd_analyze},
+	{"status", cmd_status},
+	{"job", cmd_job},
+	{"gcodebench", cmd_gcodebench},
+	{"profile", cmd_profile},
+	{"log", cmd_log},
+	{"fsstress", cmd_fsstress},
+	{"files", cmd_files},
+	{"cache", cmd_cache},
+	{"clmap", cmd_clmap},
+	{"sdbench", cmd_sdbench},
+	{"sdstat", cmd_sdstat},
+	{"iosched", cmd_iosched},
+	{"stream", cmd_stream},
+	{"coalesce", cmd_coalesce},
+	{"config", cmd_config},
 	{NULL, NULL}
 };
 
-static const ShellConfig shell_cfg1 = {(BaseSequentialStream *)&SDU1,  commands};
+static const ShellConfig shell_cfg1 = {&console_shell,  commands};
+
+/*
+ * The one shell, respawned from main() whenever USB comes up. Jobs run on
+ * their own thread, see job.c. In SRAM rather than the CCM, some commands
+ * read the card into their stack.
+ */
+static THD_WORKING_AREA(waShell, 1536);
 
 /*===========================================================================*/
 /* Main and generic code.                                                    */
@@ -120,7 +169,7 @@ static const ShellConfig shell_cfg1 = {(BaseSequentialStream *)&SDU1,  commands}
 /*
  * Green LED blinker thread to show the system is running.
  */
-static THD_WORKING_AREA(waThread1, 128);
+static CCM_DATA THD_WORKING_AREA(waThread1, 128);
 static THD_FUNCTION(Thread1, arg) {
 	(void)arg;
 	chRegSetThreadName("blinker");
@@ -147,6 +196,41 @@ int main(void) {
 	halInit();
 	chSysInit();
 
+	/*
+	 * Object pools, before anything that may allocate from them.
+	 */
+	pools_init();
+
+	/*
+	 * Sector cache tags live in the CCM which is not cleared at startup.
+	 */
+	sdcache_init();
+
+	/*
+	 * Card request queue and its worker, before the first card access.
+	 */
+	iosched_init();
+
+	/*
+	 * Settings, defaults until a card with a config.ini is mounted.
+	 */
+	config_init();
+
+	/*
+	 * Motion queue and its dry run executor.
+	 */
+	planner_init();
+
+	/*
+	 * Job reader counters, stream shows them before the first job.
+	 */
+	jobstream_init();
+
+	/*
+	 * Job thread, idle until gcodetest.
+	 */
+	job_init();
+
 	/*
 	 * Shell manager initialization.
 	 */
@@ -168,13 +252,23 @@ int main(void) {
         usbStart(serusbcfg.usbp, &usbcfg);
         usbConnectBus(serusbcfg.usbp);
 
+	/*
+	 * Buffered console for job output.
+	 */
+	console_init((BaseSequentialStream *)&SDU1);
 
 
 	/*
-	 * Start SD Driver
+	 * Start SD Driver. sdcConnect() puts SD cards on the 4 bit bus, the
+	 * mount manager then raises the clock, see sdmode.c.
 	 */
 	sdcStart(&SDCD1, NULL);
 
+	/*
+	 * Free space counter, waits for the first mount.
+	 */
+	volume_init();
+
 	/*
 	 * Activate Serial Drivers 1 & 2
 	 */
@@ -183,9 +277,6 @@ int main(void) {
 	//palSetPadMode(GPIOB, 6, PAL_MODE_ALTERNATE(7));
 	//palSetPadMode(GPIOB, 7, PAL_MODE_ALTERNATE(7));
 
-	// Create shell on USART 1 & 2
-	shellCreate(&shell_cfg1, SHELL_WA_SIZE, NORMALPRIO);
-
 	/*
 	 * Creates the blinker thread.
 	 */
@@ -199,13 +290,14 @@ int main(void) {
                 if (!shelltp) {
                         if (SDU1.config->usbp->state == USB_ACTIVE) {
                                 /* Spawns a new shell.*/
-                                shelltp = shellCreate(&shell_cfg1, SHELL_WA_SIZE, NORMALPRIO);
+                                shelltp = shellCreateStatic(&shell_cfg1, waShell,
+                                                sizeof(waShell), NORMALPRIO);
                         }
                 }
                 else {
                         /* If the previous shell exited.*/
                         if (chThdTerminatedX(shelltp)) {
-                                /* Recovers memory of the previous shell.*/
+                                /* Drops the reference, the area is static.*/
                                 chThdRelease(shelltp);
                                 shelltp = NULL;
                         }
@@ -0,0 +1,31 @@
+/*
+ * memmap.h
+ *
+ *  Memory placement on the STM32F407. The 64 KB CCM has no wait states and
+ *  is not on the bus matrix so the CPU never contends with DMA there, but
+ *  for the same reason the SDIO DMA cannot reach it. Buffers the SDIO reads
+ *  or writes go to SRAM in their own section, the linker script checks
+ *  that section does not end up anywhere else.
+ */
+
+#ifndef MEMMAP_H_
+#define MEMMAP_H_
+
+/*
+ * CPU only data, thread stacks, parser and planner state. Not cleared at
+ * startup.
+ */
+#define CCM_DATA        __attribute__((section(".ram4")))
+
+/*
+ * SDIO DMA buffers, word aligned in SRAM. Not cleared at startup.
+ */
+#define DMA_DATA        __attribute__((section(".dmabuf"), aligned(4)))
+
+#define MEM_CCM_BASE    0x10000000U
+#define MEM_CCM_SIZE    0x00010000U
+
+#define MEM_IS_CCM(p)       ((uint32_t)(p) - MEM_CCM_BASE < MEM_CCM_SIZE)
+#define MEM_IS_DMA_SAFE(p)  (!MEM_IS_CCM(p) && (((uint32_t)(p) & 3U) == 0))
+
+#endif /* MEMMAP_H_ */
@@ -0,0 +1,490 @@
+/*
+ * planner.c
+ *
+ *  Motion queue between the parser and the executor. The job thread pushes
+ *  its moves through the coalescer of coalesce.c, which turns runs of tiny
+ *  colinear moves into one block, and waits when the ring is full. There are no
+ *  steppers yet, the executor thread does a dry run and holds each block
+ *  for its duration at the programmed feedrate, which is enough to see
+ *  whether the job keeps the queue fed.
+ *
+ *  A job starts executing once PLANNER_PRIME blocks are queued. The queue
+ *  running empty after that and before the end of the job is a starvation
+ *  event, on a machine that is a stop in the middle of a line and a blob
+ *  on the part.
+ *
+ *  A held executor stops after the block it is on and the queue fills up
+ *  behind it, that is how a job pauses. An abort drops what is queued.
+ */
+
+/*===========================================================================*/
+/* Motion queue.                                                             */
+/*===========================================================================*/
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "ch.h"
+#include "hal.h"
+
+#include "chprintf.h"
+
+#include "planner.h"
+#include "coalesce.h"
+#include "machine.h"
+#include "progress.h"
+#include "job.h"
+#include "memmap.h"
+
+#define RING_MASK       (PLANNER_BLOCKS - 1)
+#define F_CACHE_BITS    4               /* feedrates with a known reciprocal */
+#define F_CACHE_SIZE    (1 << F_CACHE_BITS)
+
+/* coalescer changes during a job, the job thread takes them at its next move */
+#define CO_REQ_CFG      0x01
+#define CO_REQ_STATS    0x02
+
+static plan_block_t ring[PLANNER_BLOCKS] CCM_DATA;
+static uint32_t plan_head CCM_DATA;     /* next free, moved by push */
+static uint32_t plan_tail CCM_DATA;     /* executing, moved by the executor */
+static plan_block_t plan_last CCM_DATA; /* position the next move starts from */
+
+static bool plan_job CCM_DATA;          /* between begin and end */
+static bool plan_primed CCM_DATA;       /* executing */
+static bool plan_starving CCM_DATA;
+static bool plan_hold CCM_DATA;         /* paused after the current block */
+static bool plan_busy CCM_DATA;         /* executor is on ring[plan_tail] */
+static systime_t plan_starve_start CCM_DATA;
+static volatile uint32_t plan_speed CCM_DATA;   /* dry run, percent of real time */
+
+static coalesce_t plan_co CCM_DATA;     /* job thread only while plan_job */
+static coalesce_cfg_t plan_co_cfg CCM_DATA;     /* latest settings */
+static volatile uint8_t plan_co_req CCM_DATA;   /* for the job thread */
+static int32_t plan_f[F_CACHE_SIZE] CCM_DATA;   /* feedrate of plan_us_per_unit */
+static float plan_us_per_unit[F_CACHE_SIZE] CCM_DATA;
+
+static MUTEX_DECL(plan_mtx);
+static CONDVAR_DECL(plan_data);
+static CONDVAR_DECL(plan_space);
+
+planner_stats_t planner_stats CCM_DATA;
+
+/*
+ * Holds a block for its duration scaled by the dry run speed, leftover
+ * microseconds carry over to the next block. Falls back to now when the
+ * queue starved.
+ */
+static void _dwell(uint32_t us)
+{
+	static systime_t next;
+	static uint64_t carry;
+	systime_t now, ticks;
+	uint32_t speed = plan_speed;    /* stream speed changes it any time */
+
+	if(speed == 0)
+		return;
+	carry += (uint64_t)us * 100 / speed;
+	ticks = (systime_t)(carry * CH_CFG_ST_FREQUENCY / 1000000);
+	carry -= (uint64_t)ticks * 1000000 / CH_CFG_ST_FREQUENCY;
+
+	now = chVTGetSystemTimeX();
+	if((int32_t)(next - now) < 0)
+		next = now;
+	next += ticks;
+	if((int32_t)(next - now) > 0)
+		chThdSleep(next - now);
+}
+
+static CCM_DATA THD_WORKING_AREA(waPlanner, 256);
+static THD_FUNCTION(planner_thread, arg)
+{
+	uint32_t depth, us;
+
+	(void)arg;
+	chRegSetThreadName("planner");
+	chMtxLock(&plan_mtx);
+	while(true)
+	{
+		while(plan_head == plan_tail || !plan_primed || plan_hold)
+		{
+			if(plan_job && plan_primed && !plan_hold && !plan_starving)
+			{
+				plan_starving = true;
+				plan_starve_start = chVTGetSystemTimeX();
+				planner_stats.starved++;
+			}
+			chCondWait(&plan_data);
+		}
+		if(plan_starving)
+		{
+			planner_stats.starved_ms += ST2MS(chVTGetSystemTimeX() - plan_starve_start);
+			plan_starving = false;
+		}
+		depth = plan_head - plan_tail;
+		if(plan_job && depth < planner_stats.min_depth)
+			planner_stats.min_depth = depth;
+		us = ring[plan_tail & RING_MASK].us;
+		plan_busy = true;
+		chMtxUnlock(&plan_mtx);
+
+		_dwell(us);
+
+		progress_executed(us);
+		chMtxLock(&plan_mtx);
+		plan_busy = false;
+		plan_tail++;
+		planner_stats.executed++;
+		chCondBroadcast(&plan_space);
+	}
+}
+
+/*
+ * Microseconds per gcode unit at feedrate f. A job sticks to a handful of
+ * feedrates, perimeters, infill, travel and a few more, and switches
+ * between them all the time. Each is divided once and found here after
+ * that, a slot is shared by the feedrates that hash to it.
+ */
+static float _us_per_unit(int32_t f)
+{
+	uint32_t i = ((uint32_t)f * 2654435761UL) >> (32 - F_CACHE_BITS);
+
+	if(plan_f[i] != f)
+	{
+		plan_f[i] = f;
+		plan_us_per_unit[i] = 60000000.0f / (float)f;
+	}
+	return plan_us_per_unit[i];
+}
+
+/*
+ * Queues a block to pt, waits while the ring is full. The block takes the
+ * longer of the time at its feedrate and the time its slowest axis needs
+ * at that axis' maximum velocity.
+ */
+static void _enqueue(const coalesce_pt_t *pt, uint32_t moves, void *ctx)
+{
+	plan_block_t *bp;
+	int32_t pos[MACHINE_AXES], d[MACHINE_AXES];
+	uint32_t us, min_us;
+	float len;
+	int i;
+
+	(void)moves;
+	(void)ctx;
+	chMtxLock(&plan_mtx);
+	if(plan_head - plan_tail >= PLANNER_BLOCKS)
+	{
+		planner_stats.full_waits++;
+		while(plan_head - plan_tail >= PLANNER_BLOCKS)
+			chCondWait(&plan_space);
+	}
+	bp = &ring[plan_head & RING_MASK];
+	bp->x = pt->x;
+	bp->y = pt->y;
+	bp->z = pt->z;
+	bp->e = pt->e;
+	bp->f = pt->f > 0 ? pt->f : PLANNER_DEFAULT_F;
+
+	pos[AXIS_X] = bp->x;
+	pos[AXIS_Y] = bp->y;
+	pos[AXIS_Z] = bp->z;
+	pos[AXIS_E] = bp->e;
+	d[AXIS_X] = abs(bp->x - plan_last.x);
+	d[AXIS_Y] = abs(bp->y - plan_last.y);
+	d[AXIS_Z] = abs(bp->z - plan_last.z);
+	d[AXIS_E] = abs(bp->e - plan_last.e);
+	len = sqrtf((float)d[AXIS_X] * (float)d[AXIS_X] +
+		(float)d[AXIS_Y] * (float)d[AXIS_Y] + (float)d[AXIS_Z] * (float)d[AXIS_Z]);
+	if(len == 0.0f)
+		len = (float)d[AXIS_E];
+	bp->len = (uint32_t)len;
+	us = (uint32_t)(len * _us_per_unit(bp->f));
+	bp->limited = false;
+	for(i = 0; i < MACHINE_AXES; i++)
+	{
+		bp->steps[i] = machine_to_steps(i, pos[i]);
+		min_us = machine_min_us(i, (uint32_t)d[i]);
+		if(min_us > us)
+		{
+			us = min_us;
+			bp->limited = true;
+		}
+	}
+	bp->us = us;
+	if(bp->limited)
+		planner_stats.limited++;
+	plan_last = *bp;
+
+	progress_planned(us);
+	plan_head++;
+	if(plan_head - plan_tail >= PLANNER_PRIME)
+		plan_primed = true;
+	planner_stats.queued++;
+	chCondSignal(&plan_data);
+	chMtxUnlock(&plan_mtx);
+}
+
+void planner_init(void)
+{
+	memset(ring, 0, sizeof(ring));
+	memset(&plan_last, 0, sizeof(plan_last));
+	plan_head = 0;
+	plan_tail = 0;
+	plan_job = false;
+	plan_primed = true;
+	plan_starving = false;
+	plan_hold = false;
+	plan_busy = false;
+	plan_speed = 100;
+	memset(plan_f, 0, sizeof(plan_f));
+	coalesce_init(&plan_co, _enqueue, NULL);
+	plan_co_cfg = plan_co.cfg;
+	plan_co_req = 0;
+	planner_reset_stats();
+	chThdCreateStatic(waPlanner, sizeof(waPlanner), NORMALPRIO + 3,
+		planner_thread, NULL);
+}
+
+/*
+ * With plan_mtx held, by the job thread or at the end of the job.
+ */
+static void _co_apply(void)
+{
+	if(plan_co_req & CO_REQ_CFG)
+		coalesce_config(&plan_co, &plan_co_cfg);
+	if(plan_co_req & CO_REQ_STATS)
+		memset(&plan_co.stats, 0, sizeof(plan_co.stats));
+	plan_co_req = 0;
+}
+
+/*
+ * Job thread, applies coalescer changes made during the job by a config
+ * load or a stream reset. The moves so far go out with the settings they
+ * came in with.
+ */
+static void _co_update(void)
+{
+	if(plan_co_req & CO_REQ_CFG)
+		coalesce_flush(&plan_co);
+	chMtxLock(&plan_mtx);
+	_co_apply();
+	chMtxUnlock(&plan_mtx);
+}
+
+/*
+ * Starts a job at the origin, the parser state starts there as well.
+ */
+void planner_begin(void)
+{
+	static const coalesce_pt_t origin;
+
+	chMtxLock(&plan_mtx);
+	coalesce_reset(&plan_co, &origin);
+	memset(&plan_last, 0, sizeof(plan_last));
+	plan_job = true;
+	plan_primed = false;
+	plan_starving = false;
+	planner_stats.min_depth = PLANNER_BLOCKS;
+	chMtxUnlock(&plan_mtx);
+}
+
+/*
+ * Queues the move to the position in mp, possibly as part of a later
+ * block.
+ */
+void planner_push(const _param_t *mp)
+{
+	coalesce_pt_t pt = {mp->x, mp->y, mp->z, mp->e, mp->f};
+
+	if(plan_co_req)
+		_co_update();
+	coalesce_push(&plan_co, &pt);
+}
+
+/*
+ * No more moves for this job, waits until the executor has done them.
+ */
+void planner_end(void)
+{
+	coalesce_flush(&plan_co);
+	chMtxLock(&plan_mtx);
+	plan_job = false;
+	_co_apply();
+	plan_primed = true;
+	chCondSignal(&plan_data);
+	while(plan_head != plan_tail)
+		chCondWait(&plan_space);
+	if(planner_stats.min_depth == PLANNER_BLOCKS)
+		planner_stats.min_depth = 0;
+	chMtxUnlock(&plan_mtx);
+}
+
+/*
+ * Holds the executor after the block it is on, or lets it go on.
+ */
+void planner_hold(bool hold)
+{
+	chMtxLock(&plan_mtx);
+	plan_hold = hold;
+	chCondSignal(&plan_data);
+	chMtxUnlock(&plan_mtx);
+}
+
+/*
+ * Drops the blocks the executor has not started and wakes a push waiting
+ * for space, for an abort from another thread. The job thread resets the
+ * coalescer itself with planner_abort().
+ */
+void planner_flush(void)
+{
+	uint32_t keep;
+
+	chMtxLock(&plan_mtx);
+	keep = plan_tail + (plan_busy ? 1 : 0);
+	planner_stats.dropped += plan_head - keep;
+	plan_head = keep;
+	chCondBroadcast(&plan_space);
+	chMtxUnlock(&plan_mtx);
+}
+
+/*
+ * Job thread, ends an aborted job without the moves still in the coalescer
+ * or the queue.
+ */
+void planner_abort(void)
+{
+	static const coalesce_pt_t origin;
+
+	coalesce_reset(&plan_co, &origin);
+	planner_flush();
+	planner_end();
+}
+
+uint32_t planner_depth(void)
+{
+	return plan_head - plan_tail;
+}
+
+/*
+ * Waits until fewer than depth blocks are queued.
+ */
+void planner_wait_below(uint32_t depth)
+{
+	chMtxLock(&plan_mtx);
+	while(plan_head - plan_tail >= depth)
+		chCondWait(&plan_space);
+	chMtxUnlock(&plan_mtx);
+}
+
+/*
+ * Dry run speed in percent of real time, 0 runs the blocks back to back.
+ */
+void planner_set_speed(uint32_t percent)
+{
+	plan_speed = percent;
+}
+
+/*
+ * Coalescer settings, applied now without a job, else the job thread
+ * picks them up with its next move.
+ */
+void planner_set_coalesce(const coalesce_cfg_t *cfg)
+{
+	chMtxLock(&plan_mtx);
+	plan_co_cfg = *cfg;
+	if(plan_job)
+		plan_co_req |= CO_REQ_CFG;
+	else
+		coalesce_config(&plan_co, cfg);
+	chMtxUnlock(&plan_mtx);
+}
+
+void planner_coalesce(coalesce_cfg_t *cfg, coalesce_stats_t *st)
+{
+	chMtxLock(&plan_mtx);
+	*cfg = plan_co_cfg;
+	*st = plan_co.stats;
+	chMtxUnlock(&plan_mtx);
+}
+
+/*
+ * Zeroes the coalescer counters, like planner_set_coalesce().
+ */
+void planner_reset_coalesce(void)
+{
+	chMtxLock(&plan_mtx);
+	if(plan_job)
+		plan_co_req |= CO_REQ_STATS;
+	else
+		memset(&plan_co.stats, 0, sizeof(plan_co.stats));
+	chMtxUnlock(&plan_mtx);
+}
+
+uint32_t planner_speed(void)
+{
+	return plan_speed;
+}
+
+void planner_reset_stats(void)
+{
+	chMtxLock(&plan_mtx);
+	memset(&planner_stats, 0, sizeof(planner_stats));
+	planner_stats.min_depth = PLANNER_BLOCKS;
+	chMtxUnlock(&plan_mtx);
+	planner_reset_coalesce();
+}
+
+/*===========================================================================*/
+/* Shell command.                                                            */
+/*===========================================================================*/
+
+void cmd_coalesce(BaseSequentialStream *chp, int argc, char *argv[])
+{
+	coalesce_cfg_t cfg;
+	coalesce_stats_t st;
+	int i;
+
+	/* a job is timed and counted with the settings it started with */
+	if(argc > 0 && job_state() != JOB_IDLE)
+	{
+		chprintf(chp, "coalesce: a job is running, see job\r\n");
+		return;
+	}
+	if(argc == 1 && !strcmp(argv[0], "reset"))
+	{
+		planner_reset_coalesce();
+		return;
+	}
+	planner_coalesce(&cfg, &st);
+	for(i = 0; i < argc; i++)
+	{
+		if(!strcmp(argv[i], "on"))
+			cfg.enabled = true;
+		else if(!strcmp(argv[i], "off"))
+			cfg.enabled = false;
+		else if(i + 1 < argc && !strcmp(argv[i], "angle"))
+			cfg.angle = strtof(argv[++i], NULL);
+		else if(i + 1 < argc && !strcmp(argv[i], "erate"))
+			cfg.erate = strtof(argv[++i], NULL);
+		else if(i + 1 < argc && !strcmp(argv[i], "dev"))
+			cfg.deviation = atoi(argv[++i]) * GCODE_UOM / 1000;
+		else
+		{
+			chprintf(chp, "Usage: coalesce [reset|on|off] [angle <deg>] "
+				"[erate <pct>] [dev <um>]\r\n");
+			return;
+		}
+	}
+	if(argc > 0)
+	{
+		planner_set_coalesce(&cfg);
+		return;
+	}
+
+	chprintf(chp, "coalescing %s: angle %.1f deg, extrusion %.1f%%, "
+		"deviation %ld um\r\n", cfg.enabled ? "on" : "off", (double)cfg.angle,
+		(double)cfg.erate, cfg.deviation * 1000 / GCODE_UOM);
+	chprintf(chp, "%lu moves into %lu blocks, %lu merged, up to %lu per block, "
+		"max deviation %.1f um\r\n", st.moves, st.blocks, st.merged,
+		st.max_moves, (double)(st.max_deviation * 1000.0f / GCODE_UOM));
+}
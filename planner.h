@@ -0,0 +1,62 @@
+/*
+ * planner.h
+ *
+ *  Motion queue between the parser and the executor.
+ */
+
+#ifndef PLANNER_H_
+#define PLANNER_H_
+
+#include "gcode_parser.h"
+#include "machine.h"
+#include "coalesce.h"
+
+#define PLANNER_BLOCKS      16      /* ring, power of two */
+#define PLANNER_PRIME       4       /* queued before a job starts moving */
+#define PLANNER_DEFAULT_F   (3000 * GCODE_UOM)  /* mm/min until the job sets F */
+
+typedef struct
+{
+	int32_t x;                  /* target, gcode units */
+	int32_t y;
+	int32_t z;
+	int32_t e;
+	int32_t f;                  /* gcode units per minute */
+	int32_t steps[MACHINE_AXES]; /* target in steps */
+	uint32_t len;               /* gcode units */
+	uint32_t us;                /* duration at f or the axis limits */
+	bool limited;               /* slowed down by an axis limit */
+} plan_block_t;
+
+typedef struct
+{
+	uint32_t queued;
+	uint32_t executed;
+	uint32_t full_waits;        /* pushes that waited for a free block */
+	uint32_t limited;           /* blocks slowed down by an axis limit */
+	uint32_t dropped;           /* queued but flushed by an abort */
+	uint32_t starved;           /* ran empty in the middle of a job */
+	uint32_t starved_ms;
+	uint32_t min_depth;         /* lowest occupancy while running */
+} planner_stats_t;
+
+extern planner_stats_t planner_stats;
+
+void planner_init(void);
+void planner_begin(void);
+void planner_push(const _param_t *mp);
+void planner_end(void);
+void planner_hold(bool hold);
+void planner_flush(void);
+void planner_abort(void);
+uint32_t planner_depth(void);
+void planner_wait_below(uint32_t depth);
+void planner_set_speed(uint32_t percent);
+uint32_t planner_speed(void);
+void planner_set_coalesce(const coalesce_cfg_t *cfg);
+void planner_coalesce(coalesce_cfg_t *cfg, coalesce_stats_t *st);
+void planner_reset_coalesce(void);
+void planner_reset_stats(void);
+void cmd_coalesce(BaseSequentialStream *chp, int argc, char *argv[]);
+
+#endif /* PLANNER_H_ */
@@ -0,0 +1,99 @@
+/*
+ * pools.c
+ *
+ *  Fixed size object pools with usage counters. Allocation and release are
+ *  O(1) and never touch the heap.
+ */
+
+/*===========================================================================*/
+/* Object pools.                                                             */
+/*===========================================================================*/
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "ch.h"
+#include "hal.h"
+
+#include "chprintf.h"
+
+#include "pools.h"
+#include "memmap.h"
+
+/*
+ * Objects only the CPU touches go to the CCM, anything that can end up as
+ * a SDIO DMA target (file objects and their sector buffer, I/O buffers)
+ * must stay in SRAM.
+ */
+static _param_t move_store[POOL_MOVE_N] CCM_DATA;
+static FILINFO filinfo_store[POOL_FILINFO_N] CCM_DATA;
+static uint32_t sector_store[POOL_SECTOR_N][POOL_SECTOR_SIZE / sizeof(uint32_t)] DMA_DATA;
+static FIL fil_store[POOL_FIL_N] DMA_DATA;
+static uint16_t lfn_store[POOL_LFN_N][POOL_LFN_SIZE / sizeof(uint16_t)] CCM_DATA;
+
+obj_pool_t move_pool = {_MEMORYPOOL_DATA(move_pool.pool, sizeof(_param_t), NULL),
+	"move", sizeof(_param_t), POOL_MOVE_N, 0, 0, 0};
+obj_pool_t sector_pool = {_MEMORYPOOL_DATA(sector_pool.pool, POOL_SECTOR_SIZE, NULL),
+	"sector", POOL_SECTOR_SIZE, POOL_SECTOR_N, 0, 0, 0};
+obj_pool_t fil_pool = {_MEMORYPOOL_DATA(fil_pool.pool, sizeof(FIL), NULL),
+	"FIL", sizeof(FIL), POOL_FIL_N, 0, 0, 0};
+obj_pool_t filinfo_pool = {_MEMORYPOOL_DATA(filinfo_pool.pool, sizeof(FILINFO), NULL),
+	"FILINFO", sizeof(FILINFO), POOL_FILINFO_N, 0, 0, 0};
+obj_pool_t lfn_pool = {_MEMORYPOOL_DATA(lfn_pool.pool, POOL_LFN_SIZE, NULL),
+	"LFN", POOL_LFN_SIZE, POOL_LFN_N, 0, 0, 0};
+
+static obj_pool_t * const pools[] = {&move_pool, &sector_pool, &fil_pool,
+	&filinfo_pool, &lfn_pool};
+
+void pools_init(void)
+{
+	chPoolLoadArray(&move_pool.pool, move_store, POOL_MOVE_N);
+	chPoolLoadArray(&sector_pool.pool, sector_store, POOL_SECTOR_N);
+	chPoolLoadArray(&fil_pool.pool, fil_store, POOL_FIL_N);
+	chPoolLoadArray(&filinfo_pool.pool, filinfo_store, POOL_FILINFO_N);
+	chPoolLoadArray(&lfn_pool.pool, lfn_store, POOL_LFN_N);
+}
+
+/*
+ * Returns NULL when the pool is empty, the pools have no provider so this
+ * never blocks or falls back to the heap.
+ */
+void *pool_alloc(obj_pool_t *op)
+{
+	void *obj;
+
+	chSysLock();
+	obj = chPoolAllocI(&op->pool);
+	if(obj)
+	{
+		if(++op->used > op->hwm)
+			op->hwm = op->used;
+	}
+	else
+		op->fails++;
+	chSysUnlock();
+
+	return obj;
+}
+
+void pool_free(obj_pool_t *op, void *obj)
+{
+	if(!obj)
+		return;
+
+	chSysLock();
+	chPoolFreeI(&op->pool, obj);
+	op->used--;
+	chSysUnlock();
+}
+
+void pools_print(BaseSequentialStream *chp)
+{
+	unsigned i;
+
+	chprintf(chp, "pool     size  total used  hwm fails\r\n");
+	for(i = 0; i < sizeof(pools) / sizeof(pools[0]); i++)
+		chprintf(chp, "%-8s %4u  %5u %4u %4u %5lu\r\n", pools[i]->name,
+			pools[i]->size, pools[i]->total, pools[i]->used,
+			pools[i]->hwm, pools[i]->fails);
+}
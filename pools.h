@@ -0,0 +1,61 @@
+/*
+ * pools.h
+ *
+ *  Fixed size object pools with usage counters. Allocation and release are
+ *  O(1) and never touch the heap.
+ */
+
+#include "ff.h"
+
+#ifndef POOLS_H_
+#define POOLS_H_
+
+#include "gcode_parser.h"
+#include "filetab.h"
+#include "fsstress.h"
+
+#define POOL_MOVE_N         16      /* move blocks */
+#define POOL_SECTOR_N       4       /* sector sized I/O buffers */
+/* file objects: the handle table, plus fsstress' threads and its shared file */
+#define POOL_FIL_N          (FILETAB_SLOTS + FSSTRESS_READERS + FSSTRESS_WRITERS + 1)
+#define POOL_FILINFO_N      8       /* directory entries, one per tree level */
+#define POOL_LFN_N          2       /* FatFs LFN buffers, used with the volume locked */
+
+#define POOL_SECTOR_SIZE    MMCSD_BLOCK_SIZE
+#define POOL_LFN_SIZE       ((_MAX_LFN + 1) * 2)
+
+typedef struct
+{
+	memory_pool_t pool;
+	const char *name;
+	uint16_t size;
+	uint16_t total;
+	uint16_t used;
+	uint16_t hwm;
+	uint32_t fails;
+} obj_pool_t;
+
+extern obj_pool_t move_pool;
+extern obj_pool_t sector_pool;
+extern obj_pool_t fil_pool;
+extern obj_pool_t filinfo_pool;
+extern obj_pool_t lfn_pool;
+
+void pools_init(void);
+void *pool_alloc(obj_pool_t *op);
+void pool_free(obj_pool_t *op, void *obj);
+void pools_print(BaseSequentialStream *chp);
+
+/*
+ * Typed wrappers.
+ */
+static inline _param_t *move_alloc(void) { return pool_alloc(&move_pool); }
+static inline void move_free(_param_t *mp) { pool_free(&move_pool, mp); }
+static inline char *sector_alloc(void) { return pool_alloc(&sector_pool); }
+static inline void sector_free(char *bp) { pool_free(&sector_pool, bp); }
+static inline FIL *fil_alloc(void) { return pool_alloc(&fil_pool); }
+static inline void fil_free(FIL *fp) { pool_free(&fil_pool, fp); }
+static inline FILINFO *filinfo_alloc(void) { return pool_alloc(&filinfo_pool); }
+static inline void filinfo_free(FILINFO *fip) { pool_free(&filinfo_pool, fip); }
+
+#endif /* POOLS_H_ */
@@ -0,0 +1,216 @@
+/*
+ * profref.c
+ *
+ *  Double precision reference of the motion profiles. profref_plan()
+ *  plans the S-curve again from the move itself, without rounding to
+ *  ticks, the ideal profile the rounding moves away from. profref_curve()
+ *  takes the plan scurve_plan() made, rounded phase times, scaled jerks
+ *  and trim included, so the fixed point evaluation of it can be checked
+ *  on its own. The shaper impulses are those of the textbook, at their
+ *  exact times. No kernel calls.
+ */
+
+/*===========================================================================*/
+/* Profile reference.                                                        */
+/*===========================================================================*/
+#include <string.h>
+#include <math.h>
+
+#include "profref.h"
+
+#define BISECT_STEPS    60
+
+/*
+ * Jerk ramp and constant acceleration times of a speed change by dv.
+ */
+static double _ramp(double dv, double a_max, double j_max, double *tj, double *ta)
+{
+	if(dv <= 0.0)
+	{
+		*tj = 0.0;
+		*ta = 0.0;
+	}
+	else if(dv * j_max >= a_max * a_max)
+	{
+		*tj = a_max / j_max;
+		*ta = dv / a_max - *tj;
+	}
+	else
+	{
+		*tj = sqrt(dv / j_max);
+		*ta = 0.0;
+	}
+	return 2.0 * *tj + *ta;
+}
+
+static double _length(double vp, double v_start, double v_end, double a_max,
+	double j_max)
+{
+	double tj, ta;
+
+	return (v_start + vp) / 2.0 * _ramp(vp - v_start, a_max, j_max, &tj, &ta) +
+		(v_end + vp) / 2.0 * _ramp(vp - v_end, a_max, j_max, &tj, &ta);
+}
+
+/*
+ * Same contract as scurve_plan() without the rate.
+ */
+bool profref_plan(profref_t *r, double len, double v_start, double v_end,
+	double v_max, double a_max, double j_max)
+{
+	double vp = v_max, lo, hi, mid, tj, ta, p = 0.0, v, a = 0.0, t, acc;
+	int i;
+
+	memset(r, 0, sizeof(*r));
+	r->len = len;
+	if(len <= 0.0)
+		return true;
+	v_start = fmin(v_start, v_max);
+	v_end = fmin(v_end, v_max);
+	lo = fmax(v_start, v_end);
+	if(_length(lo, v_start, v_end, a_max, j_max) > len)
+		return false;
+	if(_length(vp, v_start, v_end, a_max, j_max) > len)
+	{
+		hi = v_max;
+		for(i = 0; i < BISECT_STEPS; i++)
+		{
+			mid = (lo + hi) / 2.0;
+			if(_length(mid, v_start, v_end, a_max, j_max) > len)
+				hi = mid;
+			else
+				lo = mid;
+		}
+		vp = lo;
+	}
+	r->v_peak = vp;
+
+	_ramp(vp - v_start, a_max, j_max, &tj, &ta);
+	r->t[0] = tj;   r->j[0] = j_max;
+	r->t[1] = ta;
+	r->t[2] = tj;   r->j[2] = -j_max;
+	r->t[3] = (len - _length(vp, v_start, v_end, a_max, j_max)) / vp;
+	_ramp(vp - v_end, a_max, j_max, &tj, &ta);
+	r->t[4] = tj;   r->j[4] = -j_max;
+	r->t[5] = ta;
+	r->t[6] = tj;   r->j[6] = j_max;
+
+	v = v_start;
+	for(i = 0; i < SCURVE_PHASES; i++)
+	{
+		t = r->t[i];
+		r->start[i] = r->total;
+		r->p0[i] = p;
+		r->v0[i] = v;
+		r->a0[i] = a;
+		acc = a + r->j[i] * t;
+		p += v * t + a * t * t / 2.0 + r->j[i] * t * t * t / 6.0;
+		v += a * t + r->j[i] * t * t / 2.0;
+		a = acc;
+		r->total += t;
+	}
+	return true;
+}
+
+/*
+ * The phases of a planned S-curve in double. The trim phase gets the
+ * constant extra velocity that takes up what the rounding left of the
+ * length, as in scurve_plan().
+ */
+void profref_curve(profref_t *r, const scurve_t *s)
+{
+	double p = 0.0, v = (double)s->v_start, a = 0.0, t, j, extra;
+	int i;
+
+	memset(r, 0, sizeof(*r));
+	r->len = (double)s->len;
+	r->v_peak = (double)s->v_peak;
+	if(s->ticks == 0)
+		return;
+	for(i = 0; i < SCURVE_PHASES; i++)
+	{
+		t = (double)s->t[i];
+		j = (double)s->j[i];
+		p += v * t + a * t * t / 2.0 + j * t * t * t / 6.0;
+		v += a * t + j * t * t / 2.0;
+		a += j * t;
+	}
+	extra = ((double)s->len - p) / (double)s->t[s->trim];
+
+	p = 0.0;
+	v = (double)s->v_start;
+	a = 0.0;
+	for(i = 0; i < SCURVE_PHASES; i++)
+	{
+		t = r->t[i] = (double)s->t[i];
+		j = r->j[i] = (double)s->j[i];
+		r->start[i] = r->total;
+		r->p0[i] = p;
+		r->v0[i] = v + (i == (int)s->trim ? extra : 0.0);
+		r->a0[i] = a;
+		p += r->v0[i] * t + a * t * t / 2.0 + j * t * t * t / 6.0;
+		v += a * t + j * t * t / 2.0;
+		a += j * t;
+		r->total += t;
+	}
+}
+
+/*
+ * Position t seconds into the move, clamped to the move, its velocity in
+ * *vel when not NULL.
+ */
+double profref_pos(const profref_t *r, double t, double *vel)
+{
+	int i;
+
+	if(t < 0.0)
+		t = 0.0;
+	if(t > r->total)
+		t = r->total;
+	for(i = SCURVE_PHASES - 1; i > 0 && (t < r->start[i] || r->t[i] == 0.0); i--)
+		;
+	t -= r->start[i];
+	if(t > r->t[i])
+		t = r->t[i];
+	if(vel != NULL)
+		*vel = r->v0[i] + r->a0[i] * t + r->j[i] * t * t / 2.0;
+	return r->p0[i] + r->v0[i] * t + r->a0[i] * t * t / 2.0 +
+		r->j[i] * t * t * t / 6.0;
+}
+
+/*
+ * Amplitudes summing to one and delays in s of a shaper, returns how many.
+ */
+uint32_t profref_impulses(shaper_type_t type, double freq, double damping,
+	double *amp, double *delay)
+{
+	double root = sqrt(1.0 - damping * damping), td = 1.0 / (freq * root);
+	double k, sum = 0.0;
+	uint32_t i, n;
+
+	switch(type)
+	{
+	case SHAPER_ZV:
+		k = exp(-damping * M_PI / root);
+		amp[0] = 1.0;                           delay[0] = 0.0;
+		amp[1] = k;                             delay[1] = td / 2.0;
+		n = 2;
+		break;
+	case SHAPER_MZV:
+		k = exp(-0.75 * damping * M_PI / root);
+		amp[0] = 1.0 - 1.0 / sqrt(2.0);         delay[0] = 0.0;
+		amp[1] = (sqrt(2.0) - 1.0) * k;         delay[1] = 0.375 * td;
+		amp[2] = amp[0] * k * k;                delay[2] = 0.75 * td;
+		n = 3;
+		break;
+	default:
+		amp[0] = 1.0;                           delay[0] = 0.0;
+		n = 1;
+		break;
+	}
+	for(i = 0; i < n; i++)
+		sum += amp[i];
+	for(i = 0; i < n; i++)
+		amp[i] /= sum;
+	return n;
+}
@@ -0,0 +1,44 @@
+/*
+ * profref.h
+ *
+ *  Double precision reference of the motion profiles of scurve.c and
+ *  shaper.c, for the profile check and the host tests.
+ */
+
+#ifndef PROFREF_H_
+#define PROFREF_H_
+
+#include <stdbool.h>
+
+#include "scurve.h"
+#include "shaper.h"
+
+/*
+ * Ticks the phase times of scurve_plan() may move by when it rounds them,
+ * up to a tick for each of the three phases of a speed change and half a
+ * tick for the cruise. The profile may be that far ahead or behind the
+ * reference.
+ */
+#define PROFREF_ROUND_TICKS     3.5
+
+typedef struct
+{
+	double start[SCURVE_PHASES];    /* s */
+	double t[SCURVE_PHASES];
+	double j[SCURVE_PHASES];        /* mm/s^3 */
+	double p0[SCURVE_PHASES];       /* mm */
+	double v0[SCURVE_PHASES];       /* mm/s */
+	double a0[SCURVE_PHASES];       /* mm/s^2 */
+	double len;
+	double v_peak;
+	double total;                   /* s */
+} profref_t;
+
+bool profref_plan(profref_t *r, double len, double v_start, double v_end,
+	double v_max, double a_max, double j_max);
+void profref_curve(profref_t *r, const scurve_t *s);
+double profref_pos(const profref_t *r, double t, double *vel);
+uint32_t profref_impulses(shaper_type_t type, double freq, double damping,
+	double *amp, double *delay);
+
+#endif /* PROFREF_H_ */
@@ -0,0 +1,280 @@
+/*
+ * progress.c
+ *
+ *  Job progress as three sequence locked records, one per writer: the job
+ *  thread counts what it parsed and queued, the planner executor what it
+ *  ran, and the job control keeps the time spent paused. A writer bumps
+ *  the sequence to odd, updates and bumps it back to even, it never waits.
+ *  A reader copies a record and tries again when the sequence was odd or
+ *  moved meanwhile, so the job never notices how often it is polled.
+ *
+ *  The reader should run below the job thread and the executor, which the
+ *  shell and the USB side do. Should one ever catch a writer preempted
+ *  halfway it sleeps a tick after a few tries to let the writer finish.
+ */
+
+/*===========================================================================*/
+/* Job progress.                                                             */
+/*===========================================================================*/
+#include <string.h>
+
+#include "ch.h"
+#include "hal.h"
+
+#include "chprintf.h"
+
+#include "progress.h"
+
+/* orders the record against the sequence, one core so no DMB needed */
+#define BARRIER()       __asm__ volatile("" ::: "memory")
+
+/* zeroed at startup, the sequences have to start even */
+static progress_job_t pr_job;
+static progress_exec_t pr_exec;
+static progress_hold_t pr_hold;
+static volatile uint32_t pr_job_seq;
+static volatile uint32_t pr_exec_seq;
+static volatile uint32_t pr_hold_seq;
+
+static inline void _write_begin(volatile uint32_t *seq)
+{
+	(*seq)++;
+	BARRIER();
+}
+
+static inline void _write_end(volatile uint32_t *seq)
+{
+	BARRIER();
+	(*seq)++;
+}
+
+static void _read(const volatile uint32_t *seq, const void *src, void *dst, size_t n)
+{
+	uint32_t s, tries = 0;
+
+	while(true)
+	{
+		s = *seq;
+		BARRIER();
+		if(!(s & 1))
+		{
+			memcpy(dst, src, n);
+			BARRIER();
+			if(*seq == s)
+				return;
+		}
+		if(++tries > PROGRESS_RETRIES)
+			chThdSleep(1);
+	}
+}
+
+/*
+ * Job thread, before the first block is queued. The executor is idle
+ * between jobs, so its record is reset from here.
+ */
+void progress_begin(const char *name, uint32_t size)
+{
+	_write_begin(&pr_exec_seq);
+	pr_exec.blocks = 0;
+	pr_exec.done_us = 0;
+	_write_end(&pr_exec_seq);
+
+	_write_begin(&pr_job_seq);
+	strncpy(pr_job.name, name, sizeof(pr_job.name) - 1);
+	pr_job.name[sizeof(pr_job.name) - 1] = 0;
+	pr_job.size = size;
+	pr_job.bytes = 0;
+	pr_job.lines = 0;
+	pr_job.blocks = 0;
+	pr_job.planned_us = 0;
+	pr_job.start = chVTGetSystemTimeX();
+	pr_job.state = PROGRESS_RUNNING;
+	_write_end(&pr_job_seq);
+}
+
+/*
+ * Job thread, per line: file offset of the next unparsed byte.
+ */
+void progress_consumed(uint32_t bytes, uint32_t lines)
+{
+	_write_begin(&pr_job_seq);
+	pr_job.bytes = bytes;
+	pr_job.lines = lines;
+	_write_end(&pr_job_seq);
+}
+
+/*
+ * Job thread, per block queued.
+ */
+void progress_planned(uint32_t us)
+{
+	_write_begin(&pr_job_seq);
+	pr_job.blocks++;
+	pr_job.planned_us += us;
+	_write_end(&pr_job_seq);
+}
+
+/*
+ * Executor, per block done.
+ */
+void progress_executed(uint32_t us)
+{
+	_write_begin(&pr_exec_seq);
+	pr_exec.blocks++;
+	pr_exec.done_us += us;
+	_write_end(&pr_exec_seq);
+}
+
+/*
+ * Job thread, once the planner has run out.
+ */
+void progress_end(progress_state_t state)
+{
+	_write_begin(&pr_job_seq);
+	pr_job.state = state;
+	pr_job.end = chVTGetSystemTimeX();
+	_write_end(&pr_job_seq);
+}
+
+/*
+ * Job control, under its lock. The pause state is kept apart from the job
+ * record because the job thread is usually blocked on a full planner when
+ * the job gets paused.
+ */
+void progress_hold(bool paused)
+{
+	systime_t now = chVTGetSystemTimeX();
+
+	if(paused == pr_hold.paused)
+		return;
+	_write_begin(&pr_hold_seq);
+	if(paused)
+		pr_hold.since = now;
+	else
+		pr_hold.total += now - pr_hold.since;
+	pr_hold.paused = paused;
+	_write_end(&pr_hold_seq);
+}
+
+/*
+ * Job control, before the job thread is started.
+ */
+void progress_hold_reset(void)
+{
+	_write_begin(&pr_hold_seq);
+	pr_hold.paused = false;
+	pr_hold.total = 0;
+	_write_end(&pr_hold_seq);
+}
+
+/*
+ * Snapshot with the derived values. The estimate scales the motion time
+ * still to come by how real time compared to planned time so far, which
+ * takes in the dry run speed and stalls, time spent paused is left out of
+ * that. The motion time of the part of the file not parsed yet is
+ * extrapolated from the part that was.
+ *
+ * The executor only ever runs what the job thread queued before, so its
+ * record is read first and the job record read after it is at least as
+ * far. A job starting in between resets both, the executor counts of the
+ * old job are then cut to the new one.
+ */
+void progress_read(progress_t *snap)
+{
+	progress_job_t *jp = &snap->job;
+	progress_hold_t hold;
+	uint64_t left_us;
+	systime_t now, paused;
+
+	_read(&pr_exec_seq, &pr_exec, &snap->exec, sizeof(snap->exec));
+	_read(&pr_job_seq, &pr_job, &snap->job, sizeof(snap->job));
+	_read(&pr_hold_seq, &pr_hold, &hold, sizeof(hold));
+	if(snap->exec.blocks > jp->blocks)
+	{
+		snap->exec.blocks = jp->blocks;
+		snap->exec.done_us = jp->planned_us;
+	}
+
+	now = jp->state == PROGRESS_RUNNING ? chVTGetSystemTimeX() : jp->end;
+	paused = hold.total;
+	if(hold.paused && jp->state == PROGRESS_RUNNING)
+	{
+		paused += now - hold.since;
+		jp->state = PROGRESS_PAUSED;
+	}
+	/* not ST2MS(), that overflows after a few minutes */
+	snap->elapsed_ms = jp->state == PROGRESS_IDLE ? 0 :
+		(now - jp->start) / (CH_CFG_ST_FREQUENCY / 1000);
+	snap->paused_ms = jp->state == PROGRESS_IDLE ? 0 :
+		paused / (CH_CFG_ST_FREQUENCY / 1000);
+	if(snap->paused_ms > snap->elapsed_ms)
+		snap->paused_ms = snap->elapsed_ms;
+	snap->percent = jp->size ? (uint32_t)((uint64_t)jp->bytes * 1000 / jp->size) : 0;
+	snap->eta_ms = 0;
+	if((jp->state != PROGRESS_RUNNING && jp->state != PROGRESS_PAUSED) ||
+		jp->bytes == 0 || snap->exec.done_us == 0)
+		return;
+
+	left_us = jp->planned_us > snap->exec.done_us ?
+		jp->planned_us - snap->exec.done_us : 0;
+	if(jp->size > jp->bytes)
+		left_us += jp->planned_us * (jp->size - jp->bytes) / jp->bytes;
+	snap->eta_ms = (uint32_t)(left_us * (snap->elapsed_ms - snap->paused_ms) /
+		snap->exec.done_us);
+}
+
+/*===========================================================================*/
+/* Shell command.                                                            */
+/*===========================================================================*/
+
+static void _print_ms(BaseSequentialStream *chp, uint32_t ms)
+{
+	uint32_t s = ms / 1000;
+
+	chprintf(chp, "%luh%02lum%02lus", s / 3600, s / 60 % 60, s % 60);
+}
+
+void cmd_status(BaseSequentialStream *chp, int argc, char *argv[])
+{
+	static const char * const states[] = {"idle", "running", "paused", "done",
+		"failed", "aborted"};
+	progress_t snap;
+	uint32_t start, cycles;
+
+	(void)argv;
+	if(argc > 0)
+	{
+		chprintf(chp, "Usage: status\r\n");
+		return;
+	}
+
+	start = chSysGetRealtimeCounterX();
+	progress_read(&snap);
+	cycles = chSysGetRealtimeCounterX() - start;
+
+	chprintf(chp, "job: %s", states[snap.job.state]);
+	if(snap.job.state == PROGRESS_IDLE)
+	{
+		chprintf(chp, "\r\n");
+		return;
+	}
+	chprintf(chp, " %s, %lu.%lu%% of %lu bytes, %lu lines\r\n", snap.job.name,
+		snap.percent / 10, snap.percent % 10, snap.job.size, snap.job.lines);
+	chprintf(chp, "blocks: %lu queued, %lu done, %lu in the planner\r\n",
+		snap.job.blocks, snap.exec.blocks, snap.job.blocks - snap.exec.blocks);
+	chprintf(chp, "motion: %lu of %lu ms planned done, elapsed ",
+		(uint32_t)(snap.exec.done_us / 1000), (uint32_t)(snap.job.planned_us / 1000));
+	_print_ms(chp, snap.elapsed_ms);
+	if(snap.paused_ms)
+	{
+		chprintf(chp, " of which paused ");
+		_print_ms(chp, snap.paused_ms);
+	}
+	if(snap.eta_ms)
+	{
+		chprintf(chp, ", about ");
+		_print_ms(chp, snap.eta_ms);
+		chprintf(chp, " to go");
+	}
+	chprintf(chp, "\r\nsnapshot in %lu cycles\r\n", cycles);
+}
@@ -0,0 +1,79 @@
+/*
+ * progress.h
+ *
+ *  Progress of the running job, published as a snapshot that any thread
+ *  can read at any rate without a lock.
+ */
+
+#ifndef PROGRESS_H_
+#define PROGRESS_H_
+
+#define PROGRESS_NAME_MAX   32
+#define PROGRESS_RETRIES    4       /* reader spins, then sleeps a tick */
+
+typedef enum
+{
+	PROGRESS_IDLE = 0,
+	PROGRESS_RUNNING,
+	PROGRESS_PAUSED,            /* only in a snapshot, see progress_hold() */
+	PROGRESS_DONE,
+	PROGRESS_FAILED,
+	PROGRESS_ABORTED
+} progress_state_t;
+
+/*
+ * Written by the job thread.
+ */
+typedef struct
+{
+	progress_state_t state;
+	char name[PROGRESS_NAME_MAX];
+	uint32_t size;              /* of the job file */
+	uint32_t bytes;             /* consumed by the parser */
+	uint32_t lines;
+	uint32_t blocks;            /* queued to the planner */
+	uint64_t planned_us;        /* motion time of those */
+	systime_t start;
+	systime_t end;
+} progress_job_t;
+
+/*
+ * Written by the planner executor.
+ */
+typedef struct
+{
+	uint32_t blocks;            /* executed */
+	uint64_t done_us;           /* planned motion time of those */
+} progress_exec_t;
+
+/*
+ * Written by the job control in job.c.
+ */
+typedef struct
+{
+	bool paused;
+	systime_t since;            /* of the current pause */
+	systime_t total;            /* of the pauses before */
+} progress_hold_t;
+
+typedef struct
+{
+	progress_job_t job;
+	progress_exec_t exec;
+	uint32_t elapsed_ms;        /* since the start, to the end when done */
+	uint32_t paused_ms;         /* part of elapsed_ms */
+	uint32_t percent;           /* of the file, x 10 */
+	uint32_t eta_ms;            /* 0 until there is enough to go by */
+} progress_t;
+
+void progress_begin(const char *name, uint32_t size);
+void progress_consumed(uint32_t bytes, uint32_t lines);
+void progress_planned(uint32_t us);
+void progress_executed(uint32_t us);
+void progress_end(progress_state_t state);
+void progress_hold(bool paused);
+void progress_hold_reset(void);
+void progress_read(progress_t *snap);
+void cmd_status(BaseSequentialStream *chp, int argc, char *argv[]);
+
+#endif /* PROGRESS_H_ */
@@ -0,0 +1,24 @@
+/*
+ * q16.h
+ *
+ *  Q16.16 fixed point, lengths in mm and velocities in mm/s.
+ */
+
+#ifndef Q16_H_
+#define Q16_H_
+
+#include <stdint.h>
+
+typedef int32_t q16_t;
+
+#define Q16_ONE         ((q16_t)1 << 16)
+
+#define Q16_FROM_F(f)   ((q16_t)((f) * 65536.0f + ((f) < 0.0f ? -0.5f : 0.5f)))
+#define Q16_TO_F(q)     ((float)(q) * (1.0f / 65536.0f))
+
+static inline q16_t q16_mul(q16_t a, q16_t b)
+{
+	return (q16_t)(((int64_t)a * b + 0x8000) >> 16);
+}
+
+#endif /* Q16_H_ */
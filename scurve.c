@@ -0,0 +1,252 @@
+/*
+ * scurve.c
+ *
+ *  Jerk limited (S-curve) velocity profile of one move: up to seven
+ *  phases of constant jerk, accelerating, cruising and decelerating. The
+ *  acceleration ramps instead of stepping, which is what excites the frame
+ *  at every corner of a trapezoid.
+ *
+ *  Planning is float and runs once per move. The phase times are rounded
+ *  to update ticks, the jerk of each ramp is scaled to keep its change of
+ *  speed, and one phase takes up the few um the rounding leaves of the
+ *  length as a constant extra velocity, so the move ends exactly at len.
+ *  Each phase is reduced to a cubic in the normalised phase time with all
+ *  coefficients in mm. Evaluation per tick is three
+ *  multiplies with no division. The phase time is a Q0.32 fraction, Q16.16
+ *  would cost up to len / 65536 of position on a long cruise. No kernel
+ *  calls.
+ */
+
+/*===========================================================================*/
+/* S-curve profiles.                                                         */
+/*===========================================================================*/
+#include <string.h>
+#include <math.h>
+
+#include "scurve.h"
+
+#define BISECT_STEPS    24
+
+/*
+ * x times a Q0.32 fraction.
+ */
+static inline q16_t _mul(uint32_t tau, q16_t x)
+{
+	return (q16_t)(((int64_t)x * tau + 0x80000000LL) >> 32);
+}
+
+/*
+ * Time of a jerk limited speed change by dv, *tj is the time of each jerk
+ * ramp and *ta the time at full acceleration between them.
+ */
+static float _ramp(float dv, float a_max, float j_max, float *tj, float *ta)
+{
+	if(dv * j_max >= a_max * a_max)
+	{
+		*tj = a_max / j_max;
+		*ta = dv / a_max - *tj;
+	}
+	else
+	{
+		*tj = sqrtf(dv / j_max);
+		*ta = 0.0f;
+	}
+	return 2.0f * *tj + *ta;
+}
+
+/*
+ * Length of accelerating to vp and decelerating to v_end, the velocity
+ * of a symmetric ramp averages to the mean of its ends.
+ */
+static float _length(float vp, float v_start, float v_end, float a_max, float j_max)
+{
+	float tj, ta;
+
+	return (v_start + vp) * 0.5f * _ramp(vp - v_start, a_max, j_max, &tj, &ta) +
+		(v_end + vp) * 0.5f * _ramp(vp - v_end, a_max, j_max, &tj, &ta);
+}
+
+/*
+ * Plans a move of len mm starting at v_start and ending at v_end, evaluated
+ * at rate ticks per second. False if v_end cannot be reached within len.
+ * A move of no length has no ticks and is done at once, one shorter than
+ * a tick gets a single tick that ends on len.
+ */
+bool scurve_plan(scurve_t *s, float len, float v_start, float v_end,
+	float v_max, float a_max, float j_max, uint32_t rate)
+{
+	float vp = v_max, lo, hi, mid, tj, ta, t;
+	float v, a, sum, v1, fwd, best, dv;
+	scurve_phase_t *pp;
+	q16_t p0;
+	int i, trim;
+
+	memset(s, 0, sizeof(*s));
+	if(len <= 0.0f)
+	{
+		s->phase = SCURVE_PHASES;
+		return true;
+	}
+	if(v_start > v_max)
+		v_start = v_max;
+	if(v_end > v_max)
+		v_end = v_max;
+	lo = v_start > v_end ? v_start : v_end;
+	if(_length(lo, v_start, v_end, a_max, j_max) > len)
+		return false;
+	if(_length(vp, v_start, v_end, a_max, j_max) > len)
+	{
+		/* no room to cruise at v_max, find the peak that fits */
+		hi = v_max;
+		for(i = 0; i < BISECT_STEPS; i++)
+		{
+			mid = 0.5f * (lo + hi);
+			if(_length(mid, v_start, v_end, a_max, j_max) > len)
+				hi = mid;
+			else
+				lo = mid;
+		}
+		vp = lo;
+	}
+
+	_ramp(vp - v_start, a_max, j_max, &tj, &ta);
+	s->t[0] = tj;   s->j[0] = j_max;
+	s->t[1] = ta;   s->j[1] = 0.0f;
+	s->t[2] = tj;   s->j[2] = -j_max;
+	_ramp(vp - v_end, a_max, j_max, &tj, &ta);
+	s->t[4] = tj;   s->j[4] = -j_max;
+	s->t[5] = ta;   s->j[5] = 0.0f;
+	s->t[6] = tj;   s->j[6] = j_max;
+	s->t[3] = 0.0f; s->j[3] = 0.0f;
+
+	/* whole ticks rounded up, the jerk of each ramp scaled down so it
+	   still changes the speed by dv = j * tj * (tj + ta), then the phases
+	   again with the rounded times */
+	for(i = 0; i < SCURVE_PHASES; i++)
+	{
+		if(i == 3)
+			continue;
+		s->ph[i].ticks = (uint32_t)ceilf(s->t[i] * (float)rate - 0.01f);
+		s->t[i] = (float)s->ph[i].ticks / (float)rate;
+	}
+	t = s->t[0] * (s->t[0] + s->t[1]);
+	dv = t > 0.0f ? (vp - v_start) / t : 0.0f;
+	s->j[0] = dv;
+	s->j[2] = -dv;
+	t = s->t[4] * (s->t[4] + s->t[5]);
+	dv = t > 0.0f ? (vp - v_end) / t : 0.0f;
+	s->j[4] = -dv;
+	s->j[6] = dv;
+	v = v_start;
+	a = 0.0f;
+	sum = 0.0f;
+	for(i = 0; i < SCURVE_PHASES; i++)
+	{
+		t = s->t[i];
+		sum += v * t + a * t * t * 0.5f + s->j[i] * t * t * t / 6.0f;
+		v += a * t + s->j[i] * t * t * 0.5f;
+		a += s->j[i] * t;
+	}
+	if(len > sum)
+		s->ph[3].ticks = (uint32_t)((len - sum) / vp * (float)rate + 0.5f);
+	for(i = 0; i < SCURVE_PHASES && s->ph[i].ticks == 0; i++)
+		;
+	if(i == SCURVE_PHASES)
+		s->ph[3].ticks = 1;
+	s->t[3] = (float)s->ph[3].ticks / (float)rate;
+
+	/* coefficients, the phase that covers the most at its lowest speed
+	   takes up what the rounding left, so the trim never runs backwards */
+	s->len = len;
+	s->v_start = v_start;
+	s->v_peak = vp;
+	v = v_start;
+	a = 0.0f;
+	p0 = Q16_FROM_F(len);
+	trim = 3;
+	best = -1.0f;
+	for(i = 0; i < SCURVE_PHASES; i++)
+	{
+		pp = &s->ph[i];
+		t = s->t[i];
+		pp->v0 = Q16_FROM_F(v);
+		s->ticks += pp->ticks;
+		if(pp->ticks == 0)
+			continue;
+		pp->inv = pp->ticks > 1 ? (uint32_t)(((uint64_t)1 << 32) / pp->ticks) : 0xFFFFFFFFU;
+		pp->rem = pp->ticks > 1 ? (uint32_t)(((uint64_t)1 << 32) % pp->ticks) : 0;
+		pp->a1 = Q16_FROM_F(v * t);
+		pp->a2 = Q16_FROM_F(a * t * t * 0.5f);
+		pp->a3 = Q16_FROM_F(s->j[i] * t * t * t / 6.0f);
+		pp->b1 = Q16_FROM_F(a * t);
+		pp->b2 = Q16_FROM_F(s->j[i] * t * t * 0.5f);
+		p0 -= pp->a1 + pp->a2 + pp->a3;
+		v1 = v + a * t + s->j[i] * t * t * 0.5f;
+		fwd = (v < v1 ? v : v1) * t;
+		if(fwd > best)
+		{
+			best = fwd;
+			trim = i;
+		}
+		v = v1;
+		a += s->j[i] * t;
+	}
+	s->trim = trim;
+	s->ph[trim].a1 += p0;
+	s->ph[trim].v0 += Q16_FROM_F(Q16_TO_F(p0) / s->t[trim]);
+
+	p0 = 0;
+	for(i = 0; i < SCURVE_PHASES; i++)
+	{
+		pp = &s->ph[i];
+		pp->p0 = p0;
+		p0 += pp->a1 + pp->a2 + pp->a3;
+	}
+	return true;
+}
+
+/*
+ * Position of the next tick, its velocity in *vel when not NULL. After the
+ * last tick it stays at the end of the move. The phase time steps by inv
+ * with the remainder carried, n * inv alone falls behind by up to
+ * ticks / 2^32 of the phase, microns on a long cruise.
+ */
+q16_t scurve_step(scurve_t *s, q16_t *vel)
+{
+	const scurve_phase_t *pp;
+	uint32_t tau;
+
+	while(s->phase < SCURVE_PHASES && s->n >= s->ph[s->phase].ticks)
+	{
+		s->phase++;
+		s->n = 0;
+		s->tau = 0;
+		s->carry = 0;
+	}
+	if(s->phase == SCURVE_PHASES)
+	{
+		pp = &s->ph[SCURVE_PHASES - 1];
+		if(vel != NULL)
+			*vel = pp->v0 + pp->b1 + pp->b2;
+		return pp->p0 + pp->a1 + pp->a2 + pp->a3;
+	}
+
+	pp = &s->ph[s->phase];
+	tau = s->tau;
+	s->n++;
+	s->tau += pp->inv;
+	s->carry += pp->rem;
+	if(s->carry >= pp->ticks)
+	{
+		s->carry -= pp->ticks;
+		s->tau++;
+	}
+	if(vel != NULL)
+		*vel = pp->v0 + _mul(tau, pp->b1 + _mul(tau, pp->b2));
+	return pp->p0 + _mul(tau, pp->a1 + _mul(tau, pp->a2 + _mul(tau, pp->a3)));
+}
+
+bool scurve_done(const scurve_t *s)
+{
+	return s->phase == SCURVE_PHASES;
+}
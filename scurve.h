@@ -0,0 +1,56 @@
+/*
+ * scurve.h
+ *
+ *  Jerk limited velocity profile of one move, evaluated per update tick in
+ *  Q16.16.
+ */
+
+#ifndef SCURVE_H_
+#define SCURVE_H_
+
+#include <stdbool.h>
+
+#include "q16.h"
+
+#define SCURVE_PHASES       7
+
+/*
+ * One phase of constant jerk. With tau = n / ticks in [0, 1) as Q0.32:
+ * p = p0 + tau * (a1 + tau * (a2 + tau * a3)), v = v0 + tau * (b1 + tau * b2)
+ */
+typedef struct
+{
+	uint32_t ticks;
+	uint32_t inv;               /* 2^32 / ticks */
+	uint32_t rem;               /* 2^32 % ticks, carried into tau */
+	q16_t p0;                   /* mm */
+	q16_t a1;
+	q16_t a2;
+	q16_t a3;
+	q16_t v0;                   /* mm/s */
+	q16_t b1;
+	q16_t b2;
+} scurve_phase_t;
+
+typedef struct
+{
+	scurve_phase_t ph[SCURVE_PHASES];
+	float t[SCURVE_PHASES];     /* phase times after rounding to ticks, s */
+	float j[SCURVE_PHASES];     /* jerk, mm/s^3 */
+	float len;
+	float v_start;
+	float v_peak;
+	uint32_t ticks;             /* whole move */
+	uint32_t trim;              /* phase that takes up the rounding */
+	uint32_t phase;             /* cursor of scurve_step() */
+	uint32_t n;
+	uint32_t tau;               /* n * 2^32 / ticks, rounded down */
+	uint32_t carry;             /* n * rem % ticks */
+} scurve_t;
+
+bool scurve_plan(scurve_t *s, float len, float v_start, float v_end,
+	float v_max, float a_max, float j_max, uint32_t rate);
+q16_t scurve_step(scurve_t *s, q16_t *vel);
+bool scurve_done(const scurve_t *s);
+
+#endif /* SCURVE_H_ */
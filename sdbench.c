@@ -0,0 +1,206 @@
+/*
+ * sdbench.c
+ *
+ *  Raw SD throughput and latency test. The transfers go straight to the
+ *  driver, past the sector cache, into the extent of a scratch file so the
+ *  file system is never touched. Sequential and random reads and writes of
+ *  512 B, 4 KB and 32 KB, with the median, 90th percentile and worst
+ *  latency of each.
+ */
+
+/*===========================================================================*/
+/* SD benchmark.                                                             */
+/*===========================================================================*/
+#include <stdlib.h>
+#include <string.h>
+
+#include "ch.h"
+#include "hal.h"
+
+#include "chprintf.h"
+
+#include "ff.h"
+#include "diskio.h"
+#include "fat.h"
+#include "clmap.h"
+#include "memmap.h"
+#include "pools.h"
+#include "filetab.h"
+#include "sdbench.h"
+#include "sdcache.h"
+#include "sdmode.h"
+#include "volume.h"
+#include "job.h"
+
+static const uint32_t bench_sizes[] = {512, 4096, SDBENCH_XFER_MAX};
+
+static uint32_t lat_us[SDBENCH_OPS] CCM_DATA;
+static uint8_t fat_buf[MMCSD_BLOCK_SIZE] CCM_DATA;
+
+static int _cmp_u32(const void *a, const void *b)
+{
+	uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+
+	return (x > y) - (x < y);
+}
+
+/*
+ * Next cluster in the chain, 0 on error. The volume lock must be held.
+ */
+static uint32_t _fat_next(FATFS *fs, uint32_t clst)
+{
+	uint32_t per, ofs;
+
+	if(fs->fs_type == FS_FAT12)
+		return 0;
+	per = (fs->fs_type == FS_FAT32) ? MMCSD_BLOCK_SIZE / 4 : MMCSD_BLOCK_SIZE / 2;
+	if(disk_read(fs->drv, fat_buf, fs->fatbase + clst / per, 1) != RES_OK)
+		return 0;
+	ofs = clst % per;
+	if(fs->fs_type == FS_FAT32)
+		return LD_DWORD(fat_buf + ofs * 4) & 0x0FFFFFFF;
+	return LD_WORD(fat_buf + ofs * 2);
+}
+
+/*
+ * First sector of the file when its clusters are contiguous, else 0.
+ */
+static uint32_t _extent(FIL *fp)
+{
+	FATFS *fs = fp->fs;
+	uint32_t clst, n, i, sector = 0;
+
+	n = (fp->fsize + fs->csize * MMCSD_BLOCK_SIZE - 1) / (fs->csize * MMCSD_BLOCK_SIZE);
+	ff_req_grant(fs->sobj);
+	for(clst = fp->sclust, i = 1; i < n; i++, clst++)
+		if(_fat_next(fs, clst) != clst + 1)
+			break;
+	if(fp->sclust >= 2 && i == n)
+		sector = fs->database + (fp->sclust - 2) * fs->csize;
+	ff_rel_grant(fs->sobj);
+	return sector;
+}
+
+/*
+ * One size, one access pattern. The card is owned by the caller.
+ */
+static void _run(BaseSequentialStream *chp, uint8_t *buf, uint32_t base,
+	uint32_t size, bool random, bool write)
+{
+	uint32_t nsect = size / MMCSD_BLOCK_SIZE, slots = SDBENCH_SIZE / size;
+	uint32_t i, sector, errors = 0;
+	uint64_t total = 0;
+	rtcnt_t start, cycles;
+
+	for(i = 0; i < SDBENCH_OPS; i++)
+	{
+		sector = base + (random ? (uint32_t)rand() % slots : i % slots) * nsect;
+		start = chSysGetRealtimeCounterX();
+		if(write ? sdcWrite(&SDCD1, sector, buf, nsect) :
+			sdcRead(&SDCD1, sector, buf, nsect))
+		{
+			errors++;
+			sdcGetAndClearErrors(&SDCD1);
+		}
+		cycles = chSysGetRealtimeCounterX() - start;
+		lat_us[i] = cycles / (STM32_SYSCLK / 1000000);
+		total += lat_us[i];
+	}
+	qsort(lat_us, SDBENCH_OPS, sizeof(lat_us[0]), _cmp_u32);
+
+	chprintf(chp, "%s %-5s %5lu B %6lu KB/s  p50 %6lu us  p90 %6lu us  max %6lu us",
+		random ? "rand" : "seq ", write ? "write" : "read", size,
+		total ? (uint32_t)((uint64_t)size * SDBENCH_OPS * 1000000 / 1024 / total) : 0,
+		lat_us[SDBENCH_OPS / 2], lat_us[SDBENCH_OPS * 9 / 10],
+		lat_us[SDBENCH_OPS - 1]);
+	if(errors)
+		chprintf(chp, "  %lu errors", errors);
+	chprintf(chp, "\r\n");
+}
+
+void cmd_sdbench(BaseSequentialStream *chp, int argc, char *argv[])
+{
+	FIL *fil = NULL;
+	uint8_t *buf;
+	uint32_t base, ofs, s;
+	UINT bw;
+	FRESULT fr;
+	int random, write;
+
+	(void)argv;
+	if(argc > 0)
+	{
+		chprintf(chp, "Usage: sdbench\r\n");
+		return;
+	}
+	/* it would take the card from the job for seconds */
+	if(job_state() != JOB_IDLE)
+	{
+		chprintf(chp, "sdbench: a job is running, see job\r\n");
+		return;
+	}
+	if(volume_mount() != FR_OK)
+	{
+		chprintf(chp, "FS: no card, or unmounted\r\n");
+		return;
+	}
+	buf = chHeapAlloc(NULL, SDBENCH_XFER_MAX);
+	if(buf == NULL || !MEM_IS_DMA_SAFE(buf))
+	{
+		chprintf(chp, "sdbench: no %d byte DMA buffer\r\n", SDBENCH_XFER_MAX);
+		goto out;
+	}
+	fil = filetab_fil_alloc();
+	if(fil == NULL)
+	{
+		chprintf(chp, "sdbench: no free file object\r\n");
+		goto out;
+	}
+
+	/* scratch file, placed in one free run if the map has one */
+	filetab_evict(SDBENCH_FILE);
+	fr = f_open(fil, SDBENCH_FILE, FA_WRITE | FA_READ | FA_CREATE_ALWAYS);
+	if(fr != FR_OK)
+	{
+		chprintf(chp, "sdbench: cannot create %s\r\n", SDBENCH_FILE);
+		verbose_error(chp, fr);
+		fil_free(fil);
+		fil = NULL;
+		goto out;
+	}
+	clmap_prepare(fil, SDBENCH_SIZE);
+	memset(buf, 0xA5, SDBENCH_XFER_MAX);
+	for(ofs = 0, fr = FR_OK; ofs < SDBENCH_SIZE && fr == FR_OK; ofs += bw)
+		fr = f_write(fil, buf, SDBENCH_XFER_MAX, &bw);
+	if(fr == FR_OK)
+		fr = f_sync(fil);
+	base = (fr == FR_OK) ? _extent(fil) : 0;
+	if(base == 0)
+	{
+		chprintf(chp, "sdbench: no contiguous %d KB for the scratch file\r\n",
+			SDBENCH_SIZE / 1024);
+		goto close;
+	}
+
+	chprintf(chp, "SD: %d bit bus at %lu kHz, high speed %s, sectors %lu+%d\r\n",
+		sdmode_bus_width(), sdmode_clock_khz(), sdmode.hs ? "on" : "off",
+		base, SDBENCH_SIZE / MMCSD_BLOCK_SIZE);
+
+	/* nothing of ours left dirty, then the card is ours alone */
+	sdcache_sync();
+	sdcache_acquire();
+	for(random = 0; random < 2; random++)
+		for(write = 0; write < 2; write++)
+			for(s = 0; s < sizeof(bench_sizes) / sizeof(bench_sizes[0]); s++)
+				_run(chp, buf, base, bench_sizes[s], random, write);
+	sdcache_release();
+
+close:
+	/* cached lines of the scratch extent are stale, it is freed below */
+	f_close(fil);
+	f_unlink(SDBENCH_FILE);
+	fil_free(fil);
+out:
+	if(buf)
+		chHeapFree(buf);
+}
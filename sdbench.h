@@ -0,0 +1,17 @@
+/*
+ * sdbench.h
+ *
+ *  Raw SD throughput and latency test.
+ */
+
+#ifndef SDBENCH_H_
+#define SDBENCH_H_
+
+#define SDBENCH_FILE        "SDBENCH.BIN"
+#define SDBENCH_SIZE        (1024 * 1024)   /* scratch extent, bytes */
+#define SDBENCH_XFER_MAX    (32 * 1024)
+#define SDBENCH_OPS         32              /* transfers per test */
+
+void cmd_sdbench(BaseSequentialStream *chp, int argc, char *argv[]);
+
+#endif /* SDBENCH_H_ */
@@ -0,0 +1,494 @@
+/*
+ * sdcache.c
+ *
+ *  Set associative sector cache between FatFs and the SDIO driver. Single
+ *  sector accesses, which is all the FAT, directory and FIL window traffic,
+ *  go through the cache with LRU replacement. Writes stay dirty until they
+ *  are evicted or FatFs asks for CTRL_SYNC, then they are handed to the I/O
+ *  scheduler as write-behind and the line is clean again. A write-behind
+ *  that fails is reported by the next call of the thread that evicted the
+ *  line, and by the next sync. A run of sequential misses turns on
+ *  read-ahead, the next sectors come in with one multi block read. Multi
+ *  sector transfers bypass the cache but are kept coherent with it.
+ */
+
+/*===========================================================================*/
+/* Sector cache.                                                             */
+/*===========================================================================*/
+#include <string.h>
+
+#include "ch.h"
+#include "hal.h"
+
+#include "chprintf.h"
+
+#include "sdcache.h"
+#include "memmap.h"
+#include "iosched.h"
+
+#define LINE_VALID      0x01
+#define LINE_DIRTY      0x02
+#define LINE_PREFETCH   0x04        /* read ahead, not used yet */
+#define LINE_SYNC       0x08        /* dirty when a sync began */
+
+#define SECTOR_WORDS    (SDCACHE_SECTOR_SIZE / sizeof(uint32_t))
+
+typedef struct
+{
+	uint32_t sector;
+	uint32_t stamp;
+	uint8_t flags;
+} sdcache_tag_t;
+
+/*
+ * Tags are CPU only, the lines and the staging buffer are SDIO DMA targets.
+ */
+static sdcache_tag_t tags[SDCACHE_SETS][SDCACHE_WAYS] CCM_DATA;
+static uint32_t lines[SDCACHE_SETS][SDCACHE_WAYS][SECTOR_WORDS] DMA_DATA;
+static uint32_t staging[SDCACHE_READAHEAD][SECTOR_WORDS] DMA_DATA;
+
+static uint32_t sdcache_clock CCM_DATA;
+static uint32_t seq_next CCM_DATA;
+static uint32_t seq_run CCM_DATA;
+static MUTEX_DECL(sdcache_mtx);
+
+sdcache_stats_t sdcache_stats CCM_DATA;
+
+#define SET_OF(sector)  ((sector) & (SDCACHE_SETS - 1))
+#define LINE(set, way)  ((uint8_t *)lines[set][way])
+
+/*===========================================================================*/
+/* Device access.                                                            */
+/*===========================================================================*/
+
+/*
+ * The SDIO DMA cannot reach the CCM and wants word aligned buffers, others
+ * are bounced through the staging buffer.
+ */
+static bool _dev_read(uint8_t *buf, uint32_t sector, uint32_t count)
+{
+	uint32_t n;
+
+	if(MEM_IS_DMA_SAFE(buf))
+		return iosched_read(sector, buf, count);
+	while(count)
+	{
+		n = count < SDCACHE_READAHEAD ? count : SDCACHE_READAHEAD;
+		if(iosched_read(sector, (uint8_t *)staging, n))
+			return HAL_FAILED;
+		memcpy(buf, staging, n * SDCACHE_SECTOR_SIZE);
+		sdcache_stats.bounced += n;
+		buf += n * SDCACHE_SECTOR_SIZE;
+		sector += n;
+		count -= n;
+	}
+	return HAL_SUCCESS;
+}
+
+static bool _dev_write(const uint8_t *buf, uint32_t sector, uint32_t count)
+{
+	uint32_t n;
+
+	if(MEM_IS_DMA_SAFE(buf))
+		return iosched_write(sector, buf, count);
+	while(count)
+	{
+		n = count < SDCACHE_READAHEAD ? count : SDCACHE_READAHEAD;
+		memcpy(staging, buf, n * SDCACHE_SECTOR_SIZE);
+		if(iosched_write(sector, (uint8_t *)staging, n))
+			return HAL_FAILED;
+		sdcache_stats.bounced += n;
+		buf += n * SDCACHE_SECTOR_SIZE;
+		sector += n;
+		count -= n;
+	}
+	return HAL_SUCCESS;
+}
+
+/*===========================================================================*/
+/* Lines.                                                                    */
+/*===========================================================================*/
+
+static int _lookup(uint32_t sector)
+{
+	sdcache_tag_t *tp = tags[SET_OF(sector)];
+	int way;
+
+	for(way = 0; way < SDCACHE_WAYS; way++)
+		if((tp[way].flags & LINE_VALID) && tp[way].sector == sector)
+			return way;
+	return -1;
+}
+
+/*
+ * Frees a way in the set, an invalid one or else the least recently used.
+ * A dirty victim is queued for write-behind.
+ */
+static int _victim(uint32_t set)
+{
+	sdcache_tag_t *tp = tags[set];
+	int way, lru = 0;
+
+	for(way = 0; way < SDCACHE_WAYS; way++)
+	{
+		if(!(tp[way].flags & LINE_VALID))
+			return way;
+		if((int32_t)(tp[way].stamp - tp[lru].stamp) < 0)
+			lru = way;
+	}
+	if(tp[lru].flags & LINE_DIRTY)
+	{
+		iosched_write_behind(tp[lru].sector, LINE(set, lru));
+		sdcache_stats.writebacks++;
+	}
+	tp[lru].flags = 0;
+	return lru;
+}
+
+static void _install(uint32_t sector, int way, uint8_t flags)
+{
+	sdcache_tag_t *tp = &tags[SET_OF(sector)][way];
+
+	tp->sector = sector;
+	tp->stamp = ++sdcache_clock;
+	tp->flags = LINE_VALID | flags;
+}
+
+/*
+ * Reads n sectors, at most SDCACHE_READAHEAD, from sector on in one
+ * command, sector itself is left in staging[0]. On a demand read that one
+ * is not counted as read ahead. Sectors already cached are not replaced,
+ * they may be dirty. Past the end of the card a demand read fails and read
+ * ahead does nothing.
+ */
+static bool _prefetch(uint32_t sector, uint32_t n, bool demand)
+{
+	uint32_t i, capacity;
+	int way;
+
+	capacity = mmcsdGetCardCapacity(&SDCD1);
+	if(capacity && sector >= capacity)
+		return demand ? HAL_FAILED : HAL_SUCCESS;
+	if(n > SDCACHE_READAHEAD)
+		n = SDCACHE_READAHEAD;
+	if(capacity && sector + n > capacity)
+		n = capacity - sector;
+	if(iosched_read(sector, (uint8_t *)staging, n))
+		return HAL_FAILED;
+	sdcache_stats.prefetches++;
+
+	for(i = 0; i < n; i++)
+	{
+		if(_lookup(sector + i) >= 0)
+			continue;
+		way = _victim(SET_OF(sector + i));
+		memcpy(LINE(SET_OF(sector + i), way), staging[i], SDCACHE_SECTOR_SIZE);
+		if(i == 0 && demand)
+		{
+			_install(sector, way, 0);
+			continue;
+		}
+		_install(sector + i, way, LINE_PREFETCH);
+		sdcache_stats.prefetched++;
+	}
+	return HAL_SUCCESS;
+}
+
+static bool _read_one(uint8_t *buf, uint32_t sector)
+{
+	uint32_t set = SET_OF(sector);
+	bool sequential;
+	int way;
+
+	sdcache_stats.reads++;
+	sequential = (sector == seq_next);
+	seq_run = sequential ? seq_run + 1 : 0;
+	seq_next = sector + 1;
+
+	if((way = _lookup(sector)) >= 0)
+	{
+		sdcache_stats.read_hits++;
+		if(tags[set][way].flags & LINE_PREFETCH)
+		{
+			sdcache_stats.prefetch_hits++;
+			tags[set][way].flags &= ~LINE_PREFETCH;
+		}
+		tags[set][way].stamp = ++sdcache_clock;
+		memcpy(buf, LINE(set, way), SDCACHE_SECTOR_SIZE);
+		return HAL_SUCCESS;
+	}
+
+	if(sequential && seq_run >= SDCACHE_SEQ_MIN)
+	{
+		if(_prefetch(sector, SDCACHE_READAHEAD, true))
+			return HAL_FAILED;
+		memcpy(buf, staging[0], SDCACHE_SECTOR_SIZE);
+		return HAL_SUCCESS;
+	}
+
+	way = _victim(set);
+	if(iosched_read(sector, LINE(set, way), 1))
+		return HAL_FAILED;
+	_install(sector, way, 0);
+	memcpy(buf, LINE(set, way), SDCACHE_SECTOR_SIZE);
+	return HAL_SUCCESS;
+}
+
+static bool _write_one(const uint8_t *buf, uint32_t sector)
+{
+	uint32_t set = SET_OF(sector);
+	int way;
+
+	uint8_t keep = 0;
+
+	sdcache_stats.writes++;
+	if((way = _lookup(sector)) >= 0)
+	{
+		sdcache_stats.write_hits++;
+		keep = tags[set][way].flags & LINE_SYNC;
+	}
+	else
+	{
+		way = _victim(set);
+	}
+	memcpy(LINE(set, way), buf, SDCACHE_SECTOR_SIZE);
+	_install(sector, way, LINE_DIRTY | keep);
+	return HAL_SUCCESS;
+}
+
+/*===========================================================================*/
+/* Interface for diskio.c                                                    */
+/*===========================================================================*/
+
+void sdcache_init(void)
+{
+	memset(&sdcache_stats, 0, sizeof(sdcache_stats));
+	sdcache_invalidate();
+}
+
+/*
+ * Drops every line, dirty ones included. Used when a card is (re)attached
+ * and the cached sectors may belong to another card.
+ */
+void sdcache_invalidate(void)
+{
+	chMtxLock(&sdcache_mtx);
+	memset(tags, 0, sizeof(tags));
+	sdcache_clock = 0;
+	seq_next = 0;
+	seq_run = 0;
+	chMtxUnlock(&sdcache_mtx);
+}
+
+bool sdcache_read(uint8_t *buf, uint32_t sector, uint32_t count)
+{
+	uint32_t i;
+	int way;
+	bool err;
+
+	chMtxLock(&sdcache_mtx);
+	if(count == 1)
+	{
+		err = _read_one(buf, sector);
+	}
+	else
+	{
+		/* straight from the card, then newer data from dirty lines */
+		sdcache_stats.direct_reads++;
+		seq_run = 0;
+		err = _dev_read(buf, sector, count);
+		for(i = 0; i < count && !err; i++)
+		{
+			way = _lookup(sector + i);
+			if(way >= 0 && (tags[SET_OF(sector + i)][way].flags & LINE_DIRTY))
+				memcpy(buf + i * SDCACHE_SECTOR_SIZE,
+					LINE(SET_OF(sector + i), way), SDCACHE_SECTOR_SIZE);
+		}
+	}
+	chMtxUnlock(&sdcache_mtx);
+	if(iosched_write_failed())
+		err = HAL_FAILED;
+	return err;
+}
+
+bool sdcache_write(const uint8_t *buf, uint32_t sector, uint32_t count)
+{
+	uint32_t i;
+	int way;
+	bool err;
+
+	chMtxLock(&sdcache_mtx);
+	if(count == 1)
+	{
+		err = _write_one(buf, sector);
+	}
+	else
+	{
+		/* write through, cached copies take the new data and are clean */
+		sdcache_stats.direct_writes++;
+		err = _dev_write(buf, sector, count);
+		for(i = 0; i < count && !err; i++)
+		{
+			if((way = _lookup(sector + i)) < 0)
+				continue;
+			memcpy(LINE(SET_OF(sector + i), way),
+				buf + i * SDCACHE_SECTOR_SIZE, SDCACHE_SECTOR_SIZE);
+			tags[SET_OF(sector + i)][way].flags &= ~LINE_DIRTY;
+		}
+	}
+	chMtxUnlock(&sdcache_mtx);
+	if(iosched_write_failed())
+		err = HAL_FAILED;
+	return err;
+}
+
+/*
+ * Brings count sectors into the cache ahead of use, in bursts of up to
+ * SDCACHE_READAHEAD sectors.
+ */
+bool sdcache_prefetch(uint32_t sector, uint32_t count)
+{
+	uint32_t n;
+	bool err = HAL_SUCCESS;
+
+	chMtxLock(&sdcache_mtx);
+	while(count && !err)
+	{
+		n = count < SDCACHE_READAHEAD ? count : SDCACHE_READAHEAD;
+		err = _prefetch(sector, n, false);
+		sector += n;
+		count -= n;
+	}
+	chMtxUnlock(&sdcache_mtx);
+	if(iosched_write_failed())
+		err = HAL_FAILED;
+	return err;
+}
+
+/*
+ * Writes back every line that is dirty when it is called, FatFs calls
+ * this through CTRL_SYNC at the end of f_sync() and f_close(), with the
+ * volume given up, see diskio.c. Lines go to the scheduler in bursts and
+ * the wait for each is outside the cache lock, readers get in between
+ * and the scheduler puts them first. A line written again meanwhile is
+ * still written back, lines dirtied after the start may be.
+ */
+bool sdcache_sync(void)
+{
+	uint32_t set, n;
+	int way;
+	bool more, err = HAL_SUCCESS;
+
+	chMtxLock(&sdcache_mtx);
+	for(set = 0; set < SDCACHE_SETS; set++)
+		for(way = 0; way < SDCACHE_WAYS; way++)
+			if(tags[set][way].flags & LINE_DIRTY)
+				tags[set][way].flags |= LINE_SYNC;
+	do
+	{
+		n = 0;
+		more = false;
+		for(set = 0; set < SDCACHE_SETS && !more; set++)
+		{
+			for(way = 0; way < SDCACHE_WAYS && !more; way++)
+			{
+				if(!(tags[set][way].flags & LINE_SYNC))
+					continue;
+				if(n == SDCACHE_SYNC_BURST)
+				{
+					more = true;
+					continue;
+				}
+				if(tags[set][way].flags & LINE_DIRTY)
+				{
+					iosched_write_behind(tags[set][way].sector, LINE(set, way));
+					sdcache_stats.writebacks++;
+					n++;
+				}
+				tags[set][way].flags &= ~(LINE_DIRTY | LINE_SYNC);
+			}
+		}
+		chMtxUnlock(&sdcache_mtx);
+		if(iosched_flush())
+			err = HAL_FAILED;
+		if(more)
+			chMtxLock(&sdcache_mtx);
+	} while(more);
+	return err;
+}
+
+/*
+ * Exclusive use of the card for commands outside the data path, e.g. the
+ * status poll of the mount manager. Queued write-behind waits meanwhile.
+ */
+void sdcache_acquire(void)
+{
+	chMtxLock(&sdcache_mtx);
+	iosched_pause();
+}
+
+void sdcache_release(void)
+{
+	iosched_resume();
+	chMtxUnlock(&sdcache_mtx);
+}
+
+/*===========================================================================*/
+/* Shell command.                                                            */
+/*===========================================================================*/
+
+static uint32_t _percent(uint32_t part, uint32_t whole)
+{
+	return whole ? (uint32_t)((uint64_t)part * 100 / whole) : 0;
+}
+
+void cmd_cache(BaseSequentialStream *chp, int argc, char *argv[])
+{
+	sdcache_stats_t st;
+	uint32_t set, dirty = 0, valid = 0;
+	int way;
+
+	if(argc == 1 && !strcmp(argv[0], "flush"))
+	{
+		if(sdcache_sync())
+			chprintf(chp, "cache: write back failed\r\n");
+		return;
+	}
+	if(argc == 1 && !strcmp(argv[0], "reset"))
+	{
+		chMtxLock(&sdcache_mtx);
+		memset(&sdcache_stats, 0, sizeof(sdcache_stats));
+		chMtxUnlock(&sdcache_mtx);
+		return;
+	}
+	if(argc > 0)
+	{
+		chprintf(chp, "Usage: cache [flush|reset]\r\n");
+		return;
+	}
+
+	chMtxLock(&sdcache_mtx);
+	st = sdcache_stats;
+	for(set = 0; set < SDCACHE_SETS; set++)
+	{
+		for(way = 0; way < SDCACHE_WAYS; way++)
+		{
+			valid += (tags[set][way].flags & LINE_VALID) != 0;
+			dirty += (tags[set][way].flags & LINE_DIRTY) != 0;
+		}
+	}
+	chMtxUnlock(&sdcache_mtx);
+
+	chprintf(chp, "%d sets x %d ways, read-ahead %d, %lu valid %lu dirty\r\n",
+		SDCACHE_SETS, SDCACHE_WAYS, SDCACHE_READAHEAD, valid, dirty);
+	chprintf(chp, "read  %8lu hits %8lu (%lu%%)\r\n",
+		st.reads, st.read_hits, _percent(st.read_hits, st.reads));
+	chprintf(chp, "write %8lu hits %8lu (%lu%%) write-backs %lu\r\n",
+		st.writes, st.write_hits, _percent(st.write_hits, st.writes),
+		st.writebacks);
+	chprintf(chp, "read-ahead %lu commands, %lu sectors, %lu used (%lu%%)\r\n",
+		st.prefetches, st.prefetched, st.prefetch_hits,
+		_percent(st.prefetch_hits, st.prefetched));
+	chprintf(chp, "direct reads %lu writes %lu, bounced sectors %lu\r\n",
+		st.direct_reads, st.direct_writes, st.bounced);
+}
@@ -0,0 +1,45 @@
+/*
+ * sdcache.h
+ *
+ *  Set associative sector cache between FatFs and the SDIO driver.
+ */
+
+#ifndef SDCACHE_H_
+#define SDCACHE_H_
+
+#define SDCACHE_SETS        8       /* power of two */
+#define SDCACHE_WAYS        4
+#define SDCACHE_READAHEAD   8       /* sectors fetched by one read-ahead */
+#define SDCACHE_SEQ_MIN     2       /* sequential misses before read-ahead */
+#define SDCACHE_SYNC_BURST  8       /* lines queued by a sync between waits */
+
+#define SDCACHE_SECTOR_SIZE MMCSD_BLOCK_SIZE
+
+typedef struct
+{
+	uint32_t reads;             /* single sector reads */
+	uint32_t read_hits;
+	uint32_t writes;            /* single sector writes */
+	uint32_t write_hits;
+	uint32_t writebacks;
+	uint32_t prefetches;        /* read-ahead commands */
+	uint32_t prefetched;        /* sectors brought in ahead */
+	uint32_t prefetch_hits;     /* of those, later read */
+	uint32_t direct_reads;      /* multi sector, past the cache */
+	uint32_t direct_writes;
+	uint32_t bounced;           /* sectors copied for CCM or unaligned buffers */
+} sdcache_stats_t;
+
+extern sdcache_stats_t sdcache_stats;
+
+void sdcache_init(void);
+void sdcache_invalidate(void);
+bool sdcache_read(uint8_t *buf, uint32_t sector, uint32_t count);
+bool sdcache_write(const uint8_t *buf, uint32_t sector, uint32_t count);
+bool sdcache_sync(void);
+bool sdcache_prefetch(uint32_t sector, uint32_t count);
+void sdcache_acquire(void);
+void sdcache_release(void);
+void cmd_cache(BaseSequentialStream *chp, int argc, char *argv[]);
+
+#endif /* SDCACHE_H_ */
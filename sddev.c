@@ -0,0 +1,178 @@
+/*
+ * sddev.c
+ *
+ *  SD card transfers with retries and error and latency accounting. Every
+ *  transfer of the cache goes through here. Failures are sorted by the
+ *  driver error flags and retried with a short, bounded backoff as long as
+ *  the card is still connected. The time each call takes, retries
+ *  included, goes into a log2 histogram per direction, the tail is what
+ *  stalls a job.
+ *
+ *  Callers own the card, see sdcache_acquire().
+ */
+
+/*===========================================================================*/
+/* SD transfers.                                                             */
+/*===========================================================================*/
+#include <string.h>
+
+#include "ch.h"
+#include "hal.h"
+
+#include "chprintf.h"
+
+#include "sddev.h"
+#include "sdmode.h"
+
+#define ERR_CRC     (SDC_CMD_CRC_ERROR | SDC_DATA_CRC_ERROR)
+#define ERR_TIMEOUT (SDC_COMMAND_TIMEOUT | SDC_DATA_TIMEOUT)
+
+/* .bss, the counters have to start at zero */
+sddev_stats_t sddev_stats[SDDEV_NOPS];
+volatile systime_t sddev_last_io;       /* of the last good transfer */
+
+static const char * const op_names[SDDEV_NOPS] = {"read", "write"};
+
+static void _count_error(sddev_stats_t *sp, sdcflags_t errors)
+{
+	if(errors & ERR_CRC)
+		sp->crc++;
+	else if(errors & ERR_TIMEOUT)
+		sp->timeout++;
+	else if(errors)
+		sp->other++;
+	else
+		sp->busy++;
+}
+
+static void _count_time(sddev_stats_t *sp, uint32_t us)
+{
+	unsigned b = 0;
+
+	if(us > sp->max_us)
+		sp->max_us = us;
+	if(us > 1)
+		b = 31 - __builtin_clz(us);
+	if(b >= SDDEV_HIST_BUCKETS)
+		b = SDDEV_HIST_BUCKETS - 1;
+	sp->hist[b]++;
+}
+
+/*
+ * A good transfer also proves the card is still there and spares the
+ * mount manager a poll.
+ */
+static bool _transfer(sddev_op_t op, uint32_t sector, uint8_t *buf, uint32_t count)
+{
+	sddev_stats_t *sp = &sddev_stats[op];
+	uint32_t backoff = SDDEV_BACKOFF_MS, attempt;
+	sdcflags_t errors;
+	rtcnt_t start;
+	bool err;
+
+	sp->calls++;
+	sp->sectors += count;
+	/* sdcRead() and sdcWrite() leave a disconnected driver ready */
+	if(blkGetDriverState(&SDCD1) != BLK_READY)
+	{
+		sp->failures++;
+		return true;
+	}
+	start = chSysGetRealtimeCounterX();
+	for(attempt = 0; ; attempt++)
+	{
+		err = (op == SDDEV_READ) ? sdcRead(&SDCD1, sector, buf, count) :
+			sdcWrite(&SDCD1, sector, buf, count);
+		if(!err)
+			break;
+		errors = sdcGetAndClearErrors(&SDCD1);
+		_count_error(sp, errors);
+		if(attempt >= SDDEV_RETRIES || blkGetDriverState(&SDCD1) != BLK_READY)
+		{
+			sp->failures++;
+			break;
+		}
+		/* CRC errors at 48 MHz drop the clock, that retry needs no wait */
+		sp->retries++;
+		if(!sdmode_fallback(errors))
+		{
+			chThdSleepMilliseconds(backoff);
+			if(backoff < SDDEV_BACKOFF_MAX)
+				backoff *= 2;
+		}
+	}
+	_count_time(sp, (chSysGetRealtimeCounterX() - start) / (STM32_SYSCLK / 1000000));
+	if(!err)
+		sddev_last_io = chVTGetSystemTimeX();
+	return err;
+}
+
+bool sddev_read(uint32_t sector, uint8_t *buf, uint32_t count)
+{
+	return _transfer(SDDEV_READ, sector, buf, count);
+}
+
+bool sddev_write(uint32_t sector, const uint8_t *buf, uint32_t count)
+{
+	return _transfer(SDDEV_WRITE, sector, (uint8_t *)buf, count);
+}
+
+/*===========================================================================*/
+/* Shell command.                                                            */
+/*===========================================================================*/
+
+static void _print_hist(BaseSequentialStream *chp, const sddev_stats_t *sp)
+{
+	uint32_t peak = 0, bar, i, lo;
+	unsigned b;
+
+	for(b = 0; b < SDDEV_HIST_BUCKETS; b++)
+		if(sp->hist[b] > peak)
+			peak = sp->hist[b];
+	for(b = 0; b < SDDEV_HIST_BUCKETS; b++)
+	{
+		if(!sp->hist[b])
+			continue;
+		lo = b ? 1UL << b : 0;
+		if(b == SDDEV_HIST_BUCKETS - 1)
+			chprintf(chp, "  %7lu us and up %8lu ", lo, sp->hist[b]);
+		else
+			chprintf(chp, "  %7lu-%-7lu us %8lu ", lo, (2UL << b) - 1, sp->hist[b]);
+		bar = (uint32_t)((uint64_t)sp->hist[b] * 32 / peak);
+		for(i = 0; i < bar || (i == 0 && bar == 0); i++)
+			chprintf(chp, "#");
+		chprintf(chp, "\r\n");
+	}
+}
+
+void cmd_sdstat(BaseSequentialStream *chp, int argc, char *argv[])
+{
+	sddev_stats_t st;
+	int op;
+
+	if(argc == 1 && !strcmp(argv[0], "reset"))
+	{
+		chSysLock();
+		memset(sddev_stats, 0, sizeof(sddev_stats));
+		chSysUnlock();
+		return;
+	}
+	if(argc > 0)
+	{
+		chprintf(chp, "Usage: sdstat [reset]\r\n");
+		return;
+	}
+
+	for(op = 0; op < SDDEV_NOPS; op++)
+	{
+		chSysLock();
+		st = sddev_stats[op];
+		chSysUnlock();
+		chprintf(chp, "%s: %lu calls, %lu sectors, worst %lu us\r\n",
+			op_names[op], st.calls, st.sectors, st.max_us);
+		chprintf(chp, "  crc %lu timeout %lu busy %lu other %lu, "
+			"retries %lu, failed %lu\r\n", st.crc, st.timeout, st.busy,
+			st.other, st.retries, st.failures);
+		_print_hist(chp, &st);
+	}
+}
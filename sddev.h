@@ -0,0 +1,43 @@
+/*
+ * sddev.h
+ *
+ *  SD card transfers with retries and error and latency accounting.
+ */
+
+#ifndef SDDEV_H_
+#define SDDEV_H_
+
+#define SDDEV_RETRIES       3       /* after the first attempt */
+#define SDDEV_BACKOFF_MS    1       /* doubled per retry */
+#define SDDEV_BACKOFF_MAX   8
+#define SDDEV_HIST_BUCKETS  20      /* log2 of us, the last is 0.5 s and up */
+
+typedef enum
+{
+	SDDEV_READ = 0,
+	SDDEV_WRITE,
+	SDDEV_NOPS
+} sddev_op_t;
+
+typedef struct
+{
+	uint32_t calls;
+	uint32_t sectors;
+	uint32_t crc;               /* command or data CRC */
+	uint32_t timeout;           /* command or data timeout */
+	uint32_t busy;              /* failed without a bus error, card busy */
+	uint32_t other;             /* FIFO, start bit */
+	uint32_t retries;
+	uint32_t failures;          /* given up */
+	uint32_t max_us;
+	uint32_t hist[SDDEV_HIST_BUCKETS];
+} sddev_stats_t;
+
+extern sddev_stats_t sddev_stats[SDDEV_NOPS];
+extern volatile systime_t sddev_last_io;
+
+bool sddev_read(uint32_t sector, uint8_t *buf, uint32_t count);
+bool sddev_write(uint32_t sector, const uint8_t *buf, uint32_t count);
+void cmd_sdstat(BaseSequentialStream *chp, int argc, char *argv[]);
+
+#endif /* SDDEV_H_ */
@@ -0,0 +1,163 @@
+/*
+ * sdmode.c
+ *
+ *  SDIO bus speed negotiation. sdcConnect() leaves a SD card on the 4 bit
+ *  bus at 24 MHz (SDIOCLK / 2). Cards that support high speed are switched
+ *  with CMD6 and the divider is bypassed for the full 48 MHz. A CRC error
+ *  at that clock drops back to 24 MHz until the next connect.
+ *
+ *  The ChibiOS driver has no call for a CMD6 data read, the 64 byte switch
+ *  status fits in the SDIO FIFO so it is read by polling, the DMA is not
+ *  involved. The caller must own the card, see sdcache_acquire().
+ */
+
+/*===========================================================================*/
+/* SDIO bus speed.                                                           */
+/*===========================================================================*/
+#include <string.h>
+
+#include "ch.h"
+#include "hal.h"
+
+#include "sdmode.h"
+#include "pools.h"
+
+#define SWITCH_CHECK    0x00FFFFF1U     /* mode 0, group 1 function 1 */
+#define SWITCH_SET      0x80FFFFF1U     /* mode 1, group 1 function 1 */
+#define STATUS_SIZE     64
+
+#define DATA_ERRORS     (SDIO_STA_DCRCFAIL | SDIO_STA_DTIMEOUT | \
+                         SDIO_STA_RXOVERR | SDIO_STA_STBITERR)
+
+sdmode_state_t sdmode;
+
+/*
+ * CMD6 with its 512 bit status, bytes in the order the card sent them.
+ */
+static bool _switch_func(uint32_t arg, uint8_t *status)
+{
+	uint32_t resp[1], sta, words[STATUS_SIZE / 4];
+	systime_t start;
+	unsigned i;
+
+	SDIO->ICR = 0xFFFFFFFFU;
+	SDIO->DTIMER = SDMODE_SWITCH_TIMEOUT;
+	SDIO->DLEN = STATUS_SIZE;
+	SDIO->DCTRL = SDIO_DCTRL_DTDIR | SDIO_DCTRL_DBLOCKSIZE_2 |
+		SDIO_DCTRL_DBLOCKSIZE_1 | SDIO_DCTRL_DTEN;      /* 2^6 bytes */
+	if(sdc_lld_send_cmd_short_crc(&SDCD1, MMCSD_CMD_SWITCH, arg, resp) ||
+		(resp[0] & MMCSD_R1_ERROR_MASK))
+	{
+		SDIO->DCTRL = 0;
+		return HAL_FAILED;
+	}
+
+	start = chVTGetSystemTimeX();
+	do
+	{
+		sta = SDIO->STA;
+		if(!chVTIsSystemTimeWithinX(start, start + MS2ST(100)))
+			sta |= SDIO_STA_DTIMEOUT;
+	} while(!(sta & (SDIO_STA_DATAEND | DATA_ERRORS)));
+	SDIO->DCTRL = 0;
+	SDIO->ICR = 0xFFFFFFFFU;
+	if(sta & DATA_ERRORS)
+		return HAL_FAILED;
+
+	for(i = 0; i < STATUS_SIZE / 4; i++)
+		words[i] = SDIO->FIFO;
+	memcpy(status, words, STATUS_SIZE);
+	return HAL_SUCCESS;
+}
+
+static void _set_bypass(bool on)
+{
+	if(on)
+		SDIO->CLKCR |= SDIO_CLKCR_BYPASS;
+	else
+		SDIO->CLKCR &= ~SDIO_CLKCR_BYPASS;
+	sdmode.bypass = on;
+}
+
+/*
+ * After sdcConnect(). Switches to high speed when the card can, then reads
+ * a few sectors at 48 MHz and stays at 24 MHz if any of them fails. Returns
+ * true when the card runs at 48 MHz.
+ */
+bool sdmode_negotiate(void)
+{
+	uint8_t status[STATUS_SIZE];
+	char *buf;
+	uint32_t i;
+
+	sdmode.hs_capable = false;
+	sdmode.hs = false;
+	sdmode.bypass = false;
+
+	/* SD only, MMC has its own switch command */
+	if((SDCD1.cardmode & SDC_MODE_CARDTYPE_MASK) == SDC_MODE_CARDTYPE_MMC)
+		return false;
+	if(_switch_func(SWITCH_CHECK, status))
+		return false;
+	sdmode.hs_capable = (status[13] & 0x02) != 0;
+	if(!sdmode.hs_capable)
+		return false;
+	if(_switch_func(SWITCH_SET, status) || (status[16] & 0x0F) != 1)
+		return false;
+	sdmode.hs = true;
+	sdmode.switches++;
+
+	/* the card needs 8 clocks before the new timing, the status read had more */
+	_set_bypass(true);
+	buf = sector_alloc();
+	if(buf == NULL)
+		return sdmode.bypass;
+	sdcGetAndClearErrors(&SDCD1);
+	for(i = 0; i < SDMODE_VERIFY_READS; i++)
+	{
+		if(sdcRead(&SDCD1, i, (uint8_t *)buf, 1))
+		{
+			sdcGetAndClearErrors(&SDCD1);
+			_set_bypass(false);
+			sdmode.fallbacks++;
+			break;
+		}
+	}
+	sector_free(buf);
+	return sdmode.bypass;
+}
+
+/*
+ * Called with the errors of a failed transfer. CRC errors at 48 MHz put
+ * the bus back to 24 MHz, true when that happened and a retry makes sense.
+ */
+bool sdmode_fallback(sdcflags_t errors)
+{
+	if(!sdmode.bypass || !(errors & (SDC_DATA_CRC_ERROR | SDC_CMD_CRC_ERROR)))
+		return false;
+	_set_bypass(false);
+	sdmode.fallbacks++;
+	return true;
+}
+
+uint32_t sdmode_clock_khz(void)
+{
+	uint32_t clkcr = SDIO->CLKCR;
+
+	if(clkcr & SDIO_CLKCR_BYPASS)
+		return SDMODE_CLK_KHZ;
+	return SDMODE_CLK_KHZ / ((clkcr & SDIO_CLKCR_CLKDIV) + 2);
+}
+
+uint8_t sdmode_bus_width(void)
+{
+	switch(SDIO->CLKCR & SDIO_CLKCR_WIDBUS)
+	{
+	case SDIO_CLKCR_WIDBUS_0:
+		return 4;
+	case SDIO_CLKCR_WIDBUS_1:
+		return 8;
+	default:
+		return 1;
+	}
+}
@@ -0,0 +1,30 @@
+/*
+ * sdmode.h
+ *
+ *  SDIO bus speed negotiation.
+ */
+
+#ifndef SDMODE_H_
+#define SDMODE_H_
+
+#define SDMODE_CLK_KHZ          48000   /* SDIOCLK from the 48 MHz PLL output */
+#define SDMODE_SWITCH_TIMEOUT   2400000 /* data timeout in card clocks, 100 ms */
+#define SDMODE_VERIFY_READS     8       /* sector reads to trust the fast clock */
+
+typedef struct
+{
+	bool hs_capable;            /* CMD6 group 1 function 1 supported */
+	bool hs;                    /* card switched to high speed */
+	bool bypass;                /* SDIOCLK straight to the card */
+	uint32_t switches;
+	uint32_t fallbacks;
+} sdmode_state_t;
+
+extern sdmode_state_t sdmode;
+
+bool sdmode_negotiate(void);
+bool sdmode_fallback(sdcflags_t errors);
+uint32_t sdmode_clock_khz(void);
+uint8_t sdmode_bus_width(void);
+
+#endif /* SDMODE_H_ */
@@ -0,0 +1,103 @@
+/*
+ * shaper.c
+ *
+ *  Input shaping of a position stream against one resonance of the
+ *  frame. The output is a weighted sum of the input delayed by fractions
+ *  of the damped period Td, the impulses cancel each other's ringing:
+ *
+ *  - ZV, 2 impulses over Td / 2,
+ *  - MZV, 3 impulses over 3 Td / 4, more tolerant to a misjudged
+ *    frequency at the cost of a little more smoothing.
+ *
+ *  Delays are rounded to whole update ticks, the history holds
+ *  SHAPER_HISTORY ticks which sets the lowest frequency for a rate. The
+ *  amplitudes are adjusted to sum to exactly one so a resting axis stays
+ *  put. Weights are set up in float, the per tick sum is Q16.16. No
+ *  kernel calls.
+ */
+
+/*===========================================================================*/
+/* Input shaper.                                                             */
+/*===========================================================================*/
+#include <string.h>
+#include <math.h>
+
+#include "shaper.h"
+
+#define PI_F            3.14159265f
+#define HIST_MASK       (SHAPER_HISTORY - 1)
+
+/*
+ * Starts with the axis at rest at pos. False if the shaper needs more
+ * history than there is at this rate.
+ */
+bool shaper_init(shaper_t *s, shaper_type_t type, float freq, float damping,
+	uint32_t rate, q16_t pos)
+{
+	float amp[SHAPER_IMPULSES], t[SHAPER_IMPULSES];
+	float k, td, sum = 0.0f, root;
+	uint32_t i;
+	q16_t left = Q16_ONE;
+
+	memset(s, 0, sizeof(*s));
+	root = sqrtf(1.0f - damping * damping);
+	td = 1.0f / (freq * root);
+	switch(type)
+	{
+	case SHAPER_ZV:
+		k = expf(-damping * PI_F / root);
+		s->n = 2;
+		amp[0] = 1.0f;          t[0] = 0.0f;
+		amp[1] = k;             t[1] = 0.5f * td;
+		break;
+	case SHAPER_MZV:
+		k = expf(-0.75f * damping * PI_F / root);
+		s->n = 3;
+		amp[0] = 1.0f - 1.0f / sqrtf(2.0f);    t[0] = 0.0f;
+		amp[1] = (sqrtf(2.0f) - 1.0f) * k;     t[1] = 0.375f * td;
+		amp[2] = amp[0] * k * k;                t[2] = 0.75f * td;
+		break;
+	default:
+		s->n = 1;
+		amp[0] = 1.0f;          t[0] = 0.0f;
+		break;
+	}
+
+	for(i = 0; i < s->n; i++)
+		sum += amp[i];
+	for(i = 0; i < s->n; i++)
+	{
+		s->delay[i] = (uint32_t)(t[i] * (float)rate + 0.5f);
+		if(s->delay[i] >= SHAPER_HISTORY)
+			return false;
+		s->amp[i] = (i == s->n - 1) ? left : Q16_FROM_F(amp[i] / sum);
+		left -= s->amp[i];
+	}
+	for(i = 0; i < SHAPER_HISTORY; i++)
+		s->hist[i] = pos;
+	return true;
+}
+
+/*
+ * Takes the position of this tick, returns the shaped one.
+ */
+q16_t shaper_step(shaper_t *s, q16_t pos)
+{
+	int64_t acc = 0;
+	uint32_t i;
+
+	s->head = (s->head + 1) & HIST_MASK;
+	s->hist[s->head] = pos;
+	for(i = 0; i < s->n; i++)
+		acc += (int64_t)s->amp[i] * s->hist[(s->head - s->delay[i]) & HIST_MASK];
+	return (q16_t)((acc + 0x8000) >> 16);
+}
+
+/*
+ * Ticks the shaped stream lags behind, the time to add at the end of a
+ * move until it has settled.
+ */
+uint32_t shaper_delay(const shaper_t *s)
+{
+	return s->delay[s->n - 1];
+}
@@ -0,0 +1,38 @@
+/*
+ * shaper.h
+ *
+ *  ZV and MZV input shapers on a Q16.16 position stream.
+ */
+
+#ifndef SHAPER_H_
+#define SHAPER_H_
+
+#include <stdbool.h>
+
+#include "q16.h"
+
+#define SHAPER_HISTORY      512     /* ticks, power of two */
+#define SHAPER_IMPULSES     3
+
+typedef enum
+{
+	SHAPER_NONE = 0,
+	SHAPER_ZV,
+	SHAPER_MZV
+} shaper_type_t;
+
+typedef struct
+{
+	uint32_t n;
+	q16_t amp[SHAPER_IMPULSES]; /* sum to Q16_ONE */
+	uint32_t delay[SHAPER_IMPULSES];    /* ticks */
+	uint32_t head;
+	q16_t hist[SHAPER_HISTORY];
+} shaper_t;
+
+bool shaper_init(shaper_t *s, shaper_type_t type, float freq, float damping,
+	uint32_t rate, q16_t pos);
+q16_t shaper_step(shaper_t *s, q16_t pos);
+uint32_t shaper_delay(const shaper_t *s);
+
+#endif /* SHAPER_H_ */
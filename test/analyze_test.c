@@ -0,0 +1,245 @@
+/*
+ * analyze_test.c
+ *
+ *  Print time estimates of analyze.c. Moves with a print time worked out
+ *  by hand go through it first. The jobs in gcode/ are then timed again by
+ *  a double precision planner with the same kinematic model that looks
+ *  ahead over the whole job instead of ANALYZE_LOOKAHEAD moves, and the
+ *  estimate has to stay within MAX_ERROR of it. That only shows the
+ *  bounded lookahead costs little, both share the model. There are no
+ *  print times recorded on a machine to check the model against.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "analyze.h"
+#include "jobfile.h"
+#include "check.h"
+
+#define UOM             GCODE_UOM
+#define DEFAULT_F       (3000 * UOM)    /* PLANNER_DEFAULT_F */
+#define MAX_MOVES       20000
+#define MAX_ERROR       0.005           /* of the reference time */
+
+/* what M201/M203 in the jobs set, in gcode units */
+static const analyze_limits_t limits = {
+	{200.0f * UOM, 200.0f * UOM, 12.0f * UOM, 120.0f * UOM},
+	{1000.0f * UOM, 1000.0f * UOM, 200.0f * UOM, 5000.0f * UOM},
+	ANALYZE_JUNCTION
+};
+
+typedef struct
+{
+	double len;                 /* mm */
+	double v;                   /* mm/s */
+	double a;                   /* mm/s2 */
+	double u[3];
+	double corner;              /* highest speed into the move */
+} ref_move_t;
+
+static ref_move_t ref[MAX_MOVES + 1];
+static uint32_t nref;
+static int32_t ref_pos[ANALYZE_AXES];
+
+/*
+ * Time of len mm entered at v0, cruising at vc at most and left at v1,
+ * both reachable.
+ */
+static double _trapezoid(double len, double v0, double vc, double v1, double a)
+{
+	double cruise = len - (2.0 * vc * vc - v0 * v0 - v1 * v1) / (2.0 * a);
+
+	if(cruise < 0.0)
+	{
+		/* never gets to vc */
+		vc = sqrt(a * len + (v0 * v0 + v1 * v1) / 2.0);
+		cruise = 0.0;
+	}
+	return (vc - v0) / a + (vc - v1) / a + cruise / vc;
+}
+
+/*
+ * The same kinematic model from scratch: the axis limits scaled to the
+ * direction of the move and the junction deviation corner speed.
+ */
+static void _ref_move(const int32_t pos[ANALYZE_AXES], int32_t f)
+{
+	ref_move_t *m = &ref[nref];
+	const ref_move_t *p = nref > 0 ? &ref[nref - 1] : NULL;
+	double d[ANALYZE_AXES], c, s;
+	int i;
+
+	for(i = 0; i < ANALYZE_AXES; i++)
+		d[i] = (double)(pos[i] - ref_pos[i]) / UOM;
+	memcpy(ref_pos, pos, sizeof(ref_pos));
+	m->len = sqrt(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]);
+	memset(m->u, 0, sizeof(m->u));
+	if(m->len > 0.0)
+	{
+		for(i = 0; i < 3; i++)
+			m->u[i] = d[i] / m->len;
+	}
+	else if((m->len = fabs(d[3])) == 0.0)
+		return;
+	m->v = f / 60.0 / UOM;
+	m->a = INFINITY;
+	for(i = 0; i < ANALYZE_AXES; i++)
+	{
+		if(d[i] == 0.0)
+			continue;
+		m->v = fmin(m->v, limits.vmax[i] / UOM * m->len / fabs(d[i]));
+		m->a = fmin(m->a, limits.amax[i] / UOM * m->len / fabs(d[i]));
+	}
+
+	m->corner = 0.0;
+	c = p != NULL ? -(p->u[0] * m->u[0] + p->u[1] * m->u[1] + p->u[2] * m->u[2]) : 1.0;
+	if(p != NULL && (p->u[0] != 0.0 || p->u[1] != 0.0 || p->u[2] != 0.0) &&
+		(m->u[0] != 0.0 || m->u[1] != 0.0 || m->u[2] != 0.0) && c < 1.0 - 1e-6)
+	{
+		m->corner = fmin(p->v, m->v);
+		if(c > -1.0 + 1e-6)
+		{
+			s = sqrt((1.0 - c) / 2.0);
+			m->corner = fmin(m->corner, sqrt(fmin(p->a, m->a) *
+				limits.junction_dev / UOM * s / (1.0 - s)));
+		}
+	}
+	nref++;
+}
+
+/*
+ * Seconds for the moves in ref[], with every corner as fast as the whole
+ * job allows.
+ */
+static double _ref_time(double *nominal)
+{
+	static double entry[MAX_MOVES + 1];
+	double t = 0.0;
+	uint32_t i;
+
+	entry[nref] = 0.0;
+	for(i = nref; i-- > 0; )
+		entry[i] = i == 0 ? 0.0 : fmin(ref[i].corner,
+			sqrt(entry[i + 1] * entry[i + 1] + 2.0 * ref[i].a * ref[i].len));
+	for(i = 0; i < nref; i++)
+		entry[i + 1] = fmin(entry[i + 1],
+			sqrt(entry[i] * entry[i] + 2.0 * ref[i].a * ref[i].len));
+	*nominal = 0.0;
+	for(i = 0; i < nref; i++)
+	{
+		t += _trapezoid(ref[i].len, entry[i], ref[i].v, entry[i + 1], ref[i].a);
+		*nominal += ref[i].len / ref[i].v;
+	}
+	return t;
+}
+
+static void _move(const _param_t *pos, bool move, void *ctx)
+{
+	int32_t p[ANALYZE_AXES] = {pos->x, pos->y, pos->z, pos->e};
+	int32_t f = pos->f > 0 ? pos->f : DEFAULT_F;
+
+	if(move)
+	{
+		analyze_move((analyze_t *)ctx, p, f);
+		if(nref < MAX_MOVES)
+			_ref_move(p, f);
+	}
+	else
+	{
+		analyze_set_position((analyze_t *)ctx, p);
+		memcpy(ref_pos, p, sizeof(ref_pos));
+	}
+}
+
+/*
+ * Runs the moves from the origin, mm and mm/min, returns the estimate in s.
+ */
+static double _estimate(const double (*moves)[3], uint32_t n)
+{
+	static analyze_t a;
+	int32_t pos[ANALYZE_AXES] = {0, 0, 0, 0};
+	uint32_t i;
+
+	analyze_init(&a, &limits);
+	for(i = 0; i < n; i++)
+	{
+		pos[0] = (int32_t)lround(moves[i][0] * UOM);
+		pos[1] = (int32_t)lround(moves[i][1] * UOM);
+		analyze_move(&a, pos, (int32_t)lround(moves[i][2] * UOM));
+	}
+	analyze_finish(&a);
+	return a.us / 1e6;
+}
+
+/*
+ * Moves with a known time at 1000 mm/s2 and a 0.05 mm junction deviation.
+ */
+static void test_known(void)
+{
+	static double line[100][3], square[4][3] = {
+		{50, 0, 6000}, {50, 50, 6000}, {0, 50, 6000}, {0, 0, 6000}};
+	static const double one[1][3] = {{100, 0, 6000}}, two[1][3] = {{2, 0, 6000}};
+	double vc, t, s = sqrt(0.5);
+	uint32_t i;
+
+	/* 5 mm up to 100 mm/s, 90 mm at it, 5 mm down: 0.1 + 0.9 + 0.1 s */
+	t = _estimate(one, 1);
+	CHECK(fabs(t - 1.1) < 1e-3);
+
+	/* up to sqrt(a * len) and straight down again */
+	t = _estimate(two, 1);
+	CHECK(fabs(t - 2.0 * sqrt(2.0 / 1000.0)) < 1e-4);
+
+	/* the same line in 1 mm moves, the lookahead carries the speed */
+	for(i = 0; i < 100; i++)
+	{
+		line[i][0] = i + 1;
+		line[i][1] = 0;
+		line[i][2] = 6000;
+	}
+	t = _estimate((const double (*)[3])line, 100);
+	CHECK(fabs(t - 1.1) < 1e-3);
+
+	/* square, the corners at sqrt(a * dev * sin(45) / (1 - sin(45))) */
+	vc = sqrt(1000.0 * 0.05 * s / (1.0 - s));
+	t = _estimate((const double (*)[3])square, 4);
+	CHECK(fabs(t - (_trapezoid(50, 0, 100, vc, 1000) +
+		2.0 * _trapezoid(50, vc, 100, vc, 1000) +
+		_trapezoid(50, vc, 100, 0, 1000))) < 1e-3);
+	printf("known moves: 1.100 s line, %.3f s square with %.1f mm/s corners\n", t, vc);
+}
+
+static void test_job(const char *name)
+{
+	static analyze_t a;
+	double t, nominal, err;
+	char path[128];
+
+	snprintf(path, sizeof(path), "gcode/%s", name);
+	nref = 0;
+	memset(ref_pos, 0, sizeof(ref_pos));
+	analyze_init(&a, &limits);
+	CHECK(jobfile_run(path, _move, &a) > 0);
+	analyze_finish(&a);
+	CHECK(nref == a.moves && nref < MAX_MOVES);
+
+	t = _ref_time(&nominal);
+	err = (a.us / 1e6 - t) / t;
+	CHECK(fabs(err) <= MAX_ERROR);
+	CHECK(fabs(a.us_nominal / 1e6 - nominal) <= nominal * 1e-4);
+	CHECK(a.us >= a.us_nominal);
+	printf("%s: %u moves, estimate %.1f s, reference %.1f s (%+.2f%%), "
+		"nominal %.1f s\n", name, a.moves, a.us / 1e6, t, err * 100.0,
+		a.us_nominal / 1e6);
+}
+
+int main(void)
+{
+	test_known();
+	test_job("cylinder.gcode");
+	test_job("bracket.gcode");
+	test_job("vase.gcode");
+	return check_done("analyze_test");
+}
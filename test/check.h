@@ -0,0 +1,31 @@
+/*
+ * check.h
+ *
+ *  Assertions for the host tests, a failed check is printed and the test
+ *  goes on, the exit status tells whether any failed.
+ */
+
+#ifndef CHECK_H_
+#define CHECK_H_
+
+#include <stdio.h>
+
+static int check_failed;
+
+#define CHECK(cond)                                                         \
+	do                                                                      \
+	{                                                                       \
+		if(!(cond))                                                         \
+		{                                                                   \
+			printf("%s:%d: failed: %s\n", __FILE__, __LINE__, #cond);       \
+			check_failed++;                                                 \
+		}                                                                   \
+	} while(0)
+
+static inline int check_done(const char *name)
+{
+	printf("%s: %s\n", name, check_failed ? "FAILED" : "ok");
+	return check_failed != 0;
+}
+
+#endif /* CHECK_H_ */
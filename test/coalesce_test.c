@@ -0,0 +1,192 @@
+/*
+ * coalesce_test.c
+ *
+ *  Runs the jobs in gcode/ through the coalescer of coalesce.c the
+ *  way planner.c does and checks every block it emits against the moves
+ *  it came from: the block ends on one of them, all of them stay within
+ *  the deviation of the block, they share the feedrate and extrude at the
+ *  rate of the block within the tolerance, and none is lost.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "coalesce.h"
+#include "jobfile.h"
+#include "check.h"
+
+#define MAX_MOVES       20000
+
+typedef struct
+{
+	coalesce_pt_t pt;
+	uint32_t moves;
+} block_t;
+
+static coalesce_pt_t in[MAX_MOVES];
+static block_t out[MAX_MOVES];
+static uint32_t nin, nout;
+
+static void _emit(const coalesce_pt_t *pt, uint32_t moves, void *ctx)
+{
+	(void)ctx;
+	if(nout < MAX_MOVES)
+	{
+		out[nout].pt = *pt;
+		out[nout].moves = moves;
+	}
+	nout++;
+}
+
+static void _move(const _param_t *pos, bool move, void *ctx)
+{
+	coalesce_pt_t pt = {pos->x, pos->y, pos->z, pos->e, pos->f};
+
+	if(!move)
+		return;
+	if(nin < MAX_MOVES)
+		in[nin++] = pt;
+	coalesce_push((coalesce_t *)ctx, &pt);
+}
+
+static bool _same(const coalesce_pt_t *a, const coalesce_pt_t *b)
+{
+	return a->x == b->x && a->y == b->y && a->z == b->z && a->e == b->e &&
+		a->f == b->f;
+}
+
+/*
+ * Distance of p from the segment a..b, in gcode units.
+ */
+static double _distance(const coalesce_pt_t *a, const coalesce_pt_t *b,
+	const coalesce_pt_t *p)
+{
+	double v[3] = {b->x - a->x, b->y - a->y, b->z - a->z};
+	double w[3] = {p->x - a->x, p->y - a->y, p->z - a->z};
+	double vv = v[0] * v[0] + v[1] * v[1] + v[2] * v[2], t = 0, d = 0;
+	int i;
+
+	if(vv > 0)
+		t = (v[0] * w[0] + v[1] * w[1] + v[2] * w[2]) / vv;
+	t = t < 0 ? 0 : t > 1 ? 1 : t;
+	for(i = 0; i < 3; i++)
+		d += (w[i] - t * v[i]) * (w[i] - t * v[i]);
+	return sqrt(d);
+}
+
+static double _len(const coalesce_pt_t *a, const coalesce_pt_t *b)
+{
+	double dx = b->x - a->x, dy = b->y - a->y, dz = b->z - a->z;
+
+	return sqrt(dx * dx + dy * dy + dz * dz);
+}
+
+/*
+ * Checks the blocks of one run, returns the worst deviation.
+ */
+static double _check_blocks(const coalesce_cfg_t *cfg)
+{
+	static const coalesce_pt_t origin;
+	const coalesce_pt_t *start = &origin, *p, *from;
+	double dev, worst = 0, rate, r, len;
+	uint32_t b, i, k = 0, bad_end = 0, bad_dev = 0, bad_f = 0, bad_rate = 0;
+
+	for(b = 0; b < nout && k < nin; b++)
+	{
+		if(!_same(&out[b].pt, &in[k + out[b].moves - 1]))
+			bad_end++;
+		len = _len(start, &out[b].pt);
+		rate = len > 0 ? (out[b].pt.e - start->e) / len : 0;
+		for(i = 0, from = start; i < out[b].moves; i++, from = p)
+		{
+			p = &in[k + i];
+			dev = _distance(start, &out[b].pt, p);
+			if(dev > worst)
+				worst = dev;
+			if(dev > cfg->deviation + 0.5)
+				bad_dev++;
+			if(p->f != out[b].pt.f)
+				bad_f++;
+			/* a move's rate against the final block, the coalescer
+			   compares with the block so far */
+			if(out[b].moves > 1 && (r = _len(from, p)) > 0)
+			{
+				r = (p->e - from->e) / r;
+				if(fabs(r - rate) > fabs(rate) * 2.0 * cfg->erate / 100.0 + 1e-6)
+					bad_rate++;
+			}
+		}
+		k += out[b].moves;
+		start = &out[b].pt;
+	}
+	CHECK(nout < MAX_MOVES && nin < MAX_MOVES);
+	CHECK(k == nin);
+	CHECK(bad_end == 0);
+	CHECK(bad_dev == 0);
+	CHECK(bad_f == 0);
+	CHECK(bad_rate == 0);
+	if(nout && nin)
+		CHECK(_same(&out[nout - 1].pt, &in[nin - 1]));
+	return worst;
+}
+
+static coalesce_stats_t _run(const char *path, const coalesce_cfg_t *cfg)
+{
+	static const coalesce_pt_t origin;
+	coalesce_t c;
+
+	nin = 0;
+	nout = 0;
+	coalesce_init(&c, _emit, NULL);
+	c.ctx = &c;
+	coalesce_config(&c, cfg);
+	coalesce_reset(&c, &origin);
+	CHECK(jobfile_run(path, _move, &c) > 0);
+	coalesce_flush(&c);
+	return c.stats;
+}
+
+/*
+ * min_merged: share of the moves the defaults must fold away on this job.
+ */
+static void test_job(const char *name, double min_merged)
+{
+	coalesce_cfg_t cfg = {true, COALESCE_ANGLE, COALESCE_ERATE, COALESCE_DEVIATION};
+	coalesce_stats_t st;
+	char path[128];
+	double worst;
+
+	snprintf(path, sizeof(path), "gcode/%s", name);
+	st = _run(path, &cfg);
+	worst = _check_blocks(&cfg);
+	CHECK(st.moves == nin && st.blocks == nout);
+	CHECK(st.merged == st.moves - st.blocks);
+	CHECK(st.max_moves <= COALESCE_MAX_MOVES);
+	CHECK(st.max_deviation <= cfg.deviation);
+	CHECK(st.merged >= min_merged * st.moves);
+	printf("%s: %u moves into %u blocks, up to %u per block, deviation "
+		"%.1f um (%.1f um checked)\n", name, st.moves, st.blocks,
+		st.max_moves, st.max_deviation * 1000.0 / GCODE_UOM,
+		worst * 1000.0 / GCODE_UOM);
+
+	/* tighter settings merge less and still hold */
+	cfg.angle = 1.0f;
+	cfg.deviation = 2;
+	st = _run(path, &cfg);
+	_check_blocks(&cfg);
+	CHECK(st.max_deviation <= cfg.deviation);
+
+	cfg.enabled = false;
+	st = _run(path, &cfg);
+	CHECK(st.merged == 0 && st.blocks == st.moves);
+	_check_blocks(&cfg);
+}
+
+int main(void)
+{
+	test_job("cylinder.gcode", 0.6);
+	test_job("bracket.gcode", 0.1);
+	test_job("vase.gcode", 0.45);
+	return check_done("coalesce_test");
+}
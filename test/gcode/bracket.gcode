@@ -0,0 +1,3084 @@
+; 60 x 30 mm bracket with round corners and two holes, 4 layers
+; test job in the layout of PrusaSlicer 2.6 output, M83, retraction,
+; moves along the facets of a mesh
+;
+; external perimeters extrusion width = 0.45mm
+; perimeters extrusion width = 0.45mm
+; infill extrusion width = 0.45mm
+; first layer extrusion width = 0.45mm
+;
+M201 X1000 Y1000 Z200 E5000 ; sets maximum accelerations, mm/sec^2
+M203 X200 Y200 Z12 E120 ; sets maximum feedrates, mm / sec
+M204 P1250 R1250 T1250 ; sets acceleration (P, T) and retract acceleration (R), mm/sec^2
+G90 ; use absolute coordinates
+M83 ; extruder relative mode
+M104 S215 ; set extruder temp
+M140 S60 ; set bed temp
+M190 S60 ; wait for bed temp
+M109 S215 ; wait for extruder temp
+G28 W ; home all without mesh bed level
+G80 ; mesh bed leveling
+G1 Z0.2 F720
+G1 Y-3 F1000 ; go outside print area
+G1 X60 E9 F1000 ; intro line
+G1 X100 E12.5 F1000 ; intro line
+M221 S95
+G21 ; set units to millimeters
+G90 ; use absolute coordinates
+M83 ; use relative distances for extrusion
+M900 K0.05 ; Filament gcode LA 1.5
+M107
+;LAYER_CHANGE
+;TYPE:Perimeter
+;WIDTH:0.45
+G1 E-.8 F2100
+G1 X89.225 Y100 F10800
+G1 E.8 F2100
+G1 F2700
+G1 X89.205 Y100.414 E.01403
+G1 X89.144 Y100.824 E.01403
+G1 X89.043 Y101.226 E.01403
+G1 X88.903 Y101.617 E.01403
+G1 X88.726 Y101.992 E.01403
+G1 X88.513 Y102.347 E.01403
+G1 X88.266 Y102.68 E.01403
+G1 X87.988 Y102.988 E.01403
+G1 X87.68 Y103.266 E.01403
+G1 X87.347 Y103.513 E.01403
+G1 X86.992 Y103.726 E.01403
+G1 X86.617 Y103.903 E.01403
+G1 X86.226 Y104.043 E.01403
+G1 X85.824 Y104.144 E.01403
+G1 X85.414 Y104.205 E.01403
+G1 X85 Y104.225 E.01403
+G1 X84.586 Y104.205 E.01403
+G1 X84.176 Y104.144 E.01403
+G1 X83.774 Y104.043 E.01403
+G1 X83.383 Y103.903 E.01403
+G1 X83.008 Y103.726 E.01403
+G1 X82.653 Y103.513 E.01403
+G1 X82.32 Y103.266 E.01403
+G1 X82.012 Y102.988 E.01403
+G1 X81.734 Y102.68 E.01403
+G1 X81.487 Y102.347 E.01403
+G1 X81.274 Y101.992 E.01403
+G1 X81.097 Y101.617 E.01403
+G1 X80.957 Y101.226 E.01403
+G1 X80.856 Y100.824 E.01403
+G1 X80.795 Y100.414 E.01403
+G1 X80.775 Y100 E.01403
+G1 X80.795 Y99.586 E.01403
+G1 X80.856 Y99.176 E.01403
+G1 X80.957 Y98.774 E.01403
+G1 X81.097 Y98.383 E.01403
+G1 X81.274 Y98.008 E.01403
+G1 X81.487 Y97.653 E.01403
+G1 X81.734 Y97.32 E.01403
+G1 X82.012 Y97.012 E.01403
+G1 X82.32 Y96.734 E.01403
+G1 X82.653 Y96.487 E.01403
+G1 X83.008 Y96.274 E.01403
+G1 X83.383 Y96.097 E.01403
+G1 X83.774 Y95.957 E.01403
+G1 X84.176 Y95.856 E.01403
+G1 X84.586 Y95.795 E.01403
+G1 X85 Y95.775 E.01403
+G1 X85.414 Y95.795 E.01403
+G1 X85.824 Y95.856 E.01403
+G1 X86.226 Y95.957 E.01403
+G1 X86.617 Y96.097 E.01403
+G1 X86.992 Y96.274 E.01403
+G1 X87.347 Y96.487 E.01403
+G1 X87.68 Y96.734 E.01403
+G1 X87.988 Y97.012 E.01403
+G1 X88.266 Y97.32 E.01403
+G1 X88.513 Y97.653 E.01403
+G1 X88.726 Y98.008 E.01403
+G1 X88.903 Y98.383 E.01403
+G1 X89.043 Y98.774 E.01403
+G1 X89.144 Y99.176 E.01403
+G1 X89.205 Y99.586 E.01403
+G1 X89.225 Y100 E.01403
+G1 E-.8 F2100
+G1 X119.225 Y100 F10800
+G1 E.8 F2100
+G1 F2700
+G1 X119.205 Y100.414 E.01403
+G1 X119.144 Y100.824 E.01403
+G1 X119.043 Y101.226 E.01403
+G1 X118.903 Y101.617 E.01403
+G1 X118.726 Y101.992 E.01403
+G1 X118.513 Y102.347 E.01403
+G1 X118.266 Y102.68 E.01403
+G1 X117.988 Y102.988 E.01403
+G1 X117.68 Y103.266 E.01403
+G1 X117.347 Y103.513 E.01403
+G1 X116.992 Y103.726 E.01403
+G1 X116.617 Y103.903 E.01403
+G1 X116.226 Y104.043 E.01403
+G1 X115.824 Y104.144 E.01403
+G1 X115.414 Y104.205 E.01403
+G1 X115 Y104.225 E.01403
+G1 X114.586 Y104.205 E.01403
+G1 X114.176 Y104.144 E.01403
+G1 X113.774 Y104.043 E.01403
+G1 X113.383 Y103.903 E.01403
+G1 X113.008 Y103.726 E.01403
+G1 X112.653 Y103.513 E.01403
+G1 X112.32 Y103.266 E.01403
+G1 X112.012 Y102.988 E.01403
+G1 X111.734 Y102.68 E.01403
+G1 X111.487 Y102.347 E.01403
+G1 X111.274 Y101.992 E.01403
+G1 X111.097 Y101.617 E.01403
+G1 X110.957 Y101.226 E.01403
+G1 X110.856 Y100.824 E.01403
+G1 X110.795 Y100.414 E.01403
+G1 X110.775 Y100 E.01403
+G1 X110.795 Y99.586 E.01403
+G1 X110.856 Y99.176 E.01403
+G1 X110.957 Y98.774 E.01403
+G1 X111.097 Y98.383 E.01403
+G1 X111.274 Y98.008 E.01403
+G1 X111.487 Y97.653 E.01403
+G1 X111.734 Y97.32 E.01403
+G1 X112.012 Y97.012 E.01403
+G1 X112.32 Y96.734 E.01403
+G1 X112.653 Y96.487 E.01403
+G1 X113.008 Y96.274 E.01403
+G1 X113.383 Y96.097 E.01403
+G1 X113.774 Y95.957 E.01403
+G1 X114.176 Y95.856 E.01403
+G1 X114.586 Y95.795 E.01403
+G1 X115 Y95.775 E.01403
+G1 X115.414 Y95.795 E.01403
+G1 X115.824 Y95.856 E.01403
+G1 X116.226 Y95.957 E.01403
+G1 X116.617 Y96.097 E.01403
+G1 X116.992 Y96.274 E.01403
+G1 X117.347 Y96.487 E.01403
+G1 X117.68 Y96.734 E.01403
+G1 X117.988 Y97.012 E.01403
+G1 X118.266 Y97.32 E.01403
+G1 X118.513 Y97.653 E.01403
+G1 X118.726 Y98.008 E.01403
+G1 X118.903 Y98.383 E.01403
+G1 X119.043 Y98.774 E.01403
+G1 X119.144 Y99.176 E.01403
+G1 X119.205 Y99.586 E.01403
+G1 X119.225 Y100 E.01403
+G1 E-.8 F2100
+G1 X125.025 Y85.675 F10800
+G1 E.8 F2100
+G1 F2700
+G1 X125.306 Y85.684 E.00952
+G1 X125.586 Y85.712 E.00952
+G1 X125.864 Y85.758 E.00952
+G1 X126.138 Y85.822 E.00952
+G1 X126.407 Y85.903 E.00952
+G1 X126.671 Y86.002 E.00952
+G1 X126.927 Y86.118 E.00952
+G1 X127.175 Y86.251 E.00952
+G1 X127.414 Y86.4 E.00952
+G1 X127.643 Y86.564 E.00952
+G1 X127.86 Y86.742 E.00952
+G1 X128.066 Y86.934 E.00952
+G1 X128.258 Y87.14 E.00952
+G1 X128.436 Y87.357 E.00952
+G1 X128.6 Y87.586 E.00952
+G1 X128.749 Y87.825 E.00952
+G1 X128.882 Y88.073 E.00952
+G1 X128.998 Y88.329 E.00952
+G1 X129.097 Y88.593 E.00952
+G1 X129.178 Y88.862 E.00952
+G1 X129.242 Y89.136 E.00952
+G1 X129.288 Y89.414 E.00952
+G1 X129.316 Y89.694 E.00952
+G1 X129.325 Y89.975 E.00952
+G1 X129.325 Y110.025 E.67869
+G1 X129.316 Y110.306 E.00952
+G1 X129.288 Y110.586 E.00952
+G1 X129.242 Y110.864 E.00952
+G1 X129.178 Y111.138 E.00952
+G1 X129.097 Y111.407 E.00952
+G1 X128.998 Y111.671 E.00952
+G1 X128.882 Y111.927 E.00952
+G1 X128.749 Y112.175 E.00952
+G1 X128.6 Y112.414 E.00952
+G1 X128.436 Y112.643 E.00952
+G1 X128.258 Y112.86 E.00952
+G1 X128.066 Y113.066 E.00952
+G1 X127.86 Y113.258 E.00952
+G1 X127.643 Y113.436 E.00952
+G1 X127.414 Y113.6 E.00952
+G1 X127.175 Y113.749 E.00952
+G1 X126.927 Y113.882 E.00952
+G1 X126.671 Y113.998 E.00952
+G1 X126.407 Y114.097 E.00952
+G1 X126.138 Y114.178 E.00952
+G1 X125.864 Y114.242 E.00952
+G1 X125.586 Y114.288 E.00952
+G1 X125.306 Y114.316 E.00952
+G1 X125.025 Y114.325 E.00952
+G1 X74.975 Y114.325 E1.69419
+G1 X74.694 Y114.316 E.00952
+G1 X74.414 Y114.288 E.00952
+G1 X74.136 Y114.242 E.00952
+G1 X73.862 Y114.178 E.00952
+G1 X73.593 Y114.097 E.00952
+G1 X73.329 Y113.998 E.00952
+G1 X73.073 Y113.882 E.00952
+G1 X72.825 Y113.749 E.00952
+G1 X72.586 Y113.6 E.00952
+G1 X72.357 Y113.436 E.00952
+G1 X72.14 Y113.258 E.00952
+G1 X71.934 Y113.066 E.00952
+G1 X71.742 Y112.86 E.00952
+G1 X71.564 Y112.643 E.00952
+G1 X71.4 Y112.414 E.00952
+G1 X71.251 Y112.175 E.00952
+G1 X71.118 Y111.927 E.00952
+G1 X71.002 Y111.671 E.00952
+G1 X70.903 Y111.407 E.00952
+G1 X70.822 Y111.138 E.00952
+G1 X70.758 Y110.864 E.00952
+G1 X70.712 Y110.586 E.00952
+G1 X70.684 Y110.306 E.00952
+G1 X70.675 Y110.025 E.00952
+G1 X70.675 Y89.975 E.67869
+G1 X70.684 Y89.694 E.00952
+G1 X70.712 Y89.414 E.00952
+G1 X70.758 Y89.136 E.00952
+G1 X70.822 Y88.862 E.00952
+G1 X70.903 Y88.593 E.00952
+G1 X71.002 Y88.329 E.00952
+G1 X71.118 Y88.073 E.00952
+G1 X71.251 Y87.825 E.00952
+G1 X71.4 Y87.586 E.00952
+G1 X71.564 Y87.357 E.00952
+G1 X71.742 Y87.14 E.00952
+G1 X71.934 Y86.934 E.00952
+G1 X72.14 Y86.742 E.00952
+G1 X72.357 Y86.564 E.00952
+G1 X72.586 Y86.4 E.00952
+G1 X72.825 Y86.251 E.00952
+G1 X73.073 Y86.118 E.00952
+G1 X73.329 Y86.002 E.00952
+G1 X73.593 Y85.903 E.00952
+G1 X73.862 Y85.822 E.00952
+G1 X74.136 Y85.758 E.00952
+G1 X74.414 Y85.712 E.00952
+G1 X74.694 Y85.684 E.00952
+G1 X74.975 Y85.675 E.00952
+G1 X125.025 Y85.675 E1.69419
+;TYPE:External perimeter
+;WIDTH:0.45
+G1 E-.8 F2100
+G1 X88.775 Y100 F10800
+G1 E.8 F2100
+G1 F1800
+G1 X88.757 Y100.37 E.01254
+G1 X88.702 Y100.736 E.01254
+G1 X88.612 Y101.096 E.01254
+G1 X88.488 Y101.445 E.01254
+G1 X88.329 Y101.78 E.01254
+G1 X88.139 Y102.097 E.01254
+G1 X87.918 Y102.395 E.01254
+G1 X87.669 Y102.669 E.01254
+G1 X87.395 Y102.918 E.01254
+G1 X87.097 Y103.139 E.01254
+G1 X86.78 Y103.329 E.01254
+G1 X86.445 Y103.488 E.01254
+G1 X86.096 Y103.612 E.01254
+G1 X85.736 Y103.702 E.01254
+G1 X85.37 Y103.757 E.01254
+G1 X85 Y103.775 E.01254
+G1 X84.63 Y103.757 E.01254
+G1 X84.264 Y103.702 E.01254
+G1 X83.904 Y103.612 E.01254
+G1 X83.555 Y103.488 E.01254
+G1 X83.22 Y103.329 E.01254
+G1 X82.903 Y103.139 E.01254
+G1 X82.605 Y102.918 E.01254
+G1 X82.331 Y102.669 E.01254
+G1 X82.082 Y102.395 E.01254
+G1 X81.861 Y102.097 E.01254
+G1 X81.671 Y101.78 E.01254
+G1 X81.512 Y101.445 E.01254
+G1 X81.388 Y101.096 E.01254
+G1 X81.298 Y100.736 E.01254
+G1 X81.243 Y100.37 E.01254
+G1 X81.225 Y100 E.01254
+G1 X81.243 Y99.63 E.01254
+G1 X81.298 Y99.264 E.01254
+G1 X81.388 Y98.904 E.01254
+G1 X81.512 Y98.555 E.01254
+G1 X81.671 Y98.22 E.01254
+G1 X81.861 Y97.903 E.01254
+G1 X82.082 Y97.605 E.01254
+G1 X82.331 Y97.331 E.01254
+G1 X82.605 Y97.082 E.01254
+G1 X82.903 Y96.861 E.01254
+G1 X83.22 Y96.671 E.01254
+G1 X83.555 Y96.512 E.01254
+G1 X83.904 Y96.388 E.01254
+G1 X84.264 Y96.298 E.01254
+G1 X84.63 Y96.243 E.01254
+G1 X85 Y96.225 E.01254
+G1 X85.37 Y96.243 E.01254
+G1 X85.736 Y96.298 E.01254
+G1 X86.096 Y96.388 E.01254
+G1 X86.445 Y96.512 E.01254
+G1 X86.78 Y96.671 E.01254
+G1 X87.097 Y96.861 E.01254
+G1 X87.395 Y97.082 E.01254
+G1 X87.669 Y97.331 E.01254
+G1 X87.918 Y97.605 E.01254
+G1 X88.139 Y97.903 E.01254
+G1 X88.329 Y98.22 E.01254
+G1 X88.488 Y98.555 E.01254
+G1 X88.612 Y98.904 E.01254
+G1 X88.702 Y99.264 E.01254
+G1 X88.757 Y99.63 E.01254
+G1 X88.775 Y100 E.01254
+G1 E-.8 F2100
+G1 X118.775 Y100 F10800
+G1 E.8 F2100
+G1 F1800
+G1 X118.757 Y100.37 E.01254
+G1 X118.702 Y100.736 E.01254
+G1 X118.612 Y101.096 E.01254
+G1 X118.488 Y101.445 E.01254
+G1 X118.329 Y101.78 E.01254
+G1 X118.139 Y102.097 E.01254
+G1 X117.918 Y102.395 E.01254
+G1 X117.669 Y102.669 E.01254
+G1 X117.395 Y102.918 E.01254
+G1 X117.097 Y103.139 E.01254
+G1 X116.78 Y103.329 E.01254
+G1 X116.445 Y103.488 E.01254
+G1 X116.096 Y103.612 E.01254
+G1 X115.736 Y103.702 E.01254
+G1 X115.37 Y103.757 E.01254
+G1 X115 Y103.775 E.01254
+G1 X114.63 Y103.757 E.01254
+G1 X114.264 Y103.702 E.01254
+G1 X113.904 Y103.612 E.01254
+G1 X113.555 Y103.488 E.01254
+G1 X113.22 Y103.329 E.01254
+G1 X112.903 Y103.139 E.01254
+G1 X112.605 Y102.918 E.01254
+G1 X112.331 Y102.669 E.01254
+G1 X112.082 Y102.395 E.01254
+G1 X111.861 Y102.097 E.01254
+G1 X111.671 Y101.78 E.01254
+G1 X111.512 Y101.445 E.01254
+G1 X111.388 Y101.096 E.01254
+G1 X111.298 Y100.736 E.01254
+G1 X111.243 Y100.37 E.01254
+G1 X111.225 Y100 E.01254
+G1 X111.243 Y99.63 E.01254
+G1 X111.298 Y99.264 E.01254
+G1 X111.388 Y98.904 E.01254
+G1 X111.512 Y98.555 E.01254
+G1 X111.671 Y98.22 E.01254
+G1 X111.861 Y97.903 E.01254
+G1 X112.082 Y97.605 E.01254
+G1 X112.331 Y97.331 E.01254
+G1 X112.605 Y97.082 E.01254
+G1 X112.903 Y96.861 E.01254
+G1 X113.22 Y96.671 E.01254
+G1 X113.555 Y96.512 E.01254
+G1 X113.904 Y96.388 E.01254
+G1 X114.264 Y96.298 E.01254
+G1 X114.63 Y96.243 E.01254
+G1 X115 Y96.225 E.01254
+G1 X115.37 Y96.243 E.01254
+G1 X115.736 Y96.298 E.01254
+G1 X116.096 Y96.388 E.01254
+G1 X116.445 Y96.512 E.01254
+G1 X116.78 Y96.671 E.01254
+G1 X117.097 Y96.861 E.01254
+G1 X117.395 Y97.082 E.01254
+G1 X117.669 Y97.331 E.01254
+G1 X117.918 Y97.605 E.01254
+G1 X118.139 Y97.903 E.01254
+G1 X118.329 Y98.22 E.01254
+G1 X118.488 Y98.555 E.01254
+G1 X118.612 Y98.904 E.01254
+G1 X118.702 Y99.264 E.01254
+G1 X118.757 Y99.63 E.01254
+G1 X118.775 Y100 E.01254
+G1 E-.8 F2100
+G1 X125.025 Y85.225 F10800
+G1 E.8 F2100
+G1 F1800
+G1 X125.336 Y85.235 E.01052
+G1 X125.645 Y85.266 E.01052
+G1 X125.952 Y85.316 E.01052
+G1 X126.254 Y85.387 E.01052
+G1 X126.552 Y85.477 E.01052
+G1 X126.843 Y85.587 E.01052
+G1 X127.126 Y85.715 E.01052
+G1 X127.4 Y85.861 E.01052
+G1 X127.664 Y86.026 E.01052
+G1 X127.917 Y86.207 E.01052
+G1 X128.157 Y86.404 E.01052
+G1 X128.384 Y86.616 E.01052
+G1 X128.596 Y86.843 E.01052
+G1 X128.793 Y87.083 E.01052
+G1 X128.974 Y87.336 E.01052
+G1 X129.139 Y87.6 E.01052
+G1 X129.285 Y87.874 E.01052
+G1 X129.413 Y88.157 E.01052
+G1 X129.523 Y88.448 E.01052
+G1 X129.613 Y88.746 E.01052
+G1 X129.684 Y89.048 E.01052
+G1 X129.734 Y89.355 E.01052
+G1 X129.765 Y89.664 E.01052
+G1 X129.775 Y89.975 E.01052
+G1 X129.775 Y110.025 E.67869
+G1 X129.765 Y110.336 E.01052
+G1 X129.734 Y110.645 E.01052
+G1 X129.684 Y110.952 E.01052
+G1 X129.613 Y111.254 E.01052
+G1 X129.523 Y111.552 E.01052
+G1 X129.413 Y111.843 E.01052
+G1 X129.285 Y112.126 E.01052
+G1 X129.139 Y112.4 E.01052
+G1 X128.974 Y112.664 E.01052
+G1 X128.793 Y112.917 E.01052
+G1 X128.596 Y113.157 E.01052
+G1 X128.384 Y113.384 E.01052
+G1 X128.157 Y113.596 E.01052
+G1 X127.917 Y113.793 E.01052
+G1 X127.664 Y113.974 E.01052
+G1 X127.4 Y114.139 E.01052
+G1 X127.126 Y114.285 E.01052
+G1 X126.843 Y114.413 E.01052
+G1 X126.552 Y114.523 E.01052
+G1 X126.254 Y114.613 E.01052
+G1 X125.952 Y114.684 E.01052
+G1 X125.645 Y114.734 E.01052
+G1 X125.336 Y114.765 E.01052
+G1 X125.025 Y114.775 E.01052
+G1 X74.975 Y114.775 E1.69419
+G1 X74.664 Y114.765 E.01052
+G1 X74.355 Y114.734 E.01052
+G1 X74.048 Y114.684 E.01052
+G1 X73.746 Y114.613 E.01052
+G1 X73.448 Y114.523 E.01052
+G1 X73.157 Y114.413 E.01052
+G1 X72.874 Y114.285 E.01052
+G1 X72.6 Y114.139 E.01052
+G1 X72.336 Y113.974 E.01052
+G1 X72.083 Y113.793 E.01052
+G1 X71.843 Y113.596 E.01052
+G1 X71.616 Y113.384 E.01052
+G1 X71.404 Y113.157 E.01052
+G1 X71.207 Y112.917 E.01052
+G1 X71.026 Y112.664 E.01052
+G1 X70.861 Y112.4 E.01052
+G1 X70.715 Y112.126 E.01052
+G1 X70.587 Y111.843 E.01052
+G1 X70.477 Y111.552 E.01052
+G1 X70.387 Y111.254 E.01052
+G1 X70.316 Y110.952 E.01052
+G1 X70.266 Y110.645 E.01052
+G1 X70.235 Y110.336 E.01052
+G1 X70.225 Y110.025 E.01052
+G1 X70.225 Y89.975 E.67869
+G1 X70.235 Y89.664 E.01052
+G1 X70.266 Y89.355 E.01052
+G1 X70.316 Y89.048 E.01052
+G1 X70.387 Y88.746 E.01052
+G1 X70.477 Y88.448 E.01052
+G1 X70.587 Y88.157 E.01052
+G1 X70.715 Y87.874 E.01052
+G1 X70.861 Y87.6 E.01052
+G1 X71.026 Y87.336 E.01052
+G1 X71.207 Y87.083 E.01052
+G1 X71.404 Y86.843 E.01052
+G1 X71.616 Y86.616 E.01052
+G1 X71.843 Y86.404 E.01052
+G1 X72.083 Y86.207 E.01052
+G1 X72.336 Y86.026 E.01052
+G1 X72.6 Y85.861 E.01052
+G1 X72.874 Y85.715 E.01052
+G1 X73.157 Y85.587 E.01052
+G1 X73.448 Y85.477 E.01052
+G1 X73.746 Y85.387 E.01052
+G1 X74.048 Y85.316 E.01052
+G1 X74.355 Y85.266 E.01052
+G1 X74.664 Y85.235 E.01052
+G1 X74.975 Y85.225 E.01052
+G1 X125.025 Y85.225 E1.69419
+;TYPE:Solid infill
+;WIDTH:0.45
+G1 E-.8 F2100
+G1 X71.021 Y86.636 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X71.622 Y86.035 E.02877
+G1 X72.259 Y86.035 E.02154
+G1 X71.021 Y87.272 E.05924
+G1 X71.021 Y87.908 E.02154
+G1 X72.895 Y86.035 E.0897
+G1 X73.532 Y86.035 E.02154
+G1 X71.021 Y88.545 E.12017
+G1 X71.021 Y89.181 E.02154
+G1 X74.168 Y86.035 E.15063
+G1 X74.804 Y86.035 E.02154
+G1 X71.021 Y89.818 E.1811
+G1 X71.021 Y90.454 E.02154
+G1 X75.441 Y86.035 E.21156
+G1 X76.077 Y86.035 E.02154
+G1 X71.021 Y91.09 E.24203
+G1 X71.021 Y91.727 E.02154
+G1 X76.714 Y86.035 E.27249
+G1 X77.35 Y86.035 E.02154
+G1 X71.021 Y92.363 E.30296
+G1 X71.021 Y93 E.02154
+G1 X77.986 Y86.035 E.33342
+G1 X78.623 Y86.035 E.02154
+G1 X71.021 Y93.636 E.36389
+G1 X71.021 Y94.272 E.02154
+G1 X79.259 Y86.035 E.39435
+G1 X79.896 Y86.035 E.02154
+G1 X71.021 Y94.909 E.42482
+G1 X71.021 Y95.545 E.02154
+G1 X80.532 Y86.035 E.45528
+G1 X81.168 Y86.035 E.02154
+G1 X71.021 Y96.182 E.48575
+G1 X71.021 Y96.818 E.02154
+G1 X81.805 Y86.035 E.51621
+G1 X82.441 Y86.035 E.02154
+G1 X71.021 Y97.454 E.54668
+G1 X71.021 Y98.091 E.02154
+G1 X83.077 Y86.035 E.57714
+G1 X83.714 Y86.035 E.02154
+G1 X71.021 Y98.727 E.60761
+G1 X71.021 Y99.364 E.02154
+G1 X84.35 Y86.035 E.63807
+G1 X84.987 Y86.035 E.02154
+G1 X71.021 Y100 E.66854
+G1 X71.021 Y100.636 E.02154
+G1 X85.623 Y86.035 E.699
+G1 X86.259 Y86.035 E.02154
+G1 X71.021 Y101.273 E.72947
+G1 X71.021 Y101.909 E.02154
+G1 X86.896 Y86.035 E.75993
+G1 X87.532 Y86.035 E.02154
+G1 X71.021 Y102.546 E.7904
+G1 X71.021 Y103.182 E.02154
+G1 X88.169 Y86.035 E.82086
+G1 X88.805 Y86.035 E.02154
+G1 X71.021 Y103.818 E.85133
+G1 X71.021 Y104.455 E.02154
+G1 X89.441 Y86.035 E.88179
+G1 X90.078 Y86.035 E.02154
+G1 X71.021 Y105.091 E.91226
+G1 X71.021 Y105.728 E.02154
+G1 X90.714 Y86.035 E.94272
+G1 X91.351 Y86.035 E.02154
+G1 X71.021 Y106.364 E.97319
+G1 X71.021 Y107 E.02154
+G1 X91.987 Y86.035 E1.00365
+G1 X92.623 Y86.035 E.02154
+G1 X71.021 Y107.637 E1.03412
+G1 X71.021 Y108.273 E.02154
+G1 X93.26 Y86.035 E1.06458
+G1 X93.896 Y86.035 E.02154
+G1 X71.021 Y108.91 E1.09505
+G1 X71.021 Y109.546 E.02154
+G1 X94.533 Y86.035 E1.12551
+G1 X95.169 Y86.035 E.02154
+G1 X71.021 Y110.182 E1.15598
+G1 X71.021 Y110.819 E.02154
+G1 X95.805 Y86.035 E1.18644
+G1 X96.442 Y86.035 E.02154
+G1 X71.021 Y111.455 E1.21691
+G1 X71.021 Y112.092 E.02154
+G1 X97.078 Y86.035 E1.24737
+G1 X97.715 Y86.035 E.02154
+G1 X71.021 Y112.728 E1.27784
+G1 X71.021 Y113.364 E.02154
+G1 X98.351 Y86.035 E1.3083
+G1 X98.987 Y86.035 E.02154
+G1 X71.057 Y113.965 E1.33708
+G1 X71.693 Y113.965 E.02154
+G1 X99.624 Y86.035 E1.33708
+G1 X100.26 Y86.035 E.02154
+G1 X72.329 Y113.965 E1.33708
+G1 X72.966 Y113.965 E.02154
+G1 X100.897 Y86.035 E1.33708
+G1 X101.533 Y86.035 E.02154
+G1 X73.602 Y113.965 E1.33708
+G1 X74.239 Y113.965 E.02154
+G1 X102.169 Y86.035 E1.33708
+G1 X102.806 Y86.035 E.02154
+G1 X74.875 Y113.965 E1.33708
+G1 X75.511 Y113.965 E.02154
+G1 X103.442 Y86.035 E1.33708
+G1 X104.079 Y86.035 E.02154
+G1 X76.148 Y113.965 E1.33708
+G1 X76.784 Y113.965 E.02154
+G1 X104.715 Y86.035 E1.33708
+G1 X105.351 Y86.035 E.02154
+G1 X77.421 Y113.965 E1.33708
+G1 X78.057 Y113.965 E.02154
+G1 X105.988 Y86.035 E1.33708
+G1 X106.624 Y86.035 E.02154
+G1 X78.693 Y113.965 E1.33708
+G1 X79.33 Y113.965 E.02154
+G1 X107.261 Y86.035 E1.33708
+G1 X107.897 Y86.035 E.02154
+G1 X79.966 Y113.965 E1.33708
+G1 X80.603 Y113.965 E.02154
+G1 X108.533 Y86.035 E1.33708
+G1 X109.17 Y86.035 E.02154
+G1 X81.239 Y113.965 E1.33708
+G1 X81.875 Y113.965 E.02154
+G1 X109.806 Y86.035 E1.33708
+G1 X110.443 Y86.035 E.02154
+G1 X82.512 Y113.965 E1.33708
+G1 X83.148 Y113.965 E.02154
+G1 X111.079 Y86.035 E1.33708
+G1 X111.715 Y86.035 E.02154
+G1 X83.785 Y113.965 E1.33708
+G1 X84.421 Y113.965 E.02154
+G1 X112.352 Y86.035 E1.33708
+G1 X112.988 Y86.035 E.02154
+G1 X85.057 Y113.965 E1.33708
+G1 X85.694 Y113.965 E.02154
+G1 X113.625 Y86.035 E1.33708
+G1 X114.261 Y86.035 E.02154
+G1 X86.33 Y113.965 E1.33708
+G1 X86.967 Y113.965 E.02154
+G1 X114.897 Y86.035 E1.33708
+G1 X115.534 Y86.035 E.02154
+G1 X87.603 Y113.965 E1.33708
+G1 X88.239 Y113.965 E.02154
+G1 X116.17 Y86.035 E1.33708
+G1 X116.806 Y86.035 E.02154
+G1 X88.876 Y113.965 E1.33708
+G1 X89.512 Y113.965 E.02154
+G1 X117.443 Y86.035 E1.33708
+G1 X118.079 Y86.035 E.02154
+G1 X90.149 Y113.965 E1.33708
+G1 X90.785 Y113.965 E.02154
+G1 X118.716 Y86.035 E1.33708
+G1 X119.352 Y86.035 E.02154
+G1 X91.421 Y113.965 E1.33708
+G1 X92.058 Y113.965 E.02154
+G1 X119.988 Y86.035 E1.33708
+G1 X120.625 Y86.035 E.02154
+G1 X92.694 Y113.965 E1.33708
+G1 X93.331 Y113.965 E.02154
+G1 X121.261 Y86.035 E1.33708
+G1 X121.898 Y86.035 E.02154
+G1 X93.967 Y113.965 E1.33708
+G1 X94.603 Y113.965 E.02154
+G1 X122.534 Y86.035 E1.33708
+G1 X123.17 Y86.035 E.02154
+G1 X95.24 Y113.965 E1.33708
+G1 X95.876 Y113.965 E.02154
+G1 X123.807 Y86.035 E1.33708
+G1 X124.443 Y86.035 E.02154
+G1 X96.513 Y113.965 E1.33708
+G1 X97.149 Y113.965 E.02154
+G1 X125.08 Y86.035 E1.33708
+G1 X125.716 Y86.035 E.02154
+G1 X97.785 Y113.965 E1.33708
+G1 X98.422 Y113.965 E.02154
+G1 X126.352 Y86.035 E1.33708
+G1 X126.989 Y86.035 E.02154
+G1 X99.058 Y113.965 E1.33708
+G1 X99.695 Y113.965 E.02154
+G1 X127.625 Y86.035 E1.33708
+G1 X128.262 Y86.035 E.02154
+G1 X100.331 Y113.965 E1.33708
+G1 X100.967 Y113.965 E.02154
+G1 X128.898 Y86.035 E1.33708
+G1 X128.969 Y86.6 E.0193
+G1 X101.604 Y113.965 E1.31
+G1 X102.24 Y113.965 E.02154
+G1 X128.969 Y87.237 E1.27953
+G1 X128.969 Y87.873 E.02154
+G1 X102.876 Y113.965 E1.24907
+G1 X103.513 Y113.965 E.02154
+G1 X128.969 Y88.51 E1.2186
+G1 X128.969 Y89.146 E.02154
+G1 X104.149 Y113.965 E1.18814
+G1 X104.786 Y113.965 E.02154
+G1 X128.969 Y89.782 E1.15767
+G1 X128.969 Y90.419 E.02154
+G1 X105.422 Y113.965 E1.12721
+G1 X106.058 Y113.965 E.02154
+G1 X128.969 Y91.055 E1.09674
+G1 X128.969 Y91.691 E.02154
+G1 X106.695 Y113.965 E1.06628
+G1 X107.331 Y113.965 E.02154
+G1 X128.969 Y92.328 E1.03581
+G1 X128.969 Y92.964 E.02154
+G1 X107.968 Y113.965 E1.00535
+G1 X108.604 Y113.965 E.02154
+G1 X128.969 Y93.601 E.97488
+G1 X128.969 Y94.237 E.02154
+G1 X109.24 Y113.965 E.94442
+G1 X109.877 Y113.965 E.02154
+G1 X128.969 Y94.873 E.91395
+G1 X128.969 Y95.51 E.02154
+G1 X110.513 Y113.965 E.88349
+G1 X111.15 Y113.965 E.02154
+G1 X128.969 Y96.146 E.85302
+G1 X128.969 Y96.783 E.02154
+G1 X111.786 Y113.965 E.82256
+G1 X112.422 Y113.965 E.02154
+G1 X128.969 Y97.419 E.79209
+G1 X128.969 Y98.055 E.02154
+G1 X113.059 Y113.965 E.76163
+G1 X113.695 Y113.965 E.02154
+G1 X128.969 Y98.692 E.73116
+G1 X128.969 Y99.328 E.02154
+G1 X114.332 Y113.965 E.7007
+G1 X114.968 Y113.965 E.02154
+G1 X128.969 Y99.965 E.67023
+G1 X128.969 Y100.601 E.02154
+G1 X115.604 Y113.965 E.63977
+G1 X116.241 Y113.965 E.02154
+G1 X128.969 Y101.237 E.6093
+G1 X128.969 Y101.874 E.02154
+G1 X116.877 Y113.965 E.57884
+G1 X117.514 Y113.965 E.02154
+G1 X128.969 Y102.51 E.54837
+G1 X128.969 Y103.147 E.02154
+G1 X118.15 Y113.965 E.51791
+G1 X118.786 Y113.965 E.02154
+G1 X128.969 Y103.783 E.48744
+G1 X128.969 Y104.419 E.02154
+G1 X119.423 Y113.965 E.45698
+G1 X120.059 Y113.965 E.02154
+G1 X128.969 Y105.056 E.42651
+G1 X128.969 Y105.692 E.02154
+G1 X120.696 Y113.965 E.39605
+G1 X121.332 Y113.965 E.02154
+G1 X128.969 Y106.329 E.36558
+G1 X128.969 Y106.965 E.02154
+G1 X121.968 Y113.965 E.33512
+G1 X122.605 Y113.965 E.02154
+G1 X128.969 Y107.601 E.30465
+G1 X128.969 Y108.238 E.02154
+G1 X123.241 Y113.965 E.27419
+G1 X123.878 Y113.965 E.02154
+G1 X128.969 Y108.874 E.24372
+G1 X128.969 Y109.511 E.02154
+G1 X124.514 Y113.965 E.21326
+G1 X125.15 Y113.965 E.02154
+G1 X128.969 Y110.147 E.18279
+G1 X128.969 Y110.783 E.02154
+G1 X125.787 Y113.965 E.15233
+G1 X126.423 Y113.965 E.02154
+G1 X128.969 Y111.42 E.12186
+G1 X128.969 Y112.056 E.02154
+G1 X127.06 Y113.965 E.0914
+G1 X127.696 Y113.965 E.02154
+G1 X128.969 Y112.693 E.06093
+G1 X128.969 Y113.329 E.02154
+G1 X128.332 Y113.965 E.03047
+;LAYER_CHANGE
+;Z:0.4
+;HEIGHT:0.2
+G1 E-.8 F2100
+G1 Z0.4 F720
+G1 E.8 F2100
+;TYPE:Perimeter
+;WIDTH:0.45
+G1 E-.8 F2100
+G1 X89.225 Y100 F10800
+G1 E.8 F2100
+G1 F2700
+G1 X89.205 Y100.414 E.01403
+G1 X89.144 Y100.824 E.01403
+G1 X89.043 Y101.226 E.01403
+G1 X88.903 Y101.617 E.01403
+G1 X88.726 Y101.992 E.01403
+G1 X88.513 Y102.347 E.01403
+G1 X88.266 Y102.68 E.01403
+G1 X87.988 Y102.988 E.01403
+G1 X87.68 Y103.266 E.01403
+G1 X87.347 Y103.513 E.01403
+G1 X86.992 Y103.726 E.01403
+G1 X86.617 Y103.903 E.01403
+G1 X86.226 Y104.043 E.01403
+G1 X85.824 Y104.144 E.01403
+G1 X85.414 Y104.205 E.01403
+G1 X85 Y104.225 E.01403
+G1 X84.586 Y104.205 E.01403
+G1 X84.176 Y104.144 E.01403
+G1 X83.774 Y104.043 E.01403
+G1 X83.383 Y103.903 E.01403
+G1 X83.008 Y103.726 E.01403
+G1 X82.653 Y103.513 E.01403
+G1 X82.32 Y103.266 E.01403
+G1 X82.012 Y102.988 E.01403
+G1 X81.734 Y102.68 E.01403
+G1 X81.487 Y102.347 E.01403
+G1 X81.274 Y101.992 E.01403
+G1 X81.097 Y101.617 E.01403
+G1 X80.957 Y101.226 E.01403
+G1 X80.856 Y100.824 E.01403
+G1 X80.795 Y100.414 E.01403
+G1 X80.775 Y100 E.01403
+G1 X80.795 Y99.586 E.01403
+G1 X80.856 Y99.176 E.01403
+G1 X80.957 Y98.774 E.01403
+G1 X81.097 Y98.383 E.01403
+G1 X81.274 Y98.008 E.01403
+G1 X81.487 Y97.653 E.01403
+G1 X81.734 Y97.32 E.01403
+G1 X82.012 Y97.012 E.01403
+G1 X82.32 Y96.734 E.01403
+G1 X82.653 Y96.487 E.01403
+G1 X83.008 Y96.274 E.01403
+G1 X83.383 Y96.097 E.01403
+G1 X83.774 Y95.957 E.01403
+G1 X84.176 Y95.856 E.01403
+G1 X84.586 Y95.795 E.01403
+G1 X85 Y95.775 E.01403
+G1 X85.414 Y95.795 E.01403
+G1 X85.824 Y95.856 E.01403
+G1 X86.226 Y95.957 E.01403
+G1 X86.617 Y96.097 E.01403
+G1 X86.992 Y96.274 E.01403
+G1 X87.347 Y96.487 E.01403
+G1 X87.68 Y96.734 E.01403
+G1 X87.988 Y97.012 E.01403
+G1 X88.266 Y97.32 E.01403
+G1 X88.513 Y97.653 E.01403
+G1 X88.726 Y98.008 E.01403
+G1 X88.903 Y98.383 E.01403
+G1 X89.043 Y98.774 E.01403
+G1 X89.144 Y99.176 E.01403
+G1 X89.205 Y99.586 E.01403
+G1 X89.225 Y100 E.01403
+G1 E-.8 F2100
+G1 X119.225 Y100 F10800
+G1 E.8 F2100
+G1 F2700
+G1 X119.205 Y100.414 E.01403
+G1 X119.144 Y100.824 E.01403
+G1 X119.043 Y101.226 E.01403
+G1 X118.903 Y101.617 E.01403
+G1 X118.726 Y101.992 E.01403
+G1 X118.513 Y102.347 E.01403
+G1 X118.266 Y102.68 E.01403
+G1 X117.988 Y102.988 E.01403
+G1 X117.68 Y103.266 E.01403
+G1 X117.347 Y103.513 E.01403
+G1 X116.992 Y103.726 E.01403
+G1 X116.617 Y103.903 E.01403
+G1 X116.226 Y104.043 E.01403
+G1 X115.824 Y104.144 E.01403
+G1 X115.414 Y104.205 E.01403
+G1 X115 Y104.225 E.01403
+G1 X114.586 Y104.205 E.01403
+G1 X114.176 Y104.144 E.01403
+G1 X113.774 Y104.043 E.01403
+G1 X113.383 Y103.903 E.01403
+G1 X113.008 Y103.726 E.01403
+G1 X112.653 Y103.513 E.01403
+G1 X112.32 Y103.266 E.01403
+G1 X112.012 Y102.988 E.01403
+G1 X111.734 Y102.68 E.01403
+G1 X111.487 Y102.347 E.01403
+G1 X111.274 Y101.992 E.01403
+G1 X111.097 Y101.617 E.01403
+G1 X110.957 Y101.226 E.01403
+G1 X110.856 Y100.824 E.01403
+G1 X110.795 Y100.414 E.01403
+G1 X110.775 Y100 E.01403
+G1 X110.795 Y99.586 E.01403
+G1 X110.856 Y99.176 E.01403
+G1 X110.957 Y98.774 E.01403
+G1 X111.097 Y98.383 E.01403
+G1 X111.274 Y98.008 E.01403
+G1 X111.487 Y97.653 E.01403
+G1 X111.734 Y97.32 E.01403
+G1 X112.012 Y97.012 E.01403
+G1 X112.32 Y96.734 E.01403
+G1 X112.653 Y96.487 E.01403
+G1 X113.008 Y96.274 E.01403
+G1 X113.383 Y96.097 E.01403
+G1 X113.774 Y95.957 E.01403
+G1 X114.176 Y95.856 E.01403
+G1 X114.586 Y95.795 E.01403
+G1 X115 Y95.775 E.01403
+G1 X115.414 Y95.795 E.01403
+G1 X115.824 Y95.856 E.01403
+G1 X116.226 Y95.957 E.01403
+G1 X116.617 Y96.097 E.01403
+G1 X116.992 Y96.274 E.01403
+G1 X117.347 Y96.487 E.01403
+G1 X117.68 Y96.734 E.01403
+G1 X117.988 Y97.012 E.01403
+G1 X118.266 Y97.32 E.01403
+G1 X118.513 Y97.653 E.01403
+G1 X118.726 Y98.008 E.01403
+G1 X118.903 Y98.383 E.01403
+G1 X119.043 Y98.774 E.01403
+G1 X119.144 Y99.176 E.01403
+G1 X119.205 Y99.586 E.01403
+G1 X119.225 Y100 E.01403
+G1 E-.8 F2100
+G1 X125.025 Y85.675 F10800
+G1 E.8 F2100
+G1 F2700
+G1 X125.306 Y85.684 E.00952
+G1 X125.586 Y85.712 E.00952
+G1 X125.864 Y85.758 E.00952
+G1 X126.138 Y85.822 E.00952
+G1 X126.407 Y85.903 E.00952
+G1 X126.671 Y86.002 E.00952
+G1 X126.927 Y86.118 E.00952
+G1 X127.175 Y86.251 E.00952
+G1 X127.414 Y86.4 E.00952
+G1 X127.643 Y86.564 E.00952
+G1 X127.86 Y86.742 E.00952
+G1 X128.066 Y86.934 E.00952
+G1 X128.258 Y87.14 E.00952
+G1 X128.436 Y87.357 E.00952
+G1 X128.6 Y87.586 E.00952
+G1 X128.749 Y87.825 E.00952
+G1 X128.882 Y88.073 E.00952
+G1 X128.998 Y88.329 E.00952
+G1 X129.097 Y88.593 E.00952
+G1 X129.178 Y88.862 E.00952
+G1 X129.242 Y89.136 E.00952
+G1 X129.288 Y89.414 E.00952
+G1 X129.316 Y89.694 E.00952
+G1 X129.325 Y89.975 E.00952
+G1 X129.325 Y110.025 E.67869
+G1 X129.316 Y110.306 E.00952
+G1 X129.288 Y110.586 E.00952
+G1 X129.242 Y110.864 E.00952
+G1 X129.178 Y111.138 E.00952
+G1 X129.097 Y111.407 E.00952
+G1 X128.998 Y111.671 E.00952
+G1 X128.882 Y111.927 E.00952
+G1 X128.749 Y112.175 E.00952
+G1 X128.6 Y112.414 E.00952
+G1 X128.436 Y112.643 E.00952
+G1 X128.258 Y112.86 E.00952
+G1 X128.066 Y113.066 E.00952
+G1 X127.86 Y113.258 E.00952
+G1 X127.643 Y113.436 E.00952
+G1 X127.414 Y113.6 E.00952
+G1 X127.175 Y113.749 E.00952
+G1 X126.927 Y113.882 E.00952
+G1 X126.671 Y113.998 E.00952
+G1 X126.407 Y114.097 E.00952
+G1 X126.138 Y114.178 E.00952
+G1 X125.864 Y114.242 E.00952
+G1 X125.586 Y114.288 E.00952
+G1 X125.306 Y114.316 E.00952
+G1 X125.025 Y114.325 E.00952
+G1 X74.975 Y114.325 E1.69419
+G1 X74.694 Y114.316 E.00952
+G1 X74.414 Y114.288 E.00952
+G1 X74.136 Y114.242 E.00952
+G1 X73.862 Y114.178 E.00952
+G1 X73.593 Y114.097 E.00952
+G1 X73.329 Y113.998 E.00952
+G1 X73.073 Y113.882 E.00952
+G1 X72.825 Y113.749 E.00952
+G1 X72.586 Y113.6 E.00952
+G1 X72.357 Y113.436 E.00952
+G1 X72.14 Y113.258 E.00952
+G1 X71.934 Y113.066 E.00952
+G1 X71.742 Y112.86 E.00952
+G1 X71.564 Y112.643 E.00952
+G1 X71.4 Y112.414 E.00952
+G1 X71.251 Y112.175 E.00952
+G1 X71.118 Y111.927 E.00952
+G1 X71.002 Y111.671 E.00952
+G1 X70.903 Y111.407 E.00952
+G1 X70.822 Y111.138 E.00952
+G1 X70.758 Y110.864 E.00952
+G1 X70.712 Y110.586 E.00952
+G1 X70.684 Y110.306 E.00952
+G1 X70.675 Y110.025 E.00952
+G1 X70.675 Y89.975 E.67869
+G1 X70.684 Y89.694 E.00952
+G1 X70.712 Y89.414 E.00952
+G1 X70.758 Y89.136 E.00952
+G1 X70.822 Y88.862 E.00952
+G1 X70.903 Y88.593 E.00952
+G1 X71.002 Y88.329 E.00952
+G1 X71.118 Y88.073 E.00952
+G1 X71.251 Y87.825 E.00952
+G1 X71.4 Y87.586 E.00952
+G1 X71.564 Y87.357 E.00952
+G1 X71.742 Y87.14 E.00952
+G1 X71.934 Y86.934 E.00952
+G1 X72.14 Y86.742 E.00952
+G1 X72.357 Y86.564 E.00952
+G1 X72.586 Y86.4 E.00952
+G1 X72.825 Y86.251 E.00952
+G1 X73.073 Y86.118 E.00952
+G1 X73.329 Y86.002 E.00952
+G1 X73.593 Y85.903 E.00952
+G1 X73.862 Y85.822 E.00952
+G1 X74.136 Y85.758 E.00952
+G1 X74.414 Y85.712 E.00952
+G1 X74.694 Y85.684 E.00952
+G1 X74.975 Y85.675 E.00952
+G1 X125.025 Y85.675 E1.69419
+;TYPE:External perimeter
+;WIDTH:0.45
+G1 E-.8 F2100
+G1 X88.775 Y100 F10800
+G1 E.8 F2100
+G1 F1800
+G1 X88.757 Y100.37 E.01254
+G1 X88.702 Y100.736 E.01254
+G1 X88.612 Y101.096 E.01254
+G1 X88.488 Y101.445 E.01254
+G1 X88.329 Y101.78 E.01254
+G1 X88.139 Y102.097 E.01254
+G1 X87.918 Y102.395 E.01254
+G1 X87.669 Y102.669 E.01254
+G1 X87.395 Y102.918 E.01254
+G1 X87.097 Y103.139 E.01254
+G1 X86.78 Y103.329 E.01254
+G1 X86.445 Y103.488 E.01254
+G1 X86.096 Y103.612 E.01254
+G1 X85.736 Y103.702 E.01254
+G1 X85.37 Y103.757 E.01254
+G1 X85 Y103.775 E.01254
+G1 X84.63 Y103.757 E.01254
+G1 X84.264 Y103.702 E.01254
+G1 X83.904 Y103.612 E.01254
+G1 X83.555 Y103.488 E.01254
+G1 X83.22 Y103.329 E.01254
+G1 X82.903 Y103.139 E.01254
+G1 X82.605 Y102.918 E.01254
+G1 X82.331 Y102.669 E.01254
+G1 X82.082 Y102.395 E.01254
+G1 X81.861 Y102.097 E.01254
+G1 X81.671 Y101.78 E.01254
+G1 X81.512 Y101.445 E.01254
+G1 X81.388 Y101.096 E.01254
+G1 X81.298 Y100.736 E.01254
+G1 X81.243 Y100.37 E.01254
+G1 X81.225 Y100 E.01254
+G1 X81.243 Y99.63 E.01254
+G1 X81.298 Y99.264 E.01254
+G1 X81.388 Y98.904 E.01254
+G1 X81.512 Y98.555 E.01254
+G1 X81.671 Y98.22 E.01254
+G1 X81.861 Y97.903 E.01254
+G1 X82.082 Y97.605 E.01254
+G1 X82.331 Y97.331 E.01254
+G1 X82.605 Y97.082 E.01254
+G1 X82.903 Y96.861 E.01254
+G1 X83.22 Y96.671 E.01254
+G1 X83.555 Y96.512 E.01254
+G1 X83.904 Y96.388 E.01254
+G1 X84.264 Y96.298 E.01254
+G1 X84.63 Y96.243 E.01254
+G1 X85 Y96.225 E.01254
+G1 X85.37 Y96.243 E.01254
+G1 X85.736 Y96.298 E.01254
+G1 X86.096 Y96.388 E.01254
+G1 X86.445 Y96.512 E.01254
+G1 X86.78 Y96.671 E.01254
+G1 X87.097 Y96.861 E.01254
+G1 X87.395 Y97.082 E.01254
+G1 X87.669 Y97.331 E.01254
+G1 X87.918 Y97.605 E.01254
+G1 X88.139 Y97.903 E.01254
+G1 X88.329 Y98.22 E.01254
+G1 X88.488 Y98.555 E.01254
+G1 X88.612 Y98.904 E.01254
+G1 X88.702 Y99.264 E.01254
+G1 X88.757 Y99.63 E.01254
+G1 X88.775 Y100 E.01254
+G1 E-.8 F2100
+G1 X118.775 Y100 F10800
+G1 E.8 F2100
+G1 F1800
+G1 X118.757 Y100.37 E.01254
+G1 X118.702 Y100.736 E.01254
+G1 X118.612 Y101.096 E.01254
+G1 X118.488 Y101.445 E.01254
+G1 X118.329 Y101.78 E.01254
+G1 X118.139 Y102.097 E.01254
+G1 X117.918 Y102.395 E.01254
+G1 X117.669 Y102.669 E.01254
+G1 X117.395 Y102.918 E.01254
+G1 X117.097 Y103.139 E.01254
+G1 X116.78 Y103.329 E.01254
+G1 X116.445 Y103.488 E.01254
+G1 X116.096 Y103.612 E.01254
+G1 X115.736 Y103.702 E.01254
+G1 X115.37 Y103.757 E.01254
+G1 X115 Y103.775 E.01254
+G1 X114.63 Y103.757 E.01254
+G1 X114.264 Y103.702 E.01254
+G1 X113.904 Y103.612 E.01254
+G1 X113.555 Y103.488 E.01254
+G1 X113.22 Y103.329 E.01254
+G1 X112.903 Y103.139 E.01254
+G1 X112.605 Y102.918 E.01254
+G1 X112.331 Y102.669 E.01254
+G1 X112.082 Y102.395 E.01254
+G1 X111.861 Y102.097 E.01254
+G1 X111.671 Y101.78 E.01254
+G1 X111.512 Y101.445 E.01254
+G1 X111.388 Y101.096 E.01254
+G1 X111.298 Y100.736 E.01254
+G1 X111.243 Y100.37 E.01254
+G1 X111.225 Y100 E.01254
+G1 X111.243 Y99.63 E.01254
+G1 X111.298 Y99.264 E.01254
+G1 X111.388 Y98.904 E.01254
+G1 X111.512 Y98.555 E.01254
+G1 X111.671 Y98.22 E.01254
+G1 X111.861 Y97.903 E.01254
+G1 X112.082 Y97.605 E.01254
+G1 X112.331 Y97.331 E.01254
+G1 X112.605 Y97.082 E.01254
+G1 X112.903 Y96.861 E.01254
+G1 X113.22 Y96.671 E.01254
+G1 X113.555 Y96.512 E.01254
+G1 X113.904 Y96.388 E.01254
+G1 X114.264 Y96.298 E.01254
+G1 X114.63 Y96.243 E.01254
+G1 X115 Y96.225 E.01254
+G1 X115.37 Y96.243 E.01254
+G1 X115.736 Y96.298 E.01254
+G1 X116.096 Y96.388 E.01254
+G1 X116.445 Y96.512 E.01254
+G1 X116.78 Y96.671 E.01254
+G1 X117.097 Y96.861 E.01254
+G1 X117.395 Y97.082 E.01254
+G1 X117.669 Y97.331 E.01254
+G1 X117.918 Y97.605 E.01254
+G1 X118.139 Y97.903 E.01254
+G1 X118.329 Y98.22 E.01254
+G1 X118.488 Y98.555 E.01254
+G1 X118.612 Y98.904 E.01254
+G1 X118.702 Y99.264 E.01254
+G1 X118.757 Y99.63 E.01254
+G1 X118.775 Y100 E.01254
+G1 E-.8 F2100
+G1 X125.025 Y85.225 F10800
+G1 E.8 F2100
+G1 F1800
+G1 X125.336 Y85.235 E.01052
+G1 X125.645 Y85.266 E.01052
+G1 X125.952 Y85.316 E.01052
+G1 X126.254 Y85.387 E.01052
+G1 X126.552 Y85.477 E.01052
+G1 X126.843 Y85.587 E.01052
+G1 X127.126 Y85.715 E.01052
+G1 X127.4 Y85.861 E.01052
+G1 X127.664 Y86.026 E.01052
+G1 X127.917 Y86.207 E.01052
+G1 X128.157 Y86.404 E.01052
+G1 X128.384 Y86.616 E.01052
+G1 X128.596 Y86.843 E.01052
+G1 X128.793 Y87.083 E.01052
+G1 X128.974 Y87.336 E.01052
+G1 X129.139 Y87.6 E.01052
+G1 X129.285 Y87.874 E.01052
+G1 X129.413 Y88.157 E.01052
+G1 X129.523 Y88.448 E.01052
+G1 X129.613 Y88.746 E.01052
+G1 X129.684 Y89.048 E.01052
+G1 X129.734 Y89.355 E.01052
+G1 X129.765 Y89.664 E.01052
+G1 X129.775 Y89.975 E.01052
+G1 X129.775 Y110.025 E.67869
+G1 X129.765 Y110.336 E.01052
+G1 X129.734 Y110.645 E.01052
+G1 X129.684 Y110.952 E.01052
+G1 X129.613 Y111.254 E.01052
+G1 X129.523 Y111.552 E.01052
+G1 X129.413 Y111.843 E.01052
+G1 X129.285 Y112.126 E.01052
+G1 X129.139 Y112.4 E.01052
+G1 X128.974 Y112.664 E.01052
+G1 X128.793 Y112.917 E.01052
+G1 X128.596 Y113.157 E.01052
+G1 X128.384 Y113.384 E.01052
+G1 X128.157 Y113.596 E.01052
+G1 X127.917 Y113.793 E.01052
+G1 X127.664 Y113.974 E.01052
+G1 X127.4 Y114.139 E.01052
+G1 X127.126 Y114.285 E.01052
+G1 X126.843 Y114.413 E.01052
+G1 X126.552 Y114.523 E.01052
+G1 X126.254 Y114.613 E.01052
+G1 X125.952 Y114.684 E.01052
+G1 X125.645 Y114.734 E.01052
+G1 X125.336 Y114.765 E.01052
+G1 X125.025 Y114.775 E.01052
+G1 X74.975 Y114.775 E1.69419
+G1 X74.664 Y114.765 E.01052
+G1 X74.355 Y114.734 E.01052
+G1 X74.048 Y114.684 E.01052
+G1 X73.746 Y114.613 E.01052
+G1 X73.448 Y114.523 E.01052
+G1 X73.157 Y114.413 E.01052
+G1 X72.874 Y114.285 E.01052
+G1 X72.6 Y114.139 E.01052
+G1 X72.336 Y113.974 E.01052
+G1 X72.083 Y113.793 E.01052
+G1 X71.843 Y113.596 E.01052
+G1 X71.616 Y113.384 E.01052
+G1 X71.404 Y113.157 E.01052
+G1 X71.207 Y112.917 E.01052
+G1 X71.026 Y112.664 E.01052
+G1 X70.861 Y112.4 E.01052
+G1 X70.715 Y112.126 E.01052
+G1 X70.587 Y111.843 E.01052
+G1 X70.477 Y111.552 E.01052
+G1 X70.387 Y111.254 E.01052
+G1 X70.316 Y110.952 E.01052
+G1 X70.266 Y110.645 E.01052
+G1 X70.235 Y110.336 E.01052
+G1 X70.225 Y110.025 E.01052
+G1 X70.225 Y89.975 E.67869
+G1 X70.235 Y89.664 E.01052
+G1 X70.266 Y89.355 E.01052
+G1 X70.316 Y89.048 E.01052
+G1 X70.387 Y88.746 E.01052
+G1 X70.477 Y88.448 E.01052
+G1 X70.587 Y88.157 E.01052
+G1 X70.715 Y87.874 E.01052
+G1 X70.861 Y87.6 E.01052
+G1 X71.026 Y87.336 E.01052
+G1 X71.207 Y87.083 E.01052
+G1 X71.404 Y86.843 E.01052
+G1 X71.616 Y86.616 E.01052
+G1 X71.843 Y86.404 E.01052
+G1 X72.083 Y86.207 E.01052
+G1 X72.336 Y86.026 E.01052
+G1 X72.6 Y85.861 E.01052
+G1 X72.874 Y85.715 E.01052
+G1 X73.157 Y85.587 E.01052
+G1 X73.448 Y85.477 E.01052
+G1 X73.746 Y85.387 E.01052
+G1 X74.048 Y85.316 E.01052
+G1 X74.355 Y85.266 E.01052
+G1 X74.664 Y85.235 E.01052
+G1 X74.975 Y85.225 E.01052
+G1 X125.025 Y85.225 E1.69419
+;TYPE:Solid infill
+;WIDTH:0.45
+G1 E-.8 F2100
+G1 X128.355 Y86.012 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X128.991 Y86.648 E.03047
+G1 X128.991 Y87.285 E.02154
+G1 X127.719 Y86.012 E.06093
+G1 X127.082 Y86.012 E.02154
+G1 X128.991 Y87.921 E.0914
+G1 X128.991 Y88.558 E.02154
+G1 X126.446 Y86.012 E.12186
+G1 X125.809 Y86.012 E.02154
+G1 X128.991 Y89.194 E.15233
+G1 X128.991 Y89.83 E.02154
+G1 X125.173 Y86.012 E.18279
+G1 X124.537 Y86.012 E.02154
+G1 X128.991 Y90.467 E.21326
+G1 X128.991 Y91.103 E.02154
+G1 X123.9 Y86.012 E.24372
+G1 X123.264 Y86.012 E.02154
+G1 X128.991 Y91.74 E.27419
+G1 X128.991 Y92.376 E.02154
+G1 X122.627 Y86.012 E.30465
+G1 X121.991 Y86.012 E.02154
+G1 X128.991 Y93.012 E.33512
+G1 X128.991 Y93.649 E.02154
+G1 X121.355 Y86.012 E.36558
+G1 X120.718 Y86.012 E.02154
+G1 X128.991 Y94.285 E.39605
+G1 X128.991 Y94.922 E.02154
+G1 X120.082 Y86.012 E.42651
+G1 X119.445 Y86.012 E.02154
+G1 X128.991 Y95.558 E.45698
+G1 X128.991 Y96.194 E.02154
+G1 X118.809 Y86.012 E.48744
+G1 X118.173 Y86.012 E.02154
+G1 X128.991 Y96.831 E.51791
+G1 X128.991 Y97.467 E.02154
+G1 X117.536 Y86.012 E.54837
+G1 X116.9 Y86.012 E.02154
+G1 X128.991 Y98.104 E.57884
+G1 X128.991 Y98.74 E.02154
+G1 X116.263 Y86.012 E.6093
+G1 X115.627 Y86.012 E.02154
+G1 X128.991 Y99.376 E.63977
+G1 X128.991 Y100.013 E.02154
+G1 X114.991 Y86.012 E.67023
+G1 X114.354 Y86.012 E.02154
+G1 X128.991 Y100.649 E.7007
+G1 X128.991 Y101.285 E.02154
+G1 X113.718 Y86.012 E.73116
+G1 X113.081 Y86.012 E.02154
+G1 X128.991 Y101.922 E.76163
+G1 X128.991 Y102.558 E.02154
+G1 X112.445 Y86.012 E.79209
+G1 X111.809 Y86.012 E.02154
+G1 X128.991 Y103.195 E.82256
+G1 X128.991 Y103.831 E.02154
+G1 X111.172 Y86.012 E.85302
+G1 X110.536 Y86.012 E.02154
+G1 X128.991 Y104.467 E.88349
+G1 X128.991 Y105.104 E.02154
+G1 X109.899 Y86.012 E.91395
+G1 X109.263 Y86.012 E.02154
+G1 X128.991 Y105.74 E.94442
+G1 X128.991 Y106.377 E.02154
+G1 X108.627 Y86.012 E.97488
+G1 X107.99 Y86.012 E.02154
+G1 X128.991 Y107.013 E1.00535
+G1 X128.991 Y107.649 E.02154
+G1 X107.354 Y86.012 E1.03581
+G1 X106.718 Y86.012 E.02154
+G1 X128.991 Y108.286 E1.06628
+G1 X128.991 Y108.922 E.02154
+G1 X106.081 Y86.012 E1.09674
+G1 X105.445 Y86.012 E.02154
+G1 X128.991 Y109.559 E1.12721
+G1 X128.991 Y110.195 E.02154
+G1 X104.808 Y86.012 E1.15767
+G1 X104.172 Y86.012 E.02154
+G1 X128.991 Y110.831 E1.18814
+G1 X128.991 Y111.468 E.02154
+G1 X103.536 Y86.012 E1.2186
+G1 X102.899 Y86.012 E.02154
+G1 X128.991 Y112.104 E1.24907
+G1 X128.991 Y112.741 E.02154
+G1 X102.263 Y86.012 E1.27953
+G1 X101.626 Y86.012 E.02154
+G1 X128.991 Y113.377 E1.31
+G1 X128.956 Y113.978 E.02038
+G1 X100.99 Y86.012 E1.33877
+G1 X100.354 Y86.012 E.02154
+G1 X128.32 Y113.978 E1.33877
+G1 X127.683 Y113.978 E.02154
+G1 X99.717 Y86.012 E1.33877
+G1 X99.081 Y86.012 E.02154
+G1 X127.047 Y113.978 E1.33877
+G1 X126.41 Y113.978 E.02154
+G1 X98.444 Y86.012 E1.33877
+G1 X97.808 Y86.012 E.02154
+G1 X125.774 Y113.978 E1.33877
+G1 X125.138 Y113.978 E.02154
+G1 X97.172 Y86.012 E1.33877
+G1 X96.535 Y86.012 E.02154
+G1 X124.501 Y113.978 E1.33877
+G1 X123.865 Y113.978 E.02154
+G1 X95.899 Y86.012 E1.33877
+G1 X95.262 Y86.012 E.02154
+G1 X123.228 Y113.978 E1.33877
+G1 X122.592 Y113.978 E.02154
+G1 X94.626 Y86.012 E1.33877
+G1 X93.99 Y86.012 E.02154
+G1 X121.956 Y113.978 E1.33877
+G1 X121.319 Y113.978 E.02154
+G1 X93.353 Y86.012 E1.33877
+G1 X92.717 Y86.012 E.02154
+G1 X120.683 Y113.978 E1.33877
+G1 X120.046 Y113.978 E.02154
+G1 X92.08 Y86.012 E1.33877
+G1 X91.444 Y86.012 E.02154
+G1 X119.41 Y113.978 E1.33877
+G1 X118.774 Y113.978 E.02154
+G1 X90.808 Y86.012 E1.33877
+G1 X90.171 Y86.012 E.02154
+G1 X118.137 Y113.978 E1.33877
+G1 X117.501 Y113.978 E.02154
+G1 X89.535 Y86.012 E1.33877
+G1 X88.898 Y86.012 E.02154
+G1 X116.864 Y113.978 E1.33877
+G1 X116.228 Y113.978 E.02154
+G1 X88.262 Y86.012 E1.33877
+G1 X87.626 Y86.012 E.02154
+G1 X115.592 Y113.978 E1.33877
+G1 X114.955 Y113.978 E.02154
+G1 X86.989 Y86.012 E1.33877
+G1 X86.353 Y86.012 E.02154
+G1 X114.319 Y113.978 E1.33877
+G1 X113.683 Y113.978 E.02154
+G1 X85.716 Y86.012 E1.33877
+G1 X85.08 Y86.012 E.02154
+G1 X113.046 Y113.978 E1.33877
+G1 X112.41 Y113.978 E.02154
+G1 X84.444 Y86.012 E1.33877
+G1 X83.807 Y86.012 E.02154
+G1 X111.773 Y113.978 E1.33877
+G1 X111.137 Y113.978 E.02154
+G1 X83.171 Y86.012 E1.33877
+G1 X82.534 Y86.012 E.02154
+G1 X110.501 Y113.978 E1.33877
+G1 X109.864 Y113.978 E.02154
+G1 X81.898 Y86.012 E1.33877
+G1 X81.262 Y86.012 E.02154
+G1 X109.228 Y113.978 E1.33877
+G1 X108.591 Y113.978 E.02154
+G1 X80.625 Y86.012 E1.33877
+G1 X79.989 Y86.012 E.02154
+G1 X107.955 Y113.978 E1.33877
+G1 X107.319 Y113.978 E.02154
+G1 X79.352 Y86.012 E1.33877
+G1 X78.716 Y86.012 E.02154
+G1 X106.682 Y113.978 E1.33877
+G1 X106.046 Y113.978 E.02154
+G1 X78.08 Y86.012 E1.33877
+G1 X77.443 Y86.012 E.02154
+G1 X105.409 Y113.978 E1.33877
+G1 X104.773 Y113.978 E.02154
+G1 X76.807 Y86.012 E1.33877
+G1 X76.171 Y86.012 E.02154
+G1 X104.137 Y113.978 E1.33877
+G1 X103.5 Y113.978 E.02154
+G1 X75.534 Y86.012 E1.33877
+G1 X74.898 Y86.012 E.02154
+G1 X102.864 Y113.978 E1.33877
+G1 X102.227 Y113.978 E.02154
+G1 X74.261 Y86.012 E1.33877
+G1 X73.625 Y86.012 E.02154
+G1 X101.591 Y113.978 E1.33877
+G1 X100.955 Y113.978 E.02154
+G1 X72.989 Y86.012 E1.33877
+G1 X72.352 Y86.012 E.02154
+G1 X100.318 Y113.978 E1.33877
+G1 X99.682 Y113.978 E.02154
+G1 X71.716 Y86.012 E1.33877
+G1 X71.079 Y86.012 E.02154
+G1 X99.045 Y113.978 E1.33877
+G1 X98.409 Y113.978 E.02154
+G1 X71.009 Y86.578 E1.31169
+G1 X71.009 Y87.214 E.02154
+G1 X97.773 Y113.978 E1.28122
+G1 X97.136 Y113.978 E.02154
+G1 X71.009 Y87.85 E1.25076
+G1 X71.009 Y88.487 E.02154
+G1 X96.5 Y113.978 E1.22029
+G1 X95.863 Y113.978 E.02154
+G1 X71.009 Y89.123 E1.18983
+G1 X71.009 Y89.76 E.02154
+G1 X95.227 Y113.978 E1.15936
+G1 X94.591 Y113.978 E.02154
+G1 X71.009 Y90.396 E1.1289
+G1 X71.009 Y91.032 E.02154
+G1 X93.954 Y113.978 E1.09843
+G1 X93.318 Y113.978 E.02154
+G1 X71.009 Y91.669 E1.06797
+G1 X71.009 Y92.305 E.02154
+G1 X92.681 Y113.978 E1.0375
+G1 X92.045 Y113.978 E.02154
+G1 X71.009 Y92.942 E1.00704
+G1 X71.009 Y93.578 E.02154
+G1 X91.409 Y113.978 E.97657
+G1 X90.772 Y113.978 E.02154
+G1 X71.009 Y94.214 E.94611
+G1 X71.009 Y94.851 E.02154
+G1 X90.136 Y113.978 E.91564
+G1 X89.499 Y113.978 E.02154
+G1 X71.009 Y95.487 E.88518
+G1 X71.009 Y96.124 E.02154
+G1 X88.863 Y113.978 E.85471
+G1 X88.227 Y113.978 E.02154
+G1 X71.009 Y96.76 E.82425
+G1 X71.009 Y97.396 E.02154
+G1 X87.59 Y113.978 E.79378
+G1 X86.954 Y113.978 E.02154
+G1 X71.009 Y98.033 E.76332
+G1 X71.009 Y98.669 E.02154
+G1 X86.317 Y113.978 E.73285
+G1 X85.681 Y113.978 E.02154
+G1 X71.009 Y99.306 E.70239
+G1 X71.009 Y99.942 E.02154
+G1 X85.045 Y113.978 E.67192
+G1 X84.408 Y113.978 E.02154
+G1 X71.009 Y100.578 E.64146
+G1 X71.009 Y101.215 E.02154
+G1 X83.772 Y113.978 E.61099
+G1 X83.136 Y113.978 E.02154
+G1 X71.009 Y101.851 E.58053
+G1 X71.009 Y102.488 E.02154
+G1 X82.499 Y113.978 E.55006
+G1 X81.863 Y113.978 E.02154
+G1 X71.009 Y103.124 E.5196
+G1 X71.009 Y103.76 E.02154
+G1 X81.226 Y113.978 E.48913
+G1 X80.59 Y113.978 E.02154
+G1 X71.009 Y104.397 E.45867
+G1 X71.009 Y105.033 E.02154
+G1 X79.954 Y113.978 E.4282
+G1 X79.317 Y113.978 E.02154
+G1 X71.009 Y105.67 E.39774
+G1 X71.009 Y106.306 E.02154
+G1 X78.681 Y113.978 E.36727
+G1 X78.044 Y113.978 E.02154
+G1 X71.009 Y106.942 E.33681
+G1 X71.009 Y107.579 E.02154
+G1 X77.408 Y113.978 E.30634
+G1 X76.772 Y113.978 E.02154
+G1 X71.009 Y108.215 E.27588
+G1 X71.009 Y108.852 E.02154
+G1 X76.135 Y113.978 E.24541
+G1 X75.499 Y113.978 E.02154
+G1 X71.009 Y109.488 E.21495
+G1 X71.009 Y110.124 E.02154
+G1 X74.862 Y113.978 E.18448
+G1 X74.226 Y113.978 E.02154
+G1 X71.009 Y110.761 E.15402
+G1 X71.009 Y111.397 E.02154
+G1 X73.59 Y113.978 E.12355
+G1 X72.953 Y113.978 E.02154
+G1 X71.009 Y112.034 E.09309
+G1 X71.009 Y112.67 E.02154
+G1 X72.317 Y113.978 E.06262
+G1 X71.68 Y113.978 E.02154
+G1 X71.009 Y113.306 E.03216
+;LAYER_CHANGE
+;Z:0.6
+;HEIGHT:0.2
+G1 E-.8 F2100
+G1 Z0.6 F720
+G1 E.8 F2100
+;TYPE:Perimeter
+;WIDTH:0.45
+G1 E-.8 F2100
+G1 X89.225 Y100 F10800
+G1 E.8 F2100
+G1 F2700
+G1 X89.205 Y100.414 E.01403
+G1 X89.144 Y100.824 E.01403
+G1 X89.043 Y101.226 E.01403
+G1 X88.903 Y101.617 E.01403
+G1 X88.726 Y101.992 E.01403
+G1 X88.513 Y102.347 E.01403
+G1 X88.266 Y102.68 E.01403
+G1 X87.988 Y102.988 E.01403
+G1 X87.68 Y103.266 E.01403
+G1 X87.347 Y103.513 E.01403
+G1 X86.992 Y103.726 E.01403
+G1 X86.617 Y103.903 E.01403
+G1 X86.226 Y104.043 E.01403
+G1 X85.824 Y104.144 E.01403
+G1 X85.414 Y104.205 E.01403
+G1 X85 Y104.225 E.01403
+G1 X84.586 Y104.205 E.01403
+G1 X84.176 Y104.144 E.01403
+G1 X83.774 Y104.043 E.01403
+G1 X83.383 Y103.903 E.01403
+G1 X83.008 Y103.726 E.01403
+G1 X82.653 Y103.513 E.01403
+G1 X82.32 Y103.266 E.01403
+G1 X82.012 Y102.988 E.01403
+G1 X81.734 Y102.68 E.01403
+G1 X81.487 Y102.347 E.01403
+G1 X81.274 Y101.992 E.01403
+G1 X81.097 Y101.617 E.01403
+G1 X80.957 Y101.226 E.01403
+G1 X80.856 Y100.824 E.01403
+G1 X80.795 Y100.414 E.01403
+G1 X80.775 Y100 E.01403
+G1 X80.795 Y99.586 E.01403
+G1 X80.856 Y99.176 E.01403
+G1 X80.957 Y98.774 E.01403
+G1 X81.097 Y98.383 E.01403
+G1 X81.274 Y98.008 E.01403
+G1 X81.487 Y97.653 E.01403
+G1 X81.734 Y97.32 E.01403
+G1 X82.012 Y97.012 E.01403
+G1 X82.32 Y96.734 E.01403
+G1 X82.653 Y96.487 E.01403
+G1 X83.008 Y96.274 E.01403
+G1 X83.383 Y96.097 E.01403
+G1 X83.774 Y95.957 E.01403
+G1 X84.176 Y95.856 E.01403
+G1 X84.586 Y95.795 E.01403
+G1 X85 Y95.775 E.01403
+G1 X85.414 Y95.795 E.01403
+G1 X85.824 Y95.856 E.01403
+G1 X86.226 Y95.957 E.01403
+G1 X86.617 Y96.097 E.01403
+G1 X86.992 Y96.274 E.01403
+G1 X87.347 Y96.487 E.01403
+G1 X87.68 Y96.734 E.01403
+G1 X87.988 Y97.012 E.01403
+G1 X88.266 Y97.32 E.01403
+G1 X88.513 Y97.653 E.01403
+G1 X88.726 Y98.008 E.01403
+G1 X88.903 Y98.383 E.01403
+G1 X89.043 Y98.774 E.01403
+G1 X89.144 Y99.176 E.01403
+G1 X89.205 Y99.586 E.01403
+G1 X89.225 Y100 E.01403
+G1 E-.8 F2100
+G1 X119.225 Y100 F10800
+G1 E.8 F2100
+G1 F2700
+G1 X119.205 Y100.414 E.01403
+G1 X119.144 Y100.824 E.01403
+G1 X119.043 Y101.226 E.01403
+G1 X118.903 Y101.617 E.01403
+G1 X118.726 Y101.992 E.01403
+G1 X118.513 Y102.347 E.01403
+G1 X118.266 Y102.68 E.01403
+G1 X117.988 Y102.988 E.01403
+G1 X117.68 Y103.266 E.01403
+G1 X117.347 Y103.513 E.01403
+G1 X116.992 Y103.726 E.01403
+G1 X116.617 Y103.903 E.01403
+G1 X116.226 Y104.043 E.01403
+G1 X115.824 Y104.144 E.01403
+G1 X115.414 Y104.205 E.01403
+G1 X115 Y104.225 E.01403
+G1 X114.586 Y104.205 E.01403
+G1 X114.176 Y104.144 E.01403
+G1 X113.774 Y104.043 E.01403
+G1 X113.383 Y103.903 E.01403
+G1 X113.008 Y103.726 E.01403
+G1 X112.653 Y103.513 E.01403
+G1 X112.32 Y103.266 E.01403
+G1 X112.012 Y102.988 E.01403
+G1 X111.734 Y102.68 E.01403
+G1 X111.487 Y102.347 E.01403
+G1 X111.274 Y101.992 E.01403
+G1 X111.097 Y101.617 E.01403
+G1 X110.957 Y101.226 E.01403
+G1 X110.856 Y100.824 E.01403
+G1 X110.795 Y100.414 E.01403
+G1 X110.775 Y100 E.01403
+G1 X110.795 Y99.586 E.01403
+G1 X110.856 Y99.176 E.01403
+G1 X110.957 Y98.774 E.01403
+G1 X111.097 Y98.383 E.01403
+G1 X111.274 Y98.008 E.01403
+G1 X111.487 Y97.653 E.01403
+G1 X111.734 Y97.32 E.01403
+G1 X112.012 Y97.012 E.01403
+G1 X112.32 Y96.734 E.01403
+G1 X112.653 Y96.487 E.01403
+G1 X113.008 Y96.274 E.01403
+G1 X113.383 Y96.097 E.01403
+G1 X113.774 Y95.957 E.01403
+G1 X114.176 Y95.856 E.01403
+G1 X114.586 Y95.795 E.01403
+G1 X115 Y95.775 E.01403
+G1 X115.414 Y95.795 E.01403
+G1 X115.824 Y95.856 E.01403
+G1 X116.226 Y95.957 E.01403
+G1 X116.617 Y96.097 E.01403
+G1 X116.992 Y96.274 E.01403
+G1 X117.347 Y96.487 E.01403
+G1 X117.68 Y96.734 E.01403
+G1 X117.988 Y97.012 E.01403
+G1 X118.266 Y97.32 E.01403
+G1 X118.513 Y97.653 E.01403
+G1 X118.726 Y98.008 E.01403
+G1 X118.903 Y98.383 E.01403
+G1 X119.043 Y98.774 E.01403
+G1 X119.144 Y99.176 E.01403
+G1 X119.205 Y99.586 E.01403
+G1 X119.225 Y100 E.01403
+G1 E-.8 F2100
+G1 X125.025 Y85.675 F10800
+G1 E.8 F2100
+G1 F2700
+G1 X125.306 Y85.684 E.00952
+G1 X125.586 Y85.712 E.00952
+G1 X125.864 Y85.758 E.00952
+G1 X126.138 Y85.822 E.00952
+G1 X126.407 Y85.903 E.00952
+G1 X126.671 Y86.002 E.00952
+G1 X126.927 Y86.118 E.00952
+G1 X127.175 Y86.251 E.00952
+G1 X127.414 Y86.4 E.00952
+G1 X127.643 Y86.564 E.00952
+G1 X127.86 Y86.742 E.00952
+G1 X128.066 Y86.934 E.00952
+G1 X128.258 Y87.14 E.00952
+G1 X128.436 Y87.357 E.00952
+G1 X128.6 Y87.586 E.00952
+G1 X128.749 Y87.825 E.00952
+G1 X128.882 Y88.073 E.00952
+G1 X128.998 Y88.329 E.00952
+G1 X129.097 Y88.593 E.00952
+G1 X129.178 Y88.862 E.00952
+G1 X129.242 Y89.136 E.00952
+G1 X129.288 Y89.414 E.00952
+G1 X129.316 Y89.694 E.00952
+G1 X129.325 Y89.975 E.00952
+G1 X129.325 Y110.025 E.67869
+G1 X129.316 Y110.306 E.00952
+G1 X129.288 Y110.586 E.00952
+G1 X129.242 Y110.864 E.00952
+G1 X129.178 Y111.138 E.00952
+G1 X129.097 Y111.407 E.00952
+G1 X128.998 Y111.671 E.00952
+G1 X128.882 Y111.927 E.00952
+G1 X128.749 Y112.175 E.00952
+G1 X128.6 Y112.414 E.00952
+G1 X128.436 Y112.643 E.00952
+G1 X128.258 Y112.86 E.00952
+G1 X128.066 Y113.066 E.00952
+G1 X127.86 Y113.258 E.00952
+G1 X127.643 Y113.436 E.00952
+G1 X127.414 Y113.6 E.00952
+G1 X127.175 Y113.749 E.00952
+G1 X126.927 Y113.882 E.00952
+G1 X126.671 Y113.998 E.00952
+G1 X126.407 Y114.097 E.00952
+G1 X126.138 Y114.178 E.00952
+G1 X125.864 Y114.242 E.00952
+G1 X125.586 Y114.288 E.00952
+G1 X125.306 Y114.316 E.00952
+G1 X125.025 Y114.325 E.00952
+G1 X74.975 Y114.325 E1.69419
+G1 X74.694 Y114.316 E.00952
+G1 X74.414 Y114.288 E.00952
+G1 X74.136 Y114.242 E.00952
+G1 X73.862 Y114.178 E.00952
+G1 X73.593 Y114.097 E.00952
+G1 X73.329 Y113.998 E.00952
+G1 X73.073 Y113.882 E.00952
+G1 X72.825 Y113.749 E.00952
+G1 X72.586 Y113.6 E.00952
+G1 X72.357 Y113.436 E.00952
+G1 X72.14 Y113.258 E.00952
+G1 X71.934 Y113.066 E.00952
+G1 X71.742 Y112.86 E.00952
+G1 X71.564 Y112.643 E.00952
+G1 X71.4 Y112.414 E.00952
+G1 X71.251 Y112.175 E.00952
+G1 X71.118 Y111.927 E.00952
+G1 X71.002 Y111.671 E.00952
+G1 X70.903 Y111.407 E.00952
+G1 X70.822 Y111.138 E.00952
+G1 X70.758 Y110.864 E.00952
+G1 X70.712 Y110.586 E.00952
+G1 X70.684 Y110.306 E.00952
+G1 X70.675 Y110.025 E.00952
+G1 X70.675 Y89.975 E.67869
+G1 X70.684 Y89.694 E.00952
+G1 X70.712 Y89.414 E.00952
+G1 X70.758 Y89.136 E.00952
+G1 X70.822 Y88.862 E.00952
+G1 X70.903 Y88.593 E.00952
+G1 X71.002 Y88.329 E.00952
+G1 X71.118 Y88.073 E.00952
+G1 X71.251 Y87.825 E.00952
+G1 X71.4 Y87.586 E.00952
+G1 X71.564 Y87.357 E.00952
+G1 X71.742 Y87.14 E.00952
+G1 X71.934 Y86.934 E.00952
+G1 X72.14 Y86.742 E.00952
+G1 X72.357 Y86.564 E.00952
+G1 X72.586 Y86.4 E.00952
+G1 X72.825 Y86.251 E.00952
+G1 X73.073 Y86.118 E.00952
+G1 X73.329 Y86.002 E.00952
+G1 X73.593 Y85.903 E.00952
+G1 X73.862 Y85.822 E.00952
+G1 X74.136 Y85.758 E.00952
+G1 X74.414 Y85.712 E.00952
+G1 X74.694 Y85.684 E.00952
+G1 X74.975 Y85.675 E.00952
+G1 X125.025 Y85.675 E1.69419
+;TYPE:External perimeter
+;WIDTH:0.45
+G1 E-.8 F2100
+G1 X88.775 Y100 F10800
+G1 E.8 F2100
+G1 F1800
+G1 X88.757 Y100.37 E.01254
+G1 X88.702 Y100.736 E.01254
+G1 X88.612 Y101.096 E.01254
+G1 X88.488 Y101.445 E.01254
+G1 X88.329 Y101.78 E.01254
+G1 X88.139 Y102.097 E.01254
+G1 X87.918 Y102.395 E.01254
+G1 X87.669 Y102.669 E.01254
+G1 X87.395 Y102.918 E.01254
+G1 X87.097 Y103.139 E.01254
+G1 X86.78 Y103.329 E.01254
+G1 X86.445 Y103.488 E.01254
+G1 X86.096 Y103.612 E.01254
+G1 X85.736 Y103.702 E.01254
+G1 X85.37 Y103.757 E.01254
+G1 X85 Y103.775 E.01254
+G1 X84.63 Y103.757 E.01254
+G1 X84.264 Y103.702 E.01254
+G1 X83.904 Y103.612 E.01254
+G1 X83.555 Y103.488 E.01254
+G1 X83.22 Y103.329 E.01254
+G1 X82.903 Y103.139 E.01254
+G1 X82.605 Y102.918 E.01254
+G1 X82.331 Y102.669 E.01254
+G1 X82.082 Y102.395 E.01254
+G1 X81.861 Y102.097 E.01254
+G1 X81.671 Y101.78 E.01254
+G1 X81.512 Y101.445 E.01254
+G1 X81.388 Y101.096 E.01254
+G1 X81.298 Y100.736 E.01254
+G1 X81.243 Y100.37 E.01254
+G1 X81.225 Y100 E.01254
+G1 X81.243 Y99.63 E.01254
+G1 X81.298 Y99.264 E.01254
+G1 X81.388 Y98.904 E.01254
+G1 X81.512 Y98.555 E.01254
+G1 X81.671 Y98.22 E.01254
+G1 X81.861 Y97.903 E.01254
+G1 X82.082 Y97.605 E.01254
+G1 X82.331 Y97.331 E.01254
+G1 X82.605 Y97.082 E.01254
+G1 X82.903 Y96.861 E.01254
+G1 X83.22 Y96.671 E.01254
+G1 X83.555 Y96.512 E.01254
+G1 X83.904 Y96.388 E.01254
+G1 X84.264 Y96.298 E.01254
+G1 X84.63 Y96.243 E.01254
+G1 X85 Y96.225 E.01254
+G1 X85.37 Y96.243 E.01254
+G1 X85.736 Y96.298 E.01254
+G1 X86.096 Y96.388 E.01254
+G1 X86.445 Y96.512 E.01254
+G1 X86.78 Y96.671 E.01254
+G1 X87.097 Y96.861 E.01254
+G1 X87.395 Y97.082 E.01254
+G1 X87.669 Y97.331 E.01254
+G1 X87.918 Y97.605 E.01254
+G1 X88.139 Y97.903 E.01254
+G1 X88.329 Y98.22 E.01254
+G1 X88.488 Y98.555 E.01254
+G1 X88.612 Y98.904 E.01254
+G1 X88.702 Y99.264 E.01254
+G1 X88.757 Y99.63 E.01254
+G1 X88.775 Y100 E.01254
+G1 E-.8 F2100
+G1 X118.775 Y100 F10800
+G1 E.8 F2100
+G1 F1800
+G1 X118.757 Y100.37 E.01254
+G1 X118.702 Y100.736 E.01254
+G1 X118.612 Y101.096 E.01254
+G1 X118.488 Y101.445 E.01254
+G1 X118.329 Y101.78 E.01254
+G1 X118.139 Y102.097 E.01254
+G1 X117.918 Y102.395 E.01254
+G1 X117.669 Y102.669 E.01254
+G1 X117.395 Y102.918 E.01254
+G1 X117.097 Y103.139 E.01254
+G1 X116.78 Y103.329 E.01254
+G1 X116.445 Y103.488 E.01254
+G1 X116.096 Y103.612 E.01254
+G1 X115.736 Y103.702 E.01254
+G1 X115.37 Y103.757 E.01254
+G1 X115 Y103.775 E.01254
+G1 X114.63 Y103.757 E.01254
+G1 X114.264 Y103.702 E.01254
+G1 X113.904 Y103.612 E.01254
+G1 X113.555 Y103.488 E.01254
+G1 X113.22 Y103.329 E.01254
+G1 X112.903 Y103.139 E.01254
+G1 X112.605 Y102.918 E.01254
+G1 X112.331 Y102.669 E.01254
+G1 X112.082 Y102.395 E.01254
+G1 X111.861 Y102.097 E.01254
+G1 X111.671 Y101.78 E.01254
+G1 X111.512 Y101.445 E.01254
+G1 X111.388 Y101.096 E.01254
+G1 X111.298 Y100.736 E.01254
+G1 X111.243 Y100.37 E.01254
+G1 X111.225 Y100 E.01254
+G1 X111.243 Y99.63 E.01254
+G1 X111.298 Y99.264 E.01254
+G1 X111.388 Y98.904 E.01254
+G1 X111.512 Y98.555 E.01254
+G1 X111.671 Y98.22 E.01254
+G1 X111.861 Y97.903 E.01254
+G1 X112.082 Y97.605 E.01254
+G1 X112.331 Y97.331 E.01254
+G1 X112.605 Y97.082 E.01254
+G1 X112.903 Y96.861 E.01254
+G1 X113.22 Y96.671 E.01254
+G1 X113.555 Y96.512 E.01254
+G1 X113.904 Y96.388 E.01254
+G1 X114.264 Y96.298 E.01254
+G1 X114.63 Y96.243 E.01254
+G1 X115 Y96.225 E.01254
+G1 X115.37 Y96.243 E.01254
+G1 X115.736 Y96.298 E.01254
+G1 X116.096 Y96.388 E.01254
+G1 X116.445 Y96.512 E.01254
+G1 X116.78 Y96.671 E.01254
+G1 X117.097 Y96.861 E.01254
+G1 X117.395 Y97.082 E.01254
+G1 X117.669 Y97.331 E.01254
+G1 X117.918 Y97.605 E.01254
+G1 X118.139 Y97.903 E.01254
+G1 X118.329 Y98.22 E.01254
+G1 X118.488 Y98.555 E.01254
+G1 X118.612 Y98.904 E.01254
+G1 X118.702 Y99.264 E.01254
+G1 X118.757 Y99.63 E.01254
+G1 X118.775 Y100 E.01254
+G1 E-.8 F2100
+G1 X125.025 Y85.225 F10800
+G1 E.8 F2100
+G1 F1800
+G1 X125.336 Y85.235 E.01052
+G1 X125.645 Y85.266 E.01052
+G1 X125.952 Y85.316 E.01052
+G1 X126.254 Y85.387 E.01052
+G1 X126.552 Y85.477 E.01052
+G1 X126.843 Y85.587 E.01052
+G1 X127.126 Y85.715 E.01052
+G1 X127.4 Y85.861 E.01052
+G1 X127.664 Y86.026 E.01052
+G1 X127.917 Y86.207 E.01052
+G1 X128.157 Y86.404 E.01052
+G1 X128.384 Y86.616 E.01052
+G1 X128.596 Y86.843 E.01052
+G1 X128.793 Y87.083 E.01052
+G1 X128.974 Y87.336 E.01052
+G1 X129.139 Y87.6 E.01052
+G1 X129.285 Y87.874 E.01052
+G1 X129.413 Y88.157 E.01052
+G1 X129.523 Y88.448 E.01052
+G1 X129.613 Y88.746 E.01052
+G1 X129.684 Y89.048 E.01052
+G1 X129.734 Y89.355 E.01052
+G1 X129.765 Y89.664 E.01052
+G1 X129.775 Y89.975 E.01052
+G1 X129.775 Y110.025 E.67869
+G1 X129.765 Y110.336 E.01052
+G1 X129.734 Y110.645 E.01052
+G1 X129.684 Y110.952 E.01052
+G1 X129.613 Y111.254 E.01052
+G1 X129.523 Y111.552 E.01052
+G1 X129.413 Y111.843 E.01052
+G1 X129.285 Y112.126 E.01052
+G1 X129.139 Y112.4 E.01052
+G1 X128.974 Y112.664 E.01052
+G1 X128.793 Y112.917 E.01052
+G1 X128.596 Y113.157 E.01052
+G1 X128.384 Y113.384 E.01052
+G1 X128.157 Y113.596 E.01052
+G1 X127.917 Y113.793 E.01052
+G1 X127.664 Y113.974 E.01052
+G1 X127.4 Y114.139 E.01052
+G1 X127.126 Y114.285 E.01052
+G1 X126.843 Y114.413 E.01052
+G1 X126.552 Y114.523 E.01052
+G1 X126.254 Y114.613 E.01052
+G1 X125.952 Y114.684 E.01052
+G1 X125.645 Y114.734 E.01052
+G1 X125.336 Y114.765 E.01052
+G1 X125.025 Y114.775 E.01052
+G1 X74.975 Y114.775 E1.69419
+G1 X74.664 Y114.765 E.01052
+G1 X74.355 Y114.734 E.01052
+G1 X74.048 Y114.684 E.01052
+G1 X73.746 Y114.613 E.01052
+G1 X73.448 Y114.523 E.01052
+G1 X73.157 Y114.413 E.01052
+G1 X72.874 Y114.285 E.01052
+G1 X72.6 Y114.139 E.01052
+G1 X72.336 Y113.974 E.01052
+G1 X72.083 Y113.793 E.01052
+G1 X71.843 Y113.596 E.01052
+G1 X71.616 Y113.384 E.01052
+G1 X71.404 Y113.157 E.01052
+G1 X71.207 Y112.917 E.01052
+G1 X71.026 Y112.664 E.01052
+G1 X70.861 Y112.4 E.01052
+G1 X70.715 Y112.126 E.01052
+G1 X70.587 Y111.843 E.01052
+G1 X70.477 Y111.552 E.01052
+G1 X70.387 Y111.254 E.01052
+G1 X70.316 Y110.952 E.01052
+G1 X70.266 Y110.645 E.01052
+G1 X70.235 Y110.336 E.01052
+G1 X70.225 Y110.025 E.01052
+G1 X70.225 Y89.975 E.67869
+G1 X70.235 Y89.664 E.01052
+G1 X70.266 Y89.355 E.01052
+G1 X70.316 Y89.048 E.01052
+G1 X70.387 Y88.746 E.01052
+G1 X70.477 Y88.448 E.01052
+G1 X70.587 Y88.157 E.01052
+G1 X70.715 Y87.874 E.01052
+G1 X70.861 Y87.6 E.01052
+G1 X71.026 Y87.336 E.01052
+G1 X71.207 Y87.083 E.01052
+G1 X71.404 Y86.843 E.01052
+G1 X71.616 Y86.616 E.01052
+G1 X71.843 Y86.404 E.01052
+G1 X72.083 Y86.207 E.01052
+G1 X72.336 Y86.026 E.01052
+G1 X72.6 Y85.861 E.01052
+G1 X72.874 Y85.715 E.01052
+G1 X73.157 Y85.587 E.01052
+G1 X73.448 Y85.477 E.01052
+G1 X73.746 Y85.387 E.01052
+G1 X74.048 Y85.316 E.01052
+G1 X74.355 Y85.266 E.01052
+G1 X74.664 Y85.235 E.01052
+G1 X74.975 Y85.225 E.01052
+G1 X125.025 Y85.225 E1.69419
+;TYPE:Solid infill
+;WIDTH:0.45
+G1 E-.8 F2100
+G1 X71.021 Y86.636 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X71.622 Y86.035 E.02877
+G1 X72.259 Y86.035 E.02154
+G1 X71.021 Y87.272 E.05924
+G1 X71.021 Y87.908 E.02154
+G1 X72.895 Y86.035 E.0897
+G1 X73.532 Y86.035 E.02154
+G1 X71.021 Y88.545 E.12017
+G1 X71.021 Y89.181 E.02154
+G1 X74.168 Y86.035 E.15063
+G1 X74.804 Y86.035 E.02154
+G1 X71.021 Y89.818 E.1811
+G1 X71.021 Y90.454 E.02154
+G1 X75.441 Y86.035 E.21156
+G1 X76.077 Y86.035 E.02154
+G1 X71.021 Y91.09 E.24203
+G1 X71.021 Y91.727 E.02154
+G1 X76.714 Y86.035 E.27249
+G1 X77.35 Y86.035 E.02154
+G1 X71.021 Y92.363 E.30296
+G1 X71.021 Y93 E.02154
+G1 X77.986 Y86.035 E.33342
+G1 X78.623 Y86.035 E.02154
+G1 X71.021 Y93.636 E.36389
+G1 X71.021 Y94.272 E.02154
+G1 X79.259 Y86.035 E.39435
+G1 X79.896 Y86.035 E.02154
+G1 X71.021 Y94.909 E.42482
+G1 X71.021 Y95.545 E.02154
+G1 X80.532 Y86.035 E.45528
+G1 X81.168 Y86.035 E.02154
+G1 X71.021 Y96.182 E.48575
+G1 X71.021 Y96.818 E.02154
+G1 X81.805 Y86.035 E.51621
+G1 X82.441 Y86.035 E.02154
+G1 X71.021 Y97.454 E.54668
+G1 X71.021 Y98.091 E.02154
+G1 X83.077 Y86.035 E.57714
+G1 X83.714 Y86.035 E.02154
+G1 X71.021 Y98.727 E.60761
+G1 X71.021 Y99.364 E.02154
+G1 X84.35 Y86.035 E.63807
+G1 X84.987 Y86.035 E.02154
+G1 X71.021 Y100 E.66854
+G1 X71.021 Y100.636 E.02154
+G1 X85.623 Y86.035 E.699
+G1 X86.259 Y86.035 E.02154
+G1 X71.021 Y101.273 E.72947
+G1 X71.021 Y101.909 E.02154
+G1 X86.896 Y86.035 E.75993
+G1 X87.532 Y86.035 E.02154
+G1 X71.021 Y102.546 E.7904
+G1 X71.021 Y103.182 E.02154
+G1 X88.169 Y86.035 E.82086
+G1 X88.805 Y86.035 E.02154
+G1 X71.021 Y103.818 E.85133
+G1 X71.021 Y104.455 E.02154
+G1 X89.441 Y86.035 E.88179
+G1 X90.078 Y86.035 E.02154
+G1 X71.021 Y105.091 E.91226
+G1 X71.021 Y105.728 E.02154
+G1 X90.714 Y86.035 E.94272
+G1 X91.351 Y86.035 E.02154
+G1 X71.021 Y106.364 E.97319
+G1 X71.021 Y107 E.02154
+G1 X91.987 Y86.035 E1.00365
+G1 X92.623 Y86.035 E.02154
+G1 X71.021 Y107.637 E1.03412
+G1 X71.021 Y108.273 E.02154
+G1 X93.26 Y86.035 E1.06458
+G1 X93.896 Y86.035 E.02154
+G1 X71.021 Y108.91 E1.09505
+G1 X71.021 Y109.546 E.02154
+G1 X94.533 Y86.035 E1.12551
+G1 X95.169 Y86.035 E.02154
+G1 X71.021 Y110.182 E1.15598
+G1 X71.021 Y110.819 E.02154
+G1 X95.805 Y86.035 E1.18644
+G1 X96.442 Y86.035 E.02154
+G1 X71.021 Y111.455 E1.21691
+G1 X71.021 Y112.092 E.02154
+G1 X97.078 Y86.035 E1.24737
+G1 X97.715 Y86.035 E.02154
+G1 X71.021 Y112.728 E1.27784
+G1 X71.021 Y113.364 E.02154
+G1 X98.351 Y86.035 E1.3083
+G1 X98.987 Y86.035 E.02154
+G1 X71.057 Y113.965 E1.33708
+G1 X71.693 Y113.965 E.02154
+G1 X99.624 Y86.035 E1.33708
+G1 X100.26 Y86.035 E.02154
+G1 X72.329 Y113.965 E1.33708
+G1 X72.966 Y113.965 E.02154
+G1 X100.897 Y86.035 E1.33708
+G1 X101.533 Y86.035 E.02154
+G1 X73.602 Y113.965 E1.33708
+G1 X74.239 Y113.965 E.02154
+G1 X102.169 Y86.035 E1.33708
+G1 X102.806 Y86.035 E.02154
+G1 X74.875 Y113.965 E1.33708
+G1 X75.511 Y113.965 E.02154
+G1 X103.442 Y86.035 E1.33708
+G1 X104.079 Y86.035 E.02154
+G1 X76.148 Y113.965 E1.33708
+G1 X76.784 Y113.965 E.02154
+G1 X104.715 Y86.035 E1.33708
+G1 X105.351 Y86.035 E.02154
+G1 X77.421 Y113.965 E1.33708
+G1 X78.057 Y113.965 E.02154
+G1 X105.988 Y86.035 E1.33708
+G1 X106.624 Y86.035 E.02154
+G1 X78.693 Y113.965 E1.33708
+G1 X79.33 Y113.965 E.02154
+G1 X107.261 Y86.035 E1.33708
+G1 X107.897 Y86.035 E.02154
+G1 X79.966 Y113.965 E1.33708
+G1 X80.603 Y113.965 E.02154
+G1 X108.533 Y86.035 E1.33708
+G1 X109.17 Y86.035 E.02154
+G1 X81.239 Y113.965 E1.33708
+G1 X81.875 Y113.965 E.02154
+G1 X109.806 Y86.035 E1.33708
+G1 X110.443 Y86.035 E.02154
+G1 X82.512 Y113.965 E1.33708
+G1 X83.148 Y113.965 E.02154
+G1 X111.079 Y86.035 E1.33708
+G1 X111.715 Y86.035 E.02154
+G1 X83.785 Y113.965 E1.33708
+G1 X84.421 Y113.965 E.02154
+G1 X112.352 Y86.035 E1.33708
+G1 X112.988 Y86.035 E.02154
+G1 X85.057 Y113.965 E1.33708
+G1 X85.694 Y113.965 E.02154
+G1 X113.625 Y86.035 E1.33708
+G1 X114.261 Y86.035 E.02154
+G1 X86.33 Y113.965 E1.33708
+G1 X86.967 Y113.965 E.02154
+G1 X114.897 Y86.035 E1.33708
+G1 X115.534 Y86.035 E.02154
+G1 X87.603 Y113.965 E1.33708
+G1 X88.239 Y113.965 E.02154
+G1 X116.17 Y86.035 E1.33708
+G1 X116.806 Y86.035 E.02154
+G1 X88.876 Y113.965 E1.33708
+G1 X89.512 Y113.965 E.02154
+G1 X117.443 Y86.035 E1.33708
+G1 X118.079 Y86.035 E.02154
+G1 X90.149 Y113.965 E1.33708
+G1 X90.785 Y113.965 E.02154
+G1 X118.716 Y86.035 E1.33708
+G1 X119.352 Y86.035 E.02154
+G1 X91.421 Y113.965 E1.33708
+G1 X92.058 Y113.965 E.02154
+G1 X119.988 Y86.035 E1.33708
+G1 X120.625 Y86.035 E.02154
+G1 X92.694 Y113.965 E1.33708
+G1 X93.331 Y113.965 E.02154
+G1 X121.261 Y86.035 E1.33708
+G1 X121.898 Y86.035 E.02154
+G1 X93.967 Y113.965 E1.33708
+G1 X94.603 Y113.965 E.02154
+G1 X122.534 Y86.035 E1.33708
+G1 X123.17 Y86.035 E.02154
+G1 X95.24 Y113.965 E1.33708
+G1 X95.876 Y113.965 E.02154
+G1 X123.807 Y86.035 E1.33708
+G1 X124.443 Y86.035 E.02154
+G1 X96.513 Y113.965 E1.33708
+G1 X97.149 Y113.965 E.02154
+G1 X125.08 Y86.035 E1.33708
+G1 X125.716 Y86.035 E.02154
+G1 X97.785 Y113.965 E1.33708
+G1 X98.422 Y113.965 E.02154
+G1 X126.352 Y86.035 E1.33708
+G1 X126.989 Y86.035 E.02154
+G1 X99.058 Y113.965 E1.33708
+G1 X99.695 Y113.965 E.02154
+G1 X127.625 Y86.035 E1.33708
+G1 X128.262 Y86.035 E.02154
+G1 X100.331 Y113.965 E1.33708
+G1 X100.967 Y113.965 E.02154
+G1 X128.898 Y86.035 E1.33708
+G1 X128.969 Y86.6 E.0193
+G1 X101.604 Y113.965 E1.31
+G1 X102.24 Y113.965 E.02154
+G1 X128.969 Y87.237 E1.27953
+G1 X128.969 Y87.873 E.02154
+G1 X102.876 Y113.965 E1.24907
+G1 X103.513 Y113.965 E.02154
+G1 X128.969 Y88.51 E1.2186
+G1 X128.969 Y89.146 E.02154
+G1 X104.149 Y113.965 E1.18814
+G1 X104.786 Y113.965 E.02154
+G1 X128.969 Y89.782 E1.15767
+G1 X128.969 Y90.419 E.02154
+G1 X105.422 Y113.965 E1.12721
+G1 X106.058 Y113.965 E.02154
+G1 X128.969 Y91.055 E1.09674
+G1 X128.969 Y91.691 E.02154
+G1 X106.695 Y113.965 E1.06628
+G1 X107.331 Y113.965 E.02154
+G1 X128.969 Y92.328 E1.03581
+G1 X128.969 Y92.964 E.02154
+G1 X107.968 Y113.965 E1.00535
+G1 X108.604 Y113.965 E.02154
+G1 X128.969 Y93.601 E.97488
+G1 X128.969 Y94.237 E.02154
+G1 X109.24 Y113.965 E.94442
+G1 X109.877 Y113.965 E.02154
+G1 X128.969 Y94.873 E.91395
+G1 X128.969 Y95.51 E.02154
+G1 X110.513 Y113.965 E.88349
+G1 X111.15 Y113.965 E.02154
+G1 X128.969 Y96.146 E.85302
+G1 X128.969 Y96.783 E.02154
+G1 X111.786 Y113.965 E.82256
+G1 X112.422 Y113.965 E.02154
+G1 X128.969 Y97.419 E.79209
+G1 X128.969 Y98.055 E.02154
+G1 X113.059 Y113.965 E.76163
+G1 X113.695 Y113.965 E.02154
+G1 X128.969 Y98.692 E.73116
+G1 X128.969 Y99.328 E.02154
+G1 X114.332 Y113.965 E.7007
+G1 X114.968 Y113.965 E.02154
+G1 X128.969 Y99.965 E.67023
+G1 X128.969 Y100.601 E.02154
+G1 X115.604 Y113.965 E.63977
+G1 X116.241 Y113.965 E.02154
+G1 X128.969 Y101.237 E.6093
+G1 X128.969 Y101.874 E.02154
+G1 X116.877 Y113.965 E.57884
+G1 X117.514 Y113.965 E.02154
+G1 X128.969 Y102.51 E.54837
+G1 X128.969 Y103.147 E.02154
+G1 X118.15 Y113.965 E.51791
+G1 X118.786 Y113.965 E.02154
+G1 X128.969 Y103.783 E.48744
+G1 X128.969 Y104.419 E.02154
+G1 X119.423 Y113.965 E.45698
+G1 X120.059 Y113.965 E.02154
+G1 X128.969 Y105.056 E.42651
+G1 X128.969 Y105.692 E.02154
+G1 X120.696 Y113.965 E.39605
+G1 X121.332 Y113.965 E.02154
+G1 X128.969 Y106.329 E.36558
+G1 X128.969 Y106.965 E.02154
+G1 X121.968 Y113.965 E.33512
+G1 X122.605 Y113.965 E.02154
+G1 X128.969 Y107.601 E.30465
+G1 X128.969 Y108.238 E.02154
+G1 X123.241 Y113.965 E.27419
+G1 X123.878 Y113.965 E.02154
+G1 X128.969 Y108.874 E.24372
+G1 X128.969 Y109.511 E.02154
+G1 X124.514 Y113.965 E.21326
+G1 X125.15 Y113.965 E.02154
+G1 X128.969 Y110.147 E.18279
+G1 X128.969 Y110.783 E.02154
+G1 X125.787 Y113.965 E.15233
+G1 X126.423 Y113.965 E.02154
+G1 X128.969 Y111.42 E.12186
+G1 X128.969 Y112.056 E.02154
+G1 X127.06 Y113.965 E.0914
+G1 X127.696 Y113.965 E.02154
+G1 X128.969 Y112.693 E.06093
+G1 X128.969 Y113.329 E.02154
+G1 X128.332 Y113.965 E.03047
+;LAYER_CHANGE
+;Z:0.8
+;HEIGHT:0.2
+G1 E-.8 F2100
+G1 Z0.8 F720
+G1 E.8 F2100
+;TYPE:Perimeter
+;WIDTH:0.45
+G1 E-.8 F2100
+G1 X89.225 Y100 F10800
+G1 E.8 F2100
+G1 F2700
+G1 X89.205 Y100.414 E.01403
+G1 X89.144 Y100.824 E.01403
+G1 X89.043 Y101.226 E.01403
+G1 X88.903 Y101.617 E.01403
+G1 X88.726 Y101.992 E.01403
+G1 X88.513 Y102.347 E.01403
+G1 X88.266 Y102.68 E.01403
+G1 X87.988 Y102.988 E.01403
+G1 X87.68 Y103.266 E.01403
+G1 X87.347 Y103.513 E.01403
+G1 X86.992 Y103.726 E.01403
+G1 X86.617 Y103.903 E.01403
+G1 X86.226 Y104.043 E.01403
+G1 X85.824 Y104.144 E.01403
+G1 X85.414 Y104.205 E.01403
+G1 X85 Y104.225 E.01403
+G1 X84.586 Y104.205 E.01403
+G1 X84.176 Y104.144 E.01403
+G1 X83.774 Y104.043 E.01403
+G1 X83.383 Y103.903 E.01403
+G1 X83.008 Y103.726 E.01403
+G1 X82.653 Y103.513 E.01403
+G1 X82.32 Y103.266 E.01403
+G1 X82.012 Y102.988 E.01403
+G1 X81.734 Y102.68 E.01403
+G1 X81.487 Y102.347 E.01403
+G1 X81.274 Y101.992 E.01403
+G1 X81.097 Y101.617 E.01403
+G1 X80.957 Y101.226 E.01403
+G1 X80.856 Y100.824 E.01403
+G1 X80.795 Y100.414 E.01403
+G1 X80.775 Y100 E.01403
+G1 X80.795 Y99.586 E.01403
+G1 X80.856 Y99.176 E.01403
+G1 X80.957 Y98.774 E.01403
+G1 X81.097 Y98.383 E.01403
+G1 X81.274 Y98.008 E.01403
+G1 X81.487 Y97.653 E.01403
+G1 X81.734 Y97.32 E.01403
+G1 X82.012 Y97.012 E.01403
+G1 X82.32 Y96.734 E.01403
+G1 X82.653 Y96.487 E.01403
+G1 X83.008 Y96.274 E.01403
+G1 X83.383 Y96.097 E.01403
+G1 X83.774 Y95.957 E.01403
+G1 X84.176 Y95.856 E.01403
+G1 X84.586 Y95.795 E.01403
+G1 X85 Y95.775 E.01403
+G1 X85.414 Y95.795 E.01403
+G1 X85.824 Y95.856 E.01403
+G1 X86.226 Y95.957 E.01403
+G1 X86.617 Y96.097 E.01403
+G1 X86.992 Y96.274 E.01403
+G1 X87.347 Y96.487 E.01403
+G1 X87.68 Y96.734 E.01403
+G1 X87.988 Y97.012 E.01403
+G1 X88.266 Y97.32 E.01403
+G1 X88.513 Y97.653 E.01403
+G1 X88.726 Y98.008 E.01403
+G1 X88.903 Y98.383 E.01403
+G1 X89.043 Y98.774 E.01403
+G1 X89.144 Y99.176 E.01403
+G1 X89.205 Y99.586 E.01403
+G1 X89.225 Y100 E.01403
+G1 E-.8 F2100
+G1 X119.225 Y100 F10800
+G1 E.8 F2100
+G1 F2700
+G1 X119.205 Y100.414 E.01403
+G1 X119.144 Y100.824 E.01403
+G1 X119.043 Y101.226 E.01403
+G1 X118.903 Y101.617 E.01403
+G1 X118.726 Y101.992 E.01403
+G1 X118.513 Y102.347 E.01403
+G1 X118.266 Y102.68 E.01403
+G1 X117.988 Y102.988 E.01403
+G1 X117.68 Y103.266 E.01403
+G1 X117.347 Y103.513 E.01403
+G1 X116.992 Y103.726 E.01403
+G1 X116.617 Y103.903 E.01403
+G1 X116.226 Y104.043 E.01403
+G1 X115.824 Y104.144 E.01403
+G1 X115.414 Y104.205 E.01403
+G1 X115 Y104.225 E.01403
+G1 X114.586 Y104.205 E.01403
+G1 X114.176 Y104.144 E.01403
+G1 X113.774 Y104.043 E.01403
+G1 X113.383 Y103.903 E.01403
+G1 X113.008 Y103.726 E.01403
+G1 X112.653 Y103.513 E.01403
+G1 X112.32 Y103.266 E.01403
+G1 X112.012 Y102.988 E.01403
+G1 X111.734 Y102.68 E.01403
+G1 X111.487 Y102.347 E.01403
+G1 X111.274 Y101.992 E.01403
+G1 X111.097 Y101.617 E.01403
+G1 X110.957 Y101.226 E.01403
+G1 X110.856 Y100.824 E.01403
+G1 X110.795 Y100.414 E.01403
+G1 X110.775 Y100 E.01403
+G1 X110.795 Y99.586 E.01403
+G1 X110.856 Y99.176 E.01403
+G1 X110.957 Y98.774 E.01403
+G1 X111.097 Y98.383 E.01403
+G1 X111.274 Y98.008 E.01403
+G1 X111.487 Y97.653 E.01403
+G1 X111.734 Y97.32 E.01403
+G1 X112.012 Y97.012 E.01403
+G1 X112.32 Y96.734 E.01403
+G1 X112.653 Y96.487 E.01403
+G1 X113.008 Y96.274 E.01403
+G1 X113.383 Y96.097 E.01403
+G1 X113.774 Y95.957 E.01403
+G1 X114.176 Y95.856 E.01403
+G1 X114.586 Y95.795 E.01403
+G1 X115 Y95.775 E.01403
+G1 X115.414 Y95.795 E.01403
+G1 X115.824 Y95.856 E.01403
+G1 X116.226 Y95.957 E.01403
+G1 X116.617 Y96.097 E.01403
+G1 X116.992 Y96.274 E.01403
+G1 X117.347 Y96.487 E.01403
+G1 X117.68 Y96.734 E.01403
+G1 X117.988 Y97.012 E.01403
+G1 X118.266 Y97.32 E.01403
+G1 X118.513 Y97.653 E.01403
+G1 X118.726 Y98.008 E.01403
+G1 X118.903 Y98.383 E.01403
+G1 X119.043 Y98.774 E.01403
+G1 X119.144 Y99.176 E.01403
+G1 X119.205 Y99.586 E.01403
+G1 X119.225 Y100 E.01403
+G1 E-.8 F2100
+G1 X125.025 Y85.675 F10800
+G1 E.8 F2100
+G1 F2700
+G1 X125.306 Y85.684 E.00952
+G1 X125.586 Y85.712 E.00952
+G1 X125.864 Y85.758 E.00952
+G1 X126.138 Y85.822 E.00952
+G1 X126.407 Y85.903 E.00952
+G1 X126.671 Y86.002 E.00952
+G1 X126.927 Y86.118 E.00952
+G1 X127.175 Y86.251 E.00952
+G1 X127.414 Y86.4 E.00952
+G1 X127.643 Y86.564 E.00952
+G1 X127.86 Y86.742 E.00952
+G1 X128.066 Y86.934 E.00952
+G1 X128.258 Y87.14 E.00952
+G1 X128.436 Y87.357 E.00952
+G1 X128.6 Y87.586 E.00952
+G1 X128.749 Y87.825 E.00952
+G1 X128.882 Y88.073 E.00952
+G1 X128.998 Y88.329 E.00952
+G1 X129.097 Y88.593 E.00952
+G1 X129.178 Y88.862 E.00952
+G1 X129.242 Y89.136 E.00952
+G1 X129.288 Y89.414 E.00952
+G1 X129.316 Y89.694 E.00952
+G1 X129.325 Y89.975 E.00952
+G1 X129.325 Y110.025 E.67869
+G1 X129.316 Y110.306 E.00952
+G1 X129.288 Y110.586 E.00952
+G1 X129.242 Y110.864 E.00952
+G1 X129.178 Y111.138 E.00952
+G1 X129.097 Y111.407 E.00952
+G1 X128.998 Y111.671 E.00952
+G1 X128.882 Y111.927 E.00952
+G1 X128.749 Y112.175 E.00952
+G1 X128.6 Y112.414 E.00952
+G1 X128.436 Y112.643 E.00952
+G1 X128.258 Y112.86 E.00952
+G1 X128.066 Y113.066 E.00952
+G1 X127.86 Y113.258 E.00952
+G1 X127.643 Y113.436 E.00952
+G1 X127.414 Y113.6 E.00952
+G1 X127.175 Y113.749 E.00952
+G1 X126.927 Y113.882 E.00952
+G1 X126.671 Y113.998 E.00952
+G1 X126.407 Y114.097 E.00952
+G1 X126.138 Y114.178 E.00952
+G1 X125.864 Y114.242 E.00952
+G1 X125.586 Y114.288 E.00952
+G1 X125.306 Y114.316 E.00952
+G1 X125.025 Y114.325 E.00952
+G1 X74.975 Y114.325 E1.69419
+G1 X74.694 Y114.316 E.00952
+G1 X74.414 Y114.288 E.00952
+G1 X74.136 Y114.242 E.00952
+G1 X73.862 Y114.178 E.00952
+G1 X73.593 Y114.097 E.00952
+G1 X73.329 Y113.998 E.00952
+G1 X73.073 Y113.882 E.00952
+G1 X72.825 Y113.749 E.00952
+G1 X72.586 Y113.6 E.00952
+G1 X72.357 Y113.436 E.00952
+G1 X72.14 Y113.258 E.00952
+G1 X71.934 Y113.066 E.00952
+G1 X71.742 Y112.86 E.00952
+G1 X71.564 Y112.643 E.00952
+G1 X71.4 Y112.414 E.00952
+G1 X71.251 Y112.175 E.00952
+G1 X71.118 Y111.927 E.00952
+G1 X71.002 Y111.671 E.00952
+G1 X70.903 Y111.407 E.00952
+G1 X70.822 Y111.138 E.00952
+G1 X70.758 Y110.864 E.00952
+G1 X70.712 Y110.586 E.00952
+G1 X70.684 Y110.306 E.00952
+G1 X70.675 Y110.025 E.00952
+G1 X70.675 Y89.975 E.67869
+G1 X70.684 Y89.694 E.00952
+G1 X70.712 Y89.414 E.00952
+G1 X70.758 Y89.136 E.00952
+G1 X70.822 Y88.862 E.00952
+G1 X70.903 Y88.593 E.00952
+G1 X71.002 Y88.329 E.00952
+G1 X71.118 Y88.073 E.00952
+G1 X71.251 Y87.825 E.00952
+G1 X71.4 Y87.586 E.00952
+G1 X71.564 Y87.357 E.00952
+G1 X71.742 Y87.14 E.00952
+G1 X71.934 Y86.934 E.00952
+G1 X72.14 Y86.742 E.00952
+G1 X72.357 Y86.564 E.00952
+G1 X72.586 Y86.4 E.00952
+G1 X72.825 Y86.251 E.00952
+G1 X73.073 Y86.118 E.00952
+G1 X73.329 Y86.002 E.00952
+G1 X73.593 Y85.903 E.00952
+G1 X73.862 Y85.822 E.00952
+G1 X74.136 Y85.758 E.00952
+G1 X74.414 Y85.712 E.00952
+G1 X74.694 Y85.684 E.00952
+G1 X74.975 Y85.675 E.00952
+G1 X125.025 Y85.675 E1.69419
+;TYPE:External perimeter
+;WIDTH:0.45
+G1 E-.8 F2100
+G1 X88.775 Y100 F10800
+G1 E.8 F2100
+G1 F1800
+G1 X88.757 Y100.37 E.01254
+G1 X88.702 Y100.736 E.01254
+G1 X88.612 Y101.096 E.01254
+G1 X88.488 Y101.445 E.01254
+G1 X88.329 Y101.78 E.01254
+G1 X88.139 Y102.097 E.01254
+G1 X87.918 Y102.395 E.01254
+G1 X87.669 Y102.669 E.01254
+G1 X87.395 Y102.918 E.01254
+G1 X87.097 Y103.139 E.01254
+G1 X86.78 Y103.329 E.01254
+G1 X86.445 Y103.488 E.01254
+G1 X86.096 Y103.612 E.01254
+G1 X85.736 Y103.702 E.01254
+G1 X85.37 Y103.757 E.01254
+G1 X85 Y103.775 E.01254
+G1 X84.63 Y103.757 E.01254
+G1 X84.264 Y103.702 E.01254
+G1 X83.904 Y103.612 E.01254
+G1 X83.555 Y103.488 E.01254
+G1 X83.22 Y103.329 E.01254
+G1 X82.903 Y103.139 E.01254
+G1 X82.605 Y102.918 E.01254
+G1 X82.331 Y102.669 E.01254
+G1 X82.082 Y102.395 E.01254
+G1 X81.861 Y102.097 E.01254
+G1 X81.671 Y101.78 E.01254
+G1 X81.512 Y101.445 E.01254
+G1 X81.388 Y101.096 E.01254
+G1 X81.298 Y100.736 E.01254
+G1 X81.243 Y100.37 E.01254
+G1 X81.225 Y100 E.01254
+G1 X81.243 Y99.63 E.01254
+G1 X81.298 Y99.264 E.01254
+G1 X81.388 Y98.904 E.01254
+G1 X81.512 Y98.555 E.01254
+G1 X81.671 Y98.22 E.01254
+G1 X81.861 Y97.903 E.01254
+G1 X82.082 Y97.605 E.01254
+G1 X82.331 Y97.331 E.01254
+G1 X82.605 Y97.082 E.01254
+G1 X82.903 Y96.861 E.01254
+G1 X83.22 Y96.671 E.01254
+G1 X83.555 Y96.512 E.01254
+G1 X83.904 Y96.388 E.01254
+G1 X84.264 Y96.298 E.01254
+G1 X84.63 Y96.243 E.01254
+G1 X85 Y96.225 E.01254
+G1 X85.37 Y96.243 E.01254
+G1 X85.736 Y96.298 E.01254
+G1 X86.096 Y96.388 E.01254
+G1 X86.445 Y96.512 E.01254
+G1 X86.78 Y96.671 E.01254
+G1 X87.097 Y96.861 E.01254
+G1 X87.395 Y97.082 E.01254
+G1 X87.669 Y97.331 E.01254
+G1 X87.918 Y97.605 E.01254
+G1 X88.139 Y97.903 E.01254
+G1 X88.329 Y98.22 E.01254
+G1 X88.488 Y98.555 E.01254
+G1 X88.612 Y98.904 E.01254
+G1 X88.702 Y99.264 E.01254
+G1 X88.757 Y99.63 E.01254
+G1 X88.775 Y100 E.01254
+G1 E-.8 F2100
+G1 X118.775 Y100 F10800
+G1 E.8 F2100
+G1 F1800
+G1 X118.757 Y100.37 E.01254
+G1 X118.702 Y100.736 E.01254
+G1 X118.612 Y101.096 E.01254
+G1 X118.488 Y101.445 E.01254
+G1 X118.329 Y101.78 E.01254
+G1 X118.139 Y102.097 E.01254
+G1 X117.918 Y102.395 E.01254
+G1 X117.669 Y102.669 E.01254
+G1 X117.395 Y102.918 E.01254
+G1 X117.097 Y103.139 E.01254
+G1 X116.78 Y103.329 E.01254
+G1 X116.445 Y103.488 E.01254
+G1 X116.096 Y103.612 E.01254
+G1 X115.736 Y103.702 E.01254
+G1 X115.37 Y103.757 E.01254
+G1 X115 Y103.775 E.01254
+G1 X114.63 Y103.757 E.01254
+G1 X114.264 Y103.702 E.01254
+G1 X113.904 Y103.612 E.01254
+G1 X113.555 Y103.488 E.01254
+G1 X113.22 Y103.329 E.01254
+G1 X112.903 Y103.139 E.01254
+G1 X112.605 Y102.918 E.01254
+G1 X112.331 Y102.669 E.01254
+G1 X112.082 Y102.395 E.01254
+G1 X111.861 Y102.097 E.01254
+G1 X111.671 Y101.78 E.01254
+G1 X111.512 Y101.445 E.01254
+G1 X111.388 Y101.096 E.01254
+G1 X111.298 Y100.736 E.01254
+G1 X111.243 Y100.37 E.01254
+G1 X111.225 Y100 E.01254
+G1 X111.243 Y99.63 E.01254
+G1 X111.298 Y99.264 E.01254
+G1 X111.388 Y98.904 E.01254
+G1 X111.512 Y98.555 E.01254
+G1 X111.671 Y98.22 E.01254
+G1 X111.861 Y97.903 E.01254
+G1 X112.082 Y97.605 E.01254
+G1 X112.331 Y97.331 E.01254
+G1 X112.605 Y97.082 E.01254
+G1 X112.903 Y96.861 E.01254
+G1 X113.22 Y96.671 E.01254
+G1 X113.555 Y96.512 E.01254
+G1 X113.904 Y96.388 E.01254
+G1 X114.264 Y96.298 E.01254
+G1 X114.63 Y96.243 E.01254
+G1 X115 Y96.225 E.01254
+G1 X115.37 Y96.243 E.01254
+G1 X115.736 Y96.298 E.01254
+G1 X116.096 Y96.388 E.01254
+G1 X116.445 Y96.512 E.01254
+G1 X116.78 Y96.671 E.01254
+G1 X117.097 Y96.861 E.01254
+G1 X117.395 Y97.082 E.01254
+G1 X117.669 Y97.331 E.01254
+G1 X117.918 Y97.605 E.01254
+G1 X118.139 Y97.903 E.01254
+G1 X118.329 Y98.22 E.01254
+G1 X118.488 Y98.555 E.01254
+G1 X118.612 Y98.904 E.01254
+G1 X118.702 Y99.264 E.01254
+G1 X118.757 Y99.63 E.01254
+G1 X118.775 Y100 E.01254
+G1 E-.8 F2100
+G1 X125.025 Y85.225 F10800
+G1 E.8 F2100
+G1 F1800
+G1 X125.336 Y85.235 E.01052
+G1 X125.645 Y85.266 E.01052
+G1 X125.952 Y85.316 E.01052
+G1 X126.254 Y85.387 E.01052
+G1 X126.552 Y85.477 E.01052
+G1 X126.843 Y85.587 E.01052
+G1 X127.126 Y85.715 E.01052
+G1 X127.4 Y85.861 E.01052
+G1 X127.664 Y86.026 E.01052
+G1 X127.917 Y86.207 E.01052
+G1 X128.157 Y86.404 E.01052
+G1 X128.384 Y86.616 E.01052
+G1 X128.596 Y86.843 E.01052
+G1 X128.793 Y87.083 E.01052
+G1 X128.974 Y87.336 E.01052
+G1 X129.139 Y87.6 E.01052
+G1 X129.285 Y87.874 E.01052
+G1 X129.413 Y88.157 E.01052
+G1 X129.523 Y88.448 E.01052
+G1 X129.613 Y88.746 E.01052
+G1 X129.684 Y89.048 E.01052
+G1 X129.734 Y89.355 E.01052
+G1 X129.765 Y89.664 E.01052
+G1 X129.775 Y89.975 E.01052
+G1 X129.775 Y110.025 E.67869
+G1 X129.765 Y110.336 E.01052
+G1 X129.734 Y110.645 E.01052
+G1 X129.684 Y110.952 E.01052
+G1 X129.613 Y111.254 E.01052
+G1 X129.523 Y111.552 E.01052
+G1 X129.413 Y111.843 E.01052
+G1 X129.285 Y112.126 E.01052
+G1 X129.139 Y112.4 E.01052
+G1 X128.974 Y112.664 E.01052
+G1 X128.793 Y112.917 E.01052
+G1 X128.596 Y113.157 E.01052
+G1 X128.384 Y113.384 E.01052
+G1 X128.157 Y113.596 E.01052
+G1 X127.917 Y113.793 E.01052
+G1 X127.664 Y113.974 E.01052
+G1 X127.4 Y114.139 E.01052
+G1 X127.126 Y114.285 E.01052
+G1 X126.843 Y114.413 E.01052
+G1 X126.552 Y114.523 E.01052
+G1 X126.254 Y114.613 E.01052
+G1 X125.952 Y114.684 E.01052
+G1 X125.645 Y114.734 E.01052
+G1 X125.336 Y114.765 E.01052
+G1 X125.025 Y114.775 E.01052
+G1 X74.975 Y114.775 E1.69419
+G1 X74.664 Y114.765 E.01052
+G1 X74.355 Y114.734 E.01052
+G1 X74.048 Y114.684 E.01052
+G1 X73.746 Y114.613 E.01052
+G1 X73.448 Y114.523 E.01052
+G1 X73.157 Y114.413 E.01052
+G1 X72.874 Y114.285 E.01052
+G1 X72.6 Y114.139 E.01052
+G1 X72.336 Y113.974 E.01052
+G1 X72.083 Y113.793 E.01052
+G1 X71.843 Y113.596 E.01052
+G1 X71.616 Y113.384 E.01052
+G1 X71.404 Y113.157 E.01052
+G1 X71.207 Y112.917 E.01052
+G1 X71.026 Y112.664 E.01052
+G1 X70.861 Y112.4 E.01052
+G1 X70.715 Y112.126 E.01052
+G1 X70.587 Y111.843 E.01052
+G1 X70.477 Y111.552 E.01052
+G1 X70.387 Y111.254 E.01052
+G1 X70.316 Y110.952 E.01052
+G1 X70.266 Y110.645 E.01052
+G1 X70.235 Y110.336 E.01052
+G1 X70.225 Y110.025 E.01052
+G1 X70.225 Y89.975 E.67869
+G1 X70.235 Y89.664 E.01052
+G1 X70.266 Y89.355 E.01052
+G1 X70.316 Y89.048 E.01052
+G1 X70.387 Y88.746 E.01052
+G1 X70.477 Y88.448 E.01052
+G1 X70.587 Y88.157 E.01052
+G1 X70.715 Y87.874 E.01052
+G1 X70.861 Y87.6 E.01052
+G1 X71.026 Y87.336 E.01052
+G1 X71.207 Y87.083 E.01052
+G1 X71.404 Y86.843 E.01052
+G1 X71.616 Y86.616 E.01052
+G1 X71.843 Y86.404 E.01052
+G1 X72.083 Y86.207 E.01052
+G1 X72.336 Y86.026 E.01052
+G1 X72.6 Y85.861 E.01052
+G1 X72.874 Y85.715 E.01052
+G1 X73.157 Y85.587 E.01052
+G1 X73.448 Y85.477 E.01052
+G1 X73.746 Y85.387 E.01052
+G1 X74.048 Y85.316 E.01052
+G1 X74.355 Y85.266 E.01052
+G1 X74.664 Y85.235 E.01052
+G1 X74.975 Y85.225 E.01052
+G1 X125.025 Y85.225 E1.69419
+;TYPE:Solid infill
+;WIDTH:0.45
+G1 E-.8 F2100
+G1 X128.355 Y86.012 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X128.991 Y86.648 E.03047
+G1 X128.991 Y87.285 E.02154
+G1 X127.719 Y86.012 E.06093
+G1 X127.082 Y86.012 E.02154
+G1 X128.991 Y87.921 E.0914
+G1 X128.991 Y88.558 E.02154
+G1 X126.446 Y86.012 E.12186
+G1 X125.809 Y86.012 E.02154
+G1 X128.991 Y89.194 E.15233
+G1 X128.991 Y89.83 E.02154
+G1 X125.173 Y86.012 E.18279
+G1 X124.537 Y86.012 E.02154
+G1 X128.991 Y90.467 E.21326
+G1 X128.991 Y91.103 E.02154
+G1 X123.9 Y86.012 E.24372
+G1 X123.264 Y86.012 E.02154
+G1 X128.991 Y91.74 E.27419
+G1 X128.991 Y92.376 E.02154
+G1 X122.627 Y86.012 E.30465
+G1 X121.991 Y86.012 E.02154
+G1 X128.991 Y93.012 E.33512
+G1 X128.991 Y93.649 E.02154
+G1 X121.355 Y86.012 E.36558
+G1 X120.718 Y86.012 E.02154
+G1 X128.991 Y94.285 E.39605
+G1 X128.991 Y94.922 E.02154
+G1 X120.082 Y86.012 E.42651
+G1 X119.445 Y86.012 E.02154
+G1 X128.991 Y95.558 E.45698
+G1 X128.991 Y96.194 E.02154
+G1 X118.809 Y86.012 E.48744
+G1 X118.173 Y86.012 E.02154
+G1 X128.991 Y96.831 E.51791
+G1 X128.991 Y97.467 E.02154
+G1 X117.536 Y86.012 E.54837
+G1 X116.9 Y86.012 E.02154
+G1 X128.991 Y98.104 E.57884
+G1 X128.991 Y98.74 E.02154
+G1 X116.263 Y86.012 E.6093
+G1 X115.627 Y86.012 E.02154
+G1 X128.991 Y99.376 E.63977
+G1 X128.991 Y100.013 E.02154
+G1 X114.991 Y86.012 E.67023
+G1 X114.354 Y86.012 E.02154
+G1 X128.991 Y100.649 E.7007
+G1 X128.991 Y101.285 E.02154
+G1 X113.718 Y86.012 E.73116
+G1 X113.081 Y86.012 E.02154
+G1 X128.991 Y101.922 E.76163
+G1 X128.991 Y102.558 E.02154
+G1 X112.445 Y86.012 E.79209
+G1 X111.809 Y86.012 E.02154
+G1 X128.991 Y103.195 E.82256
+G1 X128.991 Y103.831 E.02154
+G1 X111.172 Y86.012 E.85302
+G1 X110.536 Y86.012 E.02154
+G1 X128.991 Y104.467 E.88349
+G1 X128.991 Y105.104 E.02154
+G1 X109.899 Y86.012 E.91395
+G1 X109.263 Y86.012 E.02154
+G1 X128.991 Y105.74 E.94442
+G1 X128.991 Y106.377 E.02154
+G1 X108.627 Y86.012 E.97488
+G1 X107.99 Y86.012 E.02154
+G1 X128.991 Y107.013 E1.00535
+G1 X128.991 Y107.649 E.02154
+G1 X107.354 Y86.012 E1.03581
+G1 X106.718 Y86.012 E.02154
+G1 X128.991 Y108.286 E1.06628
+G1 X128.991 Y108.922 E.02154
+G1 X106.081 Y86.012 E1.09674
+G1 X105.445 Y86.012 E.02154
+G1 X128.991 Y109.559 E1.12721
+G1 X128.991 Y110.195 E.02154
+G1 X104.808 Y86.012 E1.15767
+G1 X104.172 Y86.012 E.02154
+G1 X128.991 Y110.831 E1.18814
+G1 X128.991 Y111.468 E.02154
+G1 X103.536 Y86.012 E1.2186
+G1 X102.899 Y86.012 E.02154
+G1 X128.991 Y112.104 E1.24907
+G1 X128.991 Y112.741 E.02154
+G1 X102.263 Y86.012 E1.27953
+G1 X101.626 Y86.012 E.02154
+G1 X128.991 Y113.377 E1.31
+G1 X128.956 Y113.978 E.02038
+G1 X100.99 Y86.012 E1.33877
+G1 X100.354 Y86.012 E.02154
+G1 X128.32 Y113.978 E1.33877
+G1 X127.683 Y113.978 E.02154
+G1 X99.717 Y86.012 E1.33877
+G1 X99.081 Y86.012 E.02154
+G1 X127.047 Y113.978 E1.33877
+G1 X126.41 Y113.978 E.02154
+G1 X98.444 Y86.012 E1.33877
+G1 X97.808 Y86.012 E.02154
+G1 X125.774 Y113.978 E1.33877
+G1 X125.138 Y113.978 E.02154
+G1 X97.172 Y86.012 E1.33877
+G1 X96.535 Y86.012 E.02154
+G1 X124.501 Y113.978 E1.33877
+G1 X123.865 Y113.978 E.02154
+G1 X95.899 Y86.012 E1.33877
+G1 X95.262 Y86.012 E.02154
+G1 X123.228 Y113.978 E1.33877
+G1 X122.592 Y113.978 E.02154
+G1 X94.626 Y86.012 E1.33877
+G1 X93.99 Y86.012 E.02154
+G1 X121.956 Y113.978 E1.33877
+G1 X121.319 Y113.978 E.02154
+G1 X93.353 Y86.012 E1.33877
+G1 X92.717 Y86.012 E.02154
+G1 X120.683 Y113.978 E1.33877
+G1 X120.046 Y113.978 E.02154
+G1 X92.08 Y86.012 E1.33877
+G1 X91.444 Y86.012 E.02154
+G1 X119.41 Y113.978 E1.33877
+G1 X118.774 Y113.978 E.02154
+G1 X90.808 Y86.012 E1.33877
+G1 X90.171 Y86.012 E.02154
+G1 X118.137 Y113.978 E1.33877
+G1 X117.501 Y113.978 E.02154
+G1 X89.535 Y86.012 E1.33877
+G1 X88.898 Y86.012 E.02154
+G1 X116.864 Y113.978 E1.33877
+G1 X116.228 Y113.978 E.02154
+G1 X88.262 Y86.012 E1.33877
+G1 X87.626 Y86.012 E.02154
+G1 X115.592 Y113.978 E1.33877
+G1 X114.955 Y113.978 E.02154
+G1 X86.989 Y86.012 E1.33877
+G1 X86.353 Y86.012 E.02154
+G1 X114.319 Y113.978 E1.33877
+G1 X113.683 Y113.978 E.02154
+G1 X85.716 Y86.012 E1.33877
+G1 X85.08 Y86.012 E.02154
+G1 X113.046 Y113.978 E1.33877
+G1 X112.41 Y113.978 E.02154
+G1 X84.444 Y86.012 E1.33877
+G1 X83.807 Y86.012 E.02154
+G1 X111.773 Y113.978 E1.33877
+G1 X111.137 Y113.978 E.02154
+G1 X83.171 Y86.012 E1.33877
+G1 X82.534 Y86.012 E.02154
+G1 X110.501 Y113.978 E1.33877
+G1 X109.864 Y113.978 E.02154
+G1 X81.898 Y86.012 E1.33877
+G1 X81.262 Y86.012 E.02154
+G1 X109.228 Y113.978 E1.33877
+G1 X108.591 Y113.978 E.02154
+G1 X80.625 Y86.012 E1.33877
+G1 X79.989 Y86.012 E.02154
+G1 X107.955 Y113.978 E1.33877
+G1 X107.319 Y113.978 E.02154
+G1 X79.352 Y86.012 E1.33877
+G1 X78.716 Y86.012 E.02154
+G1 X106.682 Y113.978 E1.33877
+G1 X106.046 Y113.978 E.02154
+G1 X78.08 Y86.012 E1.33877
+G1 X77.443 Y86.012 E.02154
+G1 X105.409 Y113.978 E1.33877
+G1 X104.773 Y113.978 E.02154
+G1 X76.807 Y86.012 E1.33877
+G1 X76.171 Y86.012 E.02154
+G1 X104.137 Y113.978 E1.33877
+G1 X103.5 Y113.978 E.02154
+G1 X75.534 Y86.012 E1.33877
+G1 X74.898 Y86.012 E.02154
+G1 X102.864 Y113.978 E1.33877
+G1 X102.227 Y113.978 E.02154
+G1 X74.261 Y86.012 E1.33877
+G1 X73.625 Y86.012 E.02154
+G1 X101.591 Y113.978 E1.33877
+G1 X100.955 Y113.978 E.02154
+G1 X72.989 Y86.012 E1.33877
+G1 X72.352 Y86.012 E.02154
+G1 X100.318 Y113.978 E1.33877
+G1 X99.682 Y113.978 E.02154
+G1 X71.716 Y86.012 E1.33877
+G1 X71.079 Y86.012 E.02154
+G1 X99.045 Y113.978 E1.33877
+G1 X98.409 Y113.978 E.02154
+G1 X71.009 Y86.578 E1.31169
+G1 X71.009 Y87.214 E.02154
+G1 X97.773 Y113.978 E1.28122
+G1 X97.136 Y113.978 E.02154
+G1 X71.009 Y87.85 E1.25076
+G1 X71.009 Y88.487 E.02154
+G1 X96.5 Y113.978 E1.22029
+G1 X95.863 Y113.978 E.02154
+G1 X71.009 Y89.123 E1.18983
+G1 X71.009 Y89.76 E.02154
+G1 X95.227 Y113.978 E1.15936
+G1 X94.591 Y113.978 E.02154
+G1 X71.009 Y90.396 E1.1289
+G1 X71.009 Y91.032 E.02154
+G1 X93.954 Y113.978 E1.09843
+G1 X93.318 Y113.978 E.02154
+G1 X71.009 Y91.669 E1.06797
+G1 X71.009 Y92.305 E.02154
+G1 X92.681 Y113.978 E1.0375
+G1 X92.045 Y113.978 E.02154
+G1 X71.009 Y92.942 E1.00704
+G1 X71.009 Y93.578 E.02154
+G1 X91.409 Y113.978 E.97657
+G1 X90.772 Y113.978 E.02154
+G1 X71.009 Y94.214 E.94611
+G1 X71.009 Y94.851 E.02154
+G1 X90.136 Y113.978 E.91564
+G1 X89.499 Y113.978 E.02154
+G1 X71.009 Y95.487 E.88518
+G1 X71.009 Y96.124 E.02154
+G1 X88.863 Y113.978 E.85471
+G1 X88.227 Y113.978 E.02154
+G1 X71.009 Y96.76 E.82425
+G1 X71.009 Y97.396 E.02154
+G1 X87.59 Y113.978 E.79378
+G1 X86.954 Y113.978 E.02154
+G1 X71.009 Y98.033 E.76332
+G1 X71.009 Y98.669 E.02154
+G1 X86.317 Y113.978 E.73285
+G1 X85.681 Y113.978 E.02154
+G1 X71.009 Y99.306 E.70239
+G1 X71.009 Y99.942 E.02154
+G1 X85.045 Y113.978 E.67192
+G1 X84.408 Y113.978 E.02154
+G1 X71.009 Y100.578 E.64146
+G1 X71.009 Y101.215 E.02154
+G1 X83.772 Y113.978 E.61099
+G1 X83.136 Y113.978 E.02154
+G1 X71.009 Y101.851 E.58053
+G1 X71.009 Y102.488 E.02154
+G1 X82.499 Y113.978 E.55006
+G1 X81.863 Y113.978 E.02154
+G1 X71.009 Y103.124 E.5196
+G1 X71.009 Y103.76 E.02154
+G1 X81.226 Y113.978 E.48913
+G1 X80.59 Y113.978 E.02154
+G1 X71.009 Y104.397 E.45867
+G1 X71.009 Y105.033 E.02154
+G1 X79.954 Y113.978 E.4282
+G1 X79.317 Y113.978 E.02154
+G1 X71.009 Y105.67 E.39774
+G1 X71.009 Y106.306 E.02154
+G1 X78.681 Y113.978 E.36727
+G1 X78.044 Y113.978 E.02154
+G1 X71.009 Y106.942 E.33681
+G1 X71.009 Y107.579 E.02154
+G1 X77.408 Y113.978 E.30634
+G1 X76.772 Y113.978 E.02154
+G1 X71.009 Y108.215 E.27588
+G1 X71.009 Y108.852 E.02154
+G1 X76.135 Y113.978 E.24541
+G1 X75.499 Y113.978 E.02154
+G1 X71.009 Y109.488 E.21495
+G1 X71.009 Y110.124 E.02154
+G1 X74.862 Y113.978 E.18448
+G1 X74.226 Y113.978 E.02154
+G1 X71.009 Y110.761 E.15402
+G1 X71.009 Y111.397 E.02154
+G1 X73.59 Y113.978 E.12355
+G1 X72.953 Y113.978 E.02154
+G1 X71.009 Y112.034 E.09309
+G1 X71.009 Y112.67 E.02154
+G1 X72.317 Y113.978 E.06262
+G1 X71.68 Y113.978 E.02154
+G1 X71.009 Y113.306 E.03216
+G1 E-.8 F2100
+M107
+G1 Z10.8 F720 ; Move print head up
+G1 X0 Y200 F3600 ; home X axis
+M104 S0 ; turn off temperature
+M140 S0 ; turn off heatbed
+M84 ; disable motors
@@ -0,0 +1,4178 @@
+; 30 mm cylinder, 360 facets, 2 perimeters, 5 layers
+; test job in the layout of PrusaSlicer 2.6 output, M83, retraction,
+; moves along the facets of a mesh
+;
+; external perimeters extrusion width = 0.45mm
+; perimeters extrusion width = 0.45mm
+; infill extrusion width = 0.45mm
+; first layer extrusion width = 0.45mm
+;
+M201 X1000 Y1000 Z200 E5000 ; sets maximum accelerations, mm/sec^2
+M203 X200 Y200 Z12 E120 ; sets maximum feedrates, mm / sec
+M204 P1250 R1250 T1250 ; sets acceleration (P, T) and retract acceleration (R), mm/sec^2
+G90 ; use absolute coordinates
+M83 ; extruder relative mode
+M104 S215 ; set extruder temp
+M140 S60 ; set bed temp
+M190 S60 ; wait for bed temp
+M109 S215 ; wait for extruder temp
+G28 W ; home all without mesh bed level
+G80 ; mesh bed leveling
+G1 Z0.2 F720
+G1 Y-3 F1000 ; go outside print area
+G1 X60 E9 F1000 ; intro line
+G1 X100 E12.5 F1000 ; intro line
+M221 S95
+G21 ; set units to millimeters
+G90 ; use absolute coordinates
+M83 ; use relative distances for extrusion
+M900 K0.05 ; Filament gcode LA 1.5
+M107
+;LAYER_CHANGE
+;TYPE:Perimeter
+;WIDTH:0.45
+G1 E-.8 F2100
+G1 X114.325 Y100 F10800
+G1 E.8 F2100
+G1 F2700
+G1 X114.323 Y100.25 E.00846
+G1 X114.316 Y100.5 E.00846
+G1 X114.305 Y100.75 E.00846
+G1 X114.29 Y100.999 E.00846
+G1 X114.27 Y101.249 E.00846
+G1 X114.247 Y101.497 E.00846
+G1 X114.218 Y101.746 E.00846
+G1 X114.186 Y101.994 E.00846
+G1 X114.149 Y102.241 E.00846
+G1 X114.107 Y102.488 E.00846
+G1 X114.062 Y102.733 E.00846
+G1 X114.012 Y102.978 E.00846
+G1 X113.958 Y103.222 E.00846
+G1 X113.899 Y103.466 E.00846
+G1 X113.837 Y103.708 E.00846
+G1 X113.77 Y103.949 E.00846
+G1 X113.699 Y104.188 E.00846
+G1 X113.624 Y104.427 E.00846
+G1 X113.545 Y104.664 E.00846
+G1 X113.461 Y104.899 E.00846
+G1 X113.374 Y105.134 E.00846
+G1 X113.282 Y105.366 E.00846
+G1 X113.186 Y105.597 E.00846
+G1 X113.087 Y105.827 E.00846
+G1 X112.983 Y106.054 E.00846
+G1 X112.875 Y106.28 E.00846
+G1 X112.764 Y106.503 E.00846
+G1 X112.648 Y106.725 E.00846
+G1 X112.529 Y106.945 E.00846
+G1 X112.406 Y107.162 E.00846
+G1 X112.279 Y107.378 E.00846
+G1 X112.148 Y107.591 E.00846
+G1 X112.014 Y107.802 E.00846
+G1 X111.876 Y108.01 E.00846
+G1 X111.734 Y108.216 E.00846
+G1 X111.589 Y108.42 E.00846
+G1 X111.44 Y108.621 E.00846
+G1 X111.288 Y108.819 E.00846
+G1 X111.133 Y109.015 E.00846
+G1 X110.974 Y109.208 E.00846
+G1 X110.811 Y109.398 E.00846
+G1 X110.646 Y109.585 E.00846
+G1 X110.477 Y109.77 E.00846
+G1 X110.305 Y109.951 E.00846
+G1 X110.129 Y110.129 E.00846
+G1 X109.951 Y110.305 E.00846
+G1 X109.77 Y110.477 E.00846
+G1 X109.585 Y110.646 E.00846
+G1 X109.398 Y110.811 E.00846
+G1 X109.208 Y110.974 E.00846
+G1 X109.015 Y111.133 E.00846
+G1 X108.819 Y111.288 E.00846
+G1 X108.621 Y111.44 E.00846
+G1 X108.42 Y111.589 E.00846
+G1 X108.216 Y111.734 E.00846
+G1 X108.01 Y111.876 E.00846
+G1 X107.802 Y112.014 E.00846
+G1 X107.591 Y112.148 E.00846
+G1 X107.378 Y112.279 E.00846
+G1 X107.162 Y112.406 E.00846
+G1 X106.945 Y112.529 E.00846
+G1 X106.725 Y112.648 E.00846
+G1 X106.503 Y112.764 E.00846
+G1 X106.28 Y112.875 E.00846
+G1 X106.054 Y112.983 E.00846
+G1 X105.827 Y113.087 E.00846
+G1 X105.597 Y113.186 E.00846
+G1 X105.366 Y113.282 E.00846
+G1 X105.134 Y113.374 E.00846
+G1 X104.899 Y113.461 E.00846
+G1 X104.664 Y113.545 E.00846
+G1 X104.427 Y113.624 E.00846
+G1 X104.188 Y113.699 E.00846
+G1 X103.949 Y113.77 E.00846
+G1 X103.708 Y113.837 E.00846
+G1 X103.466 Y113.899 E.00846
+G1 X103.222 Y113.958 E.00846
+G1 X102.978 Y114.012 E.00846
+G1 X102.733 Y114.062 E.00846
+G1 X102.488 Y114.107 E.00846
+G1 X102.241 Y114.149 E.00846
+G1 X101.994 Y114.186 E.00846
+G1 X101.746 Y114.218 E.00846
+G1 X101.497 Y114.247 E.00846
+G1 X101.249 Y114.27 E.00846
+G1 X100.999 Y114.29 E.00846
+G1 X100.75 Y114.305 E.00846
+G1 X100.5 Y114.316 E.00846
+G1 X100.25 Y114.323 E.00846
+G1 X100 Y114.325 E.00846
+G1 X99.75 Y114.323 E.00846
+G1 X99.5 Y114.316 E.00846
+G1 X99.25 Y114.305 E.00846
+G1 X99.001 Y114.29 E.00846
+G1 X98.751 Y114.27 E.00846
+G1 X98.503 Y114.247 E.00846
+G1 X98.254 Y114.218 E.00846
+G1 X98.006 Y114.186 E.00846
+G1 X97.759 Y114.149 E.00846
+G1 X97.512 Y114.107 E.00846
+G1 X97.267 Y114.062 E.00846
+G1 X97.022 Y114.012 E.00846
+G1 X96.778 Y113.958 E.00846
+G1 X96.534 Y113.899 E.00846
+G1 X96.292 Y113.837 E.00846
+G1 X96.051 Y113.77 E.00846
+G1 X95.812 Y113.699 E.00846
+G1 X95.573 Y113.624 E.00846
+G1 X95.336 Y113.545 E.00846
+G1 X95.101 Y113.461 E.00846
+G1 X94.866 Y113.374 E.00846
+G1 X94.634 Y113.282 E.00846
+G1 X94.403 Y113.186 E.00846
+G1 X94.173 Y113.087 E.00846
+G1 X93.946 Y112.983 E.00846
+G1 X93.72 Y112.875 E.00846
+G1 X93.497 Y112.764 E.00846
+G1 X93.275 Y112.648 E.00846
+G1 X93.055 Y112.529 E.00846
+G1 X92.838 Y112.406 E.00846
+G1 X92.622 Y112.279 E.00846
+G1 X92.409 Y112.148 E.00846
+G1 X92.198 Y112.014 E.00846
+G1 X91.99 Y111.876 E.00846
+G1 X91.784 Y111.734 E.00846
+G1 X91.58 Y111.589 E.00846
+G1 X91.379 Y111.44 E.00846
+G1 X91.181 Y111.288 E.00846
+G1 X90.985 Y111.133 E.00846
+G1 X90.792 Y110.974 E.00846
+G1 X90.602 Y110.811 E.00846
+G1 X90.415 Y110.646 E.00846
+G1 X90.23 Y110.477 E.00846
+G1 X90.049 Y110.305 E.00846
+G1 X89.871 Y110.129 E.00846
+G1 X89.695 Y109.951 E.00846
+G1 X89.523 Y109.77 E.00846
+G1 X89.354 Y109.585 E.00846
+G1 X89.189 Y109.398 E.00846
+G1 X89.026 Y109.208 E.00846
+G1 X88.867 Y109.015 E.00846
+G1 X88.712 Y108.819 E.00846
+G1 X88.56 Y108.621 E.00846
+G1 X88.411 Y108.42 E.00846
+G1 X88.266 Y108.216 E.00846
+G1 X88.124 Y108.01 E.00846
+G1 X87.986 Y107.802 E.00846
+G1 X87.852 Y107.591 E.00846
+G1 X87.721 Y107.378 E.00846
+G1 X87.594 Y107.162 E.00846
+G1 X87.471 Y106.945 E.00846
+G1 X87.352 Y106.725 E.00846
+G1 X87.236 Y106.503 E.00846
+G1 X87.125 Y106.28 E.00846
+G1 X87.017 Y106.054 E.00846
+G1 X86.913 Y105.827 E.00846
+G1 X86.814 Y105.597 E.00846
+G1 X86.718 Y105.366 E.00846
+G1 X86.626 Y105.134 E.00846
+G1 X86.539 Y104.899 E.00846
+G1 X86.455 Y104.664 E.00846
+G1 X86.376 Y104.427 E.00846
+G1 X86.301 Y104.188 E.00846
+G1 X86.23 Y103.949 E.00846
+G1 X86.163 Y103.708 E.00846
+G1 X86.101 Y103.466 E.00846
+G1 X86.042 Y103.222 E.00846
+G1 X85.988 Y102.978 E.00846
+G1 X85.938 Y102.733 E.00846
+G1 X85.893 Y102.488 E.00846
+G1 X85.851 Y102.241 E.00846
+G1 X85.814 Y101.994 E.00846
+G1 X85.782 Y101.746 E.00846
+G1 X85.753 Y101.497 E.00846
+G1 X85.73 Y101.249 E.00846
+G1 X85.71 Y100.999 E.00846
+G1 X85.695 Y100.75 E.00846
+G1 X85.684 Y100.5 E.00846
+G1 X85.677 Y100.25 E.00846
+G1 X85.675 Y100 E.00846
+G1 X85.677 Y99.75 E.00846
+G1 X85.684 Y99.5 E.00846
+G1 X85.695 Y99.25 E.00846
+G1 X85.71 Y99.001 E.00846
+G1 X85.73 Y98.751 E.00846
+G1 X85.753 Y98.503 E.00846
+G1 X85.782 Y98.254 E.00846
+G1 X85.814 Y98.006 E.00846
+G1 X85.851 Y97.759 E.00846
+G1 X85.893 Y97.512 E.00846
+G1 X85.938 Y97.267 E.00846
+G1 X85.988 Y97.022 E.00846
+G1 X86.042 Y96.778 E.00846
+G1 X86.101 Y96.534 E.00846
+G1 X86.163 Y96.292 E.00846
+G1 X86.23 Y96.051 E.00846
+G1 X86.301 Y95.812 E.00846
+G1 X86.376 Y95.573 E.00846
+G1 X86.455 Y95.336 E.00846
+G1 X86.539 Y95.101 E.00846
+G1 X86.626 Y94.866 E.00846
+G1 X86.718 Y94.634 E.00846
+G1 X86.814 Y94.403 E.00846
+G1 X86.913 Y94.173 E.00846
+G1 X87.017 Y93.946 E.00846
+G1 X87.125 Y93.72 E.00846
+G1 X87.236 Y93.497 E.00846
+G1 X87.352 Y93.275 E.00846
+G1 X87.471 Y93.055 E.00846
+G1 X87.594 Y92.838 E.00846
+G1 X87.721 Y92.622 E.00846
+G1 X87.852 Y92.409 E.00846
+G1 X87.986 Y92.198 E.00846
+G1 X88.124 Y91.99 E.00846
+G1 X88.266 Y91.784 E.00846
+G1 X88.411 Y91.58 E.00846
+G1 X88.56 Y91.379 E.00846
+G1 X88.712 Y91.181 E.00846
+G1 X88.867 Y90.985 E.00846
+G1 X89.026 Y90.792 E.00846
+G1 X89.189 Y90.602 E.00846
+G1 X89.354 Y90.415 E.00846
+G1 X89.523 Y90.23 E.00846
+G1 X89.695 Y90.049 E.00846
+G1 X89.871 Y89.871 E.00846
+G1 X90.049 Y89.695 E.00846
+G1 X90.23 Y89.523 E.00846
+G1 X90.415 Y89.354 E.00846
+G1 X90.602 Y89.189 E.00846
+G1 X90.792 Y89.026 E.00846
+G1 X90.985 Y88.867 E.00846
+G1 X91.181 Y88.712 E.00846
+G1 X91.379 Y88.56 E.00846
+G1 X91.58 Y88.411 E.00846
+G1 X91.784 Y88.266 E.00846
+G1 X91.99 Y88.124 E.00846
+G1 X92.198 Y87.986 E.00846
+G1 X92.409 Y87.852 E.00846
+G1 X92.622 Y87.721 E.00846
+G1 X92.837 Y87.594 E.00846
+G1 X93.055 Y87.471 E.00846
+G1 X93.275 Y87.352 E.00846
+G1 X93.497 Y87.236 E.00846
+G1 X93.72 Y87.125 E.00846
+G1 X93.946 Y87.017 E.00846
+G1 X94.173 Y86.913 E.00846
+G1 X94.403 Y86.814 E.00846
+G1 X94.634 Y86.718 E.00846
+G1 X94.866 Y86.626 E.00846
+G1 X95.101 Y86.539 E.00846
+G1 X95.336 Y86.455 E.00846
+G1 X95.573 Y86.376 E.00846
+G1 X95.812 Y86.301 E.00846
+G1 X96.051 Y86.23 E.00846
+G1 X96.292 Y86.163 E.00846
+G1 X96.534 Y86.101 E.00846
+G1 X96.778 Y86.042 E.00846
+G1 X97.022 Y85.988 E.00846
+G1 X97.267 Y85.938 E.00846
+G1 X97.512 Y85.893 E.00846
+G1 X97.759 Y85.851 E.00846
+G1 X98.006 Y85.814 E.00846
+G1 X98.254 Y85.782 E.00846
+G1 X98.503 Y85.753 E.00846
+G1 X98.751 Y85.73 E.00846
+G1 X99.001 Y85.71 E.00846
+G1 X99.25 Y85.695 E.00846
+G1 X99.5 Y85.684 E.00846
+G1 X99.75 Y85.677 E.00846
+G1 X100 Y85.675 E.00846
+G1 X100.25 Y85.677 E.00846
+G1 X100.5 Y85.684 E.00846
+G1 X100.75 Y85.695 E.00846
+G1 X100.999 Y85.71 E.00846
+G1 X101.249 Y85.73 E.00846
+G1 X101.497 Y85.753 E.00846
+G1 X101.746 Y85.782 E.00846
+G1 X101.994 Y85.814 E.00846
+G1 X102.241 Y85.851 E.00846
+G1 X102.488 Y85.893 E.00846
+G1 X102.733 Y85.938 E.00846
+G1 X102.978 Y85.988 E.00846
+G1 X103.222 Y86.042 E.00846
+G1 X103.466 Y86.101 E.00846
+G1 X103.708 Y86.163 E.00846
+G1 X103.949 Y86.23 E.00846
+G1 X104.188 Y86.301 E.00846
+G1 X104.427 Y86.376 E.00846
+G1 X104.664 Y86.455 E.00846
+G1 X104.899 Y86.539 E.00846
+G1 X105.134 Y86.626 E.00846
+G1 X105.366 Y86.718 E.00846
+G1 X105.597 Y86.814 E.00846
+G1 X105.827 Y86.913 E.00846
+G1 X106.054 Y87.017 E.00846
+G1 X106.28 Y87.125 E.00846
+G1 X106.503 Y87.236 E.00846
+G1 X106.725 Y87.352 E.00846
+G1 X106.945 Y87.471 E.00846
+G1 X107.162 Y87.594 E.00846
+G1 X107.378 Y87.721 E.00846
+G1 X107.591 Y87.852 E.00846
+G1 X107.802 Y87.986 E.00846
+G1 X108.01 Y88.124 E.00846
+G1 X108.216 Y88.266 E.00846
+G1 X108.42 Y88.411 E.00846
+G1 X108.621 Y88.56 E.00846
+G1 X108.819 Y88.712 E.00846
+G1 X109.015 Y88.867 E.00846
+G1 X109.208 Y89.026 E.00846
+G1 X109.398 Y89.189 E.00846
+G1 X109.585 Y89.354 E.00846
+G1 X109.77 Y89.523 E.00846
+G1 X109.951 Y89.695 E.00846
+G1 X110.129 Y89.871 E.00846
+G1 X110.305 Y90.049 E.00846
+G1 X110.477 Y90.23 E.00846
+G1 X110.646 Y90.415 E.00846
+G1 X110.811 Y90.602 E.00846
+G1 X110.974 Y90.792 E.00846
+G1 X111.133 Y90.985 E.00846
+G1 X111.288 Y91.181 E.00846
+G1 X111.44 Y91.379 E.00846
+G1 X111.589 Y91.58 E.00846
+G1 X111.734 Y91.784 E.00846
+G1 X111.876 Y91.99 E.00846
+G1 X112.014 Y92.198 E.00846
+G1 X112.148 Y92.409 E.00846
+G1 X112.279 Y92.622 E.00846
+G1 X112.406 Y92.837 E.00846
+G1 X112.529 Y93.055 E.00846
+G1 X112.648 Y93.275 E.00846
+G1 X112.764 Y93.497 E.00846
+G1 X112.875 Y93.72 E.00846
+G1 X112.983 Y93.946 E.00846
+G1 X113.087 Y94.173 E.00846
+G1 X113.186 Y94.403 E.00846
+G1 X113.282 Y94.634 E.00846
+G1 X113.374 Y94.866 E.00846
+G1 X113.461 Y95.101 E.00846
+G1 X113.545 Y95.336 E.00846
+G1 X113.624 Y95.573 E.00846
+G1 X113.699 Y95.812 E.00846
+G1 X113.77 Y96.051 E.00846
+G1 X113.837 Y96.292 E.00846
+G1 X113.899 Y96.534 E.00846
+G1 X113.958 Y96.778 E.00846
+G1 X114.012 Y97.022 E.00846
+G1 X114.062 Y97.267 E.00846
+G1 X114.107 Y97.512 E.00846
+G1 X114.149 Y97.759 E.00846
+G1 X114.186 Y98.006 E.00846
+G1 X114.218 Y98.254 E.00846
+G1 X114.247 Y98.503 E.00846
+G1 X114.27 Y98.751 E.00846
+G1 X114.29 Y99.001 E.00846
+G1 X114.305 Y99.25 E.00846
+G1 X114.316 Y99.5 E.00846
+G1 X114.323 Y99.75 E.00846
+G1 X114.325 Y100 E.00846
+;TYPE:External perimeter
+;WIDTH:0.45
+G1 F1800
+G1 X114.773 Y100.258 E.01749
+G1 X114.766 Y100.516 E.00873
+G1 X114.755 Y100.773 E.00873
+G1 X114.739 Y101.031 E.00873
+G1 X114.719 Y101.288 E.00873
+G1 X114.694 Y101.544 E.00873
+G1 X114.665 Y101.801 E.00873
+G1 X114.631 Y102.056 E.00873
+G1 X114.593 Y102.311 E.00873
+G1 X114.551 Y102.566 E.00873
+G1 X114.504 Y102.819 E.00873
+G1 X114.452 Y103.072 E.00873
+G1 X114.396 Y103.324 E.00873
+G1 X114.336 Y103.574 E.00873
+G1 X114.272 Y103.824 E.00873
+G1 X114.203 Y104.073 E.00873
+G1 X114.129 Y104.32 E.00873
+G1 X114.052 Y104.566 E.00873
+G1 X113.97 Y104.81 E.00873
+G1 X113.884 Y105.053 E.00873
+G1 X113.794 Y105.295 E.00873
+G1 X113.699 Y105.535 E.00873
+G1 X113.6 Y105.773 E.00873
+G1 X113.498 Y106.01 E.00873
+G1 X113.391 Y106.244 E.00873
+G1 X113.28 Y106.477 E.00873
+G1 X113.165 Y106.708 E.00873
+G1 X113.046 Y106.936 E.00873
+G1 X112.923 Y107.163 E.00873
+G1 X112.796 Y107.388 E.00873
+G1 X112.665 Y107.61 E.00873
+G1 X112.53 Y107.83 E.00873
+G1 X112.391 Y108.047 E.00873
+G1 X112.249 Y108.262 E.00873
+G1 X112.103 Y108.475 E.00873
+G1 X111.953 Y108.685 E.00873
+G1 X111.8 Y108.892 E.00873
+G1 X111.643 Y109.096 E.00873
+G1 X111.482 Y109.298 E.00873
+G1 X111.318 Y109.497 E.00873
+G1 X111.151 Y109.693 E.00873
+G1 X110.98 Y109.886 E.00873
+G1 X110.806 Y110.077 E.00873
+G1 X110.628 Y110.264 E.00873
+G1 X110.448 Y110.448 E.00873
+G1 X110.264 Y110.628 E.00873
+G1 X110.077 Y110.806 E.00873
+G1 X109.886 Y110.98 E.00873
+G1 X109.693 Y111.151 E.00873
+G1 X109.497 Y111.318 E.00873
+G1 X109.298 Y111.482 E.00873
+G1 X109.096 Y111.643 E.00873
+G1 X108.892 Y111.8 E.00873
+G1 X108.685 Y111.953 E.00873
+G1 X108.475 Y112.103 E.00873
+G1 X108.262 Y112.249 E.00873
+G1 X108.047 Y112.391 E.00873
+G1 X107.83 Y112.53 E.00873
+G1 X107.61 Y112.665 E.00873
+G1 X107.388 Y112.796 E.00873
+G1 X107.163 Y112.923 E.00873
+G1 X106.936 Y113.046 E.00873
+G1 X106.708 Y113.165 E.00873
+G1 X106.477 Y113.28 E.00873
+G1 X106.244 Y113.391 E.00873
+G1 X106.01 Y113.498 E.00873
+G1 X105.773 Y113.6 E.00873
+G1 X105.535 Y113.699 E.00873
+G1 X105.295 Y113.794 E.00873
+G1 X105.053 Y113.884 E.00873
+G1 X104.81 Y113.97 E.00873
+G1 X104.566 Y114.052 E.00873
+G1 X104.32 Y114.129 E.00873
+G1 X104.073 Y114.203 E.00873
+G1 X103.824 Y114.272 E.00873
+G1 X103.574 Y114.336 E.00873
+G1 X103.324 Y114.396 E.00873
+G1 X103.072 Y114.452 E.00873
+G1 X102.819 Y114.504 E.00873
+G1 X102.566 Y114.551 E.00873
+G1 X102.311 Y114.593 E.00873
+G1 X102.056 Y114.631 E.00873
+G1 X101.801 Y114.665 E.00873
+G1 X101.544 Y114.694 E.00873
+G1 X101.288 Y114.719 E.00873
+G1 X101.031 Y114.739 E.00873
+G1 X100.773 Y114.755 E.00873
+G1 X100.516 Y114.766 E.00873
+G1 X100.258 Y114.773 E.00873
+G1 X100 Y114.775 E.00873
+G1 X99.742 Y114.773 E.00873
+G1 X99.484 Y114.766 E.00873
+G1 X99.227 Y114.755 E.00873
+G1 X98.969 Y114.739 E.00873
+G1 X98.712 Y114.719 E.00873
+G1 X98.456 Y114.694 E.00873
+G1 X98.199 Y114.665 E.00873
+G1 X97.944 Y114.631 E.00873
+G1 X97.689 Y114.593 E.00873
+G1 X97.434 Y114.551 E.00873
+G1 X97.181 Y114.504 E.00873
+G1 X96.928 Y114.452 E.00873
+G1 X96.676 Y114.396 E.00873
+G1 X96.426 Y114.336 E.00873
+G1 X96.176 Y114.272 E.00873
+G1 X95.927 Y114.203 E.00873
+G1 X95.68 Y114.129 E.00873
+G1 X95.434 Y114.052 E.00873
+G1 X95.19 Y113.97 E.00873
+G1 X94.947 Y113.884 E.00873
+G1 X94.705 Y113.794 E.00873
+G1 X94.465 Y113.699 E.00873
+G1 X94.227 Y113.6 E.00873
+G1 X93.99 Y113.498 E.00873
+G1 X93.756 Y113.391 E.00873
+G1 X93.523 Y113.28 E.00873
+G1 X93.292 Y113.165 E.00873
+G1 X93.064 Y113.046 E.00873
+G1 X92.837 Y112.923 E.00873
+G1 X92.612 Y112.796 E.00873
+G1 X92.39 Y112.665 E.00873
+G1 X92.17 Y112.53 E.00873
+G1 X91.953 Y112.391 E.00873
+G1 X91.738 Y112.249 E.00873
+G1 X91.525 Y112.103 E.00873
+G1 X91.315 Y111.953 E.00873
+G1 X91.108 Y111.8 E.00873
+G1 X90.904 Y111.643 E.00873
+G1 X90.702 Y111.482 E.00873
+G1 X90.503 Y111.318 E.00873
+G1 X90.307 Y111.151 E.00873
+G1 X90.114 Y110.98 E.00873
+G1 X89.923 Y110.806 E.00873
+G1 X89.736 Y110.628 E.00873
+G1 X89.552 Y110.448 E.00873
+G1 X89.372 Y110.264 E.00873
+G1 X89.194 Y110.077 E.00873
+G1 X89.02 Y109.886 E.00873
+G1 X88.849 Y109.693 E.00873
+G1 X88.682 Y109.497 E.00873
+G1 X88.518 Y109.298 E.00873
+G1 X88.357 Y109.096 E.00873
+G1 X88.2 Y108.892 E.00873
+G1 X88.047 Y108.685 E.00873
+G1 X87.897 Y108.475 E.00873
+G1 X87.751 Y108.262 E.00873
+G1 X87.609 Y108.047 E.00873
+G1 X87.47 Y107.83 E.00873
+G1 X87.335 Y107.61 E.00873
+G1 X87.204 Y107.388 E.00873
+G1 X87.077 Y107.163 E.00873
+G1 X86.954 Y106.936 E.00873
+G1 X86.835 Y106.708 E.00873
+G1 X86.72 Y106.477 E.00873
+G1 X86.609 Y106.244 E.00873
+G1 X86.502 Y106.01 E.00873
+G1 X86.4 Y105.773 E.00873
+G1 X86.301 Y105.535 E.00873
+G1 X86.206 Y105.295 E.00873
+G1 X86.116 Y105.053 E.00873
+G1 X86.03 Y104.81 E.00873
+G1 X85.948 Y104.566 E.00873
+G1 X85.871 Y104.32 E.00873
+G1 X85.797 Y104.073 E.00873
+G1 X85.728 Y103.824 E.00873
+G1 X85.664 Y103.574 E.00873
+G1 X85.604 Y103.324 E.00873
+G1 X85.548 Y103.072 E.00873
+G1 X85.496 Y102.819 E.00873
+G1 X85.449 Y102.566 E.00873
+G1 X85.407 Y102.311 E.00873
+G1 X85.369 Y102.056 E.00873
+G1 X85.335 Y101.801 E.00873
+G1 X85.306 Y101.544 E.00873
+G1 X85.281 Y101.288 E.00873
+G1 X85.261 Y101.031 E.00873
+G1 X85.245 Y100.773 E.00873
+G1 X85.234 Y100.516 E.00873
+G1 X85.227 Y100.258 E.00873
+G1 X85.225 Y100 E.00873
+G1 X85.227 Y99.742 E.00873
+G1 X85.234 Y99.484 E.00873
+G1 X85.245 Y99.227 E.00873
+G1 X85.261 Y98.969 E.00873
+G1 X85.281 Y98.712 E.00873
+G1 X85.306 Y98.456 E.00873
+G1 X85.335 Y98.199 E.00873
+G1 X85.369 Y97.944 E.00873
+G1 X85.407 Y97.689 E.00873
+G1 X85.449 Y97.434 E.00873
+G1 X85.496 Y97.181 E.00873
+G1 X85.548 Y96.928 E.00873
+G1 X85.604 Y96.676 E.00873
+G1 X85.664 Y96.426 E.00873
+G1 X85.728 Y96.176 E.00873
+G1 X85.797 Y95.927 E.00873
+G1 X85.871 Y95.68 E.00873
+G1 X85.948 Y95.434 E.00873
+G1 X86.03 Y95.19 E.00873
+G1 X86.116 Y94.947 E.00873
+G1 X86.206 Y94.705 E.00873
+G1 X86.301 Y94.465 E.00873
+G1 X86.4 Y94.227 E.00873
+G1 X86.502 Y93.99 E.00873
+G1 X86.609 Y93.756 E.00873
+G1 X86.72 Y93.523 E.00873
+G1 X86.835 Y93.292 E.00873
+G1 X86.954 Y93.064 E.00873
+G1 X87.077 Y92.837 E.00873
+G1 X87.204 Y92.612 E.00873
+G1 X87.335 Y92.39 E.00873
+G1 X87.47 Y92.17 E.00873
+G1 X87.609 Y91.953 E.00873
+G1 X87.751 Y91.738 E.00873
+G1 X87.897 Y91.525 E.00873
+G1 X88.047 Y91.315 E.00873
+G1 X88.2 Y91.108 E.00873
+G1 X88.357 Y90.904 E.00873
+G1 X88.518 Y90.702 E.00873
+G1 X88.682 Y90.503 E.00873
+G1 X88.849 Y90.307 E.00873
+G1 X89.02 Y90.114 E.00873
+G1 X89.194 Y89.923 E.00873
+G1 X89.372 Y89.736 E.00873
+G1 X89.552 Y89.552 E.00873
+G1 X89.736 Y89.372 E.00873
+G1 X89.923 Y89.194 E.00873
+G1 X90.114 Y89.02 E.00873
+G1 X90.307 Y88.849 E.00873
+G1 X90.503 Y88.682 E.00873
+G1 X90.702 Y88.518 E.00873
+G1 X90.904 Y88.357 E.00873
+G1 X91.108 Y88.2 E.00873
+G1 X91.315 Y88.047 E.00873
+G1 X91.525 Y87.897 E.00873
+G1 X91.738 Y87.751 E.00873
+G1 X91.953 Y87.609 E.00873
+G1 X92.17 Y87.47 E.00873
+G1 X92.39 Y87.335 E.00873
+G1 X92.612 Y87.204 E.00873
+G1 X92.837 Y87.077 E.00873
+G1 X93.064 Y86.954 E.00873
+G1 X93.292 Y86.835 E.00873
+G1 X93.523 Y86.72 E.00873
+G1 X93.756 Y86.609 E.00873
+G1 X93.99 Y86.502 E.00873
+G1 X94.227 Y86.4 E.00873
+G1 X94.465 Y86.301 E.00873
+G1 X94.705 Y86.206 E.00873
+G1 X94.947 Y86.116 E.00873
+G1 X95.19 Y86.03 E.00873
+G1 X95.434 Y85.948 E.00873
+G1 X95.68 Y85.871 E.00873
+G1 X95.927 Y85.797 E.00873
+G1 X96.176 Y85.728 E.00873
+G1 X96.426 Y85.664 E.00873
+G1 X96.676 Y85.604 E.00873
+G1 X96.928 Y85.548 E.00873
+G1 X97.181 Y85.496 E.00873
+G1 X97.434 Y85.449 E.00873
+G1 X97.689 Y85.407 E.00873
+G1 X97.944 Y85.369 E.00873
+G1 X98.199 Y85.335 E.00873
+G1 X98.456 Y85.306 E.00873
+G1 X98.712 Y85.281 E.00873
+G1 X98.969 Y85.261 E.00873
+G1 X99.227 Y85.245 E.00873
+G1 X99.484 Y85.234 E.00873
+G1 X99.742 Y85.227 E.00873
+G1 X100 Y85.225 E.00873
+G1 X100.258 Y85.227 E.00873
+G1 X100.516 Y85.234 E.00873
+G1 X100.773 Y85.245 E.00873
+G1 X101.031 Y85.261 E.00873
+G1 X101.288 Y85.281 E.00873
+G1 X101.544 Y85.306 E.00873
+G1 X101.801 Y85.335 E.00873
+G1 X102.056 Y85.369 E.00873
+G1 X102.311 Y85.407 E.00873
+G1 X102.566 Y85.449 E.00873
+G1 X102.819 Y85.496 E.00873
+G1 X103.072 Y85.548 E.00873
+G1 X103.324 Y85.604 E.00873
+G1 X103.574 Y85.664 E.00873
+G1 X103.824 Y85.728 E.00873
+G1 X104.073 Y85.797 E.00873
+G1 X104.32 Y85.871 E.00873
+G1 X104.566 Y85.948 E.00873
+G1 X104.81 Y86.03 E.00873
+G1 X105.053 Y86.116 E.00873
+G1 X105.295 Y86.206 E.00873
+G1 X105.535 Y86.301 E.00873
+G1 X105.773 Y86.4 E.00873
+G1 X106.01 Y86.502 E.00873
+G1 X106.244 Y86.609 E.00873
+G1 X106.477 Y86.72 E.00873
+G1 X106.708 Y86.835 E.00873
+G1 X106.936 Y86.954 E.00873
+G1 X107.163 Y87.077 E.00873
+G1 X107.388 Y87.204 E.00873
+G1 X107.61 Y87.335 E.00873
+G1 X107.83 Y87.47 E.00873
+G1 X108.047 Y87.609 E.00873
+G1 X108.262 Y87.751 E.00873
+G1 X108.475 Y87.897 E.00873
+G1 X108.685 Y88.047 E.00873
+G1 X108.892 Y88.2 E.00873
+G1 X109.096 Y88.357 E.00873
+G1 X109.298 Y88.518 E.00873
+G1 X109.497 Y88.682 E.00873
+G1 X109.693 Y88.849 E.00873
+G1 X109.886 Y89.02 E.00873
+G1 X110.077 Y89.194 E.00873
+G1 X110.264 Y89.372 E.00873
+G1 X110.448 Y89.552 E.00873
+G1 X110.628 Y89.736 E.00873
+G1 X110.806 Y89.923 E.00873
+G1 X110.98 Y90.114 E.00873
+G1 X111.151 Y90.307 E.00873
+G1 X111.318 Y90.503 E.00873
+G1 X111.482 Y90.702 E.00873
+G1 X111.643 Y90.904 E.00873
+G1 X111.8 Y91.108 E.00873
+G1 X111.953 Y91.315 E.00873
+G1 X112.103 Y91.525 E.00873
+G1 X112.249 Y91.738 E.00873
+G1 X112.391 Y91.953 E.00873
+G1 X112.53 Y92.17 E.00873
+G1 X112.665 Y92.39 E.00873
+G1 X112.796 Y92.612 E.00873
+G1 X112.923 Y92.837 E.00873
+G1 X113.046 Y93.064 E.00873
+G1 X113.165 Y93.292 E.00873
+G1 X113.28 Y93.523 E.00873
+G1 X113.391 Y93.756 E.00873
+G1 X113.498 Y93.99 E.00873
+G1 X113.6 Y94.227 E.00873
+G1 X113.699 Y94.465 E.00873
+G1 X113.794 Y94.705 E.00873
+G1 X113.884 Y94.947 E.00873
+G1 X113.97 Y95.19 E.00873
+G1 X114.052 Y95.434 E.00873
+G1 X114.129 Y95.68 E.00873
+G1 X114.203 Y95.927 E.00873
+G1 X114.272 Y96.176 E.00873
+G1 X114.336 Y96.426 E.00873
+G1 X114.396 Y96.676 E.00873
+G1 X114.452 Y96.928 E.00873
+G1 X114.504 Y97.181 E.00873
+G1 X114.551 Y97.434 E.00873
+G1 X114.593 Y97.689 E.00873
+G1 X114.631 Y97.944 E.00873
+G1 X114.665 Y98.199 E.00873
+G1 X114.694 Y98.456 E.00873
+G1 X114.719 Y98.712 E.00873
+G1 X114.739 Y98.969 E.00873
+G1 X114.755 Y99.227 E.00873
+G1 X114.766 Y99.484 E.00873
+G1 X114.773 Y99.742 E.00873
+G1 X114.775 Y100 E.00873
+;TYPE:Solid infill
+;WIDTH:0.45
+G1 E-.8 F2100
+G1 X87.961 Y92.858 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X92.84 Y87.979 E.23356
+G1 X94.183 Y87.272 E.05139
+G1 X87.289 Y94.166 E.33004
+G1 X86.829 Y95.262 E.04023
+G1 X95.244 Y86.848 E.40281
+G1 X96.198 Y86.53 E.03406
+G1 X86.546 Y96.182 E.46205
+G1 X86.334 Y97.03 E.02961
+G1 X97.047 Y86.317 E.51283
+G1 X97.825 Y86.176 E.02676
+G1 X86.193 Y97.808 E.55683
+G1 X86.087 Y98.55 E.02539
+G1 X98.532 Y86.105 E.59576
+G1 X99.239 Y86.035 E.02405
+G1 X86.051 Y99.222 E.6313
+G1 X86.016 Y99.894 E.02277
+G1 X99.875 Y86.035 E.66346
+G1 X100.512 Y86.035 E.02154
+G1 X86.016 Y100.53 E.69393
+G1 X86.051 Y101.131 E.02038
+G1 X101.113 Y86.07 E.72101
+G1 X101.714 Y86.105 E.02038
+G1 X86.122 Y101.697 E.74639
+G1 X86.193 Y102.263 E.0193
+G1 X102.244 Y86.211 E.7684
+G1 X102.774 Y86.317 E.01831
+G1 X86.299 Y102.793 E.78871
+G1 X86.405 Y103.323 E.01831
+G1 X103.305 Y86.424 E.80902
+G1 X103.8 Y86.565 E.01743
+G1 X86.546 Y103.818 E.82594
+G1 X86.688 Y104.313 E.01743
+G1 X104.295 Y86.706 E.84287
+G1 X104.79 Y86.848 E.01743
+G1 X86.864 Y104.773 E.8581
+G1 X87.041 Y105.233 E.01667
+G1 X105.249 Y87.025 E.87164
+G1 X105.674 Y87.237 E.01606
+G1 X87.218 Y105.692 E.88349
+G1 X87.43 Y106.116 E.01606
+G1 X106.098 Y87.449 E.89364
+G1 X106.522 Y87.661 E.01606
+G1 X87.642 Y106.541 E.9038
+G1 X87.89 Y106.93 E.0156
+G1 X106.946 Y87.873 E.91226
+G1 X107.335 Y88.121 E.0156
+G1 X88.102 Y107.354 E.92072
+G1 X88.349 Y107.743 E.0156
+G1 X107.724 Y88.368 E.92749
+G1 X108.113 Y88.616 E.0156
+G1 X88.632 Y108.096 E.93257
+G1 X88.88 Y108.485 E.0156
+G1 X108.467 Y88.898 E.93765
+G1 X108.82 Y89.181 E.01533
+G1 X89.163 Y108.839 E.94103
+G1 X89.445 Y109.192 E.01533
+G1 X109.174 Y89.464 E.94442
+G1 X109.527 Y89.747 E.01533
+G1 X89.764 Y109.511 E.94611
+G1 X90.082 Y109.829 E.01523
+G1 X109.845 Y90.065 E.94611
+G1 X110.164 Y90.383 E.01523
+G1 X90.4 Y110.147 E.94611
+G1 X90.718 Y110.465 E.01523
+G1 X110.447 Y90.737 E.94442
+G1 X110.765 Y91.055 E.01523
+G1 X91.072 Y110.748 E.94272
+G1 X91.425 Y111.031 E.01533
+G1 X111.048 Y91.409 E.93934
+G1 X111.295 Y91.798 E.0156
+G1 X91.779 Y111.314 E.93426
+G1 X92.168 Y111.561 E.0156
+G1 X111.578 Y92.151 E.92918
+G1 X111.825 Y92.54 E.0156
+G1 X92.557 Y111.809 E.92241
+G1 X92.946 Y112.056 E.0156
+G1 X112.073 Y92.929 E.91564
+G1 X112.285 Y93.353 E.01606
+G1 X93.335 Y112.304 E.90718
+G1 X93.759 Y112.516 E.01606
+G1 X112.497 Y93.777 E.89703
+G1 X112.709 Y94.202 E.01606
+G1 X94.183 Y112.728 E.88687
+G1 X94.643 Y112.905 E.01667
+G1 X112.921 Y94.626 E.87502
+G1 X113.098 Y95.086 E.01667
+G1 X95.102 Y113.081 E.86148
+G1 X95.562 Y113.258 E.01667
+G1 X113.24 Y95.581 E.84625
+G1 X113.416 Y96.04 E.01667
+G1 X96.057 Y113.4 E.83102
+G1 X96.552 Y113.541 E.01743
+G1 X113.558 Y96.535 E.81409
+G1 X113.664 Y97.066 E.01831
+G1 X97.047 Y113.683 E.79548
+G1 X97.577 Y113.789 E.01831
+G1 X113.77 Y97.596 E.77517
+G1 X113.841 Y98.162 E.0193
+G1 X98.143 Y113.859 E.75147
+G1 X98.709 Y113.93 E.0193
+G1 X113.911 Y98.727 E.72778
+G1 X113.982 Y99.293 E.0193
+G1 X99.31 Y113.965 E.70239
+G1 X99.946 Y113.965 E.02154
+G1 X113.982 Y99.929 E.67192
+G1 X113.982 Y100.566 E.02154
+G1 X100.582 Y113.965 E.64146
+G1 X101.254 Y113.93 E.02277
+G1 X113.911 Y101.273 E.60591
+G1 X113.841 Y101.98 E.02405
+G1 X101.961 Y113.859 E.56868
+G1 X102.739 Y113.718 E.02676
+G1 X113.699 Y102.758 E.52467
+G1 X113.522 Y103.571 E.02817
+G1 X103.552 Y113.541 E.47728
+G1 X104.471 Y113.258 E.03256
+G1 X113.24 Y104.49 E.41974
+G1 X112.851 Y105.515 E.03712
+G1 X105.497 Y112.869 E.35204
+G1 X106.734 Y112.268 E.04657
+G1 X112.25 Y106.753 E.26403
+G1 E-.8 F2100
+G1 X111.048 Y108.591 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X108.573 Y111.066 E.11848
+;LAYER_CHANGE
+;Z:0.4
+;HEIGHT:0.2
+G1 E-.8 F2100
+G1 Z0.4 F720
+G1 E.8 F2100
+;TYPE:Perimeter
+;WIDTH:0.45
+G1 E-.8 F2100
+G1 X114.325 Y100 F10800
+G1 E.8 F2100
+G1 F2700
+G1 X114.323 Y100.25 E.00846
+G1 X114.316 Y100.5 E.00846
+G1 X114.305 Y100.75 E.00846
+G1 X114.29 Y100.999 E.00846
+G1 X114.27 Y101.249 E.00846
+G1 X114.247 Y101.497 E.00846
+G1 X114.218 Y101.746 E.00846
+G1 X114.186 Y101.994 E.00846
+G1 X114.149 Y102.241 E.00846
+G1 X114.107 Y102.488 E.00846
+G1 X114.062 Y102.733 E.00846
+G1 X114.012 Y102.978 E.00846
+G1 X113.958 Y103.222 E.00846
+G1 X113.899 Y103.466 E.00846
+G1 X113.837 Y103.708 E.00846
+G1 X113.77 Y103.949 E.00846
+G1 X113.699 Y104.188 E.00846
+G1 X113.624 Y104.427 E.00846
+G1 X113.545 Y104.664 E.00846
+G1 X113.461 Y104.899 E.00846
+G1 X113.374 Y105.134 E.00846
+G1 X113.282 Y105.366 E.00846
+G1 X113.186 Y105.597 E.00846
+G1 X113.087 Y105.827 E.00846
+G1 X112.983 Y106.054 E.00846
+G1 X112.875 Y106.28 E.00846
+G1 X112.764 Y106.503 E.00846
+G1 X112.648 Y106.725 E.00846
+G1 X112.529 Y106.945 E.00846
+G1 X112.406 Y107.162 E.00846
+G1 X112.279 Y107.378 E.00846
+G1 X112.148 Y107.591 E.00846
+G1 X112.014 Y107.802 E.00846
+G1 X111.876 Y108.01 E.00846
+G1 X111.734 Y108.216 E.00846
+G1 X111.589 Y108.42 E.00846
+G1 X111.44 Y108.621 E.00846
+G1 X111.288 Y108.819 E.00846
+G1 X111.133 Y109.015 E.00846
+G1 X110.974 Y109.208 E.00846
+G1 X110.811 Y109.398 E.00846
+G1 X110.646 Y109.585 E.00846
+G1 X110.477 Y109.77 E.00846
+G1 X110.305 Y109.951 E.00846
+G1 X110.129 Y110.129 E.00846
+G1 X109.951 Y110.305 E.00846
+G1 X109.77 Y110.477 E.00846
+G1 X109.585 Y110.646 E.00846
+G1 X109.398 Y110.811 E.00846
+G1 X109.208 Y110.974 E.00846
+G1 X109.015 Y111.133 E.00846
+G1 X108.819 Y111.288 E.00846
+G1 X108.621 Y111.44 E.00846
+G1 X108.42 Y111.589 E.00846
+G1 X108.216 Y111.734 E.00846
+G1 X108.01 Y111.876 E.00846
+G1 X107.802 Y112.014 E.00846
+G1 X107.591 Y112.148 E.00846
+G1 X107.378 Y112.279 E.00846
+G1 X107.162 Y112.406 E.00846
+G1 X106.945 Y112.529 E.00846
+G1 X106.725 Y112.648 E.00846
+G1 X106.503 Y112.764 E.00846
+G1 X106.28 Y112.875 E.00846
+G1 X106.054 Y112.983 E.00846
+G1 X105.827 Y113.087 E.00846
+G1 X105.597 Y113.186 E.00846
+G1 X105.366 Y113.282 E.00846
+G1 X105.134 Y113.374 E.00846
+G1 X104.899 Y113.461 E.00846
+G1 X104.664 Y113.545 E.00846
+G1 X104.427 Y113.624 E.00846
+G1 X104.188 Y113.699 E.00846
+G1 X103.949 Y113.77 E.00846
+G1 X103.708 Y113.837 E.00846
+G1 X103.466 Y113.899 E.00846
+G1 X103.222 Y113.958 E.00846
+G1 X102.978 Y114.012 E.00846
+G1 X102.733 Y114.062 E.00846
+G1 X102.488 Y114.107 E.00846
+G1 X102.241 Y114.149 E.00846
+G1 X101.994 Y114.186 E.00846
+G1 X101.746 Y114.218 E.00846
+G1 X101.497 Y114.247 E.00846
+G1 X101.249 Y114.27 E.00846
+G1 X100.999 Y114.29 E.00846
+G1 X100.75 Y114.305 E.00846
+G1 X100.5 Y114.316 E.00846
+G1 X100.25 Y114.323 E.00846
+G1 X100 Y114.325 E.00846
+G1 X99.75 Y114.323 E.00846
+G1 X99.5 Y114.316 E.00846
+G1 X99.25 Y114.305 E.00846
+G1 X99.001 Y114.29 E.00846
+G1 X98.751 Y114.27 E.00846
+G1 X98.503 Y114.247 E.00846
+G1 X98.254 Y114.218 E.00846
+G1 X98.006 Y114.186 E.00846
+G1 X97.759 Y114.149 E.00846
+G1 X97.512 Y114.107 E.00846
+G1 X97.267 Y114.062 E.00846
+G1 X97.022 Y114.012 E.00846
+G1 X96.778 Y113.958 E.00846
+G1 X96.534 Y113.899 E.00846
+G1 X96.292 Y113.837 E.00846
+G1 X96.051 Y113.77 E.00846
+G1 X95.812 Y113.699 E.00846
+G1 X95.573 Y113.624 E.00846
+G1 X95.336 Y113.545 E.00846
+G1 X95.101 Y113.461 E.00846
+G1 X94.866 Y113.374 E.00846
+G1 X94.634 Y113.282 E.00846
+G1 X94.403 Y113.186 E.00846
+G1 X94.173 Y113.087 E.00846
+G1 X93.946 Y112.983 E.00846
+G1 X93.72 Y112.875 E.00846
+G1 X93.497 Y112.764 E.00846
+G1 X93.275 Y112.648 E.00846
+G1 X93.055 Y112.529 E.00846
+G1 X92.838 Y112.406 E.00846
+G1 X92.622 Y112.279 E.00846
+G1 X92.409 Y112.148 E.00846
+G1 X92.198 Y112.014 E.00846
+G1 X91.99 Y111.876 E.00846
+G1 X91.784 Y111.734 E.00846
+G1 X91.58 Y111.589 E.00846
+G1 X91.379 Y111.44 E.00846
+G1 X91.181 Y111.288 E.00846
+G1 X90.985 Y111.133 E.00846
+G1 X90.792 Y110.974 E.00846
+G1 X90.602 Y110.811 E.00846
+G1 X90.415 Y110.646 E.00846
+G1 X90.23 Y110.477 E.00846
+G1 X90.049 Y110.305 E.00846
+G1 X89.871 Y110.129 E.00846
+G1 X89.695 Y109.951 E.00846
+G1 X89.523 Y109.77 E.00846
+G1 X89.354 Y109.585 E.00846
+G1 X89.189 Y109.398 E.00846
+G1 X89.026 Y109.208 E.00846
+G1 X88.867 Y109.015 E.00846
+G1 X88.712 Y108.819 E.00846
+G1 X88.56 Y108.621 E.00846
+G1 X88.411 Y108.42 E.00846
+G1 X88.266 Y108.216 E.00846
+G1 X88.124 Y108.01 E.00846
+G1 X87.986 Y107.802 E.00846
+G1 X87.852 Y107.591 E.00846
+G1 X87.721 Y107.378 E.00846
+G1 X87.594 Y107.162 E.00846
+G1 X87.471 Y106.945 E.00846
+G1 X87.352 Y106.725 E.00846
+G1 X87.236 Y106.503 E.00846
+G1 X87.125 Y106.28 E.00846
+G1 X87.017 Y106.054 E.00846
+G1 X86.913 Y105.827 E.00846
+G1 X86.814 Y105.597 E.00846
+G1 X86.718 Y105.366 E.00846
+G1 X86.626 Y105.134 E.00846
+G1 X86.539 Y104.899 E.00846
+G1 X86.455 Y104.664 E.00846
+G1 X86.376 Y104.427 E.00846
+G1 X86.301 Y104.188 E.00846
+G1 X86.23 Y103.949 E.00846
+G1 X86.163 Y103.708 E.00846
+G1 X86.101 Y103.466 E.00846
+G1 X86.042 Y103.222 E.00846
+G1 X85.988 Y102.978 E.00846
+G1 X85.938 Y102.733 E.00846
+G1 X85.893 Y102.488 E.00846
+G1 X85.851 Y102.241 E.00846
+G1 X85.814 Y101.994 E.00846
+G1 X85.782 Y101.746 E.00846
+G1 X85.753 Y101.497 E.00846
+G1 X85.73 Y101.249 E.00846
+G1 X85.71 Y100.999 E.00846
+G1 X85.695 Y100.75 E.00846
+G1 X85.684 Y100.5 E.00846
+G1 X85.677 Y100.25 E.00846
+G1 X85.675 Y100 E.00846
+G1 X85.677 Y99.75 E.00846
+G1 X85.684 Y99.5 E.00846
+G1 X85.695 Y99.25 E.00846
+G1 X85.71 Y99.001 E.00846
+G1 X85.73 Y98.751 E.00846
+G1 X85.753 Y98.503 E.00846
+G1 X85.782 Y98.254 E.00846
+G1 X85.814 Y98.006 E.00846
+G1 X85.851 Y97.759 E.00846
+G1 X85.893 Y97.512 E.00846
+G1 X85.938 Y97.267 E.00846
+G1 X85.988 Y97.022 E.00846
+G1 X86.042 Y96.778 E.00846
+G1 X86.101 Y96.534 E.00846
+G1 X86.163 Y96.292 E.00846
+G1 X86.23 Y96.051 E.00846
+G1 X86.301 Y95.812 E.00846
+G1 X86.376 Y95.573 E.00846
+G1 X86.455 Y95.336 E.00846
+G1 X86.539 Y95.101 E.00846
+G1 X86.626 Y94.866 E.00846
+G1 X86.718 Y94.634 E.00846
+G1 X86.814 Y94.403 E.00846
+G1 X86.913 Y94.173 E.00846
+G1 X87.017 Y93.946 E.00846
+G1 X87.125 Y93.72 E.00846
+G1 X87.236 Y93.497 E.00846
+G1 X87.352 Y93.275 E.00846
+G1 X87.471 Y93.055 E.00846
+G1 X87.594 Y92.838 E.00846
+G1 X87.721 Y92.622 E.00846
+G1 X87.852 Y92.409 E.00846
+G1 X87.986 Y92.198 E.00846
+G1 X88.124 Y91.99 E.00846
+G1 X88.266 Y91.784 E.00846
+G1 X88.411 Y91.58 E.00846
+G1 X88.56 Y91.379 E.00846
+G1 X88.712 Y91.181 E.00846
+G1 X88.867 Y90.985 E.00846
+G1 X89.026 Y90.792 E.00846
+G1 X89.189 Y90.602 E.00846
+G1 X89.354 Y90.415 E.00846
+G1 X89.523 Y90.23 E.00846
+G1 X89.695 Y90.049 E.00846
+G1 X89.871 Y89.871 E.00846
+G1 X90.049 Y89.695 E.00846
+G1 X90.23 Y89.523 E.00846
+G1 X90.415 Y89.354 E.00846
+G1 X90.602 Y89.189 E.00846
+G1 X90.792 Y89.026 E.00846
+G1 X90.985 Y88.867 E.00846
+G1 X91.181 Y88.712 E.00846
+G1 X91.379 Y88.56 E.00846
+G1 X91.58 Y88.411 E.00846
+G1 X91.784 Y88.266 E.00846
+G1 X91.99 Y88.124 E.00846
+G1 X92.198 Y87.986 E.00846
+G1 X92.409 Y87.852 E.00846
+G1 X92.622 Y87.721 E.00846
+G1 X92.837 Y87.594 E.00846
+G1 X93.055 Y87.471 E.00846
+G1 X93.275 Y87.352 E.00846
+G1 X93.497 Y87.236 E.00846
+G1 X93.72 Y87.125 E.00846
+G1 X93.946 Y87.017 E.00846
+G1 X94.173 Y86.913 E.00846
+G1 X94.403 Y86.814 E.00846
+G1 X94.634 Y86.718 E.00846
+G1 X94.866 Y86.626 E.00846
+G1 X95.101 Y86.539 E.00846
+G1 X95.336 Y86.455 E.00846
+G1 X95.573 Y86.376 E.00846
+G1 X95.812 Y86.301 E.00846
+G1 X96.051 Y86.23 E.00846
+G1 X96.292 Y86.163 E.00846
+G1 X96.534 Y86.101 E.00846
+G1 X96.778 Y86.042 E.00846
+G1 X97.022 Y85.988 E.00846
+G1 X97.267 Y85.938 E.00846
+G1 X97.512 Y85.893 E.00846
+G1 X97.759 Y85.851 E.00846
+G1 X98.006 Y85.814 E.00846
+G1 X98.254 Y85.782 E.00846
+G1 X98.503 Y85.753 E.00846
+G1 X98.751 Y85.73 E.00846
+G1 X99.001 Y85.71 E.00846
+G1 X99.25 Y85.695 E.00846
+G1 X99.5 Y85.684 E.00846
+G1 X99.75 Y85.677 E.00846
+G1 X100 Y85.675 E.00846
+G1 X100.25 Y85.677 E.00846
+G1 X100.5 Y85.684 E.00846
+G1 X100.75 Y85.695 E.00846
+G1 X100.999 Y85.71 E.00846
+G1 X101.249 Y85.73 E.00846
+G1 X101.497 Y85.753 E.00846
+G1 X101.746 Y85.782 E.00846
+G1 X101.994 Y85.814 E.00846
+G1 X102.241 Y85.851 E.00846
+G1 X102.488 Y85.893 E.00846
+G1 X102.733 Y85.938 E.00846
+G1 X102.978 Y85.988 E.00846
+G1 X103.222 Y86.042 E.00846
+G1 X103.466 Y86.101 E.00846
+G1 X103.708 Y86.163 E.00846
+G1 X103.949 Y86.23 E.00846
+G1 X104.188 Y86.301 E.00846
+G1 X104.427 Y86.376 E.00846
+G1 X104.664 Y86.455 E.00846
+G1 X104.899 Y86.539 E.00846
+G1 X105.134 Y86.626 E.00846
+G1 X105.366 Y86.718 E.00846
+G1 X105.597 Y86.814 E.00846
+G1 X105.827 Y86.913 E.00846
+G1 X106.054 Y87.017 E.00846
+G1 X106.28 Y87.125 E.00846
+G1 X106.503 Y87.236 E.00846
+G1 X106.725 Y87.352 E.00846
+G1 X106.945 Y87.471 E.00846
+G1 X107.162 Y87.594 E.00846
+G1 X107.378 Y87.721 E.00846
+G1 X107.591 Y87.852 E.00846
+G1 X107.802 Y87.986 E.00846
+G1 X108.01 Y88.124 E.00846
+G1 X108.216 Y88.266 E.00846
+G1 X108.42 Y88.411 E.00846
+G1 X108.621 Y88.56 E.00846
+G1 X108.819 Y88.712 E.00846
+G1 X109.015 Y88.867 E.00846
+G1 X109.208 Y89.026 E.00846
+G1 X109.398 Y89.189 E.00846
+G1 X109.585 Y89.354 E.00846
+G1 X109.77 Y89.523 E.00846
+G1 X109.951 Y89.695 E.00846
+G1 X110.129 Y89.871 E.00846
+G1 X110.305 Y90.049 E.00846
+G1 X110.477 Y90.23 E.00846
+G1 X110.646 Y90.415 E.00846
+G1 X110.811 Y90.602 E.00846
+G1 X110.974 Y90.792 E.00846
+G1 X111.133 Y90.985 E.00846
+G1 X111.288 Y91.181 E.00846
+G1 X111.44 Y91.379 E.00846
+G1 X111.589 Y91.58 E.00846
+G1 X111.734 Y91.784 E.00846
+G1 X111.876 Y91.99 E.00846
+G1 X112.014 Y92.198 E.00846
+G1 X112.148 Y92.409 E.00846
+G1 X112.279 Y92.622 E.00846
+G1 X112.406 Y92.837 E.00846
+G1 X112.529 Y93.055 E.00846
+G1 X112.648 Y93.275 E.00846
+G1 X112.764 Y93.497 E.00846
+G1 X112.875 Y93.72 E.00846
+G1 X112.983 Y93.946 E.00846
+G1 X113.087 Y94.173 E.00846
+G1 X113.186 Y94.403 E.00846
+G1 X113.282 Y94.634 E.00846
+G1 X113.374 Y94.866 E.00846
+G1 X113.461 Y95.101 E.00846
+G1 X113.545 Y95.336 E.00846
+G1 X113.624 Y95.573 E.00846
+G1 X113.699 Y95.812 E.00846
+G1 X113.77 Y96.051 E.00846
+G1 X113.837 Y96.292 E.00846
+G1 X113.899 Y96.534 E.00846
+G1 X113.958 Y96.778 E.00846
+G1 X114.012 Y97.022 E.00846
+G1 X114.062 Y97.267 E.00846
+G1 X114.107 Y97.512 E.00846
+G1 X114.149 Y97.759 E.00846
+G1 X114.186 Y98.006 E.00846
+G1 X114.218 Y98.254 E.00846
+G1 X114.247 Y98.503 E.00846
+G1 X114.27 Y98.751 E.00846
+G1 X114.29 Y99.001 E.00846
+G1 X114.305 Y99.25 E.00846
+G1 X114.316 Y99.5 E.00846
+G1 X114.323 Y99.75 E.00846
+G1 X114.325 Y100 E.00846
+;TYPE:External perimeter
+;WIDTH:0.45
+G1 F1800
+G1 X114.773 Y100.258 E.01749
+G1 X114.766 Y100.516 E.00873
+G1 X114.755 Y100.773 E.00873
+G1 X114.739 Y101.031 E.00873
+G1 X114.719 Y101.288 E.00873
+G1 X114.694 Y101.544 E.00873
+G1 X114.665 Y101.801 E.00873
+G1 X114.631 Y102.056 E.00873
+G1 X114.593 Y102.311 E.00873
+G1 X114.551 Y102.566 E.00873
+G1 X114.504 Y102.819 E.00873
+G1 X114.452 Y103.072 E.00873
+G1 X114.396 Y103.324 E.00873
+G1 X114.336 Y103.574 E.00873
+G1 X114.272 Y103.824 E.00873
+G1 X114.203 Y104.073 E.00873
+G1 X114.129 Y104.32 E.00873
+G1 X114.052 Y104.566 E.00873
+G1 X113.97 Y104.81 E.00873
+G1 X113.884 Y105.053 E.00873
+G1 X113.794 Y105.295 E.00873
+G1 X113.699 Y105.535 E.00873
+G1 X113.6 Y105.773 E.00873
+G1 X113.498 Y106.01 E.00873
+G1 X113.391 Y106.244 E.00873
+G1 X113.28 Y106.477 E.00873
+G1 X113.165 Y106.708 E.00873
+G1 X113.046 Y106.936 E.00873
+G1 X112.923 Y107.163 E.00873
+G1 X112.796 Y107.388 E.00873
+G1 X112.665 Y107.61 E.00873
+G1 X112.53 Y107.83 E.00873
+G1 X112.391 Y108.047 E.00873
+G1 X112.249 Y108.262 E.00873
+G1 X112.103 Y108.475 E.00873
+G1 X111.953 Y108.685 E.00873
+G1 X111.8 Y108.892 E.00873
+G1 X111.643 Y109.096 E.00873
+G1 X111.482 Y109.298 E.00873
+G1 X111.318 Y109.497 E.00873
+G1 X111.151 Y109.693 E.00873
+G1 X110.98 Y109.886 E.00873
+G1 X110.806 Y110.077 E.00873
+G1 X110.628 Y110.264 E.00873
+G1 X110.448 Y110.448 E.00873
+G1 X110.264 Y110.628 E.00873
+G1 X110.077 Y110.806 E.00873
+G1 X109.886 Y110.98 E.00873
+G1 X109.693 Y111.151 E.00873
+G1 X109.497 Y111.318 E.00873
+G1 X109.298 Y111.482 E.00873
+G1 X109.096 Y111.643 E.00873
+G1 X108.892 Y111.8 E.00873
+G1 X108.685 Y111.953 E.00873
+G1 X108.475 Y112.103 E.00873
+G1 X108.262 Y112.249 E.00873
+G1 X108.047 Y112.391 E.00873
+G1 X107.83 Y112.53 E.00873
+G1 X107.61 Y112.665 E.00873
+G1 X107.388 Y112.796 E.00873
+G1 X107.163 Y112.923 E.00873
+G1 X106.936 Y113.046 E.00873
+G1 X106.708 Y113.165 E.00873
+G1 X106.477 Y113.28 E.00873
+G1 X106.244 Y113.391 E.00873
+G1 X106.01 Y113.498 E.00873
+G1 X105.773 Y113.6 E.00873
+G1 X105.535 Y113.699 E.00873
+G1 X105.295 Y113.794 E.00873
+G1 X105.053 Y113.884 E.00873
+G1 X104.81 Y113.97 E.00873
+G1 X104.566 Y114.052 E.00873
+G1 X104.32 Y114.129 E.00873
+G1 X104.073 Y114.203 E.00873
+G1 X103.824 Y114.272 E.00873
+G1 X103.574 Y114.336 E.00873
+G1 X103.324 Y114.396 E.00873
+G1 X103.072 Y114.452 E.00873
+G1 X102.819 Y114.504 E.00873
+G1 X102.566 Y114.551 E.00873
+G1 X102.311 Y114.593 E.00873
+G1 X102.056 Y114.631 E.00873
+G1 X101.801 Y114.665 E.00873
+G1 X101.544 Y114.694 E.00873
+G1 X101.288 Y114.719 E.00873
+G1 X101.031 Y114.739 E.00873
+G1 X100.773 Y114.755 E.00873
+G1 X100.516 Y114.766 E.00873
+G1 X100.258 Y114.773 E.00873
+G1 X100 Y114.775 E.00873
+G1 X99.742 Y114.773 E.00873
+G1 X99.484 Y114.766 E.00873
+G1 X99.227 Y114.755 E.00873
+G1 X98.969 Y114.739 E.00873
+G1 X98.712 Y114.719 E.00873
+G1 X98.456 Y114.694 E.00873
+G1 X98.199 Y114.665 E.00873
+G1 X97.944 Y114.631 E.00873
+G1 X97.689 Y114.593 E.00873
+G1 X97.434 Y114.551 E.00873
+G1 X97.181 Y114.504 E.00873
+G1 X96.928 Y114.452 E.00873
+G1 X96.676 Y114.396 E.00873
+G1 X96.426 Y114.336 E.00873
+G1 X96.176 Y114.272 E.00873
+G1 X95.927 Y114.203 E.00873
+G1 X95.68 Y114.129 E.00873
+G1 X95.434 Y114.052 E.00873
+G1 X95.19 Y113.97 E.00873
+G1 X94.947 Y113.884 E.00873
+G1 X94.705 Y113.794 E.00873
+G1 X94.465 Y113.699 E.00873
+G1 X94.227 Y113.6 E.00873
+G1 X93.99 Y113.498 E.00873
+G1 X93.756 Y113.391 E.00873
+G1 X93.523 Y113.28 E.00873
+G1 X93.292 Y113.165 E.00873
+G1 X93.064 Y113.046 E.00873
+G1 X92.837 Y112.923 E.00873
+G1 X92.612 Y112.796 E.00873
+G1 X92.39 Y112.665 E.00873
+G1 X92.17 Y112.53 E.00873
+G1 X91.953 Y112.391 E.00873
+G1 X91.738 Y112.249 E.00873
+G1 X91.525 Y112.103 E.00873
+G1 X91.315 Y111.953 E.00873
+G1 X91.108 Y111.8 E.00873
+G1 X90.904 Y111.643 E.00873
+G1 X90.702 Y111.482 E.00873
+G1 X90.503 Y111.318 E.00873
+G1 X90.307 Y111.151 E.00873
+G1 X90.114 Y110.98 E.00873
+G1 X89.923 Y110.806 E.00873
+G1 X89.736 Y110.628 E.00873
+G1 X89.552 Y110.448 E.00873
+G1 X89.372 Y110.264 E.00873
+G1 X89.194 Y110.077 E.00873
+G1 X89.02 Y109.886 E.00873
+G1 X88.849 Y109.693 E.00873
+G1 X88.682 Y109.497 E.00873
+G1 X88.518 Y109.298 E.00873
+G1 X88.357 Y109.096 E.00873
+G1 X88.2 Y108.892 E.00873
+G1 X88.047 Y108.685 E.00873
+G1 X87.897 Y108.475 E.00873
+G1 X87.751 Y108.262 E.00873
+G1 X87.609 Y108.047 E.00873
+G1 X87.47 Y107.83 E.00873
+G1 X87.335 Y107.61 E.00873
+G1 X87.204 Y107.388 E.00873
+G1 X87.077 Y107.163 E.00873
+G1 X86.954 Y106.936 E.00873
+G1 X86.835 Y106.708 E.00873
+G1 X86.72 Y106.477 E.00873
+G1 X86.609 Y106.244 E.00873
+G1 X86.502 Y106.01 E.00873
+G1 X86.4 Y105.773 E.00873
+G1 X86.301 Y105.535 E.00873
+G1 X86.206 Y105.295 E.00873
+G1 X86.116 Y105.053 E.00873
+G1 X86.03 Y104.81 E.00873
+G1 X85.948 Y104.566 E.00873
+G1 X85.871 Y104.32 E.00873
+G1 X85.797 Y104.073 E.00873
+G1 X85.728 Y103.824 E.00873
+G1 X85.664 Y103.574 E.00873
+G1 X85.604 Y103.324 E.00873
+G1 X85.548 Y103.072 E.00873
+G1 X85.496 Y102.819 E.00873
+G1 X85.449 Y102.566 E.00873
+G1 X85.407 Y102.311 E.00873
+G1 X85.369 Y102.056 E.00873
+G1 X85.335 Y101.801 E.00873
+G1 X85.306 Y101.544 E.00873
+G1 X85.281 Y101.288 E.00873
+G1 X85.261 Y101.031 E.00873
+G1 X85.245 Y100.773 E.00873
+G1 X85.234 Y100.516 E.00873
+G1 X85.227 Y100.258 E.00873
+G1 X85.225 Y100 E.00873
+G1 X85.227 Y99.742 E.00873
+G1 X85.234 Y99.484 E.00873
+G1 X85.245 Y99.227 E.00873
+G1 X85.261 Y98.969 E.00873
+G1 X85.281 Y98.712 E.00873
+G1 X85.306 Y98.456 E.00873
+G1 X85.335 Y98.199 E.00873
+G1 X85.369 Y97.944 E.00873
+G1 X85.407 Y97.689 E.00873
+G1 X85.449 Y97.434 E.00873
+G1 X85.496 Y97.181 E.00873
+G1 X85.548 Y96.928 E.00873
+G1 X85.604 Y96.676 E.00873
+G1 X85.664 Y96.426 E.00873
+G1 X85.728 Y96.176 E.00873
+G1 X85.797 Y95.927 E.00873
+G1 X85.871 Y95.68 E.00873
+G1 X85.948 Y95.434 E.00873
+G1 X86.03 Y95.19 E.00873
+G1 X86.116 Y94.947 E.00873
+G1 X86.206 Y94.705 E.00873
+G1 X86.301 Y94.465 E.00873
+G1 X86.4 Y94.227 E.00873
+G1 X86.502 Y93.99 E.00873
+G1 X86.609 Y93.756 E.00873
+G1 X86.72 Y93.523 E.00873
+G1 X86.835 Y93.292 E.00873
+G1 X86.954 Y93.064 E.00873
+G1 X87.077 Y92.837 E.00873
+G1 X87.204 Y92.612 E.00873
+G1 X87.335 Y92.39 E.00873
+G1 X87.47 Y92.17 E.00873
+G1 X87.609 Y91.953 E.00873
+G1 X87.751 Y91.738 E.00873
+G1 X87.897 Y91.525 E.00873
+G1 X88.047 Y91.315 E.00873
+G1 X88.2 Y91.108 E.00873
+G1 X88.357 Y90.904 E.00873
+G1 X88.518 Y90.702 E.00873
+G1 X88.682 Y90.503 E.00873
+G1 X88.849 Y90.307 E.00873
+G1 X89.02 Y90.114 E.00873
+G1 X89.194 Y89.923 E.00873
+G1 X89.372 Y89.736 E.00873
+G1 X89.552 Y89.552 E.00873
+G1 X89.736 Y89.372 E.00873
+G1 X89.923 Y89.194 E.00873
+G1 X90.114 Y89.02 E.00873
+G1 X90.307 Y88.849 E.00873
+G1 X90.503 Y88.682 E.00873
+G1 X90.702 Y88.518 E.00873
+G1 X90.904 Y88.357 E.00873
+G1 X91.108 Y88.2 E.00873
+G1 X91.315 Y88.047 E.00873
+G1 X91.525 Y87.897 E.00873
+G1 X91.738 Y87.751 E.00873
+G1 X91.953 Y87.609 E.00873
+G1 X92.17 Y87.47 E.00873
+G1 X92.39 Y87.335 E.00873
+G1 X92.612 Y87.204 E.00873
+G1 X92.837 Y87.077 E.00873
+G1 X93.064 Y86.954 E.00873
+G1 X93.292 Y86.835 E.00873
+G1 X93.523 Y86.72 E.00873
+G1 X93.756 Y86.609 E.00873
+G1 X93.99 Y86.502 E.00873
+G1 X94.227 Y86.4 E.00873
+G1 X94.465 Y86.301 E.00873
+G1 X94.705 Y86.206 E.00873
+G1 X94.947 Y86.116 E.00873
+G1 X95.19 Y86.03 E.00873
+G1 X95.434 Y85.948 E.00873
+G1 X95.68 Y85.871 E.00873
+G1 X95.927 Y85.797 E.00873
+G1 X96.176 Y85.728 E.00873
+G1 X96.426 Y85.664 E.00873
+G1 X96.676 Y85.604 E.00873
+G1 X96.928 Y85.548 E.00873
+G1 X97.181 Y85.496 E.00873
+G1 X97.434 Y85.449 E.00873
+G1 X97.689 Y85.407 E.00873
+G1 X97.944 Y85.369 E.00873
+G1 X98.199 Y85.335 E.00873
+G1 X98.456 Y85.306 E.00873
+G1 X98.712 Y85.281 E.00873
+G1 X98.969 Y85.261 E.00873
+G1 X99.227 Y85.245 E.00873
+G1 X99.484 Y85.234 E.00873
+G1 X99.742 Y85.227 E.00873
+G1 X100 Y85.225 E.00873
+G1 X100.258 Y85.227 E.00873
+G1 X100.516 Y85.234 E.00873
+G1 X100.773 Y85.245 E.00873
+G1 X101.031 Y85.261 E.00873
+G1 X101.288 Y85.281 E.00873
+G1 X101.544 Y85.306 E.00873
+G1 X101.801 Y85.335 E.00873
+G1 X102.056 Y85.369 E.00873
+G1 X102.311 Y85.407 E.00873
+G1 X102.566 Y85.449 E.00873
+G1 X102.819 Y85.496 E.00873
+G1 X103.072 Y85.548 E.00873
+G1 X103.324 Y85.604 E.00873
+G1 X103.574 Y85.664 E.00873
+G1 X103.824 Y85.728 E.00873
+G1 X104.073 Y85.797 E.00873
+G1 X104.32 Y85.871 E.00873
+G1 X104.566 Y85.948 E.00873
+G1 X104.81 Y86.03 E.00873
+G1 X105.053 Y86.116 E.00873
+G1 X105.295 Y86.206 E.00873
+G1 X105.535 Y86.301 E.00873
+G1 X105.773 Y86.4 E.00873
+G1 X106.01 Y86.502 E.00873
+G1 X106.244 Y86.609 E.00873
+G1 X106.477 Y86.72 E.00873
+G1 X106.708 Y86.835 E.00873
+G1 X106.936 Y86.954 E.00873
+G1 X107.163 Y87.077 E.00873
+G1 X107.388 Y87.204 E.00873
+G1 X107.61 Y87.335 E.00873
+G1 X107.83 Y87.47 E.00873
+G1 X108.047 Y87.609 E.00873
+G1 X108.262 Y87.751 E.00873
+G1 X108.475 Y87.897 E.00873
+G1 X108.685 Y88.047 E.00873
+G1 X108.892 Y88.2 E.00873
+G1 X109.096 Y88.357 E.00873
+G1 X109.298 Y88.518 E.00873
+G1 X109.497 Y88.682 E.00873
+G1 X109.693 Y88.849 E.00873
+G1 X109.886 Y89.02 E.00873
+G1 X110.077 Y89.194 E.00873
+G1 X110.264 Y89.372 E.00873
+G1 X110.448 Y89.552 E.00873
+G1 X110.628 Y89.736 E.00873
+G1 X110.806 Y89.923 E.00873
+G1 X110.98 Y90.114 E.00873
+G1 X111.151 Y90.307 E.00873
+G1 X111.318 Y90.503 E.00873
+G1 X111.482 Y90.702 E.00873
+G1 X111.643 Y90.904 E.00873
+G1 X111.8 Y91.108 E.00873
+G1 X111.953 Y91.315 E.00873
+G1 X112.103 Y91.525 E.00873
+G1 X112.249 Y91.738 E.00873
+G1 X112.391 Y91.953 E.00873
+G1 X112.53 Y92.17 E.00873
+G1 X112.665 Y92.39 E.00873
+G1 X112.796 Y92.612 E.00873
+G1 X112.923 Y92.837 E.00873
+G1 X113.046 Y93.064 E.00873
+G1 X113.165 Y93.292 E.00873
+G1 X113.28 Y93.523 E.00873
+G1 X113.391 Y93.756 E.00873
+G1 X113.498 Y93.99 E.00873
+G1 X113.6 Y94.227 E.00873
+G1 X113.699 Y94.465 E.00873
+G1 X113.794 Y94.705 E.00873
+G1 X113.884 Y94.947 E.00873
+G1 X113.97 Y95.19 E.00873
+G1 X114.052 Y95.434 E.00873
+G1 X114.129 Y95.68 E.00873
+G1 X114.203 Y95.927 E.00873
+G1 X114.272 Y96.176 E.00873
+G1 X114.336 Y96.426 E.00873
+G1 X114.396 Y96.676 E.00873
+G1 X114.452 Y96.928 E.00873
+G1 X114.504 Y97.181 E.00873
+G1 X114.551 Y97.434 E.00873
+G1 X114.593 Y97.689 E.00873
+G1 X114.631 Y97.944 E.00873
+G1 X114.665 Y98.199 E.00873
+G1 X114.694 Y98.456 E.00873
+G1 X114.719 Y98.712 E.00873
+G1 X114.739 Y98.969 E.00873
+G1 X114.755 Y99.227 E.00873
+G1 X114.766 Y99.484 E.00873
+G1 X114.773 Y99.742 E.00873
+G1 X114.775 Y100 E.00873
+;TYPE:Internal infill
+;WIDTH:0.45
+G1 E-.8 F2100
+G1 X106.081 Y87.395 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X112.587 Y93.9 E.31142
+G1 E-.8 F2100
+G1 X113.824 Y97.966 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X102.015 Y86.157 E.56529
+G1 E-.8 F2100
+G1 X99.081 Y86.051 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X113.965 Y100.936 E.71254
+G1 E-.8 F2100
+G1 X113.576 Y103.375 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X96.641 Y86.44 E.81071
+G1 E-.8 F2100
+G1 X94.52 Y87.147 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X112.869 Y105.497 E.87841
+G1 E-.8 F2100
+G1 X111.879 Y107.335 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X92.646 Y88.102 E.92072
+G1 E-.8 F2100
+G1 X91.02 Y89.304 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X110.713 Y108.997 E.94272
+G1 X109.298 Y110.411 E.0677
+G1 X89.57 Y90.683 E.94442
+G1 E-.8 F2100
+G1 X88.333 Y92.274 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X107.707 Y111.649 E.92749
+G1 E-.8 F2100
+G1 X105.904 Y112.674 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X87.343 Y94.112 E.88856
+G1 E-.8 F2100
+G1 X86.565 Y96.163 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X103.854 Y113.452 E.82763
+G1 E-.8 F2100
+G1 X101.485 Y113.911 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X86.105 Y98.532 E.73624
+G1 E-.8 F2100
+G1 X86.07 Y101.325 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X98.656 Y113.911 E.60253
+G1 E-.8 F2100
+G1 X94.98 Y113.063 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X86.954 Y105.037 E.3842
+;LAYER_CHANGE
+;Z:0.6
+;HEIGHT:0.2
+G1 E-.8 F2100
+G1 Z0.6 F720
+G1 E.8 F2100
+;TYPE:Perimeter
+;WIDTH:0.45
+G1 E-.8 F2100
+G1 X114.325 Y100 F10800
+G1 E.8 F2100
+G1 F2700
+G1 X114.323 Y100.25 E.00846
+G1 X114.316 Y100.5 E.00846
+G1 X114.305 Y100.75 E.00846
+G1 X114.29 Y100.999 E.00846
+G1 X114.27 Y101.249 E.00846
+G1 X114.247 Y101.497 E.00846
+G1 X114.218 Y101.746 E.00846
+G1 X114.186 Y101.994 E.00846
+G1 X114.149 Y102.241 E.00846
+G1 X114.107 Y102.488 E.00846
+G1 X114.062 Y102.733 E.00846
+G1 X114.012 Y102.978 E.00846
+G1 X113.958 Y103.222 E.00846
+G1 X113.899 Y103.466 E.00846
+G1 X113.837 Y103.708 E.00846
+G1 X113.77 Y103.949 E.00846
+G1 X113.699 Y104.188 E.00846
+G1 X113.624 Y104.427 E.00846
+G1 X113.545 Y104.664 E.00846
+G1 X113.461 Y104.899 E.00846
+G1 X113.374 Y105.134 E.00846
+G1 X113.282 Y105.366 E.00846
+G1 X113.186 Y105.597 E.00846
+G1 X113.087 Y105.827 E.00846
+G1 X112.983 Y106.054 E.00846
+G1 X112.875 Y106.28 E.00846
+G1 X112.764 Y106.503 E.00846
+G1 X112.648 Y106.725 E.00846
+G1 X112.529 Y106.945 E.00846
+G1 X112.406 Y107.162 E.00846
+G1 X112.279 Y107.378 E.00846
+G1 X112.148 Y107.591 E.00846
+G1 X112.014 Y107.802 E.00846
+G1 X111.876 Y108.01 E.00846
+G1 X111.734 Y108.216 E.00846
+G1 X111.589 Y108.42 E.00846
+G1 X111.44 Y108.621 E.00846
+G1 X111.288 Y108.819 E.00846
+G1 X111.133 Y109.015 E.00846
+G1 X110.974 Y109.208 E.00846
+G1 X110.811 Y109.398 E.00846
+G1 X110.646 Y109.585 E.00846
+G1 X110.477 Y109.77 E.00846
+G1 X110.305 Y109.951 E.00846
+G1 X110.129 Y110.129 E.00846
+G1 X109.951 Y110.305 E.00846
+G1 X109.77 Y110.477 E.00846
+G1 X109.585 Y110.646 E.00846
+G1 X109.398 Y110.811 E.00846
+G1 X109.208 Y110.974 E.00846
+G1 X109.015 Y111.133 E.00846
+G1 X108.819 Y111.288 E.00846
+G1 X108.621 Y111.44 E.00846
+G1 X108.42 Y111.589 E.00846
+G1 X108.216 Y111.734 E.00846
+G1 X108.01 Y111.876 E.00846
+G1 X107.802 Y112.014 E.00846
+G1 X107.591 Y112.148 E.00846
+G1 X107.378 Y112.279 E.00846
+G1 X107.162 Y112.406 E.00846
+G1 X106.945 Y112.529 E.00846
+G1 X106.725 Y112.648 E.00846
+G1 X106.503 Y112.764 E.00846
+G1 X106.28 Y112.875 E.00846
+G1 X106.054 Y112.983 E.00846
+G1 X105.827 Y113.087 E.00846
+G1 X105.597 Y113.186 E.00846
+G1 X105.366 Y113.282 E.00846
+G1 X105.134 Y113.374 E.00846
+G1 X104.899 Y113.461 E.00846
+G1 X104.664 Y113.545 E.00846
+G1 X104.427 Y113.624 E.00846
+G1 X104.188 Y113.699 E.00846
+G1 X103.949 Y113.77 E.00846
+G1 X103.708 Y113.837 E.00846
+G1 X103.466 Y113.899 E.00846
+G1 X103.222 Y113.958 E.00846
+G1 X102.978 Y114.012 E.00846
+G1 X102.733 Y114.062 E.00846
+G1 X102.488 Y114.107 E.00846
+G1 X102.241 Y114.149 E.00846
+G1 X101.994 Y114.186 E.00846
+G1 X101.746 Y114.218 E.00846
+G1 X101.497 Y114.247 E.00846
+G1 X101.249 Y114.27 E.00846
+G1 X100.999 Y114.29 E.00846
+G1 X100.75 Y114.305 E.00846
+G1 X100.5 Y114.316 E.00846
+G1 X100.25 Y114.323 E.00846
+G1 X100 Y114.325 E.00846
+G1 X99.75 Y114.323 E.00846
+G1 X99.5 Y114.316 E.00846
+G1 X99.25 Y114.305 E.00846
+G1 X99.001 Y114.29 E.00846
+G1 X98.751 Y114.27 E.00846
+G1 X98.503 Y114.247 E.00846
+G1 X98.254 Y114.218 E.00846
+G1 X98.006 Y114.186 E.00846
+G1 X97.759 Y114.149 E.00846
+G1 X97.512 Y114.107 E.00846
+G1 X97.267 Y114.062 E.00846
+G1 X97.022 Y114.012 E.00846
+G1 X96.778 Y113.958 E.00846
+G1 X96.534 Y113.899 E.00846
+G1 X96.292 Y113.837 E.00846
+G1 X96.051 Y113.77 E.00846
+G1 X95.812 Y113.699 E.00846
+G1 X95.573 Y113.624 E.00846
+G1 X95.336 Y113.545 E.00846
+G1 X95.101 Y113.461 E.00846
+G1 X94.866 Y113.374 E.00846
+G1 X94.634 Y113.282 E.00846
+G1 X94.403 Y113.186 E.00846
+G1 X94.173 Y113.087 E.00846
+G1 X93.946 Y112.983 E.00846
+G1 X93.72 Y112.875 E.00846
+G1 X93.497 Y112.764 E.00846
+G1 X93.275 Y112.648 E.00846
+G1 X93.055 Y112.529 E.00846
+G1 X92.838 Y112.406 E.00846
+G1 X92.622 Y112.279 E.00846
+G1 X92.409 Y112.148 E.00846
+G1 X92.198 Y112.014 E.00846
+G1 X91.99 Y111.876 E.00846
+G1 X91.784 Y111.734 E.00846
+G1 X91.58 Y111.589 E.00846
+G1 X91.379 Y111.44 E.00846
+G1 X91.181 Y111.288 E.00846
+G1 X90.985 Y111.133 E.00846
+G1 X90.792 Y110.974 E.00846
+G1 X90.602 Y110.811 E.00846
+G1 X90.415 Y110.646 E.00846
+G1 X90.23 Y110.477 E.00846
+G1 X90.049 Y110.305 E.00846
+G1 X89.871 Y110.129 E.00846
+G1 X89.695 Y109.951 E.00846
+G1 X89.523 Y109.77 E.00846
+G1 X89.354 Y109.585 E.00846
+G1 X89.189 Y109.398 E.00846
+G1 X89.026 Y109.208 E.00846
+G1 X88.867 Y109.015 E.00846
+G1 X88.712 Y108.819 E.00846
+G1 X88.56 Y108.621 E.00846
+G1 X88.411 Y108.42 E.00846
+G1 X88.266 Y108.216 E.00846
+G1 X88.124 Y108.01 E.00846
+G1 X87.986 Y107.802 E.00846
+G1 X87.852 Y107.591 E.00846
+G1 X87.721 Y107.378 E.00846
+G1 X87.594 Y107.162 E.00846
+G1 X87.471 Y106.945 E.00846
+G1 X87.352 Y106.725 E.00846
+G1 X87.236 Y106.503 E.00846
+G1 X87.125 Y106.28 E.00846
+G1 X87.017 Y106.054 E.00846
+G1 X86.913 Y105.827 E.00846
+G1 X86.814 Y105.597 E.00846
+G1 X86.718 Y105.366 E.00846
+G1 X86.626 Y105.134 E.00846
+G1 X86.539 Y104.899 E.00846
+G1 X86.455 Y104.664 E.00846
+G1 X86.376 Y104.427 E.00846
+G1 X86.301 Y104.188 E.00846
+G1 X86.23 Y103.949 E.00846
+G1 X86.163 Y103.708 E.00846
+G1 X86.101 Y103.466 E.00846
+G1 X86.042 Y103.222 E.00846
+G1 X85.988 Y102.978 E.00846
+G1 X85.938 Y102.733 E.00846
+G1 X85.893 Y102.488 E.00846
+G1 X85.851 Y102.241 E.00846
+G1 X85.814 Y101.994 E.00846
+G1 X85.782 Y101.746 E.00846
+G1 X85.753 Y101.497 E.00846
+G1 X85.73 Y101.249 E.00846
+G1 X85.71 Y100.999 E.00846
+G1 X85.695 Y100.75 E.00846
+G1 X85.684 Y100.5 E.00846
+G1 X85.677 Y100.25 E.00846
+G1 X85.675 Y100 E.00846
+G1 X85.677 Y99.75 E.00846
+G1 X85.684 Y99.5 E.00846
+G1 X85.695 Y99.25 E.00846
+G1 X85.71 Y99.001 E.00846
+G1 X85.73 Y98.751 E.00846
+G1 X85.753 Y98.503 E.00846
+G1 X85.782 Y98.254 E.00846
+G1 X85.814 Y98.006 E.00846
+G1 X85.851 Y97.759 E.00846
+G1 X85.893 Y97.512 E.00846
+G1 X85.938 Y97.267 E.00846
+G1 X85.988 Y97.022 E.00846
+G1 X86.042 Y96.778 E.00846
+G1 X86.101 Y96.534 E.00846
+G1 X86.163 Y96.292 E.00846
+G1 X86.23 Y96.051 E.00846
+G1 X86.301 Y95.812 E.00846
+G1 X86.376 Y95.573 E.00846
+G1 X86.455 Y95.336 E.00846
+G1 X86.539 Y95.101 E.00846
+G1 X86.626 Y94.866 E.00846
+G1 X86.718 Y94.634 E.00846
+G1 X86.814 Y94.403 E.00846
+G1 X86.913 Y94.173 E.00846
+G1 X87.017 Y93.946 E.00846
+G1 X87.125 Y93.72 E.00846
+G1 X87.236 Y93.497 E.00846
+G1 X87.352 Y93.275 E.00846
+G1 X87.471 Y93.055 E.00846
+G1 X87.594 Y92.838 E.00846
+G1 X87.721 Y92.622 E.00846
+G1 X87.852 Y92.409 E.00846
+G1 X87.986 Y92.198 E.00846
+G1 X88.124 Y91.99 E.00846
+G1 X88.266 Y91.784 E.00846
+G1 X88.411 Y91.58 E.00846
+G1 X88.56 Y91.379 E.00846
+G1 X88.712 Y91.181 E.00846
+G1 X88.867 Y90.985 E.00846
+G1 X89.026 Y90.792 E.00846
+G1 X89.189 Y90.602 E.00846
+G1 X89.354 Y90.415 E.00846
+G1 X89.523 Y90.23 E.00846
+G1 X89.695 Y90.049 E.00846
+G1 X89.871 Y89.871 E.00846
+G1 X90.049 Y89.695 E.00846
+G1 X90.23 Y89.523 E.00846
+G1 X90.415 Y89.354 E.00846
+G1 X90.602 Y89.189 E.00846
+G1 X90.792 Y89.026 E.00846
+G1 X90.985 Y88.867 E.00846
+G1 X91.181 Y88.712 E.00846
+G1 X91.379 Y88.56 E.00846
+G1 X91.58 Y88.411 E.00846
+G1 X91.784 Y88.266 E.00846
+G1 X91.99 Y88.124 E.00846
+G1 X92.198 Y87.986 E.00846
+G1 X92.409 Y87.852 E.00846
+G1 X92.622 Y87.721 E.00846
+G1 X92.837 Y87.594 E.00846
+G1 X93.055 Y87.471 E.00846
+G1 X93.275 Y87.352 E.00846
+G1 X93.497 Y87.236 E.00846
+G1 X93.72 Y87.125 E.00846
+G1 X93.946 Y87.017 E.00846
+G1 X94.173 Y86.913 E.00846
+G1 X94.403 Y86.814 E.00846
+G1 X94.634 Y86.718 E.00846
+G1 X94.866 Y86.626 E.00846
+G1 X95.101 Y86.539 E.00846
+G1 X95.336 Y86.455 E.00846
+G1 X95.573 Y86.376 E.00846
+G1 X95.812 Y86.301 E.00846
+G1 X96.051 Y86.23 E.00846
+G1 X96.292 Y86.163 E.00846
+G1 X96.534 Y86.101 E.00846
+G1 X96.778 Y86.042 E.00846
+G1 X97.022 Y85.988 E.00846
+G1 X97.267 Y85.938 E.00846
+G1 X97.512 Y85.893 E.00846
+G1 X97.759 Y85.851 E.00846
+G1 X98.006 Y85.814 E.00846
+G1 X98.254 Y85.782 E.00846
+G1 X98.503 Y85.753 E.00846
+G1 X98.751 Y85.73 E.00846
+G1 X99.001 Y85.71 E.00846
+G1 X99.25 Y85.695 E.00846
+G1 X99.5 Y85.684 E.00846
+G1 X99.75 Y85.677 E.00846
+G1 X100 Y85.675 E.00846
+G1 X100.25 Y85.677 E.00846
+G1 X100.5 Y85.684 E.00846
+G1 X100.75 Y85.695 E.00846
+G1 X100.999 Y85.71 E.00846
+G1 X101.249 Y85.73 E.00846
+G1 X101.497 Y85.753 E.00846
+G1 X101.746 Y85.782 E.00846
+G1 X101.994 Y85.814 E.00846
+G1 X102.241 Y85.851 E.00846
+G1 X102.488 Y85.893 E.00846
+G1 X102.733 Y85.938 E.00846
+G1 X102.978 Y85.988 E.00846
+G1 X103.222 Y86.042 E.00846
+G1 X103.466 Y86.101 E.00846
+G1 X103.708 Y86.163 E.00846
+G1 X103.949 Y86.23 E.00846
+G1 X104.188 Y86.301 E.00846
+G1 X104.427 Y86.376 E.00846
+G1 X104.664 Y86.455 E.00846
+G1 X104.899 Y86.539 E.00846
+G1 X105.134 Y86.626 E.00846
+G1 X105.366 Y86.718 E.00846
+G1 X105.597 Y86.814 E.00846
+G1 X105.827 Y86.913 E.00846
+G1 X106.054 Y87.017 E.00846
+G1 X106.28 Y87.125 E.00846
+G1 X106.503 Y87.236 E.00846
+G1 X106.725 Y87.352 E.00846
+G1 X106.945 Y87.471 E.00846
+G1 X107.162 Y87.594 E.00846
+G1 X107.378 Y87.721 E.00846
+G1 X107.591 Y87.852 E.00846
+G1 X107.802 Y87.986 E.00846
+G1 X108.01 Y88.124 E.00846
+G1 X108.216 Y88.266 E.00846
+G1 X108.42 Y88.411 E.00846
+G1 X108.621 Y88.56 E.00846
+G1 X108.819 Y88.712 E.00846
+G1 X109.015 Y88.867 E.00846
+G1 X109.208 Y89.026 E.00846
+G1 X109.398 Y89.189 E.00846
+G1 X109.585 Y89.354 E.00846
+G1 X109.77 Y89.523 E.00846
+G1 X109.951 Y89.695 E.00846
+G1 X110.129 Y89.871 E.00846
+G1 X110.305 Y90.049 E.00846
+G1 X110.477 Y90.23 E.00846
+G1 X110.646 Y90.415 E.00846
+G1 X110.811 Y90.602 E.00846
+G1 X110.974 Y90.792 E.00846
+G1 X111.133 Y90.985 E.00846
+G1 X111.288 Y91.181 E.00846
+G1 X111.44 Y91.379 E.00846
+G1 X111.589 Y91.58 E.00846
+G1 X111.734 Y91.784 E.00846
+G1 X111.876 Y91.99 E.00846
+G1 X112.014 Y92.198 E.00846
+G1 X112.148 Y92.409 E.00846
+G1 X112.279 Y92.622 E.00846
+G1 X112.406 Y92.837 E.00846
+G1 X112.529 Y93.055 E.00846
+G1 X112.648 Y93.275 E.00846
+G1 X112.764 Y93.497 E.00846
+G1 X112.875 Y93.72 E.00846
+G1 X112.983 Y93.946 E.00846
+G1 X113.087 Y94.173 E.00846
+G1 X113.186 Y94.403 E.00846
+G1 X113.282 Y94.634 E.00846
+G1 X113.374 Y94.866 E.00846
+G1 X113.461 Y95.101 E.00846
+G1 X113.545 Y95.336 E.00846
+G1 X113.624 Y95.573 E.00846
+G1 X113.699 Y95.812 E.00846
+G1 X113.77 Y96.051 E.00846
+G1 X113.837 Y96.292 E.00846
+G1 X113.899 Y96.534 E.00846
+G1 X113.958 Y96.778 E.00846
+G1 X114.012 Y97.022 E.00846
+G1 X114.062 Y97.267 E.00846
+G1 X114.107 Y97.512 E.00846
+G1 X114.149 Y97.759 E.00846
+G1 X114.186 Y98.006 E.00846
+G1 X114.218 Y98.254 E.00846
+G1 X114.247 Y98.503 E.00846
+G1 X114.27 Y98.751 E.00846
+G1 X114.29 Y99.001 E.00846
+G1 X114.305 Y99.25 E.00846
+G1 X114.316 Y99.5 E.00846
+G1 X114.323 Y99.75 E.00846
+G1 X114.325 Y100 E.00846
+;TYPE:External perimeter
+;WIDTH:0.45
+G1 F1800
+G1 X114.773 Y100.258 E.01749
+G1 X114.766 Y100.516 E.00873
+G1 X114.755 Y100.773 E.00873
+G1 X114.739 Y101.031 E.00873
+G1 X114.719 Y101.288 E.00873
+G1 X114.694 Y101.544 E.00873
+G1 X114.665 Y101.801 E.00873
+G1 X114.631 Y102.056 E.00873
+G1 X114.593 Y102.311 E.00873
+G1 X114.551 Y102.566 E.00873
+G1 X114.504 Y102.819 E.00873
+G1 X114.452 Y103.072 E.00873
+G1 X114.396 Y103.324 E.00873
+G1 X114.336 Y103.574 E.00873
+G1 X114.272 Y103.824 E.00873
+G1 X114.203 Y104.073 E.00873
+G1 X114.129 Y104.32 E.00873
+G1 X114.052 Y104.566 E.00873
+G1 X113.97 Y104.81 E.00873
+G1 X113.884 Y105.053 E.00873
+G1 X113.794 Y105.295 E.00873
+G1 X113.699 Y105.535 E.00873
+G1 X113.6 Y105.773 E.00873
+G1 X113.498 Y106.01 E.00873
+G1 X113.391 Y106.244 E.00873
+G1 X113.28 Y106.477 E.00873
+G1 X113.165 Y106.708 E.00873
+G1 X113.046 Y106.936 E.00873
+G1 X112.923 Y107.163 E.00873
+G1 X112.796 Y107.388 E.00873
+G1 X112.665 Y107.61 E.00873
+G1 X112.53 Y107.83 E.00873
+G1 X112.391 Y108.047 E.00873
+G1 X112.249 Y108.262 E.00873
+G1 X112.103 Y108.475 E.00873
+G1 X111.953 Y108.685 E.00873
+G1 X111.8 Y108.892 E.00873
+G1 X111.643 Y109.096 E.00873
+G1 X111.482 Y109.298 E.00873
+G1 X111.318 Y109.497 E.00873
+G1 X111.151 Y109.693 E.00873
+G1 X110.98 Y109.886 E.00873
+G1 X110.806 Y110.077 E.00873
+G1 X110.628 Y110.264 E.00873
+G1 X110.448 Y110.448 E.00873
+G1 X110.264 Y110.628 E.00873
+G1 X110.077 Y110.806 E.00873
+G1 X109.886 Y110.98 E.00873
+G1 X109.693 Y111.151 E.00873
+G1 X109.497 Y111.318 E.00873
+G1 X109.298 Y111.482 E.00873
+G1 X109.096 Y111.643 E.00873
+G1 X108.892 Y111.8 E.00873
+G1 X108.685 Y111.953 E.00873
+G1 X108.475 Y112.103 E.00873
+G1 X108.262 Y112.249 E.00873
+G1 X108.047 Y112.391 E.00873
+G1 X107.83 Y112.53 E.00873
+G1 X107.61 Y112.665 E.00873
+G1 X107.388 Y112.796 E.00873
+G1 X107.163 Y112.923 E.00873
+G1 X106.936 Y113.046 E.00873
+G1 X106.708 Y113.165 E.00873
+G1 X106.477 Y113.28 E.00873
+G1 X106.244 Y113.391 E.00873
+G1 X106.01 Y113.498 E.00873
+G1 X105.773 Y113.6 E.00873
+G1 X105.535 Y113.699 E.00873
+G1 X105.295 Y113.794 E.00873
+G1 X105.053 Y113.884 E.00873
+G1 X104.81 Y113.97 E.00873
+G1 X104.566 Y114.052 E.00873
+G1 X104.32 Y114.129 E.00873
+G1 X104.073 Y114.203 E.00873
+G1 X103.824 Y114.272 E.00873
+G1 X103.574 Y114.336 E.00873
+G1 X103.324 Y114.396 E.00873
+G1 X103.072 Y114.452 E.00873
+G1 X102.819 Y114.504 E.00873
+G1 X102.566 Y114.551 E.00873
+G1 X102.311 Y114.593 E.00873
+G1 X102.056 Y114.631 E.00873
+G1 X101.801 Y114.665 E.00873
+G1 X101.544 Y114.694 E.00873
+G1 X101.288 Y114.719 E.00873
+G1 X101.031 Y114.739 E.00873
+G1 X100.773 Y114.755 E.00873
+G1 X100.516 Y114.766 E.00873
+G1 X100.258 Y114.773 E.00873
+G1 X100 Y114.775 E.00873
+G1 X99.742 Y114.773 E.00873
+G1 X99.484 Y114.766 E.00873
+G1 X99.227 Y114.755 E.00873
+G1 X98.969 Y114.739 E.00873
+G1 X98.712 Y114.719 E.00873
+G1 X98.456 Y114.694 E.00873
+G1 X98.199 Y114.665 E.00873
+G1 X97.944 Y114.631 E.00873
+G1 X97.689 Y114.593 E.00873
+G1 X97.434 Y114.551 E.00873
+G1 X97.181 Y114.504 E.00873
+G1 X96.928 Y114.452 E.00873
+G1 X96.676 Y114.396 E.00873
+G1 X96.426 Y114.336 E.00873
+G1 X96.176 Y114.272 E.00873
+G1 X95.927 Y114.203 E.00873
+G1 X95.68 Y114.129 E.00873
+G1 X95.434 Y114.052 E.00873
+G1 X95.19 Y113.97 E.00873
+G1 X94.947 Y113.884 E.00873
+G1 X94.705 Y113.794 E.00873
+G1 X94.465 Y113.699 E.00873
+G1 X94.227 Y113.6 E.00873
+G1 X93.99 Y113.498 E.00873
+G1 X93.756 Y113.391 E.00873
+G1 X93.523 Y113.28 E.00873
+G1 X93.292 Y113.165 E.00873
+G1 X93.064 Y113.046 E.00873
+G1 X92.837 Y112.923 E.00873
+G1 X92.612 Y112.796 E.00873
+G1 X92.39 Y112.665 E.00873
+G1 X92.17 Y112.53 E.00873
+G1 X91.953 Y112.391 E.00873
+G1 X91.738 Y112.249 E.00873
+G1 X91.525 Y112.103 E.00873
+G1 X91.315 Y111.953 E.00873
+G1 X91.108 Y111.8 E.00873
+G1 X90.904 Y111.643 E.00873
+G1 X90.702 Y111.482 E.00873
+G1 X90.503 Y111.318 E.00873
+G1 X90.307 Y111.151 E.00873
+G1 X90.114 Y110.98 E.00873
+G1 X89.923 Y110.806 E.00873
+G1 X89.736 Y110.628 E.00873
+G1 X89.552 Y110.448 E.00873
+G1 X89.372 Y110.264 E.00873
+G1 X89.194 Y110.077 E.00873
+G1 X89.02 Y109.886 E.00873
+G1 X88.849 Y109.693 E.00873
+G1 X88.682 Y109.497 E.00873
+G1 X88.518 Y109.298 E.00873
+G1 X88.357 Y109.096 E.00873
+G1 X88.2 Y108.892 E.00873
+G1 X88.047 Y108.685 E.00873
+G1 X87.897 Y108.475 E.00873
+G1 X87.751 Y108.262 E.00873
+G1 X87.609 Y108.047 E.00873
+G1 X87.47 Y107.83 E.00873
+G1 X87.335 Y107.61 E.00873
+G1 X87.204 Y107.388 E.00873
+G1 X87.077 Y107.163 E.00873
+G1 X86.954 Y106.936 E.00873
+G1 X86.835 Y106.708 E.00873
+G1 X86.72 Y106.477 E.00873
+G1 X86.609 Y106.244 E.00873
+G1 X86.502 Y106.01 E.00873
+G1 X86.4 Y105.773 E.00873
+G1 X86.301 Y105.535 E.00873
+G1 X86.206 Y105.295 E.00873
+G1 X86.116 Y105.053 E.00873
+G1 X86.03 Y104.81 E.00873
+G1 X85.948 Y104.566 E.00873
+G1 X85.871 Y104.32 E.00873
+G1 X85.797 Y104.073 E.00873
+G1 X85.728 Y103.824 E.00873
+G1 X85.664 Y103.574 E.00873
+G1 X85.604 Y103.324 E.00873
+G1 X85.548 Y103.072 E.00873
+G1 X85.496 Y102.819 E.00873
+G1 X85.449 Y102.566 E.00873
+G1 X85.407 Y102.311 E.00873
+G1 X85.369 Y102.056 E.00873
+G1 X85.335 Y101.801 E.00873
+G1 X85.306 Y101.544 E.00873
+G1 X85.281 Y101.288 E.00873
+G1 X85.261 Y101.031 E.00873
+G1 X85.245 Y100.773 E.00873
+G1 X85.234 Y100.516 E.00873
+G1 X85.227 Y100.258 E.00873
+G1 X85.225 Y100 E.00873
+G1 X85.227 Y99.742 E.00873
+G1 X85.234 Y99.484 E.00873
+G1 X85.245 Y99.227 E.00873
+G1 X85.261 Y98.969 E.00873
+G1 X85.281 Y98.712 E.00873
+G1 X85.306 Y98.456 E.00873
+G1 X85.335 Y98.199 E.00873
+G1 X85.369 Y97.944 E.00873
+G1 X85.407 Y97.689 E.00873
+G1 X85.449 Y97.434 E.00873
+G1 X85.496 Y97.181 E.00873
+G1 X85.548 Y96.928 E.00873
+G1 X85.604 Y96.676 E.00873
+G1 X85.664 Y96.426 E.00873
+G1 X85.728 Y96.176 E.00873
+G1 X85.797 Y95.927 E.00873
+G1 X85.871 Y95.68 E.00873
+G1 X85.948 Y95.434 E.00873
+G1 X86.03 Y95.19 E.00873
+G1 X86.116 Y94.947 E.00873
+G1 X86.206 Y94.705 E.00873
+G1 X86.301 Y94.465 E.00873
+G1 X86.4 Y94.227 E.00873
+G1 X86.502 Y93.99 E.00873
+G1 X86.609 Y93.756 E.00873
+G1 X86.72 Y93.523 E.00873
+G1 X86.835 Y93.292 E.00873
+G1 X86.954 Y93.064 E.00873
+G1 X87.077 Y92.837 E.00873
+G1 X87.204 Y92.612 E.00873
+G1 X87.335 Y92.39 E.00873
+G1 X87.47 Y92.17 E.00873
+G1 X87.609 Y91.953 E.00873
+G1 X87.751 Y91.738 E.00873
+G1 X87.897 Y91.525 E.00873
+G1 X88.047 Y91.315 E.00873
+G1 X88.2 Y91.108 E.00873
+G1 X88.357 Y90.904 E.00873
+G1 X88.518 Y90.702 E.00873
+G1 X88.682 Y90.503 E.00873
+G1 X88.849 Y90.307 E.00873
+G1 X89.02 Y90.114 E.00873
+G1 X89.194 Y89.923 E.00873
+G1 X89.372 Y89.736 E.00873
+G1 X89.552 Y89.552 E.00873
+G1 X89.736 Y89.372 E.00873
+G1 X89.923 Y89.194 E.00873
+G1 X90.114 Y89.02 E.00873
+G1 X90.307 Y88.849 E.00873
+G1 X90.503 Y88.682 E.00873
+G1 X90.702 Y88.518 E.00873
+G1 X90.904 Y88.357 E.00873
+G1 X91.108 Y88.2 E.00873
+G1 X91.315 Y88.047 E.00873
+G1 X91.525 Y87.897 E.00873
+G1 X91.738 Y87.751 E.00873
+G1 X91.953 Y87.609 E.00873
+G1 X92.17 Y87.47 E.00873
+G1 X92.39 Y87.335 E.00873
+G1 X92.612 Y87.204 E.00873
+G1 X92.837 Y87.077 E.00873
+G1 X93.064 Y86.954 E.00873
+G1 X93.292 Y86.835 E.00873
+G1 X93.523 Y86.72 E.00873
+G1 X93.756 Y86.609 E.00873
+G1 X93.99 Y86.502 E.00873
+G1 X94.227 Y86.4 E.00873
+G1 X94.465 Y86.301 E.00873
+G1 X94.705 Y86.206 E.00873
+G1 X94.947 Y86.116 E.00873
+G1 X95.19 Y86.03 E.00873
+G1 X95.434 Y85.948 E.00873
+G1 X95.68 Y85.871 E.00873
+G1 X95.927 Y85.797 E.00873
+G1 X96.176 Y85.728 E.00873
+G1 X96.426 Y85.664 E.00873
+G1 X96.676 Y85.604 E.00873
+G1 X96.928 Y85.548 E.00873
+G1 X97.181 Y85.496 E.00873
+G1 X97.434 Y85.449 E.00873
+G1 X97.689 Y85.407 E.00873
+G1 X97.944 Y85.369 E.00873
+G1 X98.199 Y85.335 E.00873
+G1 X98.456 Y85.306 E.00873
+G1 X98.712 Y85.281 E.00873
+G1 X98.969 Y85.261 E.00873
+G1 X99.227 Y85.245 E.00873
+G1 X99.484 Y85.234 E.00873
+G1 X99.742 Y85.227 E.00873
+G1 X100 Y85.225 E.00873
+G1 X100.258 Y85.227 E.00873
+G1 X100.516 Y85.234 E.00873
+G1 X100.773 Y85.245 E.00873
+G1 X101.031 Y85.261 E.00873
+G1 X101.288 Y85.281 E.00873
+G1 X101.544 Y85.306 E.00873
+G1 X101.801 Y85.335 E.00873
+G1 X102.056 Y85.369 E.00873
+G1 X102.311 Y85.407 E.00873
+G1 X102.566 Y85.449 E.00873
+G1 X102.819 Y85.496 E.00873
+G1 X103.072 Y85.548 E.00873
+G1 X103.324 Y85.604 E.00873
+G1 X103.574 Y85.664 E.00873
+G1 X103.824 Y85.728 E.00873
+G1 X104.073 Y85.797 E.00873
+G1 X104.32 Y85.871 E.00873
+G1 X104.566 Y85.948 E.00873
+G1 X104.81 Y86.03 E.00873
+G1 X105.053 Y86.116 E.00873
+G1 X105.295 Y86.206 E.00873
+G1 X105.535 Y86.301 E.00873
+G1 X105.773 Y86.4 E.00873
+G1 X106.01 Y86.502 E.00873
+G1 X106.244 Y86.609 E.00873
+G1 X106.477 Y86.72 E.00873
+G1 X106.708 Y86.835 E.00873
+G1 X106.936 Y86.954 E.00873
+G1 X107.163 Y87.077 E.00873
+G1 X107.388 Y87.204 E.00873
+G1 X107.61 Y87.335 E.00873
+G1 X107.83 Y87.47 E.00873
+G1 X108.047 Y87.609 E.00873
+G1 X108.262 Y87.751 E.00873
+G1 X108.475 Y87.897 E.00873
+G1 X108.685 Y88.047 E.00873
+G1 X108.892 Y88.2 E.00873
+G1 X109.096 Y88.357 E.00873
+G1 X109.298 Y88.518 E.00873
+G1 X109.497 Y88.682 E.00873
+G1 X109.693 Y88.849 E.00873
+G1 X109.886 Y89.02 E.00873
+G1 X110.077 Y89.194 E.00873
+G1 X110.264 Y89.372 E.00873
+G1 X110.448 Y89.552 E.00873
+G1 X110.628 Y89.736 E.00873
+G1 X110.806 Y89.923 E.00873
+G1 X110.98 Y90.114 E.00873
+G1 X111.151 Y90.307 E.00873
+G1 X111.318 Y90.503 E.00873
+G1 X111.482 Y90.702 E.00873
+G1 X111.643 Y90.904 E.00873
+G1 X111.8 Y91.108 E.00873
+G1 X111.953 Y91.315 E.00873
+G1 X112.103 Y91.525 E.00873
+G1 X112.249 Y91.738 E.00873
+G1 X112.391 Y91.953 E.00873
+G1 X112.53 Y92.17 E.00873
+G1 X112.665 Y92.39 E.00873
+G1 X112.796 Y92.612 E.00873
+G1 X112.923 Y92.837 E.00873
+G1 X113.046 Y93.064 E.00873
+G1 X113.165 Y93.292 E.00873
+G1 X113.28 Y93.523 E.00873
+G1 X113.391 Y93.756 E.00873
+G1 X113.498 Y93.99 E.00873
+G1 X113.6 Y94.227 E.00873
+G1 X113.699 Y94.465 E.00873
+G1 X113.794 Y94.705 E.00873
+G1 X113.884 Y94.947 E.00873
+G1 X113.97 Y95.19 E.00873
+G1 X114.052 Y95.434 E.00873
+G1 X114.129 Y95.68 E.00873
+G1 X114.203 Y95.927 E.00873
+G1 X114.272 Y96.176 E.00873
+G1 X114.336 Y96.426 E.00873
+G1 X114.396 Y96.676 E.00873
+G1 X114.452 Y96.928 E.00873
+G1 X114.504 Y97.181 E.00873
+G1 X114.551 Y97.434 E.00873
+G1 X114.593 Y97.689 E.00873
+G1 X114.631 Y97.944 E.00873
+G1 X114.665 Y98.199 E.00873
+G1 X114.694 Y98.456 E.00873
+G1 X114.719 Y98.712 E.00873
+G1 X114.739 Y98.969 E.00873
+G1 X114.755 Y99.227 E.00873
+G1 X114.766 Y99.484 E.00873
+G1 X114.773 Y99.742 E.00873
+G1 X114.775 Y100 E.00873
+;TYPE:Internal infill
+;WIDTH:0.45
+G1 E-.8 F2100
+G1 X87.395 Y93.919 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X93.9 Y87.413 E.31142
+G1 E-.8 F2100
+G1 X97.966 Y86.176 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X86.157 Y97.985 E.56529
+G1 E-.8 F2100
+G1 X86.051 Y100.919 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X100.936 Y86.035 E.71254
+G1 E-.8 F2100
+G1 X103.375 Y86.424 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X86.44 Y103.359 E.81071
+G1 E-.8 F2100
+G1 X87.147 Y105.48 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X105.497 Y87.131 E.87841
+G1 E-.8 F2100
+G1 X107.335 Y88.121 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X88.102 Y107.354 E.92072
+G1 E-.8 F2100
+G1 X89.304 Y108.98 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X108.997 Y89.287 E.94272
+G1 X110.411 Y90.702 E.0677
+G1 X90.683 Y110.43 E.94442
+G1 E-.8 F2100
+G1 X92.274 Y111.667 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X111.649 Y92.293 E.92749
+G1 E-.8 F2100
+G1 X112.674 Y94.096 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X94.112 Y112.657 E.88856
+G1 E-.8 F2100
+G1 X96.163 Y113.435 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X113.452 Y96.146 E.82763
+G1 E-.8 F2100
+G1 X113.911 Y98.515 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X98.532 Y113.895 E.73624
+G1 E-.8 F2100
+G1 X101.325 Y113.93 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X113.911 Y101.344 E.60253
+G1 E-.8 F2100
+G1 X113.063 Y105.02 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X105.037 Y113.046 E.3842
+;LAYER_CHANGE
+;Z:0.8
+;HEIGHT:0.2
+G1 E-.8 F2100
+G1 Z0.8 F720
+G1 E.8 F2100
+;TYPE:Perimeter
+;WIDTH:0.45
+G1 E-.8 F2100
+G1 X114.325 Y100 F10800
+G1 E.8 F2100
+G1 F2700
+G1 X114.323 Y100.25 E.00846
+G1 X114.316 Y100.5 E.00846
+G1 X114.305 Y100.75 E.00846
+G1 X114.29 Y100.999 E.00846
+G1 X114.27 Y101.249 E.00846
+G1 X114.247 Y101.497 E.00846
+G1 X114.218 Y101.746 E.00846
+G1 X114.186 Y101.994 E.00846
+G1 X114.149 Y102.241 E.00846
+G1 X114.107 Y102.488 E.00846
+G1 X114.062 Y102.733 E.00846
+G1 X114.012 Y102.978 E.00846
+G1 X113.958 Y103.222 E.00846
+G1 X113.899 Y103.466 E.00846
+G1 X113.837 Y103.708 E.00846
+G1 X113.77 Y103.949 E.00846
+G1 X113.699 Y104.188 E.00846
+G1 X113.624 Y104.427 E.00846
+G1 X113.545 Y104.664 E.00846
+G1 X113.461 Y104.899 E.00846
+G1 X113.374 Y105.134 E.00846
+G1 X113.282 Y105.366 E.00846
+G1 X113.186 Y105.597 E.00846
+G1 X113.087 Y105.827 E.00846
+G1 X112.983 Y106.054 E.00846
+G1 X112.875 Y106.28 E.00846
+G1 X112.764 Y106.503 E.00846
+G1 X112.648 Y106.725 E.00846
+G1 X112.529 Y106.945 E.00846
+G1 X112.406 Y107.162 E.00846
+G1 X112.279 Y107.378 E.00846
+G1 X112.148 Y107.591 E.00846
+G1 X112.014 Y107.802 E.00846
+G1 X111.876 Y108.01 E.00846
+G1 X111.734 Y108.216 E.00846
+G1 X111.589 Y108.42 E.00846
+G1 X111.44 Y108.621 E.00846
+G1 X111.288 Y108.819 E.00846
+G1 X111.133 Y109.015 E.00846
+G1 X110.974 Y109.208 E.00846
+G1 X110.811 Y109.398 E.00846
+G1 X110.646 Y109.585 E.00846
+G1 X110.477 Y109.77 E.00846
+G1 X110.305 Y109.951 E.00846
+G1 X110.129 Y110.129 E.00846
+G1 X109.951 Y110.305 E.00846
+G1 X109.77 Y110.477 E.00846
+G1 X109.585 Y110.646 E.00846
+G1 X109.398 Y110.811 E.00846
+G1 X109.208 Y110.974 E.00846
+G1 X109.015 Y111.133 E.00846
+G1 X108.819 Y111.288 E.00846
+G1 X108.621 Y111.44 E.00846
+G1 X108.42 Y111.589 E.00846
+G1 X108.216 Y111.734 E.00846
+G1 X108.01 Y111.876 E.00846
+G1 X107.802 Y112.014 E.00846
+G1 X107.591 Y112.148 E.00846
+G1 X107.378 Y112.279 E.00846
+G1 X107.162 Y112.406 E.00846
+G1 X106.945 Y112.529 E.00846
+G1 X106.725 Y112.648 E.00846
+G1 X106.503 Y112.764 E.00846
+G1 X106.28 Y112.875 E.00846
+G1 X106.054 Y112.983 E.00846
+G1 X105.827 Y113.087 E.00846
+G1 X105.597 Y113.186 E.00846
+G1 X105.366 Y113.282 E.00846
+G1 X105.134 Y113.374 E.00846
+G1 X104.899 Y113.461 E.00846
+G1 X104.664 Y113.545 E.00846
+G1 X104.427 Y113.624 E.00846
+G1 X104.188 Y113.699 E.00846
+G1 X103.949 Y113.77 E.00846
+G1 X103.708 Y113.837 E.00846
+G1 X103.466 Y113.899 E.00846
+G1 X103.222 Y113.958 E.00846
+G1 X102.978 Y114.012 E.00846
+G1 X102.733 Y114.062 E.00846
+G1 X102.488 Y114.107 E.00846
+G1 X102.241 Y114.149 E.00846
+G1 X101.994 Y114.186 E.00846
+G1 X101.746 Y114.218 E.00846
+G1 X101.497 Y114.247 E.00846
+G1 X101.249 Y114.27 E.00846
+G1 X100.999 Y114.29 E.00846
+G1 X100.75 Y114.305 E.00846
+G1 X100.5 Y114.316 E.00846
+G1 X100.25 Y114.323 E.00846
+G1 X100 Y114.325 E.00846
+G1 X99.75 Y114.323 E.00846
+G1 X99.5 Y114.316 E.00846
+G1 X99.25 Y114.305 E.00846
+G1 X99.001 Y114.29 E.00846
+G1 X98.751 Y114.27 E.00846
+G1 X98.503 Y114.247 E.00846
+G1 X98.254 Y114.218 E.00846
+G1 X98.006 Y114.186 E.00846
+G1 X97.759 Y114.149 E.00846
+G1 X97.512 Y114.107 E.00846
+G1 X97.267 Y114.062 E.00846
+G1 X97.022 Y114.012 E.00846
+G1 X96.778 Y113.958 E.00846
+G1 X96.534 Y113.899 E.00846
+G1 X96.292 Y113.837 E.00846
+G1 X96.051 Y113.77 E.00846
+G1 X95.812 Y113.699 E.00846
+G1 X95.573 Y113.624 E.00846
+G1 X95.336 Y113.545 E.00846
+G1 X95.101 Y113.461 E.00846
+G1 X94.866 Y113.374 E.00846
+G1 X94.634 Y113.282 E.00846
+G1 X94.403 Y113.186 E.00846
+G1 X94.173 Y113.087 E.00846
+G1 X93.946 Y112.983 E.00846
+G1 X93.72 Y112.875 E.00846
+G1 X93.497 Y112.764 E.00846
+G1 X93.275 Y112.648 E.00846
+G1 X93.055 Y112.529 E.00846
+G1 X92.838 Y112.406 E.00846
+G1 X92.622 Y112.279 E.00846
+G1 X92.409 Y112.148 E.00846
+G1 X92.198 Y112.014 E.00846
+G1 X91.99 Y111.876 E.00846
+G1 X91.784 Y111.734 E.00846
+G1 X91.58 Y111.589 E.00846
+G1 X91.379 Y111.44 E.00846
+G1 X91.181 Y111.288 E.00846
+G1 X90.985 Y111.133 E.00846
+G1 X90.792 Y110.974 E.00846
+G1 X90.602 Y110.811 E.00846
+G1 X90.415 Y110.646 E.00846
+G1 X90.23 Y110.477 E.00846
+G1 X90.049 Y110.305 E.00846
+G1 X89.871 Y110.129 E.00846
+G1 X89.695 Y109.951 E.00846
+G1 X89.523 Y109.77 E.00846
+G1 X89.354 Y109.585 E.00846
+G1 X89.189 Y109.398 E.00846
+G1 X89.026 Y109.208 E.00846
+G1 X88.867 Y109.015 E.00846
+G1 X88.712 Y108.819 E.00846
+G1 X88.56 Y108.621 E.00846
+G1 X88.411 Y108.42 E.00846
+G1 X88.266 Y108.216 E.00846
+G1 X88.124 Y108.01 E.00846
+G1 X87.986 Y107.802 E.00846
+G1 X87.852 Y107.591 E.00846
+G1 X87.721 Y107.378 E.00846
+G1 X87.594 Y107.162 E.00846
+G1 X87.471 Y106.945 E.00846
+G1 X87.352 Y106.725 E.00846
+G1 X87.236 Y106.503 E.00846
+G1 X87.125 Y106.28 E.00846
+G1 X87.017 Y106.054 E.00846
+G1 X86.913 Y105.827 E.00846
+G1 X86.814 Y105.597 E.00846
+G1 X86.718 Y105.366 E.00846
+G1 X86.626 Y105.134 E.00846
+G1 X86.539 Y104.899 E.00846
+G1 X86.455 Y104.664 E.00846
+G1 X86.376 Y104.427 E.00846
+G1 X86.301 Y104.188 E.00846
+G1 X86.23 Y103.949 E.00846
+G1 X86.163 Y103.708 E.00846
+G1 X86.101 Y103.466 E.00846
+G1 X86.042 Y103.222 E.00846
+G1 X85.988 Y102.978 E.00846
+G1 X85.938 Y102.733 E.00846
+G1 X85.893 Y102.488 E.00846
+G1 X85.851 Y102.241 E.00846
+G1 X85.814 Y101.994 E.00846
+G1 X85.782 Y101.746 E.00846
+G1 X85.753 Y101.497 E.00846
+G1 X85.73 Y101.249 E.00846
+G1 X85.71 Y100.999 E.00846
+G1 X85.695 Y100.75 E.00846
+G1 X85.684 Y100.5 E.00846
+G1 X85.677 Y100.25 E.00846
+G1 X85.675 Y100 E.00846
+G1 X85.677 Y99.75 E.00846
+G1 X85.684 Y99.5 E.00846
+G1 X85.695 Y99.25 E.00846
+G1 X85.71 Y99.001 E.00846
+G1 X85.73 Y98.751 E.00846
+G1 X85.753 Y98.503 E.00846
+G1 X85.782 Y98.254 E.00846
+G1 X85.814 Y98.006 E.00846
+G1 X85.851 Y97.759 E.00846
+G1 X85.893 Y97.512 E.00846
+G1 X85.938 Y97.267 E.00846
+G1 X85.988 Y97.022 E.00846
+G1 X86.042 Y96.778 E.00846
+G1 X86.101 Y96.534 E.00846
+G1 X86.163 Y96.292 E.00846
+G1 X86.23 Y96.051 E.00846
+G1 X86.301 Y95.812 E.00846
+G1 X86.376 Y95.573 E.00846
+G1 X86.455 Y95.336 E.00846
+G1 X86.539 Y95.101 E.00846
+G1 X86.626 Y94.866 E.00846
+G1 X86.718 Y94.634 E.00846
+G1 X86.814 Y94.403 E.00846
+G1 X86.913 Y94.173 E.00846
+G1 X87.017 Y93.946 E.00846
+G1 X87.125 Y93.72 E.00846
+G1 X87.236 Y93.497 E.00846
+G1 X87.352 Y93.275 E.00846
+G1 X87.471 Y93.055 E.00846
+G1 X87.594 Y92.838 E.00846
+G1 X87.721 Y92.622 E.00846
+G1 X87.852 Y92.409 E.00846
+G1 X87.986 Y92.198 E.00846
+G1 X88.124 Y91.99 E.00846
+G1 X88.266 Y91.784 E.00846
+G1 X88.411 Y91.58 E.00846
+G1 X88.56 Y91.379 E.00846
+G1 X88.712 Y91.181 E.00846
+G1 X88.867 Y90.985 E.00846
+G1 X89.026 Y90.792 E.00846
+G1 X89.189 Y90.602 E.00846
+G1 X89.354 Y90.415 E.00846
+G1 X89.523 Y90.23 E.00846
+G1 X89.695 Y90.049 E.00846
+G1 X89.871 Y89.871 E.00846
+G1 X90.049 Y89.695 E.00846
+G1 X90.23 Y89.523 E.00846
+G1 X90.415 Y89.354 E.00846
+G1 X90.602 Y89.189 E.00846
+G1 X90.792 Y89.026 E.00846
+G1 X90.985 Y88.867 E.00846
+G1 X91.181 Y88.712 E.00846
+G1 X91.379 Y88.56 E.00846
+G1 X91.58 Y88.411 E.00846
+G1 X91.784 Y88.266 E.00846
+G1 X91.99 Y88.124 E.00846
+G1 X92.198 Y87.986 E.00846
+G1 X92.409 Y87.852 E.00846
+G1 X92.622 Y87.721 E.00846
+G1 X92.837 Y87.594 E.00846
+G1 X93.055 Y87.471 E.00846
+G1 X93.275 Y87.352 E.00846
+G1 X93.497 Y87.236 E.00846
+G1 X93.72 Y87.125 E.00846
+G1 X93.946 Y87.017 E.00846
+G1 X94.173 Y86.913 E.00846
+G1 X94.403 Y86.814 E.00846
+G1 X94.634 Y86.718 E.00846
+G1 X94.866 Y86.626 E.00846
+G1 X95.101 Y86.539 E.00846
+G1 X95.336 Y86.455 E.00846
+G1 X95.573 Y86.376 E.00846
+G1 X95.812 Y86.301 E.00846
+G1 X96.051 Y86.23 E.00846
+G1 X96.292 Y86.163 E.00846
+G1 X96.534 Y86.101 E.00846
+G1 X96.778 Y86.042 E.00846
+G1 X97.022 Y85.988 E.00846
+G1 X97.267 Y85.938 E.00846
+G1 X97.512 Y85.893 E.00846
+G1 X97.759 Y85.851 E.00846
+G1 X98.006 Y85.814 E.00846
+G1 X98.254 Y85.782 E.00846
+G1 X98.503 Y85.753 E.00846
+G1 X98.751 Y85.73 E.00846
+G1 X99.001 Y85.71 E.00846
+G1 X99.25 Y85.695 E.00846
+G1 X99.5 Y85.684 E.00846
+G1 X99.75 Y85.677 E.00846
+G1 X100 Y85.675 E.00846
+G1 X100.25 Y85.677 E.00846
+G1 X100.5 Y85.684 E.00846
+G1 X100.75 Y85.695 E.00846
+G1 X100.999 Y85.71 E.00846
+G1 X101.249 Y85.73 E.00846
+G1 X101.497 Y85.753 E.00846
+G1 X101.746 Y85.782 E.00846
+G1 X101.994 Y85.814 E.00846
+G1 X102.241 Y85.851 E.00846
+G1 X102.488 Y85.893 E.00846
+G1 X102.733 Y85.938 E.00846
+G1 X102.978 Y85.988 E.00846
+G1 X103.222 Y86.042 E.00846
+G1 X103.466 Y86.101 E.00846
+G1 X103.708 Y86.163 E.00846
+G1 X103.949 Y86.23 E.00846
+G1 X104.188 Y86.301 E.00846
+G1 X104.427 Y86.376 E.00846
+G1 X104.664 Y86.455 E.00846
+G1 X104.899 Y86.539 E.00846
+G1 X105.134 Y86.626 E.00846
+G1 X105.366 Y86.718 E.00846
+G1 X105.597 Y86.814 E.00846
+G1 X105.827 Y86.913 E.00846
+G1 X106.054 Y87.017 E.00846
+G1 X106.28 Y87.125 E.00846
+G1 X106.503 Y87.236 E.00846
+G1 X106.725 Y87.352 E.00846
+G1 X106.945 Y87.471 E.00846
+G1 X107.162 Y87.594 E.00846
+G1 X107.378 Y87.721 E.00846
+G1 X107.591 Y87.852 E.00846
+G1 X107.802 Y87.986 E.00846
+G1 X108.01 Y88.124 E.00846
+G1 X108.216 Y88.266 E.00846
+G1 X108.42 Y88.411 E.00846
+G1 X108.621 Y88.56 E.00846
+G1 X108.819 Y88.712 E.00846
+G1 X109.015 Y88.867 E.00846
+G1 X109.208 Y89.026 E.00846
+G1 X109.398 Y89.189 E.00846
+G1 X109.585 Y89.354 E.00846
+G1 X109.77 Y89.523 E.00846
+G1 X109.951 Y89.695 E.00846
+G1 X110.129 Y89.871 E.00846
+G1 X110.305 Y90.049 E.00846
+G1 X110.477 Y90.23 E.00846
+G1 X110.646 Y90.415 E.00846
+G1 X110.811 Y90.602 E.00846
+G1 X110.974 Y90.792 E.00846
+G1 X111.133 Y90.985 E.00846
+G1 X111.288 Y91.181 E.00846
+G1 X111.44 Y91.379 E.00846
+G1 X111.589 Y91.58 E.00846
+G1 X111.734 Y91.784 E.00846
+G1 X111.876 Y91.99 E.00846
+G1 X112.014 Y92.198 E.00846
+G1 X112.148 Y92.409 E.00846
+G1 X112.279 Y92.622 E.00846
+G1 X112.406 Y92.837 E.00846
+G1 X112.529 Y93.055 E.00846
+G1 X112.648 Y93.275 E.00846
+G1 X112.764 Y93.497 E.00846
+G1 X112.875 Y93.72 E.00846
+G1 X112.983 Y93.946 E.00846
+G1 X113.087 Y94.173 E.00846
+G1 X113.186 Y94.403 E.00846
+G1 X113.282 Y94.634 E.00846
+G1 X113.374 Y94.866 E.00846
+G1 X113.461 Y95.101 E.00846
+G1 X113.545 Y95.336 E.00846
+G1 X113.624 Y95.573 E.00846
+G1 X113.699 Y95.812 E.00846
+G1 X113.77 Y96.051 E.00846
+G1 X113.837 Y96.292 E.00846
+G1 X113.899 Y96.534 E.00846
+G1 X113.958 Y96.778 E.00846
+G1 X114.012 Y97.022 E.00846
+G1 X114.062 Y97.267 E.00846
+G1 X114.107 Y97.512 E.00846
+G1 X114.149 Y97.759 E.00846
+G1 X114.186 Y98.006 E.00846
+G1 X114.218 Y98.254 E.00846
+G1 X114.247 Y98.503 E.00846
+G1 X114.27 Y98.751 E.00846
+G1 X114.29 Y99.001 E.00846
+G1 X114.305 Y99.25 E.00846
+G1 X114.316 Y99.5 E.00846
+G1 X114.323 Y99.75 E.00846
+G1 X114.325 Y100 E.00846
+;TYPE:External perimeter
+;WIDTH:0.45
+G1 F1800
+G1 X114.773 Y100.258 E.01749
+G1 X114.766 Y100.516 E.00873
+G1 X114.755 Y100.773 E.00873
+G1 X114.739 Y101.031 E.00873
+G1 X114.719 Y101.288 E.00873
+G1 X114.694 Y101.544 E.00873
+G1 X114.665 Y101.801 E.00873
+G1 X114.631 Y102.056 E.00873
+G1 X114.593 Y102.311 E.00873
+G1 X114.551 Y102.566 E.00873
+G1 X114.504 Y102.819 E.00873
+G1 X114.452 Y103.072 E.00873
+G1 X114.396 Y103.324 E.00873
+G1 X114.336 Y103.574 E.00873
+G1 X114.272 Y103.824 E.00873
+G1 X114.203 Y104.073 E.00873
+G1 X114.129 Y104.32 E.00873
+G1 X114.052 Y104.566 E.00873
+G1 X113.97 Y104.81 E.00873
+G1 X113.884 Y105.053 E.00873
+G1 X113.794 Y105.295 E.00873
+G1 X113.699 Y105.535 E.00873
+G1 X113.6 Y105.773 E.00873
+G1 X113.498 Y106.01 E.00873
+G1 X113.391 Y106.244 E.00873
+G1 X113.28 Y106.477 E.00873
+G1 X113.165 Y106.708 E.00873
+G1 X113.046 Y106.936 E.00873
+G1 X112.923 Y107.163 E.00873
+G1 X112.796 Y107.388 E.00873
+G1 X112.665 Y107.61 E.00873
+G1 X112.53 Y107.83 E.00873
+G1 X112.391 Y108.047 E.00873
+G1 X112.249 Y108.262 E.00873
+G1 X112.103 Y108.475 E.00873
+G1 X111.953 Y108.685 E.00873
+G1 X111.8 Y108.892 E.00873
+G1 X111.643 Y109.096 E.00873
+G1 X111.482 Y109.298 E.00873
+G1 X111.318 Y109.497 E.00873
+G1 X111.151 Y109.693 E.00873
+G1 X110.98 Y109.886 E.00873
+G1 X110.806 Y110.077 E.00873
+G1 X110.628 Y110.264 E.00873
+G1 X110.448 Y110.448 E.00873
+G1 X110.264 Y110.628 E.00873
+G1 X110.077 Y110.806 E.00873
+G1 X109.886 Y110.98 E.00873
+G1 X109.693 Y111.151 E.00873
+G1 X109.497 Y111.318 E.00873
+G1 X109.298 Y111.482 E.00873
+G1 X109.096 Y111.643 E.00873
+G1 X108.892 Y111.8 E.00873
+G1 X108.685 Y111.953 E.00873
+G1 X108.475 Y112.103 E.00873
+G1 X108.262 Y112.249 E.00873
+G1 X108.047 Y112.391 E.00873
+G1 X107.83 Y112.53 E.00873
+G1 X107.61 Y112.665 E.00873
+G1 X107.388 Y112.796 E.00873
+G1 X107.163 Y112.923 E.00873
+G1 X106.936 Y113.046 E.00873
+G1 X106.708 Y113.165 E.00873
+G1 X106.477 Y113.28 E.00873
+G1 X106.244 Y113.391 E.00873
+G1 X106.01 Y113.498 E.00873
+G1 X105.773 Y113.6 E.00873
+G1 X105.535 Y113.699 E.00873
+G1 X105.295 Y113.794 E.00873
+G1 X105.053 Y113.884 E.00873
+G1 X104.81 Y113.97 E.00873
+G1 X104.566 Y114.052 E.00873
+G1 X104.32 Y114.129 E.00873
+G1 X104.073 Y114.203 E.00873
+G1 X103.824 Y114.272 E.00873
+G1 X103.574 Y114.336 E.00873
+G1 X103.324 Y114.396 E.00873
+G1 X103.072 Y114.452 E.00873
+G1 X102.819 Y114.504 E.00873
+G1 X102.566 Y114.551 E.00873
+G1 X102.311 Y114.593 E.00873
+G1 X102.056 Y114.631 E.00873
+G1 X101.801 Y114.665 E.00873
+G1 X101.544 Y114.694 E.00873
+G1 X101.288 Y114.719 E.00873
+G1 X101.031 Y114.739 E.00873
+G1 X100.773 Y114.755 E.00873
+G1 X100.516 Y114.766 E.00873
+G1 X100.258 Y114.773 E.00873
+G1 X100 Y114.775 E.00873
+G1 X99.742 Y114.773 E.00873
+G1 X99.484 Y114.766 E.00873
+G1 X99.227 Y114.755 E.00873
+G1 X98.969 Y114.739 E.00873
+G1 X98.712 Y114.719 E.00873
+G1 X98.456 Y114.694 E.00873
+G1 X98.199 Y114.665 E.00873
+G1 X97.944 Y114.631 E.00873
+G1 X97.689 Y114.593 E.00873
+G1 X97.434 Y114.551 E.00873
+G1 X97.181 Y114.504 E.00873
+G1 X96.928 Y114.452 E.00873
+G1 X96.676 Y114.396 E.00873
+G1 X96.426 Y114.336 E.00873
+G1 X96.176 Y114.272 E.00873
+G1 X95.927 Y114.203 E.00873
+G1 X95.68 Y114.129 E.00873
+G1 X95.434 Y114.052 E.00873
+G1 X95.19 Y113.97 E.00873
+G1 X94.947 Y113.884 E.00873
+G1 X94.705 Y113.794 E.00873
+G1 X94.465 Y113.699 E.00873
+G1 X94.227 Y113.6 E.00873
+G1 X93.99 Y113.498 E.00873
+G1 X93.756 Y113.391 E.00873
+G1 X93.523 Y113.28 E.00873
+G1 X93.292 Y113.165 E.00873
+G1 X93.064 Y113.046 E.00873
+G1 X92.837 Y112.923 E.00873
+G1 X92.612 Y112.796 E.00873
+G1 X92.39 Y112.665 E.00873
+G1 X92.17 Y112.53 E.00873
+G1 X91.953 Y112.391 E.00873
+G1 X91.738 Y112.249 E.00873
+G1 X91.525 Y112.103 E.00873
+G1 X91.315 Y111.953 E.00873
+G1 X91.108 Y111.8 E.00873
+G1 X90.904 Y111.643 E.00873
+G1 X90.702 Y111.482 E.00873
+G1 X90.503 Y111.318 E.00873
+G1 X90.307 Y111.151 E.00873
+G1 X90.114 Y110.98 E.00873
+G1 X89.923 Y110.806 E.00873
+G1 X89.736 Y110.628 E.00873
+G1 X89.552 Y110.448 E.00873
+G1 X89.372 Y110.264 E.00873
+G1 X89.194 Y110.077 E.00873
+G1 X89.02 Y109.886 E.00873
+G1 X88.849 Y109.693 E.00873
+G1 X88.682 Y109.497 E.00873
+G1 X88.518 Y109.298 E.00873
+G1 X88.357 Y109.096 E.00873
+G1 X88.2 Y108.892 E.00873
+G1 X88.047 Y108.685 E.00873
+G1 X87.897 Y108.475 E.00873
+G1 X87.751 Y108.262 E.00873
+G1 X87.609 Y108.047 E.00873
+G1 X87.47 Y107.83 E.00873
+G1 X87.335 Y107.61 E.00873
+G1 X87.204 Y107.388 E.00873
+G1 X87.077 Y107.163 E.00873
+G1 X86.954 Y106.936 E.00873
+G1 X86.835 Y106.708 E.00873
+G1 X86.72 Y106.477 E.00873
+G1 X86.609 Y106.244 E.00873
+G1 X86.502 Y106.01 E.00873
+G1 X86.4 Y105.773 E.00873
+G1 X86.301 Y105.535 E.00873
+G1 X86.206 Y105.295 E.00873
+G1 X86.116 Y105.053 E.00873
+G1 X86.03 Y104.81 E.00873
+G1 X85.948 Y104.566 E.00873
+G1 X85.871 Y104.32 E.00873
+G1 X85.797 Y104.073 E.00873
+G1 X85.728 Y103.824 E.00873
+G1 X85.664 Y103.574 E.00873
+G1 X85.604 Y103.324 E.00873
+G1 X85.548 Y103.072 E.00873
+G1 X85.496 Y102.819 E.00873
+G1 X85.449 Y102.566 E.00873
+G1 X85.407 Y102.311 E.00873
+G1 X85.369 Y102.056 E.00873
+G1 X85.335 Y101.801 E.00873
+G1 X85.306 Y101.544 E.00873
+G1 X85.281 Y101.288 E.00873
+G1 X85.261 Y101.031 E.00873
+G1 X85.245 Y100.773 E.00873
+G1 X85.234 Y100.516 E.00873
+G1 X85.227 Y100.258 E.00873
+G1 X85.225 Y100 E.00873
+G1 X85.227 Y99.742 E.00873
+G1 X85.234 Y99.484 E.00873
+G1 X85.245 Y99.227 E.00873
+G1 X85.261 Y98.969 E.00873
+G1 X85.281 Y98.712 E.00873
+G1 X85.306 Y98.456 E.00873
+G1 X85.335 Y98.199 E.00873
+G1 X85.369 Y97.944 E.00873
+G1 X85.407 Y97.689 E.00873
+G1 X85.449 Y97.434 E.00873
+G1 X85.496 Y97.181 E.00873
+G1 X85.548 Y96.928 E.00873
+G1 X85.604 Y96.676 E.00873
+G1 X85.664 Y96.426 E.00873
+G1 X85.728 Y96.176 E.00873
+G1 X85.797 Y95.927 E.00873
+G1 X85.871 Y95.68 E.00873
+G1 X85.948 Y95.434 E.00873
+G1 X86.03 Y95.19 E.00873
+G1 X86.116 Y94.947 E.00873
+G1 X86.206 Y94.705 E.00873
+G1 X86.301 Y94.465 E.00873
+G1 X86.4 Y94.227 E.00873
+G1 X86.502 Y93.99 E.00873
+G1 X86.609 Y93.756 E.00873
+G1 X86.72 Y93.523 E.00873
+G1 X86.835 Y93.292 E.00873
+G1 X86.954 Y93.064 E.00873
+G1 X87.077 Y92.837 E.00873
+G1 X87.204 Y92.612 E.00873
+G1 X87.335 Y92.39 E.00873
+G1 X87.47 Y92.17 E.00873
+G1 X87.609 Y91.953 E.00873
+G1 X87.751 Y91.738 E.00873
+G1 X87.897 Y91.525 E.00873
+G1 X88.047 Y91.315 E.00873
+G1 X88.2 Y91.108 E.00873
+G1 X88.357 Y90.904 E.00873
+G1 X88.518 Y90.702 E.00873
+G1 X88.682 Y90.503 E.00873
+G1 X88.849 Y90.307 E.00873
+G1 X89.02 Y90.114 E.00873
+G1 X89.194 Y89.923 E.00873
+G1 X89.372 Y89.736 E.00873
+G1 X89.552 Y89.552 E.00873
+G1 X89.736 Y89.372 E.00873
+G1 X89.923 Y89.194 E.00873
+G1 X90.114 Y89.02 E.00873
+G1 X90.307 Y88.849 E.00873
+G1 X90.503 Y88.682 E.00873
+G1 X90.702 Y88.518 E.00873
+G1 X90.904 Y88.357 E.00873
+G1 X91.108 Y88.2 E.00873
+G1 X91.315 Y88.047 E.00873
+G1 X91.525 Y87.897 E.00873
+G1 X91.738 Y87.751 E.00873
+G1 X91.953 Y87.609 E.00873
+G1 X92.17 Y87.47 E.00873
+G1 X92.39 Y87.335 E.00873
+G1 X92.612 Y87.204 E.00873
+G1 X92.837 Y87.077 E.00873
+G1 X93.064 Y86.954 E.00873
+G1 X93.292 Y86.835 E.00873
+G1 X93.523 Y86.72 E.00873
+G1 X93.756 Y86.609 E.00873
+G1 X93.99 Y86.502 E.00873
+G1 X94.227 Y86.4 E.00873
+G1 X94.465 Y86.301 E.00873
+G1 X94.705 Y86.206 E.00873
+G1 X94.947 Y86.116 E.00873
+G1 X95.19 Y86.03 E.00873
+G1 X95.434 Y85.948 E.00873
+G1 X95.68 Y85.871 E.00873
+G1 X95.927 Y85.797 E.00873
+G1 X96.176 Y85.728 E.00873
+G1 X96.426 Y85.664 E.00873
+G1 X96.676 Y85.604 E.00873
+G1 X96.928 Y85.548 E.00873
+G1 X97.181 Y85.496 E.00873
+G1 X97.434 Y85.449 E.00873
+G1 X97.689 Y85.407 E.00873
+G1 X97.944 Y85.369 E.00873
+G1 X98.199 Y85.335 E.00873
+G1 X98.456 Y85.306 E.00873
+G1 X98.712 Y85.281 E.00873
+G1 X98.969 Y85.261 E.00873
+G1 X99.227 Y85.245 E.00873
+G1 X99.484 Y85.234 E.00873
+G1 X99.742 Y85.227 E.00873
+G1 X100 Y85.225 E.00873
+G1 X100.258 Y85.227 E.00873
+G1 X100.516 Y85.234 E.00873
+G1 X100.773 Y85.245 E.00873
+G1 X101.031 Y85.261 E.00873
+G1 X101.288 Y85.281 E.00873
+G1 X101.544 Y85.306 E.00873
+G1 X101.801 Y85.335 E.00873
+G1 X102.056 Y85.369 E.00873
+G1 X102.311 Y85.407 E.00873
+G1 X102.566 Y85.449 E.00873
+G1 X102.819 Y85.496 E.00873
+G1 X103.072 Y85.548 E.00873
+G1 X103.324 Y85.604 E.00873
+G1 X103.574 Y85.664 E.00873
+G1 X103.824 Y85.728 E.00873
+G1 X104.073 Y85.797 E.00873
+G1 X104.32 Y85.871 E.00873
+G1 X104.566 Y85.948 E.00873
+G1 X104.81 Y86.03 E.00873
+G1 X105.053 Y86.116 E.00873
+G1 X105.295 Y86.206 E.00873
+G1 X105.535 Y86.301 E.00873
+G1 X105.773 Y86.4 E.00873
+G1 X106.01 Y86.502 E.00873
+G1 X106.244 Y86.609 E.00873
+G1 X106.477 Y86.72 E.00873
+G1 X106.708 Y86.835 E.00873
+G1 X106.936 Y86.954 E.00873
+G1 X107.163 Y87.077 E.00873
+G1 X107.388 Y87.204 E.00873
+G1 X107.61 Y87.335 E.00873
+G1 X107.83 Y87.47 E.00873
+G1 X108.047 Y87.609 E.00873
+G1 X108.262 Y87.751 E.00873
+G1 X108.475 Y87.897 E.00873
+G1 X108.685 Y88.047 E.00873
+G1 X108.892 Y88.2 E.00873
+G1 X109.096 Y88.357 E.00873
+G1 X109.298 Y88.518 E.00873
+G1 X109.497 Y88.682 E.00873
+G1 X109.693 Y88.849 E.00873
+G1 X109.886 Y89.02 E.00873
+G1 X110.077 Y89.194 E.00873
+G1 X110.264 Y89.372 E.00873
+G1 X110.448 Y89.552 E.00873
+G1 X110.628 Y89.736 E.00873
+G1 X110.806 Y89.923 E.00873
+G1 X110.98 Y90.114 E.00873
+G1 X111.151 Y90.307 E.00873
+G1 X111.318 Y90.503 E.00873
+G1 X111.482 Y90.702 E.00873
+G1 X111.643 Y90.904 E.00873
+G1 X111.8 Y91.108 E.00873
+G1 X111.953 Y91.315 E.00873
+G1 X112.103 Y91.525 E.00873
+G1 X112.249 Y91.738 E.00873
+G1 X112.391 Y91.953 E.00873
+G1 X112.53 Y92.17 E.00873
+G1 X112.665 Y92.39 E.00873
+G1 X112.796 Y92.612 E.00873
+G1 X112.923 Y92.837 E.00873
+G1 X113.046 Y93.064 E.00873
+G1 X113.165 Y93.292 E.00873
+G1 X113.28 Y93.523 E.00873
+G1 X113.391 Y93.756 E.00873
+G1 X113.498 Y93.99 E.00873
+G1 X113.6 Y94.227 E.00873
+G1 X113.699 Y94.465 E.00873
+G1 X113.794 Y94.705 E.00873
+G1 X113.884 Y94.947 E.00873
+G1 X113.97 Y95.19 E.00873
+G1 X114.052 Y95.434 E.00873
+G1 X114.129 Y95.68 E.00873
+G1 X114.203 Y95.927 E.00873
+G1 X114.272 Y96.176 E.00873
+G1 X114.336 Y96.426 E.00873
+G1 X114.396 Y96.676 E.00873
+G1 X114.452 Y96.928 E.00873
+G1 X114.504 Y97.181 E.00873
+G1 X114.551 Y97.434 E.00873
+G1 X114.593 Y97.689 E.00873
+G1 X114.631 Y97.944 E.00873
+G1 X114.665 Y98.199 E.00873
+G1 X114.694 Y98.456 E.00873
+G1 X114.719 Y98.712 E.00873
+G1 X114.739 Y98.969 E.00873
+G1 X114.755 Y99.227 E.00873
+G1 X114.766 Y99.484 E.00873
+G1 X114.773 Y99.742 E.00873
+G1 X114.775 Y100 E.00873
+;TYPE:Internal infill
+;WIDTH:0.45
+G1 E-.8 F2100
+G1 X106.081 Y87.395 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X112.587 Y93.9 E.31142
+G1 E-.8 F2100
+G1 X113.824 Y97.966 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X102.015 Y86.157 E.56529
+G1 E-.8 F2100
+G1 X99.081 Y86.051 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X113.965 Y100.936 E.71254
+G1 E-.8 F2100
+G1 X113.576 Y103.375 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X96.641 Y86.44 E.81071
+G1 E-.8 F2100
+G1 X94.52 Y87.147 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X112.869 Y105.497 E.87841
+G1 E-.8 F2100
+G1 X111.879 Y107.335 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X92.646 Y88.102 E.92072
+G1 E-.8 F2100
+G1 X91.02 Y89.304 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X110.713 Y108.997 E.94272
+G1 X109.298 Y110.411 E.0677
+G1 X89.57 Y90.683 E.94442
+G1 E-.8 F2100
+G1 X88.333 Y92.274 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X107.707 Y111.649 E.92749
+G1 E-.8 F2100
+G1 X105.904 Y112.674 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X87.343 Y94.112 E.88856
+G1 E-.8 F2100
+G1 X86.565 Y96.163 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X103.854 Y113.452 E.82763
+G1 E-.8 F2100
+G1 X101.485 Y113.911 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X86.105 Y98.532 E.73624
+G1 E-.8 F2100
+G1 X86.07 Y101.325 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X98.656 Y113.911 E.60253
+G1 E-.8 F2100
+G1 X94.98 Y113.063 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X86.954 Y105.037 E.3842
+;LAYER_CHANGE
+;Z:1
+;HEIGHT:0.2
+G1 E-.8 F2100
+G1 Z1 F720
+G1 E.8 F2100
+;TYPE:Perimeter
+;WIDTH:0.45
+G1 E-.8 F2100
+G1 X114.325 Y100 F10800
+G1 E.8 F2100
+G1 F2700
+G1 X114.323 Y100.25 E.00846
+G1 X114.316 Y100.5 E.00846
+G1 X114.305 Y100.75 E.00846
+G1 X114.29 Y100.999 E.00846
+G1 X114.27 Y101.249 E.00846
+G1 X114.247 Y101.497 E.00846
+G1 X114.218 Y101.746 E.00846
+G1 X114.186 Y101.994 E.00846
+G1 X114.149 Y102.241 E.00846
+G1 X114.107 Y102.488 E.00846
+G1 X114.062 Y102.733 E.00846
+G1 X114.012 Y102.978 E.00846
+G1 X113.958 Y103.222 E.00846
+G1 X113.899 Y103.466 E.00846
+G1 X113.837 Y103.708 E.00846
+G1 X113.77 Y103.949 E.00846
+G1 X113.699 Y104.188 E.00846
+G1 X113.624 Y104.427 E.00846
+G1 X113.545 Y104.664 E.00846
+G1 X113.461 Y104.899 E.00846
+G1 X113.374 Y105.134 E.00846
+G1 X113.282 Y105.366 E.00846
+G1 X113.186 Y105.597 E.00846
+G1 X113.087 Y105.827 E.00846
+G1 X112.983 Y106.054 E.00846
+G1 X112.875 Y106.28 E.00846
+G1 X112.764 Y106.503 E.00846
+G1 X112.648 Y106.725 E.00846
+G1 X112.529 Y106.945 E.00846
+G1 X112.406 Y107.162 E.00846
+G1 X112.279 Y107.378 E.00846
+G1 X112.148 Y107.591 E.00846
+G1 X112.014 Y107.802 E.00846
+G1 X111.876 Y108.01 E.00846
+G1 X111.734 Y108.216 E.00846
+G1 X111.589 Y108.42 E.00846
+G1 X111.44 Y108.621 E.00846
+G1 X111.288 Y108.819 E.00846
+G1 X111.133 Y109.015 E.00846
+G1 X110.974 Y109.208 E.00846
+G1 X110.811 Y109.398 E.00846
+G1 X110.646 Y109.585 E.00846
+G1 X110.477 Y109.77 E.00846
+G1 X110.305 Y109.951 E.00846
+G1 X110.129 Y110.129 E.00846
+G1 X109.951 Y110.305 E.00846
+G1 X109.77 Y110.477 E.00846
+G1 X109.585 Y110.646 E.00846
+G1 X109.398 Y110.811 E.00846
+G1 X109.208 Y110.974 E.00846
+G1 X109.015 Y111.133 E.00846
+G1 X108.819 Y111.288 E.00846
+G1 X108.621 Y111.44 E.00846
+G1 X108.42 Y111.589 E.00846
+G1 X108.216 Y111.734 E.00846
+G1 X108.01 Y111.876 E.00846
+G1 X107.802 Y112.014 E.00846
+G1 X107.591 Y112.148 E.00846
+G1 X107.378 Y112.279 E.00846
+G1 X107.162 Y112.406 E.00846
+G1 X106.945 Y112.529 E.00846
+G1 X106.725 Y112.648 E.00846
+G1 X106.503 Y112.764 E.00846
+G1 X106.28 Y112.875 E.00846
+G1 X106.054 Y112.983 E.00846
+G1 X105.827 Y113.087 E.00846
+G1 X105.597 Y113.186 E.00846
+G1 X105.366 Y113.282 E.00846
+G1 X105.134 Y113.374 E.00846
+G1 X104.899 Y113.461 E.00846
+G1 X104.664 Y113.545 E.00846
+G1 X104.427 Y113.624 E.00846
+G1 X104.188 Y113.699 E.00846
+G1 X103.949 Y113.77 E.00846
+G1 X103.708 Y113.837 E.00846
+G1 X103.466 Y113.899 E.00846
+G1 X103.222 Y113.958 E.00846
+G1 X102.978 Y114.012 E.00846
+G1 X102.733 Y114.062 E.00846
+G1 X102.488 Y114.107 E.00846
+G1 X102.241 Y114.149 E.00846
+G1 X101.994 Y114.186 E.00846
+G1 X101.746 Y114.218 E.00846
+G1 X101.497 Y114.247 E.00846
+G1 X101.249 Y114.27 E.00846
+G1 X100.999 Y114.29 E.00846
+G1 X100.75 Y114.305 E.00846
+G1 X100.5 Y114.316 E.00846
+G1 X100.25 Y114.323 E.00846
+G1 X100 Y114.325 E.00846
+G1 X99.75 Y114.323 E.00846
+G1 X99.5 Y114.316 E.00846
+G1 X99.25 Y114.305 E.00846
+G1 X99.001 Y114.29 E.00846
+G1 X98.751 Y114.27 E.00846
+G1 X98.503 Y114.247 E.00846
+G1 X98.254 Y114.218 E.00846
+G1 X98.006 Y114.186 E.00846
+G1 X97.759 Y114.149 E.00846
+G1 X97.512 Y114.107 E.00846
+G1 X97.267 Y114.062 E.00846
+G1 X97.022 Y114.012 E.00846
+G1 X96.778 Y113.958 E.00846
+G1 X96.534 Y113.899 E.00846
+G1 X96.292 Y113.837 E.00846
+G1 X96.051 Y113.77 E.00846
+G1 X95.812 Y113.699 E.00846
+G1 X95.573 Y113.624 E.00846
+G1 X95.336 Y113.545 E.00846
+G1 X95.101 Y113.461 E.00846
+G1 X94.866 Y113.374 E.00846
+G1 X94.634 Y113.282 E.00846
+G1 X94.403 Y113.186 E.00846
+G1 X94.173 Y113.087 E.00846
+G1 X93.946 Y112.983 E.00846
+G1 X93.72 Y112.875 E.00846
+G1 X93.497 Y112.764 E.00846
+G1 X93.275 Y112.648 E.00846
+G1 X93.055 Y112.529 E.00846
+G1 X92.838 Y112.406 E.00846
+G1 X92.622 Y112.279 E.00846
+G1 X92.409 Y112.148 E.00846
+G1 X92.198 Y112.014 E.00846
+G1 X91.99 Y111.876 E.00846
+G1 X91.784 Y111.734 E.00846
+G1 X91.58 Y111.589 E.00846
+G1 X91.379 Y111.44 E.00846
+G1 X91.181 Y111.288 E.00846
+G1 X90.985 Y111.133 E.00846
+G1 X90.792 Y110.974 E.00846
+G1 X90.602 Y110.811 E.00846
+G1 X90.415 Y110.646 E.00846
+G1 X90.23 Y110.477 E.00846
+G1 X90.049 Y110.305 E.00846
+G1 X89.871 Y110.129 E.00846
+G1 X89.695 Y109.951 E.00846
+G1 X89.523 Y109.77 E.00846
+G1 X89.354 Y109.585 E.00846
+G1 X89.189 Y109.398 E.00846
+G1 X89.026 Y109.208 E.00846
+G1 X88.867 Y109.015 E.00846
+G1 X88.712 Y108.819 E.00846
+G1 X88.56 Y108.621 E.00846
+G1 X88.411 Y108.42 E.00846
+G1 X88.266 Y108.216 E.00846
+G1 X88.124 Y108.01 E.00846
+G1 X87.986 Y107.802 E.00846
+G1 X87.852 Y107.591 E.00846
+G1 X87.721 Y107.378 E.00846
+G1 X87.594 Y107.162 E.00846
+G1 X87.471 Y106.945 E.00846
+G1 X87.352 Y106.725 E.00846
+G1 X87.236 Y106.503 E.00846
+G1 X87.125 Y106.28 E.00846
+G1 X87.017 Y106.054 E.00846
+G1 X86.913 Y105.827 E.00846
+G1 X86.814 Y105.597 E.00846
+G1 X86.718 Y105.366 E.00846
+G1 X86.626 Y105.134 E.00846
+G1 X86.539 Y104.899 E.00846
+G1 X86.455 Y104.664 E.00846
+G1 X86.376 Y104.427 E.00846
+G1 X86.301 Y104.188 E.00846
+G1 X86.23 Y103.949 E.00846
+G1 X86.163 Y103.708 E.00846
+G1 X86.101 Y103.466 E.00846
+G1 X86.042 Y103.222 E.00846
+G1 X85.988 Y102.978 E.00846
+G1 X85.938 Y102.733 E.00846
+G1 X85.893 Y102.488 E.00846
+G1 X85.851 Y102.241 E.00846
+G1 X85.814 Y101.994 E.00846
+G1 X85.782 Y101.746 E.00846
+G1 X85.753 Y101.497 E.00846
+G1 X85.73 Y101.249 E.00846
+G1 X85.71 Y100.999 E.00846
+G1 X85.695 Y100.75 E.00846
+G1 X85.684 Y100.5 E.00846
+G1 X85.677 Y100.25 E.00846
+G1 X85.675 Y100 E.00846
+G1 X85.677 Y99.75 E.00846
+G1 X85.684 Y99.5 E.00846
+G1 X85.695 Y99.25 E.00846
+G1 X85.71 Y99.001 E.00846
+G1 X85.73 Y98.751 E.00846
+G1 X85.753 Y98.503 E.00846
+G1 X85.782 Y98.254 E.00846
+G1 X85.814 Y98.006 E.00846
+G1 X85.851 Y97.759 E.00846
+G1 X85.893 Y97.512 E.00846
+G1 X85.938 Y97.267 E.00846
+G1 X85.988 Y97.022 E.00846
+G1 X86.042 Y96.778 E.00846
+G1 X86.101 Y96.534 E.00846
+G1 X86.163 Y96.292 E.00846
+G1 X86.23 Y96.051 E.00846
+G1 X86.301 Y95.812 E.00846
+G1 X86.376 Y95.573 E.00846
+G1 X86.455 Y95.336 E.00846
+G1 X86.539 Y95.101 E.00846
+G1 X86.626 Y94.866 E.00846
+G1 X86.718 Y94.634 E.00846
+G1 X86.814 Y94.403 E.00846
+G1 X86.913 Y94.173 E.00846
+G1 X87.017 Y93.946 E.00846
+G1 X87.125 Y93.72 E.00846
+G1 X87.236 Y93.497 E.00846
+G1 X87.352 Y93.275 E.00846
+G1 X87.471 Y93.055 E.00846
+G1 X87.594 Y92.838 E.00846
+G1 X87.721 Y92.622 E.00846
+G1 X87.852 Y92.409 E.00846
+G1 X87.986 Y92.198 E.00846
+G1 X88.124 Y91.99 E.00846
+G1 X88.266 Y91.784 E.00846
+G1 X88.411 Y91.58 E.00846
+G1 X88.56 Y91.379 E.00846
+G1 X88.712 Y91.181 E.00846
+G1 X88.867 Y90.985 E.00846
+G1 X89.026 Y90.792 E.00846
+G1 X89.189 Y90.602 E.00846
+G1 X89.354 Y90.415 E.00846
+G1 X89.523 Y90.23 E.00846
+G1 X89.695 Y90.049 E.00846
+G1 X89.871 Y89.871 E.00846
+G1 X90.049 Y89.695 E.00846
+G1 X90.23 Y89.523 E.00846
+G1 X90.415 Y89.354 E.00846
+G1 X90.602 Y89.189 E.00846
+G1 X90.792 Y89.026 E.00846
+G1 X90.985 Y88.867 E.00846
+G1 X91.181 Y88.712 E.00846
+G1 X91.379 Y88.56 E.00846
+G1 X91.58 Y88.411 E.00846
+G1 X91.784 Y88.266 E.00846
+G1 X91.99 Y88.124 E.00846
+G1 X92.198 Y87.986 E.00846
+G1 X92.409 Y87.852 E.00846
+G1 X92.622 Y87.721 E.00846
+G1 X92.837 Y87.594 E.00846
+G1 X93.055 Y87.471 E.00846
+G1 X93.275 Y87.352 E.00846
+G1 X93.497 Y87.236 E.00846
+G1 X93.72 Y87.125 E.00846
+G1 X93.946 Y87.017 E.00846
+G1 X94.173 Y86.913 E.00846
+G1 X94.403 Y86.814 E.00846
+G1 X94.634 Y86.718 E.00846
+G1 X94.866 Y86.626 E.00846
+G1 X95.101 Y86.539 E.00846
+G1 X95.336 Y86.455 E.00846
+G1 X95.573 Y86.376 E.00846
+G1 X95.812 Y86.301 E.00846
+G1 X96.051 Y86.23 E.00846
+G1 X96.292 Y86.163 E.00846
+G1 X96.534 Y86.101 E.00846
+G1 X96.778 Y86.042 E.00846
+G1 X97.022 Y85.988 E.00846
+G1 X97.267 Y85.938 E.00846
+G1 X97.512 Y85.893 E.00846
+G1 X97.759 Y85.851 E.00846
+G1 X98.006 Y85.814 E.00846
+G1 X98.254 Y85.782 E.00846
+G1 X98.503 Y85.753 E.00846
+G1 X98.751 Y85.73 E.00846
+G1 X99.001 Y85.71 E.00846
+G1 X99.25 Y85.695 E.00846
+G1 X99.5 Y85.684 E.00846
+G1 X99.75 Y85.677 E.00846
+G1 X100 Y85.675 E.00846
+G1 X100.25 Y85.677 E.00846
+G1 X100.5 Y85.684 E.00846
+G1 X100.75 Y85.695 E.00846
+G1 X100.999 Y85.71 E.00846
+G1 X101.249 Y85.73 E.00846
+G1 X101.497 Y85.753 E.00846
+G1 X101.746 Y85.782 E.00846
+G1 X101.994 Y85.814 E.00846
+G1 X102.241 Y85.851 E.00846
+G1 X102.488 Y85.893 E.00846
+G1 X102.733 Y85.938 E.00846
+G1 X102.978 Y85.988 E.00846
+G1 X103.222 Y86.042 E.00846
+G1 X103.466 Y86.101 E.00846
+G1 X103.708 Y86.163 E.00846
+G1 X103.949 Y86.23 E.00846
+G1 X104.188 Y86.301 E.00846
+G1 X104.427 Y86.376 E.00846
+G1 X104.664 Y86.455 E.00846
+G1 X104.899 Y86.539 E.00846
+G1 X105.134 Y86.626 E.00846
+G1 X105.366 Y86.718 E.00846
+G1 X105.597 Y86.814 E.00846
+G1 X105.827 Y86.913 E.00846
+G1 X106.054 Y87.017 E.00846
+G1 X106.28 Y87.125 E.00846
+G1 X106.503 Y87.236 E.00846
+G1 X106.725 Y87.352 E.00846
+G1 X106.945 Y87.471 E.00846
+G1 X107.162 Y87.594 E.00846
+G1 X107.378 Y87.721 E.00846
+G1 X107.591 Y87.852 E.00846
+G1 X107.802 Y87.986 E.00846
+G1 X108.01 Y88.124 E.00846
+G1 X108.216 Y88.266 E.00846
+G1 X108.42 Y88.411 E.00846
+G1 X108.621 Y88.56 E.00846
+G1 X108.819 Y88.712 E.00846
+G1 X109.015 Y88.867 E.00846
+G1 X109.208 Y89.026 E.00846
+G1 X109.398 Y89.189 E.00846
+G1 X109.585 Y89.354 E.00846
+G1 X109.77 Y89.523 E.00846
+G1 X109.951 Y89.695 E.00846
+G1 X110.129 Y89.871 E.00846
+G1 X110.305 Y90.049 E.00846
+G1 X110.477 Y90.23 E.00846
+G1 X110.646 Y90.415 E.00846
+G1 X110.811 Y90.602 E.00846
+G1 X110.974 Y90.792 E.00846
+G1 X111.133 Y90.985 E.00846
+G1 X111.288 Y91.181 E.00846
+G1 X111.44 Y91.379 E.00846
+G1 X111.589 Y91.58 E.00846
+G1 X111.734 Y91.784 E.00846
+G1 X111.876 Y91.99 E.00846
+G1 X112.014 Y92.198 E.00846
+G1 X112.148 Y92.409 E.00846
+G1 X112.279 Y92.622 E.00846
+G1 X112.406 Y92.837 E.00846
+G1 X112.529 Y93.055 E.00846
+G1 X112.648 Y93.275 E.00846
+G1 X112.764 Y93.497 E.00846
+G1 X112.875 Y93.72 E.00846
+G1 X112.983 Y93.946 E.00846
+G1 X113.087 Y94.173 E.00846
+G1 X113.186 Y94.403 E.00846
+G1 X113.282 Y94.634 E.00846
+G1 X113.374 Y94.866 E.00846
+G1 X113.461 Y95.101 E.00846
+G1 X113.545 Y95.336 E.00846
+G1 X113.624 Y95.573 E.00846
+G1 X113.699 Y95.812 E.00846
+G1 X113.77 Y96.051 E.00846
+G1 X113.837 Y96.292 E.00846
+G1 X113.899 Y96.534 E.00846
+G1 X113.958 Y96.778 E.00846
+G1 X114.012 Y97.022 E.00846
+G1 X114.062 Y97.267 E.00846
+G1 X114.107 Y97.512 E.00846
+G1 X114.149 Y97.759 E.00846
+G1 X114.186 Y98.006 E.00846
+G1 X114.218 Y98.254 E.00846
+G1 X114.247 Y98.503 E.00846
+G1 X114.27 Y98.751 E.00846
+G1 X114.29 Y99.001 E.00846
+G1 X114.305 Y99.25 E.00846
+G1 X114.316 Y99.5 E.00846
+G1 X114.323 Y99.75 E.00846
+G1 X114.325 Y100 E.00846
+;TYPE:External perimeter
+;WIDTH:0.45
+G1 F1800
+G1 X114.773 Y100.258 E.01749
+G1 X114.766 Y100.516 E.00873
+G1 X114.755 Y100.773 E.00873
+G1 X114.739 Y101.031 E.00873
+G1 X114.719 Y101.288 E.00873
+G1 X114.694 Y101.544 E.00873
+G1 X114.665 Y101.801 E.00873
+G1 X114.631 Y102.056 E.00873
+G1 X114.593 Y102.311 E.00873
+G1 X114.551 Y102.566 E.00873
+G1 X114.504 Y102.819 E.00873
+G1 X114.452 Y103.072 E.00873
+G1 X114.396 Y103.324 E.00873
+G1 X114.336 Y103.574 E.00873
+G1 X114.272 Y103.824 E.00873
+G1 X114.203 Y104.073 E.00873
+G1 X114.129 Y104.32 E.00873
+G1 X114.052 Y104.566 E.00873
+G1 X113.97 Y104.81 E.00873
+G1 X113.884 Y105.053 E.00873
+G1 X113.794 Y105.295 E.00873
+G1 X113.699 Y105.535 E.00873
+G1 X113.6 Y105.773 E.00873
+G1 X113.498 Y106.01 E.00873
+G1 X113.391 Y106.244 E.00873
+G1 X113.28 Y106.477 E.00873
+G1 X113.165 Y106.708 E.00873
+G1 X113.046 Y106.936 E.00873
+G1 X112.923 Y107.163 E.00873
+G1 X112.796 Y107.388 E.00873
+G1 X112.665 Y107.61 E.00873
+G1 X112.53 Y107.83 E.00873
+G1 X112.391 Y108.047 E.00873
+G1 X112.249 Y108.262 E.00873
+G1 X112.103 Y108.475 E.00873
+G1 X111.953 Y108.685 E.00873
+G1 X111.8 Y108.892 E.00873
+G1 X111.643 Y109.096 E.00873
+G1 X111.482 Y109.298 E.00873
+G1 X111.318 Y109.497 E.00873
+G1 X111.151 Y109.693 E.00873
+G1 X110.98 Y109.886 E.00873
+G1 X110.806 Y110.077 E.00873
+G1 X110.628 Y110.264 E.00873
+G1 X110.448 Y110.448 E.00873
+G1 X110.264 Y110.628 E.00873
+G1 X110.077 Y110.806 E.00873
+G1 X109.886 Y110.98 E.00873
+G1 X109.693 Y111.151 E.00873
+G1 X109.497 Y111.318 E.00873
+G1 X109.298 Y111.482 E.00873
+G1 X109.096 Y111.643 E.00873
+G1 X108.892 Y111.8 E.00873
+G1 X108.685 Y111.953 E.00873
+G1 X108.475 Y112.103 E.00873
+G1 X108.262 Y112.249 E.00873
+G1 X108.047 Y112.391 E.00873
+G1 X107.83 Y112.53 E.00873
+G1 X107.61 Y112.665 E.00873
+G1 X107.388 Y112.796 E.00873
+G1 X107.163 Y112.923 E.00873
+G1 X106.936 Y113.046 E.00873
+G1 X106.708 Y113.165 E.00873
+G1 X106.477 Y113.28 E.00873
+G1 X106.244 Y113.391 E.00873
+G1 X106.01 Y113.498 E.00873
+G1 X105.773 Y113.6 E.00873
+G1 X105.535 Y113.699 E.00873
+G1 X105.295 Y113.794 E.00873
+G1 X105.053 Y113.884 E.00873
+G1 X104.81 Y113.97 E.00873
+G1 X104.566 Y114.052 E.00873
+G1 X104.32 Y114.129 E.00873
+G1 X104.073 Y114.203 E.00873
+G1 X103.824 Y114.272 E.00873
+G1 X103.574 Y114.336 E.00873
+G1 X103.324 Y114.396 E.00873
+G1 X103.072 Y114.452 E.00873
+G1 X102.819 Y114.504 E.00873
+G1 X102.566 Y114.551 E.00873
+G1 X102.311 Y114.593 E.00873
+G1 X102.056 Y114.631 E.00873
+G1 X101.801 Y114.665 E.00873
+G1 X101.544 Y114.694 E.00873
+G1 X101.288 Y114.719 E.00873
+G1 X101.031 Y114.739 E.00873
+G1 X100.773 Y114.755 E.00873
+G1 X100.516 Y114.766 E.00873
+G1 X100.258 Y114.773 E.00873
+G1 X100 Y114.775 E.00873
+G1 X99.742 Y114.773 E.00873
+G1 X99.484 Y114.766 E.00873
+G1 X99.227 Y114.755 E.00873
+G1 X98.969 Y114.739 E.00873
+G1 X98.712 Y114.719 E.00873
+G1 X98.456 Y114.694 E.00873
+G1 X98.199 Y114.665 E.00873
+G1 X97.944 Y114.631 E.00873
+G1 X97.689 Y114.593 E.00873
+G1 X97.434 Y114.551 E.00873
+G1 X97.181 Y114.504 E.00873
+G1 X96.928 Y114.452 E.00873
+G1 X96.676 Y114.396 E.00873
+G1 X96.426 Y114.336 E.00873
+G1 X96.176 Y114.272 E.00873
+G1 X95.927 Y114.203 E.00873
+G1 X95.68 Y114.129 E.00873
+G1 X95.434 Y114.052 E.00873
+G1 X95.19 Y113.97 E.00873
+G1 X94.947 Y113.884 E.00873
+G1 X94.705 Y113.794 E.00873
+G1 X94.465 Y113.699 E.00873
+G1 X94.227 Y113.6 E.00873
+G1 X93.99 Y113.498 E.00873
+G1 X93.756 Y113.391 E.00873
+G1 X93.523 Y113.28 E.00873
+G1 X93.292 Y113.165 E.00873
+G1 X93.064 Y113.046 E.00873
+G1 X92.837 Y112.923 E.00873
+G1 X92.612 Y112.796 E.00873
+G1 X92.39 Y112.665 E.00873
+G1 X92.17 Y112.53 E.00873
+G1 X91.953 Y112.391 E.00873
+G1 X91.738 Y112.249 E.00873
+G1 X91.525 Y112.103 E.00873
+G1 X91.315 Y111.953 E.00873
+G1 X91.108 Y111.8 E.00873
+G1 X90.904 Y111.643 E.00873
+G1 X90.702 Y111.482 E.00873
+G1 X90.503 Y111.318 E.00873
+G1 X90.307 Y111.151 E.00873
+G1 X90.114 Y110.98 E.00873
+G1 X89.923 Y110.806 E.00873
+G1 X89.736 Y110.628 E.00873
+G1 X89.552 Y110.448 E.00873
+G1 X89.372 Y110.264 E.00873
+G1 X89.194 Y110.077 E.00873
+G1 X89.02 Y109.886 E.00873
+G1 X88.849 Y109.693 E.00873
+G1 X88.682 Y109.497 E.00873
+G1 X88.518 Y109.298 E.00873
+G1 X88.357 Y109.096 E.00873
+G1 X88.2 Y108.892 E.00873
+G1 X88.047 Y108.685 E.00873
+G1 X87.897 Y108.475 E.00873
+G1 X87.751 Y108.262 E.00873
+G1 X87.609 Y108.047 E.00873
+G1 X87.47 Y107.83 E.00873
+G1 X87.335 Y107.61 E.00873
+G1 X87.204 Y107.388 E.00873
+G1 X87.077 Y107.163 E.00873
+G1 X86.954 Y106.936 E.00873
+G1 X86.835 Y106.708 E.00873
+G1 X86.72 Y106.477 E.00873
+G1 X86.609 Y106.244 E.00873
+G1 X86.502 Y106.01 E.00873
+G1 X86.4 Y105.773 E.00873
+G1 X86.301 Y105.535 E.00873
+G1 X86.206 Y105.295 E.00873
+G1 X86.116 Y105.053 E.00873
+G1 X86.03 Y104.81 E.00873
+G1 X85.948 Y104.566 E.00873
+G1 X85.871 Y104.32 E.00873
+G1 X85.797 Y104.073 E.00873
+G1 X85.728 Y103.824 E.00873
+G1 X85.664 Y103.574 E.00873
+G1 X85.604 Y103.324 E.00873
+G1 X85.548 Y103.072 E.00873
+G1 X85.496 Y102.819 E.00873
+G1 X85.449 Y102.566 E.00873
+G1 X85.407 Y102.311 E.00873
+G1 X85.369 Y102.056 E.00873
+G1 X85.335 Y101.801 E.00873
+G1 X85.306 Y101.544 E.00873
+G1 X85.281 Y101.288 E.00873
+G1 X85.261 Y101.031 E.00873
+G1 X85.245 Y100.773 E.00873
+G1 X85.234 Y100.516 E.00873
+G1 X85.227 Y100.258 E.00873
+G1 X85.225 Y100 E.00873
+G1 X85.227 Y99.742 E.00873
+G1 X85.234 Y99.484 E.00873
+G1 X85.245 Y99.227 E.00873
+G1 X85.261 Y98.969 E.00873
+G1 X85.281 Y98.712 E.00873
+G1 X85.306 Y98.456 E.00873
+G1 X85.335 Y98.199 E.00873
+G1 X85.369 Y97.944 E.00873
+G1 X85.407 Y97.689 E.00873
+G1 X85.449 Y97.434 E.00873
+G1 X85.496 Y97.181 E.00873
+G1 X85.548 Y96.928 E.00873
+G1 X85.604 Y96.676 E.00873
+G1 X85.664 Y96.426 E.00873
+G1 X85.728 Y96.176 E.00873
+G1 X85.797 Y95.927 E.00873
+G1 X85.871 Y95.68 E.00873
+G1 X85.948 Y95.434 E.00873
+G1 X86.03 Y95.19 E.00873
+G1 X86.116 Y94.947 E.00873
+G1 X86.206 Y94.705 E.00873
+G1 X86.301 Y94.465 E.00873
+G1 X86.4 Y94.227 E.00873
+G1 X86.502 Y93.99 E.00873
+G1 X86.609 Y93.756 E.00873
+G1 X86.72 Y93.523 E.00873
+G1 X86.835 Y93.292 E.00873
+G1 X86.954 Y93.064 E.00873
+G1 X87.077 Y92.837 E.00873
+G1 X87.204 Y92.612 E.00873
+G1 X87.335 Y92.39 E.00873
+G1 X87.47 Y92.17 E.00873
+G1 X87.609 Y91.953 E.00873
+G1 X87.751 Y91.738 E.00873
+G1 X87.897 Y91.525 E.00873
+G1 X88.047 Y91.315 E.00873
+G1 X88.2 Y91.108 E.00873
+G1 X88.357 Y90.904 E.00873
+G1 X88.518 Y90.702 E.00873
+G1 X88.682 Y90.503 E.00873
+G1 X88.849 Y90.307 E.00873
+G1 X89.02 Y90.114 E.00873
+G1 X89.194 Y89.923 E.00873
+G1 X89.372 Y89.736 E.00873
+G1 X89.552 Y89.552 E.00873
+G1 X89.736 Y89.372 E.00873
+G1 X89.923 Y89.194 E.00873
+G1 X90.114 Y89.02 E.00873
+G1 X90.307 Y88.849 E.00873
+G1 X90.503 Y88.682 E.00873
+G1 X90.702 Y88.518 E.00873
+G1 X90.904 Y88.357 E.00873
+G1 X91.108 Y88.2 E.00873
+G1 X91.315 Y88.047 E.00873
+G1 X91.525 Y87.897 E.00873
+G1 X91.738 Y87.751 E.00873
+G1 X91.953 Y87.609 E.00873
+G1 X92.17 Y87.47 E.00873
+G1 X92.39 Y87.335 E.00873
+G1 X92.612 Y87.204 E.00873
+G1 X92.837 Y87.077 E.00873
+G1 X93.064 Y86.954 E.00873
+G1 X93.292 Y86.835 E.00873
+G1 X93.523 Y86.72 E.00873
+G1 X93.756 Y86.609 E.00873
+G1 X93.99 Y86.502 E.00873
+G1 X94.227 Y86.4 E.00873
+G1 X94.465 Y86.301 E.00873
+G1 X94.705 Y86.206 E.00873
+G1 X94.947 Y86.116 E.00873
+G1 X95.19 Y86.03 E.00873
+G1 X95.434 Y85.948 E.00873
+G1 X95.68 Y85.871 E.00873
+G1 X95.927 Y85.797 E.00873
+G1 X96.176 Y85.728 E.00873
+G1 X96.426 Y85.664 E.00873
+G1 X96.676 Y85.604 E.00873
+G1 X96.928 Y85.548 E.00873
+G1 X97.181 Y85.496 E.00873
+G1 X97.434 Y85.449 E.00873
+G1 X97.689 Y85.407 E.00873
+G1 X97.944 Y85.369 E.00873
+G1 X98.199 Y85.335 E.00873
+G1 X98.456 Y85.306 E.00873
+G1 X98.712 Y85.281 E.00873
+G1 X98.969 Y85.261 E.00873
+G1 X99.227 Y85.245 E.00873
+G1 X99.484 Y85.234 E.00873
+G1 X99.742 Y85.227 E.00873
+G1 X100 Y85.225 E.00873
+G1 X100.258 Y85.227 E.00873
+G1 X100.516 Y85.234 E.00873
+G1 X100.773 Y85.245 E.00873
+G1 X101.031 Y85.261 E.00873
+G1 X101.288 Y85.281 E.00873
+G1 X101.544 Y85.306 E.00873
+G1 X101.801 Y85.335 E.00873
+G1 X102.056 Y85.369 E.00873
+G1 X102.311 Y85.407 E.00873
+G1 X102.566 Y85.449 E.00873
+G1 X102.819 Y85.496 E.00873
+G1 X103.072 Y85.548 E.00873
+G1 X103.324 Y85.604 E.00873
+G1 X103.574 Y85.664 E.00873
+G1 X103.824 Y85.728 E.00873
+G1 X104.073 Y85.797 E.00873
+G1 X104.32 Y85.871 E.00873
+G1 X104.566 Y85.948 E.00873
+G1 X104.81 Y86.03 E.00873
+G1 X105.053 Y86.116 E.00873
+G1 X105.295 Y86.206 E.00873
+G1 X105.535 Y86.301 E.00873
+G1 X105.773 Y86.4 E.00873
+G1 X106.01 Y86.502 E.00873
+G1 X106.244 Y86.609 E.00873
+G1 X106.477 Y86.72 E.00873
+G1 X106.708 Y86.835 E.00873
+G1 X106.936 Y86.954 E.00873
+G1 X107.163 Y87.077 E.00873
+G1 X107.388 Y87.204 E.00873
+G1 X107.61 Y87.335 E.00873
+G1 X107.83 Y87.47 E.00873
+G1 X108.047 Y87.609 E.00873
+G1 X108.262 Y87.751 E.00873
+G1 X108.475 Y87.897 E.00873
+G1 X108.685 Y88.047 E.00873
+G1 X108.892 Y88.2 E.00873
+G1 X109.096 Y88.357 E.00873
+G1 X109.298 Y88.518 E.00873
+G1 X109.497 Y88.682 E.00873
+G1 X109.693 Y88.849 E.00873
+G1 X109.886 Y89.02 E.00873
+G1 X110.077 Y89.194 E.00873
+G1 X110.264 Y89.372 E.00873
+G1 X110.448 Y89.552 E.00873
+G1 X110.628 Y89.736 E.00873
+G1 X110.806 Y89.923 E.00873
+G1 X110.98 Y90.114 E.00873
+G1 X111.151 Y90.307 E.00873
+G1 X111.318 Y90.503 E.00873
+G1 X111.482 Y90.702 E.00873
+G1 X111.643 Y90.904 E.00873
+G1 X111.8 Y91.108 E.00873
+G1 X111.953 Y91.315 E.00873
+G1 X112.103 Y91.525 E.00873
+G1 X112.249 Y91.738 E.00873
+G1 X112.391 Y91.953 E.00873
+G1 X112.53 Y92.17 E.00873
+G1 X112.665 Y92.39 E.00873
+G1 X112.796 Y92.612 E.00873
+G1 X112.923 Y92.837 E.00873
+G1 X113.046 Y93.064 E.00873
+G1 X113.165 Y93.292 E.00873
+G1 X113.28 Y93.523 E.00873
+G1 X113.391 Y93.756 E.00873
+G1 X113.498 Y93.99 E.00873
+G1 X113.6 Y94.227 E.00873
+G1 X113.699 Y94.465 E.00873
+G1 X113.794 Y94.705 E.00873
+G1 X113.884 Y94.947 E.00873
+G1 X113.97 Y95.19 E.00873
+G1 X114.052 Y95.434 E.00873
+G1 X114.129 Y95.68 E.00873
+G1 X114.203 Y95.927 E.00873
+G1 X114.272 Y96.176 E.00873
+G1 X114.336 Y96.426 E.00873
+G1 X114.396 Y96.676 E.00873
+G1 X114.452 Y96.928 E.00873
+G1 X114.504 Y97.181 E.00873
+G1 X114.551 Y97.434 E.00873
+G1 X114.593 Y97.689 E.00873
+G1 X114.631 Y97.944 E.00873
+G1 X114.665 Y98.199 E.00873
+G1 X114.694 Y98.456 E.00873
+G1 X114.719 Y98.712 E.00873
+G1 X114.739 Y98.969 E.00873
+G1 X114.755 Y99.227 E.00873
+G1 X114.766 Y99.484 E.00873
+G1 X114.773 Y99.742 E.00873
+G1 X114.775 Y100 E.00873
+;TYPE:Solid infill
+;WIDTH:0.45
+G1 E-.8 F2100
+G1 X87.961 Y92.858 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X92.84 Y87.979 E.23356
+G1 X94.183 Y87.272 E.05139
+G1 X87.289 Y94.166 E.33004
+G1 X86.829 Y95.262 E.04023
+G1 X95.244 Y86.848 E.40281
+G1 X96.198 Y86.53 E.03406
+G1 X86.546 Y96.182 E.46205
+G1 X86.334 Y97.03 E.02961
+G1 X97.047 Y86.317 E.51283
+G1 X97.825 Y86.176 E.02676
+G1 X86.193 Y97.808 E.55683
+G1 X86.087 Y98.55 E.02539
+G1 X98.532 Y86.105 E.59576
+G1 X99.239 Y86.035 E.02405
+G1 X86.051 Y99.222 E.6313
+G1 X86.016 Y99.894 E.02277
+G1 X99.875 Y86.035 E.66346
+G1 X100.512 Y86.035 E.02154
+G1 X86.016 Y100.53 E.69393
+G1 X86.051 Y101.131 E.02038
+G1 X101.113 Y86.07 E.72101
+G1 X101.714 Y86.105 E.02038
+G1 X86.122 Y101.697 E.74639
+G1 X86.193 Y102.263 E.0193
+G1 X102.244 Y86.211 E.7684
+G1 X102.774 Y86.317 E.01831
+G1 X86.299 Y102.793 E.78871
+G1 X86.405 Y103.323 E.01831
+G1 X103.305 Y86.424 E.80902
+G1 X103.8 Y86.565 E.01743
+G1 X86.546 Y103.818 E.82594
+G1 X86.688 Y104.313 E.01743
+G1 X104.295 Y86.706 E.84287
+G1 X104.79 Y86.848 E.01743
+G1 X86.864 Y104.773 E.8581
+G1 X87.041 Y105.233 E.01667
+G1 X105.249 Y87.025 E.87164
+G1 X105.674 Y87.237 E.01606
+G1 X87.218 Y105.692 E.88349
+G1 X87.43 Y106.116 E.01606
+G1 X106.098 Y87.449 E.89364
+G1 X106.522 Y87.661 E.01606
+G1 X87.642 Y106.541 E.9038
+G1 X87.89 Y106.93 E.0156
+G1 X106.946 Y87.873 E.91226
+G1 X107.335 Y88.121 E.0156
+G1 X88.102 Y107.354 E.92072
+G1 X88.349 Y107.743 E.0156
+G1 X107.724 Y88.368 E.92749
+G1 X108.113 Y88.616 E.0156
+G1 X88.632 Y108.096 E.93257
+G1 X88.88 Y108.485 E.0156
+G1 X108.467 Y88.898 E.93765
+G1 X108.82 Y89.181 E.01533
+G1 X89.163 Y108.839 E.94103
+G1 X89.445 Y109.192 E.01533
+G1 X109.174 Y89.464 E.94442
+G1 X109.527 Y89.747 E.01533
+G1 X89.764 Y109.511 E.94611
+G1 X90.082 Y109.829 E.01523
+G1 X109.845 Y90.065 E.94611
+G1 X110.164 Y90.383 E.01523
+G1 X90.4 Y110.147 E.94611
+G1 X90.718 Y110.465 E.01523
+G1 X110.447 Y90.737 E.94442
+G1 X110.765 Y91.055 E.01523
+G1 X91.072 Y110.748 E.94272
+G1 X91.425 Y111.031 E.01533
+G1 X111.048 Y91.409 E.93934
+G1 X111.295 Y91.798 E.0156
+G1 X91.779 Y111.314 E.93426
+G1 X92.168 Y111.561 E.0156
+G1 X111.578 Y92.151 E.92918
+G1 X111.825 Y92.54 E.0156
+G1 X92.557 Y111.809 E.92241
+G1 X92.946 Y112.056 E.0156
+G1 X112.073 Y92.929 E.91564
+G1 X112.285 Y93.353 E.01606
+G1 X93.335 Y112.304 E.90718
+G1 X93.759 Y112.516 E.01606
+G1 X112.497 Y93.777 E.89703
+G1 X112.709 Y94.202 E.01606
+G1 X94.183 Y112.728 E.88687
+G1 X94.643 Y112.905 E.01667
+G1 X112.921 Y94.626 E.87502
+G1 X113.098 Y95.086 E.01667
+G1 X95.102 Y113.081 E.86148
+G1 X95.562 Y113.258 E.01667
+G1 X113.24 Y95.581 E.84625
+G1 X113.416 Y96.04 E.01667
+G1 X96.057 Y113.4 E.83102
+G1 X96.552 Y113.541 E.01743
+G1 X113.558 Y96.535 E.81409
+G1 X113.664 Y97.066 E.01831
+G1 X97.047 Y113.683 E.79548
+G1 X97.577 Y113.789 E.01831
+G1 X113.77 Y97.596 E.77517
+G1 X113.841 Y98.162 E.0193
+G1 X98.143 Y113.859 E.75147
+G1 X98.709 Y113.93 E.0193
+G1 X113.911 Y98.727 E.72778
+G1 X113.982 Y99.293 E.0193
+G1 X99.31 Y113.965 E.70239
+G1 X99.946 Y113.965 E.02154
+G1 X113.982 Y99.929 E.67192
+G1 X113.982 Y100.566 E.02154
+G1 X100.582 Y113.965 E.64146
+G1 X101.254 Y113.93 E.02277
+G1 X113.911 Y101.273 E.60591
+G1 X113.841 Y101.98 E.02405
+G1 X101.961 Y113.859 E.56868
+G1 X102.739 Y113.718 E.02676
+G1 X113.699 Y102.758 E.52467
+G1 X113.522 Y103.571 E.02817
+G1 X103.552 Y113.541 E.47728
+G1 X104.471 Y113.258 E.03256
+G1 X113.24 Y104.49 E.41974
+G1 X112.851 Y105.515 E.03712
+G1 X105.497 Y112.869 E.35204
+G1 X106.734 Y112.268 E.04657
+G1 X112.25 Y106.753 E.26403
+G1 E-.8 F2100
+G1 X111.048 Y108.591 F10800
+G1 E.8 F2100
+G1 F3600
+G1 X108.573 Y111.066 E.11848
+G1 E-.8 F2100
+M107
+G1 Z11 F720 ; Move print head up
+G1 X0 Y200 F3600 ; home X axis
+M104 S0 ; turn off temperature
+M140 S0 ; turn off heatbed
+M84 ; disable motors
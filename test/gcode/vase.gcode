@@ -0,0 +1,2092 @@
+; 40 mm spiral vase, 256 facets, 8 turns
+; test job in the layout of PrusaSlicer 2.6 output, M83, retraction,
+; moves along the facets of a mesh
+;
+; external perimeters extrusion width = 0.45mm
+; perimeters extrusion width = 0.45mm
+; infill extrusion width = 0.45mm
+; first layer extrusion width = 0.45mm
+;
+M201 X1000 Y1000 Z200 E5000 ; sets maximum accelerations, mm/sec^2
+M203 X200 Y200 Z12 E120 ; sets maximum feedrates, mm / sec
+M204 P1250 R1250 T1250 ; sets acceleration (P, T) and retract acceleration (R), mm/sec^2
+G90 ; use absolute coordinates
+M83 ; extruder relative mode
+M104 S215 ; set extruder temp
+M140 S60 ; set bed temp
+M190 S60 ; wait for bed temp
+M109 S215 ; wait for extruder temp
+G28 W ; home all without mesh bed level
+G80 ; mesh bed leveling
+G1 Z0.2 F720
+G1 Y-3 F1000 ; go outside print area
+G1 X60 E9 F1000 ; intro line
+G1 X100 E12.5 F1000 ; intro line
+M221 S95
+G21 ; set units to millimeters
+G90 ; use absolute coordinates
+M83 ; use relative distances for extrusion
+M900 K0.05 ; Filament gcode LA 1.5
+M107
+;LAYER_CHANGE
+;TYPE:External perimeter
+;WIDTH:0.45
+G1 E-.8 F2100
+G1 X120 Y100 F10800
+G1 E.8 F2100
+G1 F1500
+G1 X119.994 Y100.491 Z0.201 E.01662
+G1 X119.976 Y100.981 Z0.202 E.01662
+G1 X119.946 Y101.471 Z0.202 E.01662
+G1 X119.904 Y101.96 Z0.203 E.01662
+G1 X119.85 Y102.448 Z0.204 E.01662
+G1 X119.784 Y102.935 Z0.205 E.01662
+G1 X119.706 Y103.419 Z0.205 E.01662
+G1 X119.616 Y103.902 Z0.206 E.01662
+G1 X119.514 Y104.382 Z0.207 E.01662
+G1 X119.401 Y104.86 Z0.208 E.01662
+G1 X119.276 Y105.334 Z0.209 E.01662
+G1 X119.139 Y105.806 Z0.209 E.01662
+G1 X118.991 Y106.274 Z0.21 E.01662
+G1 X118.831 Y106.738 Z0.211 E.01662
+G1 X118.66 Y107.198 Z0.212 E.01662
+G1 X118.478 Y107.654 Z0.213 E.01662
+G1 X118.284 Y108.105 Z0.213 E.01662
+G1 X118.08 Y108.551 Z0.214 E.01662
+G1 X117.864 Y108.992 Z0.215 E.01662
+G1 X117.638 Y109.428 Z0.216 E.01662
+G1 X117.402 Y109.858 Z0.216 E.01662
+G1 X117.155 Y110.282 Z0.217 E.01662
+G1 X116.897 Y110.7 Z0.218 E.01662
+G1 X116.629 Y111.111 Z0.219 E.01662
+G1 X116.352 Y111.516 Z0.22 E.01662
+G1 X116.064 Y111.914 Z0.22 E.01662
+G1 X115.767 Y112.305 Z0.221 E.01662
+G1 X115.46 Y112.688 Z0.222 E.01662
+G1 X115.144 Y113.063 Z0.223 E.01662
+G1 X114.819 Y113.431 Z0.223 E.01662
+G1 X114.485 Y113.791 Z0.224 E.01662
+G1 X114.142 Y114.142 Z0.225 E.01662
+G1 X113.791 Y114.485 Z0.226 E.01662
+G1 X113.431 Y114.819 Z0.227 E.01662
+G1 X113.063 Y115.144 Z0.227 E.01662
+G1 X112.688 Y115.46 Z0.228 E.01662
+G1 X112.305 Y115.767 Z0.229 E.01662
+G1 X111.914 Y116.064 Z0.23 E.01662
+G1 X111.516 Y116.352 Z0.23 E.01662
+G1 X111.111 Y116.629 Z0.231 E.01662
+G1 X110.7 Y116.897 Z0.232 E.01662
+G1 X110.282 Y117.155 Z0.233 E.01662
+G1 X109.858 Y117.402 Z0.234 E.01662
+G1 X109.428 Y117.638 Z0.234 E.01662
+G1 X108.992 Y117.864 Z0.235 E.01662
+G1 X108.551 Y118.08 Z0.236 E.01662
+G1 X108.105 Y118.284 Z0.237 E.01662
+G1 X107.654 Y118.478 Z0.238 E.01662
+G1 X107.198 Y118.66 Z0.238 E.01662
+G1 X106.738 Y118.831 Z0.239 E.01662
+G1 X106.274 Y118.991 Z0.24 E.01662
+G1 X105.806 Y119.139 Z0.241 E.01662
+G1 X105.334 Y119.276 Z0.241 E.01662
+G1 X104.86 Y119.401 Z0.242 E.01662
+G1 X104.382 Y119.514 Z0.243 E.01662
+G1 X103.902 Y119.616 Z0.244 E.01662
+G1 X103.419 Y119.706 Z0.245 E.01662
+G1 X102.935 Y119.784 Z0.245 E.01662
+G1 X102.448 Y119.85 Z0.246 E.01662
+G1 X101.96 Y119.904 Z0.247 E.01662
+G1 X101.471 Y119.946 Z0.248 E.01662
+G1 X100.981 Y119.976 Z0.248 E.01662
+G1 X100.491 Y119.994 Z0.249 E.01662
+G1 X100 Y120 Z0.25 E.01662
+G1 X99.509 Y119.994 Z0.251 E.01662
+G1 X99.019 Y119.976 Z0.252 E.01662
+G1 X98.529 Y119.946 Z0.252 E.01662
+G1 X98.04 Y119.904 Z0.253 E.01662
+G1 X97.552 Y119.85 Z0.254 E.01662
+G1 X97.065 Y119.784 Z0.255 E.01662
+G1 X96.581 Y119.706 Z0.255 E.01662
+G1 X96.098 Y119.616 Z0.256 E.01662
+G1 X95.618 Y119.514 Z0.257 E.01662
+G1 X95.14 Y119.401 Z0.258 E.01662
+G1 X94.666 Y119.276 Z0.259 E.01662
+G1 X94.194 Y119.139 Z0.259 E.01662
+G1 X93.726 Y118.991 Z0.26 E.01662
+G1 X93.262 Y118.831 Z0.261 E.01662
+G1 X92.802 Y118.66 Z0.262 E.01662
+G1 X92.346 Y118.478 Z0.263 E.01662
+G1 X91.895 Y118.284 Z0.263 E.01662
+G1 X91.449 Y118.08 Z0.264 E.01662
+G1 X91.008 Y117.864 Z0.265 E.01662
+G1 X90.572 Y117.638 Z0.266 E.01662
+G1 X90.142 Y117.402 Z0.266 E.01662
+G1 X89.718 Y117.155 Z0.267 E.01662
+G1 X89.3 Y116.897 Z0.268 E.01662
+G1 X88.889 Y116.629 Z0.269 E.01662
+G1 X88.484 Y116.352 Z0.27 E.01662
+G1 X88.086 Y116.064 Z0.27 E.01662
+G1 X87.695 Y115.767 Z0.271 E.01662
+G1 X87.312 Y115.46 Z0.272 E.01662
+G1 X86.937 Y115.144 Z0.273 E.01662
+G1 X86.569 Y114.819 Z0.273 E.01662
+G1 X86.209 Y114.485 Z0.274 E.01662
+G1 X85.858 Y114.142 Z0.275 E.01662
+G1 X85.515 Y113.791 Z0.276 E.01662
+G1 X85.181 Y113.431 Z0.277 E.01662
+G1 X84.856 Y113.063 Z0.277 E.01662
+G1 X84.54 Y112.688 Z0.278 E.01662
+G1 X84.233 Y112.305 Z0.279 E.01662
+G1 X83.936 Y111.914 Z0.28 E.01662
+G1 X83.648 Y111.516 Z0.28 E.01662
+G1 X83.371 Y111.111 Z0.281 E.01662
+G1 X83.103 Y110.7 Z0.282 E.01662
+G1 X82.845 Y110.282 Z0.283 E.01662
+G1 X82.598 Y109.858 Z0.284 E.01662
+G1 X82.362 Y109.428 Z0.284 E.01662
+G1 X82.136 Y108.992 Z0.285 E.01662
+G1 X81.92 Y108.551 Z0.286 E.01662
+G1 X81.716 Y108.105 Z0.287 E.01662
+G1 X81.522 Y107.654 Z0.288 E.01662
+G1 X81.34 Y107.198 Z0.288 E.01662
+G1 X81.169 Y106.738 Z0.289 E.01662
+G1 X81.009 Y106.274 Z0.29 E.01662
+G1 X80.861 Y105.806 Z0.291 E.01662
+G1 X80.724 Y105.334 Z0.291 E.01662
+G1 X80.599 Y104.86 Z0.292 E.01662
+G1 X80.486 Y104.382 Z0.293 E.01662
+G1 X80.384 Y103.902 Z0.294 E.01662
+G1 X80.294 Y103.419 Z0.295 E.01662
+G1 X80.216 Y102.935 Z0.295 E.01662
+G1 X80.15 Y102.448 Z0.296 E.01662
+G1 X80.096 Y101.96 Z0.297 E.01662
+G1 X80.054 Y101.471 Z0.298 E.01662
+G1 X80.024 Y100.981 Z0.298 E.01662
+G1 X80.006 Y100.491 Z0.299 E.01662
+G1 X80 Y100 Z0.3 E.01662
+G1 X80.006 Y99.509 Z0.301 E.01662
+G1 X80.024 Y99.019 Z0.302 E.01662
+G1 X80.054 Y98.529 Z0.302 E.01662
+G1 X80.096 Y98.04 Z0.303 E.01662
+G1 X80.15 Y97.552 Z0.304 E.01662
+G1 X80.216 Y97.065 Z0.305 E.01662
+G1 X80.294 Y96.581 Z0.305 E.01662
+G1 X80.384 Y96.098 Z0.306 E.01662
+G1 X80.486 Y95.618 Z0.307 E.01662
+G1 X80.599 Y95.14 Z0.308 E.01662
+G1 X80.724 Y94.666 Z0.309 E.01662
+G1 X80.861 Y94.194 Z0.309 E.01662
+G1 X81.009 Y93.726 Z0.31 E.01662
+G1 X81.169 Y93.262 Z0.311 E.01662
+G1 X81.34 Y92.802 Z0.312 E.01662
+G1 X81.522 Y92.346 Z0.312 E.01662
+G1 X81.716 Y91.895 Z0.313 E.01662
+G1 X81.92 Y91.449 Z0.314 E.01662
+G1 X82.136 Y91.008 Z0.315 E.01662
+G1 X82.362 Y90.572 Z0.316 E.01662
+G1 X82.598 Y90.142 Z0.316 E.01662
+G1 X82.845 Y89.718 Z0.317 E.01662
+G1 X83.103 Y89.3 Z0.318 E.01662
+G1 X83.371 Y88.889 Z0.319 E.01662
+G1 X83.648 Y88.484 Z0.32 E.01662
+G1 X83.936 Y88.086 Z0.32 E.01662
+G1 X84.233 Y87.695 Z0.321 E.01662
+G1 X84.54 Y87.312 Z0.322 E.01662
+G1 X84.856 Y86.937 Z0.323 E.01662
+G1 X85.181 Y86.569 Z0.323 E.01662
+G1 X85.515 Y86.209 Z0.324 E.01662
+G1 X85.858 Y85.858 Z0.325 E.01662
+G1 X86.209 Y85.515 Z0.326 E.01662
+G1 X86.569 Y85.181 Z0.327 E.01662
+G1 X86.937 Y84.856 Z0.327 E.01662
+G1 X87.312 Y84.54 Z0.328 E.01662
+G1 X87.695 Y84.233 Z0.329 E.01662
+G1 X88.086 Y83.936 Z0.33 E.01662
+G1 X88.484 Y83.648 Z0.33 E.01662
+G1 X88.889 Y83.371 Z0.331 E.01662
+G1 X89.3 Y83.103 Z0.332 E.01662
+G1 X89.718 Y82.845 Z0.333 E.01662
+G1 X90.142 Y82.598 Z0.334 E.01662
+G1 X90.572 Y82.362 Z0.334 E.01662
+G1 X91.008 Y82.136 Z0.335 E.01662
+G1 X91.449 Y81.92 Z0.336 E.01662
+G1 X91.895 Y81.716 Z0.337 E.01662
+G1 X92.346 Y81.522 Z0.338 E.01662
+G1 X92.802 Y81.34 Z0.338 E.01662
+G1 X93.262 Y81.169 Z0.339 E.01662
+G1 X93.726 Y81.009 Z0.34 E.01662
+G1 X94.194 Y80.861 Z0.341 E.01662
+G1 X94.666 Y80.724 Z0.341 E.01662
+G1 X95.14 Y80.599 Z0.342 E.01662
+G1 X95.618 Y80.486 Z0.343 E.01662
+G1 X96.098 Y80.384 Z0.344 E.01662
+G1 X96.581 Y80.294 Z0.345 E.01662
+G1 X97.065 Y80.216 Z0.345 E.01662
+G1 X97.552 Y80.15 Z0.346 E.01662
+G1 X98.04 Y80.096 Z0.347 E.01662
+G1 X98.529 Y80.054 Z0.348 E.01662
+G1 X99.019 Y80.024 Z0.348 E.01662
+G1 X99.509 Y80.006 Z0.349 E.01662
+G1 X100 Y80 Z0.35 E.01662
+G1 X100.491 Y80.006 Z0.351 E.01662
+G1 X100.981 Y80.024 Z0.352 E.01662
+G1 X101.471 Y80.054 Z0.352 E.01662
+G1 X101.96 Y80.096 Z0.353 E.01662
+G1 X102.448 Y80.15 Z0.354 E.01662
+G1 X102.935 Y80.216 Z0.355 E.01662
+G1 X103.419 Y80.294 Z0.355 E.01662
+G1 X103.902 Y80.384 Z0.356 E.01662
+G1 X104.382 Y80.486 Z0.357 E.01662
+G1 X104.86 Y80.599 Z0.358 E.01662
+G1 X105.334 Y80.724 Z0.359 E.01662
+G1 X105.806 Y80.861 Z0.359 E.01662
+G1 X106.274 Y81.009 Z0.36 E.01662
+G1 X106.738 Y81.169 Z0.361 E.01662
+G1 X107.198 Y81.34 Z0.362 E.01662
+G1 X107.654 Y81.522 Z0.363 E.01662
+G1 X108.105 Y81.716 Z0.363 E.01662
+G1 X108.551 Y81.92 Z0.364 E.01662
+G1 X108.992 Y82.136 Z0.365 E.01662
+G1 X109.428 Y82.362 Z0.366 E.01662
+G1 X109.858 Y82.598 Z0.366 E.01662
+G1 X110.282 Y82.845 Z0.367 E.01662
+G1 X110.7 Y83.103 Z0.368 E.01662
+G1 X111.111 Y83.371 Z0.369 E.01662
+G1 X111.516 Y83.648 Z0.37 E.01662
+G1 X111.914 Y83.936 Z0.37 E.01662
+G1 X112.305 Y84.233 Z0.371 E.01662
+G1 X112.688 Y84.54 Z0.372 E.01662
+G1 X113.063 Y84.856 Z0.373 E.01662
+G1 X113.431 Y85.181 Z0.373 E.01662
+G1 X113.791 Y85.515 Z0.374 E.01662
+G1 X114.142 Y85.858 Z0.375 E.01662
+G1 X114.485 Y86.209 Z0.376 E.01662
+G1 X114.819 Y86.569 Z0.377 E.01662
+G1 X115.144 Y86.937 Z0.377 E.01662
+G1 X115.46 Y87.312 Z0.378 E.01662
+G1 X115.767 Y87.695 Z0.379 E.01662
+G1 X116.064 Y88.086 Z0.38 E.01662
+G1 X116.352 Y88.484 Z0.38 E.01662
+G1 X116.629 Y88.889 Z0.381 E.01662
+G1 X116.897 Y89.3 Z0.382 E.01662
+G1 X117.155 Y89.718 Z0.383 E.01662
+G1 X117.402 Y90.142 Z0.384 E.01662
+G1 X117.638 Y90.572 Z0.384 E.01662
+G1 X117.864 Y91.008 Z0.385 E.01662
+G1 X118.08 Y91.449 Z0.386 E.01662
+G1 X118.284 Y91.895 Z0.387 E.01662
+G1 X118.478 Y92.346 Z0.388 E.01662
+G1 X118.66 Y92.802 Z0.388 E.01662
+G1 X118.831 Y93.262 Z0.389 E.01662
+G1 X118.991 Y93.726 Z0.39 E.01662
+G1 X119.139 Y94.194 Z0.391 E.01662
+G1 X119.276 Y94.666 Z0.391 E.01662
+G1 X119.401 Y95.14 Z0.392 E.01662
+G1 X119.514 Y95.618 Z0.393 E.01662
+G1 X119.616 Y96.098 Z0.394 E.01662
+G1 X119.706 Y96.581 Z0.395 E.01662
+G1 X119.784 Y97.065 Z0.395 E.01662
+G1 X119.85 Y97.552 Z0.396 E.01662
+G1 X119.904 Y98.04 Z0.397 E.01662
+G1 X119.946 Y98.529 Z0.398 E.01662
+G1 X119.976 Y99.019 Z0.398 E.01662
+G1 X119.994 Y99.509 Z0.399 E.01662
+G1 X120 Y100 Z0.4 E.01662
+G1 X119.994 Y100.491 Z0.401 E.01662
+G1 X119.976 Y100.981 Z0.402 E.01662
+G1 X119.946 Y101.471 Z0.402 E.01662
+G1 X119.904 Y101.96 Z0.403 E.01662
+G1 X119.85 Y102.448 Z0.404 E.01662
+G1 X119.784 Y102.935 Z0.405 E.01662
+G1 X119.706 Y103.419 Z0.405 E.01662
+G1 X119.616 Y103.902 Z0.406 E.01662
+G1 X119.514 Y104.382 Z0.407 E.01662
+G1 X119.401 Y104.86 Z0.408 E.01662
+G1 X119.276 Y105.334 Z0.409 E.01662
+G1 X119.139 Y105.806 Z0.409 E.01662
+G1 X118.991 Y106.274 Z0.41 E.01662
+G1 X118.831 Y106.738 Z0.411 E.01662
+G1 X118.66 Y107.198 Z0.412 E.01662
+G1 X118.478 Y107.654 Z0.413 E.01662
+G1 X118.284 Y108.105 Z0.413 E.01662
+G1 X118.08 Y108.551 Z0.414 E.01662
+G1 X117.864 Y108.992 Z0.415 E.01662
+G1 X117.638 Y109.428 Z0.416 E.01662
+G1 X117.402 Y109.858 Z0.416 E.01662
+G1 X117.155 Y110.282 Z0.417 E.01662
+G1 X116.897 Y110.7 Z0.418 E.01662
+G1 X116.629 Y111.111 Z0.419 E.01662
+G1 X116.352 Y111.516 Z0.42 E.01662
+G1 X116.064 Y111.914 Z0.42 E.01662
+G1 X115.767 Y112.305 Z0.421 E.01662
+G1 X115.46 Y112.688 Z0.422 E.01662
+G1 X115.144 Y113.063 Z0.423 E.01662
+G1 X114.819 Y113.431 Z0.423 E.01662
+G1 X114.485 Y113.791 Z0.424 E.01662
+G1 X114.142 Y114.142 Z0.425 E.01662
+G1 X113.791 Y114.485 Z0.426 E.01662
+G1 X113.431 Y114.819 Z0.427 E.01662
+G1 X113.063 Y115.144 Z0.427 E.01662
+G1 X112.688 Y115.46 Z0.428 E.01662
+G1 X112.305 Y115.767 Z0.429 E.01662
+G1 X111.914 Y116.064 Z0.43 E.01662
+G1 X111.516 Y116.352 Z0.43 E.01662
+G1 X111.111 Y116.629 Z0.431 E.01662
+G1 X110.7 Y116.897 Z0.432 E.01662
+G1 X110.282 Y117.155 Z0.433 E.01662
+G1 X109.858 Y117.402 Z0.434 E.01662
+G1 X109.428 Y117.638 Z0.434 E.01662
+G1 X108.992 Y117.864 Z0.435 E.01662
+G1 X108.551 Y118.08 Z0.436 E.01662
+G1 X108.105 Y118.284 Z0.437 E.01662
+G1 X107.654 Y118.478 Z0.438 E.01662
+G1 X107.198 Y118.66 Z0.438 E.01662
+G1 X106.738 Y118.831 Z0.439 E.01662
+G1 X106.274 Y118.991 Z0.44 E.01662
+G1 X105.806 Y119.139 Z0.441 E.01662
+G1 X105.334 Y119.276 Z0.441 E.01662
+G1 X104.86 Y119.401 Z0.442 E.01662
+G1 X104.382 Y119.514 Z0.443 E.01662
+G1 X103.902 Y119.616 Z0.444 E.01662
+G1 X103.419 Y119.706 Z0.445 E.01662
+G1 X102.935 Y119.784 Z0.445 E.01662
+G1 X102.448 Y119.85 Z0.446 E.01662
+G1 X101.96 Y119.904 Z0.447 E.01662
+G1 X101.471 Y119.946 Z0.448 E.01662
+G1 X100.981 Y119.976 Z0.448 E.01662
+G1 X100.491 Y119.994 Z0.449 E.01662
+G1 X100 Y120 Z0.45 E.01662
+G1 X99.509 Y119.994 Z0.451 E.01662
+G1 X99.019 Y119.976 Z0.452 E.01662
+G1 X98.529 Y119.946 Z0.452 E.01662
+G1 X98.04 Y119.904 Z0.453 E.01662
+G1 X97.552 Y119.85 Z0.454 E.01662
+G1 X97.065 Y119.784 Z0.455 E.01662
+G1 X96.581 Y119.706 Z0.455 E.01662
+G1 X96.098 Y119.616 Z0.456 E.01662
+G1 X95.618 Y119.514 Z0.457 E.01662
+G1 X95.14 Y119.401 Z0.458 E.01662
+G1 X94.666 Y119.276 Z0.459 E.01662
+G1 X94.194 Y119.139 Z0.459 E.01662
+G1 X93.726 Y118.991 Z0.46 E.01662
+G1 X93.262 Y118.831 Z0.461 E.01662
+G1 X92.802 Y118.66 Z0.462 E.01662
+G1 X92.346 Y118.478 Z0.463 E.01662
+G1 X91.895 Y118.284 Z0.463 E.01662
+G1 X91.449 Y118.08 Z0.464 E.01662
+G1 X91.008 Y117.864 Z0.465 E.01662
+G1 X90.572 Y117.638 Z0.466 E.01662
+G1 X90.142 Y117.402 Z0.466 E.01662
+G1 X89.718 Y117.155 Z0.467 E.01662
+G1 X89.3 Y116.897 Z0.468 E.01662
+G1 X88.889 Y116.629 Z0.469 E.01662
+G1 X88.484 Y116.352 Z0.47 E.01662
+G1 X88.086 Y116.064 Z0.47 E.01662
+G1 X87.695 Y115.767 Z0.471 E.01662
+G1 X87.312 Y115.46 Z0.472 E.01662
+G1 X86.937 Y115.144 Z0.473 E.01662
+G1 X86.569 Y114.819 Z0.473 E.01662
+G1 X86.209 Y114.485 Z0.474 E.01662
+G1 X85.858 Y114.142 Z0.475 E.01662
+G1 X85.515 Y113.791 Z0.476 E.01662
+G1 X85.181 Y113.431 Z0.477 E.01662
+G1 X84.856 Y113.063 Z0.477 E.01662
+G1 X84.54 Y112.688 Z0.478 E.01662
+G1 X84.233 Y112.305 Z0.479 E.01662
+G1 X83.936 Y111.914 Z0.48 E.01662
+G1 X83.648 Y111.516 Z0.48 E.01662
+G1 X83.371 Y111.111 Z0.481 E.01662
+G1 X83.103 Y110.7 Z0.482 E.01662
+G1 X82.845 Y110.282 Z0.483 E.01662
+G1 X82.598 Y109.858 Z0.484 E.01662
+G1 X82.362 Y109.428 Z0.484 E.01662
+G1 X82.136 Y108.992 Z0.485 E.01662
+G1 X81.92 Y108.551 Z0.486 E.01662
+G1 X81.716 Y108.105 Z0.487 E.01662
+G1 X81.522 Y107.654 Z0.488 E.01662
+G1 X81.34 Y107.198 Z0.488 E.01662
+G1 X81.169 Y106.738 Z0.489 E.01662
+G1 X81.009 Y106.274 Z0.49 E.01662
+G1 X80.861 Y105.806 Z0.491 E.01662
+G1 X80.724 Y105.334 Z0.491 E.01662
+G1 X80.599 Y104.86 Z0.492 E.01662
+G1 X80.486 Y104.382 Z0.493 E.01662
+G1 X80.384 Y103.902 Z0.494 E.01662
+G1 X80.294 Y103.419 Z0.495 E.01662
+G1 X80.216 Y102.935 Z0.495 E.01662
+G1 X80.15 Y102.448 Z0.496 E.01662
+G1 X80.096 Y101.96 Z0.497 E.01662
+G1 X80.054 Y101.471 Z0.498 E.01662
+G1 X80.024 Y100.981 Z0.498 E.01662
+G1 X80.006 Y100.491 Z0.499 E.01662
+G1 X80 Y100 Z0.5 E.01662
+G1 X80.006 Y99.509 Z0.501 E.01662
+G1 X80.024 Y99.019 Z0.502 E.01662
+G1 X80.054 Y98.529 Z0.502 E.01662
+G1 X80.096 Y98.04 Z0.503 E.01662
+G1 X80.15 Y97.552 Z0.504 E.01662
+G1 X80.216 Y97.065 Z0.505 E.01662
+G1 X80.294 Y96.581 Z0.505 E.01662
+G1 X80.384 Y96.098 Z0.506 E.01662
+G1 X80.486 Y95.618 Z0.507 E.01662
+G1 X80.599 Y95.14 Z0.508 E.01662
+G1 X80.724 Y94.666 Z0.509 E.01662
+G1 X80.861 Y94.194 Z0.509 E.01662
+G1 X81.009 Y93.726 Z0.51 E.01662
+G1 X81.169 Y93.262 Z0.511 E.01662
+G1 X81.34 Y92.802 Z0.512 E.01662
+G1 X81.522 Y92.346 Z0.513 E.01662
+G1 X81.716 Y91.895 Z0.513 E.01662
+G1 X81.92 Y91.449 Z0.514 E.01662
+G1 X82.136 Y91.008 Z0.515 E.01662
+G1 X82.362 Y90.572 Z0.516 E.01662
+G1 X82.598 Y90.142 Z0.516 E.01662
+G1 X82.845 Y89.718 Z0.517 E.01662
+G1 X83.103 Y89.3 Z0.518 E.01662
+G1 X83.371 Y88.889 Z0.519 E.01662
+G1 X83.648 Y88.484 Z0.52 E.01662
+G1 X83.936 Y88.086 Z0.52 E.01662
+G1 X84.233 Y87.695 Z0.521 E.01662
+G1 X84.54 Y87.312 Z0.522 E.01662
+G1 X84.856 Y86.937 Z0.523 E.01662
+G1 X85.181 Y86.569 Z0.523 E.01662
+G1 X85.515 Y86.209 Z0.524 E.01662
+G1 X85.858 Y85.858 Z0.525 E.01662
+G1 X86.209 Y85.515 Z0.526 E.01662
+G1 X86.569 Y85.181 Z0.527 E.01662
+G1 X86.937 Y84.856 Z0.527 E.01662
+G1 X87.312 Y84.54 Z0.528 E.01662
+G1 X87.695 Y84.233 Z0.529 E.01662
+G1 X88.086 Y83.936 Z0.53 E.01662
+G1 X88.484 Y83.648 Z0.53 E.01662
+G1 X88.889 Y83.371 Z0.531 E.01662
+G1 X89.3 Y83.103 Z0.532 E.01662
+G1 X89.718 Y82.845 Z0.533 E.01662
+G1 X90.142 Y82.598 Z0.534 E.01662
+G1 X90.572 Y82.362 Z0.534 E.01662
+G1 X91.008 Y82.136 Z0.535 E.01662
+G1 X91.449 Y81.92 Z0.536 E.01662
+G1 X91.895 Y81.716 Z0.537 E.01662
+G1 X92.346 Y81.522 Z0.538 E.01662
+G1 X92.802 Y81.34 Z0.538 E.01662
+G1 X93.262 Y81.169 Z0.539 E.01662
+G1 X93.726 Y81.009 Z0.54 E.01662
+G1 X94.194 Y80.861 Z0.541 E.01662
+G1 X94.666 Y80.724 Z0.541 E.01662
+G1 X95.14 Y80.599 Z0.542 E.01662
+G1 X95.618 Y80.486 Z0.543 E.01662
+G1 X96.098 Y80.384 Z0.544 E.01662
+G1 X96.581 Y80.294 Z0.545 E.01662
+G1 X97.065 Y80.216 Z0.545 E.01662
+G1 X97.552 Y80.15 Z0.546 E.01662
+G1 X98.04 Y80.096 Z0.547 E.01662
+G1 X98.529 Y80.054 Z0.548 E.01662
+G1 X99.019 Y80.024 Z0.548 E.01662
+G1 X99.509 Y80.006 Z0.549 E.01662
+G1 X100 Y80 Z0.55 E.01662
+G1 X100.491 Y80.006 Z0.551 E.01662
+G1 X100.981 Y80.024 Z0.552 E.01662
+G1 X101.471 Y80.054 Z0.552 E.01662
+G1 X101.96 Y80.096 Z0.553 E.01662
+G1 X102.448 Y80.15 Z0.554 E.01662
+G1 X102.935 Y80.216 Z0.555 E.01662
+G1 X103.419 Y80.294 Z0.555 E.01662
+G1 X103.902 Y80.384 Z0.556 E.01662
+G1 X104.382 Y80.486 Z0.557 E.01662
+G1 X104.86 Y80.599 Z0.558 E.01662
+G1 X105.334 Y80.724 Z0.559 E.01662
+G1 X105.806 Y80.861 Z0.559 E.01662
+G1 X106.274 Y81.009 Z0.56 E.01662
+G1 X106.738 Y81.169 Z0.561 E.01662
+G1 X107.198 Y81.34 Z0.562 E.01662
+G1 X107.654 Y81.522 Z0.562 E.01662
+G1 X108.105 Y81.716 Z0.563 E.01662
+G1 X108.551 Y81.92 Z0.564 E.01662
+G1 X108.992 Y82.136 Z0.565 E.01662
+G1 X109.428 Y82.362 Z0.566 E.01662
+G1 X109.858 Y82.598 Z0.566 E.01662
+G1 X110.282 Y82.845 Z0.567 E.01662
+G1 X110.7 Y83.103 Z0.568 E.01662
+G1 X111.111 Y83.371 Z0.569 E.01662
+G1 X111.516 Y83.648 Z0.57 E.01662
+G1 X111.914 Y83.936 Z0.57 E.01662
+G1 X112.305 Y84.233 Z0.571 E.01662
+G1 X112.688 Y84.54 Z0.572 E.01662
+G1 X113.063 Y84.856 Z0.573 E.01662
+G1 X113.431 Y85.181 Z0.573 E.01662
+G1 X113.791 Y85.515 Z0.574 E.01662
+G1 X114.142 Y85.858 Z0.575 E.01662
+G1 X114.485 Y86.209 Z0.576 E.01662
+G1 X114.819 Y86.569 Z0.577 E.01662
+G1 X115.144 Y86.937 Z0.577 E.01662
+G1 X115.46 Y87.312 Z0.578 E.01662
+G1 X115.767 Y87.695 Z0.579 E.01662
+G1 X116.064 Y88.086 Z0.58 E.01662
+G1 X116.352 Y88.484 Z0.58 E.01662
+G1 X116.629 Y88.889 Z0.581 E.01662
+G1 X116.897 Y89.3 Z0.582 E.01662
+G1 X117.155 Y89.718 Z0.583 E.01662
+G1 X117.402 Y90.142 Z0.584 E.01662
+G1 X117.638 Y90.572 Z0.584 E.01662
+G1 X117.864 Y91.008 Z0.585 E.01662
+G1 X118.08 Y91.449 Z0.586 E.01662
+G1 X118.284 Y91.895 Z0.587 E.01662
+G1 X118.478 Y92.346 Z0.588 E.01662
+G1 X118.66 Y92.802 Z0.588 E.01662
+G1 X118.831 Y93.262 Z0.589 E.01662
+G1 X118.991 Y93.726 Z0.59 E.01662
+G1 X119.139 Y94.194 Z0.591 E.01662
+G1 X119.276 Y94.666 Z0.591 E.01662
+G1 X119.401 Y95.14 Z0.592 E.01662
+G1 X119.514 Y95.618 Z0.593 E.01662
+G1 X119.616 Y96.098 Z0.594 E.01662
+G1 X119.706 Y96.581 Z0.595 E.01662
+G1 X119.784 Y97.065 Z0.595 E.01662
+G1 X119.85 Y97.552 Z0.596 E.01662
+G1 X119.904 Y98.04 Z0.597 E.01662
+G1 X119.946 Y98.529 Z0.598 E.01662
+G1 X119.976 Y99.019 Z0.598 E.01662
+G1 X119.994 Y99.509 Z0.599 E.01662
+G1 X120 Y100 Z0.6 E.01662
+G1 X119.994 Y100.491 Z0.601 E.01662
+G1 X119.976 Y100.981 Z0.602 E.01662
+G1 X119.946 Y101.471 Z0.602 E.01662
+G1 X119.904 Y101.96 Z0.603 E.01662
+G1 X119.85 Y102.448 Z0.604 E.01662
+G1 X119.784 Y102.935 Z0.605 E.01662
+G1 X119.706 Y103.419 Z0.605 E.01662
+G1 X119.616 Y103.902 Z0.606 E.01662
+G1 X119.514 Y104.382 Z0.607 E.01662
+G1 X119.401 Y104.86 Z0.608 E.01662
+G1 X119.276 Y105.334 Z0.609 E.01662
+G1 X119.139 Y105.806 Z0.609 E.01662
+G1 X118.991 Y106.274 Z0.61 E.01662
+G1 X118.831 Y106.738 Z0.611 E.01662
+G1 X118.66 Y107.198 Z0.612 E.01662
+G1 X118.478 Y107.654 Z0.613 E.01662
+G1 X118.284 Y108.105 Z0.613 E.01662
+G1 X118.08 Y108.551 Z0.614 E.01662
+G1 X117.864 Y108.992 Z0.615 E.01662
+G1 X117.638 Y109.428 Z0.616 E.01662
+G1 X117.402 Y109.858 Z0.616 E.01662
+G1 X117.155 Y110.282 Z0.617 E.01662
+G1 X116.897 Y110.7 Z0.618 E.01662
+G1 X116.629 Y111.111 Z0.619 E.01662
+G1 X116.352 Y111.516 Z0.62 E.01662
+G1 X116.064 Y111.914 Z0.62 E.01662
+G1 X115.767 Y112.305 Z0.621 E.01662
+G1 X115.46 Y112.688 Z0.622 E.01662
+G1 X115.144 Y113.063 Z0.623 E.01662
+G1 X114.819 Y113.431 Z0.623 E.01662
+G1 X114.485 Y113.791 Z0.624 E.01662
+G1 X114.142 Y114.142 Z0.625 E.01662
+G1 X113.791 Y114.485 Z0.626 E.01662
+G1 X113.431 Y114.819 Z0.627 E.01662
+G1 X113.063 Y115.144 Z0.627 E.01662
+G1 X112.688 Y115.46 Z0.628 E.01662
+G1 X112.305 Y115.767 Z0.629 E.01662
+G1 X111.914 Y116.064 Z0.63 E.01662
+G1 X111.516 Y116.352 Z0.63 E.01662
+G1 X111.111 Y116.629 Z0.631 E.01662
+G1 X110.7 Y116.897 Z0.632 E.01662
+G1 X110.282 Y117.155 Z0.633 E.01662
+G1 X109.858 Y117.402 Z0.634 E.01662
+G1 X109.428 Y117.638 Z0.634 E.01662
+G1 X108.992 Y117.864 Z0.635 E.01662
+G1 X108.551 Y118.08 Z0.636 E.01662
+G1 X108.105 Y118.284 Z0.637 E.01662
+G1 X107.654 Y118.478 Z0.638 E.01662
+G1 X107.198 Y118.66 Z0.638 E.01662
+G1 X106.738 Y118.831 Z0.639 E.01662
+G1 X106.274 Y118.991 Z0.64 E.01662
+G1 X105.806 Y119.139 Z0.641 E.01662
+G1 X105.334 Y119.276 Z0.641 E.01662
+G1 X104.86 Y119.401 Z0.642 E.01662
+G1 X104.382 Y119.514 Z0.643 E.01662
+G1 X103.902 Y119.616 Z0.644 E.01662
+G1 X103.419 Y119.706 Z0.645 E.01662
+G1 X102.935 Y119.784 Z0.645 E.01662
+G1 X102.448 Y119.85 Z0.646 E.01662
+G1 X101.96 Y119.904 Z0.647 E.01662
+G1 X101.471 Y119.946 Z0.648 E.01662
+G1 X100.981 Y119.976 Z0.648 E.01662
+G1 X100.491 Y119.994 Z0.649 E.01662
+G1 X100 Y120 Z0.65 E.01662
+G1 X99.509 Y119.994 Z0.651 E.01662
+G1 X99.019 Y119.976 Z0.652 E.01662
+G1 X98.529 Y119.946 Z0.652 E.01662
+G1 X98.04 Y119.904 Z0.653 E.01662
+G1 X97.552 Y119.85 Z0.654 E.01662
+G1 X97.065 Y119.784 Z0.655 E.01662
+G1 X96.581 Y119.706 Z0.655 E.01662
+G1 X96.098 Y119.616 Z0.656 E.01662
+G1 X95.618 Y119.514 Z0.657 E.01662
+G1 X95.14 Y119.401 Z0.658 E.01662
+G1 X94.666 Y119.276 Z0.659 E.01662
+G1 X94.194 Y119.139 Z0.659 E.01662
+G1 X93.726 Y118.991 Z0.66 E.01662
+G1 X93.262 Y118.831 Z0.661 E.01662
+G1 X92.802 Y118.66 Z0.662 E.01662
+G1 X92.346 Y118.478 Z0.663 E.01662
+G1 X91.895 Y118.284 Z0.663 E.01662
+G1 X91.449 Y118.08 Z0.664 E.01662
+G1 X91.008 Y117.864 Z0.665 E.01662
+G1 X90.572 Y117.638 Z0.666 E.01662
+G1 X90.142 Y117.402 Z0.666 E.01662
+G1 X89.718 Y117.155 Z0.667 E.01662
+G1 X89.3 Y116.897 Z0.668 E.01662
+G1 X88.889 Y116.629 Z0.669 E.01662
+G1 X88.484 Y116.352 Z0.67 E.01662
+G1 X88.086 Y116.064 Z0.67 E.01662
+G1 X87.695 Y115.767 Z0.671 E.01662
+G1 X87.312 Y115.46 Z0.672 E.01662
+G1 X86.937 Y115.144 Z0.673 E.01662
+G1 X86.569 Y114.819 Z0.673 E.01662
+G1 X86.209 Y114.485 Z0.674 E.01662
+G1 X85.858 Y114.142 Z0.675 E.01662
+G1 X85.515 Y113.791 Z0.676 E.01662
+G1 X85.181 Y113.431 Z0.677 E.01662
+G1 X84.856 Y113.063 Z0.677 E.01662
+G1 X84.54 Y112.688 Z0.678 E.01662
+G1 X84.233 Y112.305 Z0.679 E.01662
+G1 X83.936 Y111.914 Z0.68 E.01662
+G1 X83.648 Y111.516 Z0.68 E.01662
+G1 X83.371 Y111.111 Z0.681 E.01662
+G1 X83.103 Y110.7 Z0.682 E.01662
+G1 X82.845 Y110.282 Z0.683 E.01662
+G1 X82.598 Y109.858 Z0.684 E.01662
+G1 X82.362 Y109.428 Z0.684 E.01662
+G1 X82.136 Y108.992 Z0.685 E.01662
+G1 X81.92 Y108.551 Z0.686 E.01662
+G1 X81.716 Y108.105 Z0.687 E.01662
+G1 X81.522 Y107.654 Z0.688 E.01662
+G1 X81.34 Y107.198 Z0.688 E.01662
+G1 X81.169 Y106.738 Z0.689 E.01662
+G1 X81.009 Y106.274 Z0.69 E.01662
+G1 X80.861 Y105.806 Z0.691 E.01662
+G1 X80.724 Y105.334 Z0.691 E.01662
+G1 X80.599 Y104.86 Z0.692 E.01662
+G1 X80.486 Y104.382 Z0.693 E.01662
+G1 X80.384 Y103.902 Z0.694 E.01662
+G1 X80.294 Y103.419 Z0.695 E.01662
+G1 X80.216 Y102.935 Z0.695 E.01662
+G1 X80.15 Y102.448 Z0.696 E.01662
+G1 X80.096 Y101.96 Z0.697 E.01662
+G1 X80.054 Y101.471 Z0.698 E.01662
+G1 X80.024 Y100.981 Z0.698 E.01662
+G1 X80.006 Y100.491 Z0.699 E.01662
+G1 X80 Y100 Z0.7 E.01662
+G1 X80.006 Y99.509 Z0.701 E.01662
+G1 X80.024 Y99.019 Z0.702 E.01662
+G1 X80.054 Y98.529 Z0.702 E.01662
+G1 X80.096 Y98.04 Z0.703 E.01662
+G1 X80.15 Y97.552 Z0.704 E.01662
+G1 X80.216 Y97.065 Z0.705 E.01662
+G1 X80.294 Y96.581 Z0.705 E.01662
+G1 X80.384 Y96.098 Z0.706 E.01662
+G1 X80.486 Y95.618 Z0.707 E.01662
+G1 X80.599 Y95.14 Z0.708 E.01662
+G1 X80.724 Y94.666 Z0.709 E.01662
+G1 X80.861 Y94.194 Z0.709 E.01662
+G1 X81.009 Y93.726 Z0.71 E.01662
+G1 X81.169 Y93.262 Z0.711 E.01662
+G1 X81.34 Y92.802 Z0.712 E.01662
+G1 X81.522 Y92.346 Z0.713 E.01662
+G1 X81.716 Y91.895 Z0.713 E.01662
+G1 X81.92 Y91.449 Z0.714 E.01662
+G1 X82.136 Y91.008 Z0.715 E.01662
+G1 X82.362 Y90.572 Z0.716 E.01662
+G1 X82.598 Y90.142 Z0.716 E.01662
+G1 X82.845 Y89.718 Z0.717 E.01662
+G1 X83.103 Y89.3 Z0.718 E.01662
+G1 X83.371 Y88.889 Z0.719 E.01662
+G1 X83.648 Y88.484 Z0.72 E.01662
+G1 X83.936 Y88.086 Z0.72 E.01662
+G1 X84.233 Y87.695 Z0.721 E.01662
+G1 X84.54 Y87.312 Z0.722 E.01662
+G1 X84.856 Y86.937 Z0.723 E.01662
+G1 X85.181 Y86.569 Z0.723 E.01662
+G1 X85.515 Y86.209 Z0.724 E.01662
+G1 X85.858 Y85.858 Z0.725 E.01662
+G1 X86.209 Y85.515 Z0.726 E.01662
+G1 X86.569 Y85.181 Z0.727 E.01662
+G1 X86.937 Y84.856 Z0.727 E.01662
+G1 X87.312 Y84.54 Z0.728 E.01662
+G1 X87.695 Y84.233 Z0.729 E.01662
+G1 X88.086 Y83.936 Z0.73 E.01662
+G1 X88.484 Y83.648 Z0.73 E.01662
+G1 X88.889 Y83.371 Z0.731 E.01662
+G1 X89.3 Y83.103 Z0.732 E.01662
+G1 X89.718 Y82.845 Z0.733 E.01662
+G1 X90.142 Y82.598 Z0.734 E.01662
+G1 X90.572 Y82.362 Z0.734 E.01662
+G1 X91.008 Y82.136 Z0.735 E.01662
+G1 X91.449 Y81.92 Z0.736 E.01662
+G1 X91.895 Y81.716 Z0.737 E.01662
+G1 X92.346 Y81.522 Z0.738 E.01662
+G1 X92.802 Y81.34 Z0.738 E.01662
+G1 X93.262 Y81.169 Z0.739 E.01662
+G1 X93.726 Y81.009 Z0.74 E.01662
+G1 X94.194 Y80.861 Z0.741 E.01662
+G1 X94.666 Y80.724 Z0.741 E.01662
+G1 X95.14 Y80.599 Z0.742 E.01662
+G1 X95.618 Y80.486 Z0.743 E.01662
+G1 X96.098 Y80.384 Z0.744 E.01662
+G1 X96.581 Y80.294 Z0.745 E.01662
+G1 X97.065 Y80.216 Z0.745 E.01662
+G1 X97.552 Y80.15 Z0.746 E.01662
+G1 X98.04 Y80.096 Z0.747 E.01662
+G1 X98.529 Y80.054 Z0.748 E.01662
+G1 X99.019 Y80.024 Z0.748 E.01662
+G1 X99.509 Y80.006 Z0.749 E.01662
+G1 X100 Y80 Z0.75 E.01662
+G1 X100.491 Y80.006 Z0.751 E.01662
+G1 X100.981 Y80.024 Z0.752 E.01662
+G1 X101.471 Y80.054 Z0.752 E.01662
+G1 X101.96 Y80.096 Z0.753 E.01662
+G1 X102.448 Y80.15 Z0.754 E.01662
+G1 X102.935 Y80.216 Z0.755 E.01662
+G1 X103.419 Y80.294 Z0.755 E.01662
+G1 X103.902 Y80.384 Z0.756 E.01662
+G1 X104.382 Y80.486 Z0.757 E.01662
+G1 X104.86 Y80.599 Z0.758 E.01662
+G1 X105.334 Y80.724 Z0.759 E.01662
+G1 X105.806 Y80.861 Z0.759 E.01662
+G1 X106.274 Y81.009 Z0.76 E.01662
+G1 X106.738 Y81.169 Z0.761 E.01662
+G1 X107.198 Y81.34 Z0.762 E.01662
+G1 X107.654 Y81.522 Z0.763 E.01662
+G1 X108.105 Y81.716 Z0.763 E.01662
+G1 X108.551 Y81.92 Z0.764 E.01662
+G1 X108.992 Y82.136 Z0.765 E.01662
+G1 X109.428 Y82.362 Z0.766 E.01662
+G1 X109.858 Y82.598 Z0.766 E.01662
+G1 X110.282 Y82.845 Z0.767 E.01662
+G1 X110.7 Y83.103 Z0.768 E.01662
+G1 X111.111 Y83.371 Z0.769 E.01662
+G1 X111.516 Y83.648 Z0.77 E.01662
+G1 X111.914 Y83.936 Z0.77 E.01662
+G1 X112.305 Y84.233 Z0.771 E.01662
+G1 X112.688 Y84.54 Z0.772 E.01662
+G1 X113.063 Y84.856 Z0.773 E.01662
+G1 X113.431 Y85.181 Z0.773 E.01662
+G1 X113.791 Y85.515 Z0.774 E.01662
+G1 X114.142 Y85.858 Z0.775 E.01662
+G1 X114.485 Y86.209 Z0.776 E.01662
+G1 X114.819 Y86.569 Z0.777 E.01662
+G1 X115.144 Y86.937 Z0.777 E.01662
+G1 X115.46 Y87.312 Z0.778 E.01662
+G1 X115.767 Y87.695 Z0.779 E.01662
+G1 X116.064 Y88.086 Z0.78 E.01662
+G1 X116.352 Y88.484 Z0.78 E.01662
+G1 X116.629 Y88.889 Z0.781 E.01662
+G1 X116.897 Y89.3 Z0.782 E.01662
+G1 X117.155 Y89.718 Z0.783 E.01662
+G1 X117.402 Y90.142 Z0.784 E.01662
+G1 X117.638 Y90.572 Z0.784 E.01662
+G1 X117.864 Y91.008 Z0.785 E.01662
+G1 X118.08 Y91.449 Z0.786 E.01662
+G1 X118.284 Y91.895 Z0.787 E.01662
+G1 X118.478 Y92.346 Z0.788 E.01662
+G1 X118.66 Y92.802 Z0.788 E.01662
+G1 X118.831 Y93.262 Z0.789 E.01662
+G1 X118.991 Y93.726 Z0.79 E.01662
+G1 X119.139 Y94.194 Z0.791 E.01662
+G1 X119.276 Y94.666 Z0.791 E.01662
+G1 X119.401 Y95.14 Z0.792 E.01662
+G1 X119.514 Y95.618 Z0.793 E.01662
+G1 X119.616 Y96.098 Z0.794 E.01662
+G1 X119.706 Y96.581 Z0.795 E.01662
+G1 X119.784 Y97.065 Z0.795 E.01662
+G1 X119.85 Y97.552 Z0.796 E.01662
+G1 X119.904 Y98.04 Z0.797 E.01662
+G1 X119.946 Y98.529 Z0.798 E.01662
+G1 X119.976 Y99.019 Z0.798 E.01662
+G1 X119.994 Y99.509 Z0.799 E.01662
+G1 X120 Y100 Z0.8 E.01662
+G1 X119.994 Y100.491 Z0.801 E.01662
+G1 X119.976 Y100.981 Z0.802 E.01662
+G1 X119.946 Y101.471 Z0.802 E.01662
+G1 X119.904 Y101.96 Z0.803 E.01662
+G1 X119.85 Y102.448 Z0.804 E.01662
+G1 X119.784 Y102.935 Z0.805 E.01662
+G1 X119.706 Y103.419 Z0.805 E.01662
+G1 X119.616 Y103.902 Z0.806 E.01662
+G1 X119.514 Y104.382 Z0.807 E.01662
+G1 X119.401 Y104.86 Z0.808 E.01662
+G1 X119.276 Y105.334 Z0.809 E.01662
+G1 X119.139 Y105.806 Z0.809 E.01662
+G1 X118.991 Y106.274 Z0.81 E.01662
+G1 X118.831 Y106.738 Z0.811 E.01662
+G1 X118.66 Y107.198 Z0.812 E.01662
+G1 X118.478 Y107.654 Z0.812 E.01662
+G1 X118.284 Y108.105 Z0.813 E.01662
+G1 X118.08 Y108.551 Z0.814 E.01662
+G1 X117.864 Y108.992 Z0.815 E.01662
+G1 X117.638 Y109.428 Z0.816 E.01662
+G1 X117.402 Y109.858 Z0.816 E.01662
+G1 X117.155 Y110.282 Z0.817 E.01662
+G1 X116.897 Y110.7 Z0.818 E.01662
+G1 X116.629 Y111.111 Z0.819 E.01662
+G1 X116.352 Y111.516 Z0.82 E.01662
+G1 X116.064 Y111.914 Z0.82 E.01662
+G1 X115.767 Y112.305 Z0.821 E.01662
+G1 X115.46 Y112.688 Z0.822 E.01662
+G1 X115.144 Y113.063 Z0.823 E.01662
+G1 X114.819 Y113.431 Z0.823 E.01662
+G1 X114.485 Y113.791 Z0.824 E.01662
+G1 X114.142 Y114.142 Z0.825 E.01662
+G1 X113.791 Y114.485 Z0.826 E.01662
+G1 X113.431 Y114.819 Z0.827 E.01662
+G1 X113.063 Y115.144 Z0.827 E.01662
+G1 X112.688 Y115.46 Z0.828 E.01662
+G1 X112.305 Y115.767 Z0.829 E.01662
+G1 X111.914 Y116.064 Z0.83 E.01662
+G1 X111.516 Y116.352 Z0.83 E.01662
+G1 X111.111 Y116.629 Z0.831 E.01662
+G1 X110.7 Y116.897 Z0.832 E.01662
+G1 X110.282 Y117.155 Z0.833 E.01662
+G1 X109.858 Y117.402 Z0.834 E.01662
+G1 X109.428 Y117.638 Z0.834 E.01662
+G1 X108.992 Y117.864 Z0.835 E.01662
+G1 X108.551 Y118.08 Z0.836 E.01662
+G1 X108.105 Y118.284 Z0.837 E.01662
+G1 X107.654 Y118.478 Z0.838 E.01662
+G1 X107.198 Y118.66 Z0.838 E.01662
+G1 X106.738 Y118.831 Z0.839 E.01662
+G1 X106.274 Y118.991 Z0.84 E.01662
+G1 X105.806 Y119.139 Z0.841 E.01662
+G1 X105.334 Y119.276 Z0.841 E.01662
+G1 X104.86 Y119.401 Z0.842 E.01662
+G1 X104.382 Y119.514 Z0.843 E.01662
+G1 X103.902 Y119.616 Z0.844 E.01662
+G1 X103.419 Y119.706 Z0.845 E.01662
+G1 X102.935 Y119.784 Z0.845 E.01662
+G1 X102.448 Y119.85 Z0.846 E.01662
+G1 X101.96 Y119.904 Z0.847 E.01662
+G1 X101.471 Y119.946 Z0.848 E.01662
+G1 X100.981 Y119.976 Z0.848 E.01662
+G1 X100.491 Y119.994 Z0.849 E.01662
+G1 X100 Y120 Z0.85 E.01662
+G1 X99.509 Y119.994 Z0.851 E.01662
+G1 X99.019 Y119.976 Z0.852 E.01662
+G1 X98.529 Y119.946 Z0.852 E.01662
+G1 X98.04 Y119.904 Z0.853 E.01662
+G1 X97.552 Y119.85 Z0.854 E.01662
+G1 X97.065 Y119.784 Z0.855 E.01662
+G1 X96.581 Y119.706 Z0.855 E.01662
+G1 X96.098 Y119.616 Z0.856 E.01662
+G1 X95.618 Y119.514 Z0.857 E.01662
+G1 X95.14 Y119.401 Z0.858 E.01662
+G1 X94.666 Y119.276 Z0.859 E.01662
+G1 X94.194 Y119.139 Z0.859 E.01662
+G1 X93.726 Y118.991 Z0.86 E.01662
+G1 X93.262 Y118.831 Z0.861 E.01662
+G1 X92.802 Y118.66 Z0.862 E.01662
+G1 X92.346 Y118.478 Z0.863 E.01662
+G1 X91.895 Y118.284 Z0.863 E.01662
+G1 X91.449 Y118.08 Z0.864 E.01662
+G1 X91.008 Y117.864 Z0.865 E.01662
+G1 X90.572 Y117.638 Z0.866 E.01662
+G1 X90.142 Y117.402 Z0.866 E.01662
+G1 X89.718 Y117.155 Z0.867 E.01662
+G1 X89.3 Y116.897 Z0.868 E.01662
+G1 X88.889 Y116.629 Z0.869 E.01662
+G1 X88.484 Y116.352 Z0.87 E.01662
+G1 X88.086 Y116.064 Z0.87 E.01662
+G1 X87.695 Y115.767 Z0.871 E.01662
+G1 X87.312 Y115.46 Z0.872 E.01662
+G1 X86.937 Y115.144 Z0.873 E.01662
+G1 X86.569 Y114.819 Z0.873 E.01662
+G1 X86.209 Y114.485 Z0.874 E.01662
+G1 X85.858 Y114.142 Z0.875 E.01662
+G1 X85.515 Y113.791 Z0.876 E.01662
+G1 X85.181 Y113.431 Z0.877 E.01662
+G1 X84.856 Y113.063 Z0.877 E.01662
+G1 X84.54 Y112.688 Z0.878 E.01662
+G1 X84.233 Y112.305 Z0.879 E.01662
+G1 X83.936 Y111.914 Z0.88 E.01662
+G1 X83.648 Y111.516 Z0.88 E.01662
+G1 X83.371 Y111.111 Z0.881 E.01662
+G1 X83.103 Y110.7 Z0.882 E.01662
+G1 X82.845 Y110.282 Z0.883 E.01662
+G1 X82.598 Y109.858 Z0.884 E.01662
+G1 X82.362 Y109.428 Z0.884 E.01662
+G1 X82.136 Y108.992 Z0.885 E.01662
+G1 X81.92 Y108.551 Z0.886 E.01662
+G1 X81.716 Y108.105 Z0.887 E.01662
+G1 X81.522 Y107.654 Z0.888 E.01662
+G1 X81.34 Y107.198 Z0.888 E.01662
+G1 X81.169 Y106.738 Z0.889 E.01662
+G1 X81.009 Y106.274 Z0.89 E.01662
+G1 X80.861 Y105.806 Z0.891 E.01662
+G1 X80.724 Y105.334 Z0.891 E.01662
+G1 X80.599 Y104.86 Z0.892 E.01662
+G1 X80.486 Y104.382 Z0.893 E.01662
+G1 X80.384 Y103.902 Z0.894 E.01662
+G1 X80.294 Y103.419 Z0.895 E.01662
+G1 X80.216 Y102.935 Z0.895 E.01662
+G1 X80.15 Y102.448 Z0.896 E.01662
+G1 X80.096 Y101.96 Z0.897 E.01662
+G1 X80.054 Y101.471 Z0.898 E.01662
+G1 X80.024 Y100.981 Z0.898 E.01662
+G1 X80.006 Y100.491 Z0.899 E.01662
+G1 X80 Y100 Z0.9 E.01662
+G1 X80.006 Y99.509 Z0.901 E.01662
+G1 X80.024 Y99.019 Z0.902 E.01662
+G1 X80.054 Y98.529 Z0.902 E.01662
+G1 X80.096 Y98.04 Z0.903 E.01662
+G1 X80.15 Y97.552 Z0.904 E.01662
+G1 X80.216 Y97.065 Z0.905 E.01662
+G1 X80.294 Y96.581 Z0.905 E.01662
+G1 X80.384 Y96.098 Z0.906 E.01662
+G1 X80.486 Y95.618 Z0.907 E.01662
+G1 X80.599 Y95.14 Z0.908 E.01662
+G1 X80.724 Y94.666 Z0.909 E.01662
+G1 X80.861 Y94.194 Z0.909 E.01662
+G1 X81.009 Y93.726 Z0.91 E.01662
+G1 X81.169 Y93.262 Z0.911 E.01662
+G1 X81.34 Y92.802 Z0.912 E.01662
+G1 X81.522 Y92.346 Z0.913 E.01662
+G1 X81.716 Y91.895 Z0.913 E.01662
+G1 X81.92 Y91.449 Z0.914 E.01662
+G1 X82.136 Y91.008 Z0.915 E.01662
+G1 X82.362 Y90.572 Z0.916 E.01662
+G1 X82.598 Y90.142 Z0.916 E.01662
+G1 X82.845 Y89.718 Z0.917 E.01662
+G1 X83.103 Y89.3 Z0.918 E.01662
+G1 X83.371 Y88.889 Z0.919 E.01662
+G1 X83.648 Y88.484 Z0.92 E.01662
+G1 X83.936 Y88.086 Z0.92 E.01662
+G1 X84.233 Y87.695 Z0.921 E.01662
+G1 X84.54 Y87.312 Z0.922 E.01662
+G1 X84.856 Y86.937 Z0.923 E.01662
+G1 X85.181 Y86.569 Z0.923 E.01662
+G1 X85.515 Y86.209 Z0.924 E.01662
+G1 X85.858 Y85.858 Z0.925 E.01662
+G1 X86.209 Y85.515 Z0.926 E.01662
+G1 X86.569 Y85.181 Z0.927 E.01662
+G1 X86.937 Y84.856 Z0.927 E.01662
+G1 X87.312 Y84.54 Z0.928 E.01662
+G1 X87.695 Y84.233 Z0.929 E.01662
+G1 X88.086 Y83.936 Z0.93 E.01662
+G1 X88.484 Y83.648 Z0.93 E.01662
+G1 X88.889 Y83.371 Z0.931 E.01662
+G1 X89.3 Y83.103 Z0.932 E.01662
+G1 X89.718 Y82.845 Z0.933 E.01662
+G1 X90.142 Y82.598 Z0.934 E.01662
+G1 X90.572 Y82.362 Z0.934 E.01662
+G1 X91.008 Y82.136 Z0.935 E.01662
+G1 X91.449 Y81.92 Z0.936 E.01662
+G1 X91.895 Y81.716 Z0.937 E.01662
+G1 X92.346 Y81.522 Z0.938 E.01662
+G1 X92.802 Y81.34 Z0.938 E.01662
+G1 X93.262 Y81.169 Z0.939 E.01662
+G1 X93.726 Y81.009 Z0.94 E.01662
+G1 X94.194 Y80.861 Z0.941 E.01662
+G1 X94.666 Y80.724 Z0.941 E.01662
+G1 X95.14 Y80.599 Z0.942 E.01662
+G1 X95.618 Y80.486 Z0.943 E.01662
+G1 X96.098 Y80.384 Z0.944 E.01662
+G1 X96.581 Y80.294 Z0.945 E.01662
+G1 X97.065 Y80.216 Z0.945 E.01662
+G1 X97.552 Y80.15 Z0.946 E.01662
+G1 X98.04 Y80.096 Z0.947 E.01662
+G1 X98.529 Y80.054 Z0.948 E.01662
+G1 X99.019 Y80.024 Z0.948 E.01662
+G1 X99.509 Y80.006 Z0.949 E.01662
+G1 X100 Y80 Z0.95 E.01662
+G1 X100.491 Y80.006 Z0.951 E.01662
+G1 X100.981 Y80.024 Z0.952 E.01662
+G1 X101.471 Y80.054 Z0.952 E.01662
+G1 X101.96 Y80.096 Z0.953 E.01662
+G1 X102.448 Y80.15 Z0.954 E.01662
+G1 X102.935 Y80.216 Z0.955 E.01662
+G1 X103.419 Y80.294 Z0.955 E.01662
+G1 X103.902 Y80.384 Z0.956 E.01662
+G1 X104.382 Y80.486 Z0.957 E.01662
+G1 X104.86 Y80.599 Z0.958 E.01662
+G1 X105.334 Y80.724 Z0.959 E.01662
+G1 X105.806 Y80.861 Z0.959 E.01662
+G1 X106.274 Y81.009 Z0.96 E.01662
+G1 X106.738 Y81.169 Z0.961 E.01662
+G1 X107.198 Y81.34 Z0.962 E.01662
+G1 X107.654 Y81.522 Z0.963 E.01662
+G1 X108.105 Y81.716 Z0.963 E.01662
+G1 X108.551 Y81.92 Z0.964 E.01662
+G1 X108.992 Y82.136 Z0.965 E.01662
+G1 X109.428 Y82.362 Z0.966 E.01662
+G1 X109.858 Y82.598 Z0.966 E.01662
+G1 X110.282 Y82.845 Z0.967 E.01662
+G1 X110.7 Y83.103 Z0.968 E.01662
+G1 X111.111 Y83.371 Z0.969 E.01662
+G1 X111.516 Y83.648 Z0.97 E.01662
+G1 X111.914 Y83.936 Z0.97 E.01662
+G1 X112.305 Y84.233 Z0.971 E.01662
+G1 X112.688 Y84.54 Z0.972 E.01662
+G1 X113.063 Y84.856 Z0.973 E.01662
+G1 X113.431 Y85.181 Z0.973 E.01662
+G1 X113.791 Y85.515 Z0.974 E.01662
+G1 X114.142 Y85.858 Z0.975 E.01662
+G1 X114.485 Y86.209 Z0.976 E.01662
+G1 X114.819 Y86.569 Z0.977 E.01662
+G1 X115.144 Y86.937 Z0.977 E.01662
+G1 X115.46 Y87.312 Z0.978 E.01662
+G1 X115.767 Y87.695 Z0.979 E.01662
+G1 X116.064 Y88.086 Z0.98 E.01662
+G1 X116.352 Y88.484 Z0.98 E.01662
+G1 X116.629 Y88.889 Z0.981 E.01662
+G1 X116.897 Y89.3 Z0.982 E.01662
+G1 X117.155 Y89.718 Z0.983 E.01662
+G1 X117.402 Y90.142 Z0.984 E.01662
+G1 X117.638 Y90.572 Z0.984 E.01662
+G1 X117.864 Y91.008 Z0.985 E.01662
+G1 X118.08 Y91.449 Z0.986 E.01662
+G1 X118.284 Y91.895 Z0.987 E.01662
+G1 X118.478 Y92.346 Z0.988 E.01662
+G1 X118.66 Y92.802 Z0.988 E.01662
+G1 X118.831 Y93.262 Z0.989 E.01662
+G1 X118.991 Y93.726 Z0.99 E.01662
+G1 X119.139 Y94.194 Z0.991 E.01662
+G1 X119.276 Y94.666 Z0.991 E.01662
+G1 X119.401 Y95.14 Z0.992 E.01662
+G1 X119.514 Y95.618 Z0.993 E.01662
+G1 X119.616 Y96.098 Z0.994 E.01662
+G1 X119.706 Y96.581 Z0.995 E.01662
+G1 X119.784 Y97.065 Z0.995 E.01662
+G1 X119.85 Y97.552 Z0.996 E.01662
+G1 X119.904 Y98.04 Z0.997 E.01662
+G1 X119.946 Y98.529 Z0.998 E.01662
+G1 X119.976 Y99.019 Z0.998 E.01662
+G1 X119.994 Y99.509 Z0.999 E.01662
+G1 X120 Y100 Z1 E.01662
+G1 X119.994 Y100.491 Z1.001 E.01662
+G1 X119.976 Y100.981 Z1.002 E.01662
+G1 X119.946 Y101.471 Z1.002 E.01662
+G1 X119.904 Y101.96 Z1.003 E.01662
+G1 X119.85 Y102.448 Z1.004 E.01662
+G1 X119.784 Y102.935 Z1.005 E.01662
+G1 X119.706 Y103.419 Z1.005 E.01662
+G1 X119.616 Y103.902 Z1.006 E.01662
+G1 X119.514 Y104.382 Z1.007 E.01662
+G1 X119.401 Y104.86 Z1.008 E.01662
+G1 X119.276 Y105.334 Z1.009 E.01662
+G1 X119.139 Y105.806 Z1.009 E.01662
+G1 X118.991 Y106.274 Z1.01 E.01662
+G1 X118.831 Y106.738 Z1.011 E.01662
+G1 X118.66 Y107.198 Z1.012 E.01662
+G1 X118.478 Y107.654 Z1.012 E.01662
+G1 X118.284 Y108.105 Z1.013 E.01662
+G1 X118.08 Y108.551 Z1.014 E.01662
+G1 X117.864 Y108.992 Z1.015 E.01662
+G1 X117.638 Y109.428 Z1.016 E.01662
+G1 X117.402 Y109.858 Z1.016 E.01662
+G1 X117.155 Y110.282 Z1.017 E.01662
+G1 X116.897 Y110.7 Z1.018 E.01662
+G1 X116.629 Y111.111 Z1.019 E.01662
+G1 X116.352 Y111.516 Z1.02 E.01662
+G1 X116.064 Y111.914 Z1.02 E.01662
+G1 X115.767 Y112.305 Z1.021 E.01662
+G1 X115.46 Y112.688 Z1.022 E.01662
+G1 X115.144 Y113.063 Z1.023 E.01662
+G1 X114.819 Y113.431 Z1.023 E.01662
+G1 X114.485 Y113.791 Z1.024 E.01662
+G1 X114.142 Y114.142 Z1.025 E.01662
+G1 X113.791 Y114.485 Z1.026 E.01662
+G1 X113.431 Y114.819 Z1.027 E.01662
+G1 X113.063 Y115.144 Z1.027 E.01662
+G1 X112.688 Y115.46 Z1.028 E.01662
+G1 X112.305 Y115.767 Z1.029 E.01662
+G1 X111.914 Y116.064 Z1.03 E.01662
+G1 X111.516 Y116.352 Z1.03 E.01662
+G1 X111.111 Y116.629 Z1.031 E.01662
+G1 X110.7 Y116.897 Z1.032 E.01662
+G1 X110.282 Y117.155 Z1.033 E.01662
+G1 X109.858 Y117.402 Z1.034 E.01662
+G1 X109.428 Y117.638 Z1.034 E.01662
+G1 X108.992 Y117.864 Z1.035 E.01662
+G1 X108.551 Y118.08 Z1.036 E.01662
+G1 X108.105 Y118.284 Z1.037 E.01662
+G1 X107.654 Y118.478 Z1.038 E.01662
+G1 X107.198 Y118.66 Z1.038 E.01662
+G1 X106.738 Y118.831 Z1.039 E.01662
+G1 X106.274 Y118.991 Z1.04 E.01662
+G1 X105.806 Y119.139 Z1.041 E.01662
+G1 X105.334 Y119.276 Z1.041 E.01662
+G1 X104.86 Y119.401 Z1.042 E.01662
+G1 X104.382 Y119.514 Z1.043 E.01662
+G1 X103.902 Y119.616 Z1.044 E.01662
+G1 X103.419 Y119.706 Z1.045 E.01662
+G1 X102.935 Y119.784 Z1.045 E.01662
+G1 X102.448 Y119.85 Z1.046 E.01662
+G1 X101.96 Y119.904 Z1.047 E.01662
+G1 X101.471 Y119.946 Z1.048 E.01662
+G1 X100.981 Y119.976 Z1.048 E.01662
+G1 X100.491 Y119.994 Z1.049 E.01662
+G1 X100 Y120 Z1.05 E.01662
+G1 X99.509 Y119.994 Z1.051 E.01662
+G1 X99.019 Y119.976 Z1.052 E.01662
+G1 X98.529 Y119.946 Z1.052 E.01662
+G1 X98.04 Y119.904 Z1.053 E.01662
+G1 X97.552 Y119.85 Z1.054 E.01662
+G1 X97.065 Y119.784 Z1.055 E.01662
+G1 X96.581 Y119.706 Z1.055 E.01662
+G1 X96.098 Y119.616 Z1.056 E.01662
+G1 X95.618 Y119.514 Z1.057 E.01662
+G1 X95.14 Y119.401 Z1.058 E.01662
+G1 X94.666 Y119.276 Z1.059 E.01662
+G1 X94.194 Y119.139 Z1.059 E.01662
+G1 X93.726 Y118.991 Z1.06 E.01662
+G1 X93.262 Y118.831 Z1.061 E.01662
+G1 X92.802 Y118.66 Z1.062 E.01662
+G1 X92.346 Y118.478 Z1.062 E.01662
+G1 X91.895 Y118.284 Z1.063 E.01662
+G1 X91.449 Y118.08 Z1.064 E.01662
+G1 X91.008 Y117.864 Z1.065 E.01662
+G1 X90.572 Y117.638 Z1.066 E.01662
+G1 X90.142 Y117.402 Z1.066 E.01662
+G1 X89.718 Y117.155 Z1.067 E.01662
+G1 X89.3 Y116.897 Z1.068 E.01662
+G1 X88.889 Y116.629 Z1.069 E.01662
+G1 X88.484 Y116.352 Z1.07 E.01662
+G1 X88.086 Y116.064 Z1.07 E.01662
+G1 X87.695 Y115.767 Z1.071 E.01662
+G1 X87.312 Y115.46 Z1.072 E.01662
+G1 X86.937 Y115.144 Z1.073 E.01662
+G1 X86.569 Y114.819 Z1.073 E.01662
+G1 X86.209 Y114.485 Z1.074 E.01662
+G1 X85.858 Y114.142 Z1.075 E.01662
+G1 X85.515 Y113.791 Z1.076 E.01662
+G1 X85.181 Y113.431 Z1.077 E.01662
+G1 X84.856 Y113.063 Z1.077 E.01662
+G1 X84.54 Y112.688 Z1.078 E.01662
+G1 X84.233 Y112.305 Z1.079 E.01662
+G1 X83.936 Y111.914 Z1.08 E.01662
+G1 X83.648 Y111.516 Z1.08 E.01662
+G1 X83.371 Y111.111 Z1.081 E.01662
+G1 X83.103 Y110.7 Z1.082 E.01662
+G1 X82.845 Y110.282 Z1.083 E.01662
+G1 X82.598 Y109.858 Z1.084 E.01662
+G1 X82.362 Y109.428 Z1.084 E.01662
+G1 X82.136 Y108.992 Z1.085 E.01662
+G1 X81.92 Y108.551 Z1.086 E.01662
+G1 X81.716 Y108.105 Z1.087 E.01662
+G1 X81.522 Y107.654 Z1.087 E.01662
+G1 X81.34 Y107.198 Z1.088 E.01662
+G1 X81.169 Y106.738 Z1.089 E.01662
+G1 X81.009 Y106.274 Z1.09 E.01662
+G1 X80.861 Y105.806 Z1.091 E.01662
+G1 X80.724 Y105.334 Z1.091 E.01662
+G1 X80.599 Y104.86 Z1.092 E.01662
+G1 X80.486 Y104.382 Z1.093 E.01662
+G1 X80.384 Y103.902 Z1.094 E.01662
+G1 X80.294 Y103.419 Z1.095 E.01662
+G1 X80.216 Y102.935 Z1.095 E.01662
+G1 X80.15 Y102.448 Z1.096 E.01662
+G1 X80.096 Y101.96 Z1.097 E.01662
+G1 X80.054 Y101.471 Z1.098 E.01662
+G1 X80.024 Y100.981 Z1.098 E.01662
+G1 X80.006 Y100.491 Z1.099 E.01662
+G1 X80 Y100 Z1.1 E.01662
+G1 X80.006 Y99.509 Z1.101 E.01662
+G1 X80.024 Y99.019 Z1.102 E.01662
+G1 X80.054 Y98.529 Z1.102 E.01662
+G1 X80.096 Y98.04 Z1.103 E.01662
+G1 X80.15 Y97.552 Z1.104 E.01662
+G1 X80.216 Y97.065 Z1.105 E.01662
+G1 X80.294 Y96.581 Z1.105 E.01662
+G1 X80.384 Y96.098 Z1.106 E.01662
+G1 X80.486 Y95.618 Z1.107 E.01662
+G1 X80.599 Y95.14 Z1.108 E.01662
+G1 X80.724 Y94.666 Z1.109 E.01662
+G1 X80.861 Y94.194 Z1.109 E.01662
+G1 X81.009 Y93.726 Z1.11 E.01662
+G1 X81.169 Y93.262 Z1.111 E.01662
+G1 X81.34 Y92.802 Z1.112 E.01662
+G1 X81.522 Y92.346 Z1.113 E.01662
+G1 X81.716 Y91.895 Z1.113 E.01662
+G1 X81.92 Y91.449 Z1.114 E.01662
+G1 X82.136 Y91.008 Z1.115 E.01662
+G1 X82.362 Y90.572 Z1.116 E.01662
+G1 X82.598 Y90.142 Z1.116 E.01662
+G1 X82.845 Y89.718 Z1.117 E.01662
+G1 X83.103 Y89.3 Z1.118 E.01662
+G1 X83.371 Y88.889 Z1.119 E.01662
+G1 X83.648 Y88.484 Z1.12 E.01662
+G1 X83.936 Y88.086 Z1.12 E.01662
+G1 X84.233 Y87.695 Z1.121 E.01662
+G1 X84.54 Y87.312 Z1.122 E.01662
+G1 X84.856 Y86.937 Z1.123 E.01662
+G1 X85.181 Y86.569 Z1.123 E.01662
+G1 X85.515 Y86.209 Z1.124 E.01662
+G1 X85.858 Y85.858 Z1.125 E.01662
+G1 X86.209 Y85.515 Z1.126 E.01662
+G1 X86.569 Y85.181 Z1.127 E.01662
+G1 X86.937 Y84.856 Z1.127 E.01662
+G1 X87.312 Y84.54 Z1.128 E.01662
+G1 X87.695 Y84.233 Z1.129 E.01662
+G1 X88.086 Y83.936 Z1.13 E.01662
+G1 X88.484 Y83.648 Z1.13 E.01662
+G1 X88.889 Y83.371 Z1.131 E.01662
+G1 X89.3 Y83.103 Z1.132 E.01662
+G1 X89.718 Y82.845 Z1.133 E.01662
+G1 X90.142 Y82.598 Z1.134 E.01662
+G1 X90.572 Y82.362 Z1.134 E.01662
+G1 X91.008 Y82.136 Z1.135 E.01662
+G1 X91.449 Y81.92 Z1.136 E.01662
+G1 X91.895 Y81.716 Z1.137 E.01662
+G1 X92.346 Y81.522 Z1.137 E.01662
+G1 X92.802 Y81.34 Z1.138 E.01662
+G1 X93.262 Y81.169 Z1.139 E.01662
+G1 X93.726 Y81.009 Z1.14 E.01662
+G1 X94.194 Y80.861 Z1.141 E.01662
+G1 X94.666 Y80.724 Z1.141 E.01662
+G1 X95.14 Y80.599 Z1.142 E.01662
+G1 X95.618 Y80.486 Z1.143 E.01662
+G1 X96.098 Y80.384 Z1.144 E.01662
+G1 X96.581 Y80.294 Z1.145 E.01662
+G1 X97.065 Y80.216 Z1.145 E.01662
+G1 X97.552 Y80.15 Z1.146 E.01662
+G1 X98.04 Y80.096 Z1.147 E.01662
+G1 X98.529 Y80.054 Z1.148 E.01662
+G1 X99.019 Y80.024 Z1.148 E.01662
+G1 X99.509 Y80.006 Z1.149 E.01662
+G1 X100 Y80 Z1.15 E.01662
+G1 X100.491 Y80.006 Z1.151 E.01662
+G1 X100.981 Y80.024 Z1.152 E.01662
+G1 X101.471 Y80.054 Z1.152 E.01662
+G1 X101.96 Y80.096 Z1.153 E.01662
+G1 X102.448 Y80.15 Z1.154 E.01662
+G1 X102.935 Y80.216 Z1.155 E.01662
+G1 X103.419 Y80.294 Z1.155 E.01662
+G1 X103.902 Y80.384 Z1.156 E.01662
+G1 X104.382 Y80.486 Z1.157 E.01662
+G1 X104.86 Y80.599 Z1.158 E.01662
+G1 X105.334 Y80.724 Z1.159 E.01662
+G1 X105.806 Y80.861 Z1.159 E.01662
+G1 X106.274 Y81.009 Z1.16 E.01662
+G1 X106.738 Y81.169 Z1.161 E.01662
+G1 X107.198 Y81.34 Z1.162 E.01662
+G1 X107.654 Y81.522 Z1.163 E.01662
+G1 X108.105 Y81.716 Z1.163 E.01662
+G1 X108.551 Y81.92 Z1.164 E.01662
+G1 X108.992 Y82.136 Z1.165 E.01662
+G1 X109.428 Y82.362 Z1.166 E.01662
+G1 X109.858 Y82.598 Z1.166 E.01662
+G1 X110.282 Y82.845 Z1.167 E.01662
+G1 X110.7 Y83.103 Z1.168 E.01662
+G1 X111.111 Y83.371 Z1.169 E.01662
+G1 X111.516 Y83.648 Z1.17 E.01662
+G1 X111.914 Y83.936 Z1.17 E.01662
+G1 X112.305 Y84.233 Z1.171 E.01662
+G1 X112.688 Y84.54 Z1.172 E.01662
+G1 X113.063 Y84.856 Z1.173 E.01662
+G1 X113.431 Y85.181 Z1.173 E.01662
+G1 X113.791 Y85.515 Z1.174 E.01662
+G1 X114.142 Y85.858 Z1.175 E.01662
+G1 X114.485 Y86.209 Z1.176 E.01662
+G1 X114.819 Y86.569 Z1.177 E.01662
+G1 X115.144 Y86.937 Z1.177 E.01662
+G1 X115.46 Y87.312 Z1.178 E.01662
+G1 X115.767 Y87.695 Z1.179 E.01662
+G1 X116.064 Y88.086 Z1.18 E.01662
+G1 X116.352 Y88.484 Z1.18 E.01662
+G1 X116.629 Y88.889 Z1.181 E.01662
+G1 X116.897 Y89.3 Z1.182 E.01662
+G1 X117.155 Y89.718 Z1.183 E.01662
+G1 X117.402 Y90.142 Z1.184 E.01662
+G1 X117.638 Y90.572 Z1.184 E.01662
+G1 X117.864 Y91.008 Z1.185 E.01662
+G1 X118.08 Y91.449 Z1.186 E.01662
+G1 X118.284 Y91.895 Z1.187 E.01662
+G1 X118.478 Y92.346 Z1.188 E.01662
+G1 X118.66 Y92.802 Z1.188 E.01662
+G1 X118.831 Y93.262 Z1.189 E.01662
+G1 X118.991 Y93.726 Z1.19 E.01662
+G1 X119.139 Y94.194 Z1.191 E.01662
+G1 X119.276 Y94.666 Z1.191 E.01662
+G1 X119.401 Y95.14 Z1.192 E.01662
+G1 X119.514 Y95.618 Z1.193 E.01662
+G1 X119.616 Y96.098 Z1.194 E.01662
+G1 X119.706 Y96.581 Z1.195 E.01662
+G1 X119.784 Y97.065 Z1.195 E.01662
+G1 X119.85 Y97.552 Z1.196 E.01662
+G1 X119.904 Y98.04 Z1.197 E.01662
+G1 X119.946 Y98.529 Z1.198 E.01662
+G1 X119.976 Y99.019 Z1.198 E.01662
+G1 X119.994 Y99.509 Z1.199 E.01662
+G1 X120 Y100 Z1.2 E.01662
+G1 X119.994 Y100.491 Z1.201 E.01662
+G1 X119.976 Y100.981 Z1.202 E.01662
+G1 X119.946 Y101.471 Z1.202 E.01662
+G1 X119.904 Y101.96 Z1.203 E.01662
+G1 X119.85 Y102.448 Z1.204 E.01662
+G1 X119.784 Y102.935 Z1.205 E.01662
+G1 X119.706 Y103.419 Z1.205 E.01662
+G1 X119.616 Y103.902 Z1.206 E.01662
+G1 X119.514 Y104.382 Z1.207 E.01662
+G1 X119.401 Y104.86 Z1.208 E.01662
+G1 X119.276 Y105.334 Z1.209 E.01662
+G1 X119.139 Y105.806 Z1.209 E.01662
+G1 X118.991 Y106.274 Z1.21 E.01662
+G1 X118.831 Y106.738 Z1.211 E.01662
+G1 X118.66 Y107.198 Z1.212 E.01662
+G1 X118.478 Y107.654 Z1.212 E.01662
+G1 X118.284 Y108.105 Z1.213 E.01662
+G1 X118.08 Y108.551 Z1.214 E.01662
+G1 X117.864 Y108.992 Z1.215 E.01662
+G1 X117.638 Y109.428 Z1.216 E.01662
+G1 X117.402 Y109.858 Z1.216 E.01662
+G1 X117.155 Y110.282 Z1.217 E.01662
+G1 X116.897 Y110.7 Z1.218 E.01662
+G1 X116.629 Y111.111 Z1.219 E.01662
+G1 X116.352 Y111.516 Z1.22 E.01662
+G1 X116.064 Y111.914 Z1.22 E.01662
+G1 X115.767 Y112.305 Z1.221 E.01662
+G1 X115.46 Y112.688 Z1.222 E.01662
+G1 X115.144 Y113.063 Z1.223 E.01662
+G1 X114.819 Y113.431 Z1.223 E.01662
+G1 X114.485 Y113.791 Z1.224 E.01662
+G1 X114.142 Y114.142 Z1.225 E.01662
+G1 X113.791 Y114.485 Z1.226 E.01662
+G1 X113.431 Y114.819 Z1.227 E.01662
+G1 X113.063 Y115.144 Z1.227 E.01662
+G1 X112.688 Y115.46 Z1.228 E.01662
+G1 X112.305 Y115.767 Z1.229 E.01662
+G1 X111.914 Y116.064 Z1.23 E.01662
+G1 X111.516 Y116.352 Z1.23 E.01662
+G1 X111.111 Y116.629 Z1.231 E.01662
+G1 X110.7 Y116.897 Z1.232 E.01662
+G1 X110.282 Y117.155 Z1.233 E.01662
+G1 X109.858 Y117.402 Z1.234 E.01662
+G1 X109.428 Y117.638 Z1.234 E.01662
+G1 X108.992 Y117.864 Z1.235 E.01662
+G1 X108.551 Y118.08 Z1.236 E.01662
+G1 X108.105 Y118.284 Z1.237 E.01662
+G1 X107.654 Y118.478 Z1.238 E.01662
+G1 X107.198 Y118.66 Z1.238 E.01662
+G1 X106.738 Y118.831 Z1.239 E.01662
+G1 X106.274 Y118.991 Z1.24 E.01662
+G1 X105.806 Y119.139 Z1.241 E.01662
+G1 X105.334 Y119.276 Z1.241 E.01662
+G1 X104.86 Y119.401 Z1.242 E.01662
+G1 X104.382 Y119.514 Z1.243 E.01662
+G1 X103.902 Y119.616 Z1.244 E.01662
+G1 X103.419 Y119.706 Z1.245 E.01662
+G1 X102.935 Y119.784 Z1.245 E.01662
+G1 X102.448 Y119.85 Z1.246 E.01662
+G1 X101.96 Y119.904 Z1.247 E.01662
+G1 X101.471 Y119.946 Z1.248 E.01662
+G1 X100.981 Y119.976 Z1.248 E.01662
+G1 X100.491 Y119.994 Z1.249 E.01662
+G1 X100 Y120 Z1.25 E.01662
+G1 X99.509 Y119.994 Z1.251 E.01662
+G1 X99.019 Y119.976 Z1.252 E.01662
+G1 X98.529 Y119.946 Z1.252 E.01662
+G1 X98.04 Y119.904 Z1.253 E.01662
+G1 X97.552 Y119.85 Z1.254 E.01662
+G1 X97.065 Y119.784 Z1.255 E.01662
+G1 X96.581 Y119.706 Z1.255 E.01662
+G1 X96.098 Y119.616 Z1.256 E.01662
+G1 X95.618 Y119.514 Z1.257 E.01662
+G1 X95.14 Y119.401 Z1.258 E.01662
+G1 X94.666 Y119.276 Z1.259 E.01662
+G1 X94.194 Y119.139 Z1.259 E.01662
+G1 X93.726 Y118.991 Z1.26 E.01662
+G1 X93.262 Y118.831 Z1.261 E.01662
+G1 X92.802 Y118.66 Z1.262 E.01662
+G1 X92.346 Y118.478 Z1.262 E.01662
+G1 X91.895 Y118.284 Z1.263 E.01662
+G1 X91.449 Y118.08 Z1.264 E.01662
+G1 X91.008 Y117.864 Z1.265 E.01662
+G1 X90.572 Y117.638 Z1.266 E.01662
+G1 X90.142 Y117.402 Z1.266 E.01662
+G1 X89.718 Y117.155 Z1.267 E.01662
+G1 X89.3 Y116.897 Z1.268 E.01662
+G1 X88.889 Y116.629 Z1.269 E.01662
+G1 X88.484 Y116.352 Z1.27 E.01662
+G1 X88.086 Y116.064 Z1.27 E.01662
+G1 X87.695 Y115.767 Z1.271 E.01662
+G1 X87.312 Y115.46 Z1.272 E.01662
+G1 X86.937 Y115.144 Z1.273 E.01662
+G1 X86.569 Y114.819 Z1.273 E.01662
+G1 X86.209 Y114.485 Z1.274 E.01662
+G1 X85.858 Y114.142 Z1.275 E.01662
+G1 X85.515 Y113.791 Z1.276 E.01662
+G1 X85.181 Y113.431 Z1.277 E.01662
+G1 X84.856 Y113.063 Z1.277 E.01662
+G1 X84.54 Y112.688 Z1.278 E.01662
+G1 X84.233 Y112.305 Z1.279 E.01662
+G1 X83.936 Y111.914 Z1.28 E.01662
+G1 X83.648 Y111.516 Z1.28 E.01662
+G1 X83.371 Y111.111 Z1.281 E.01662
+G1 X83.103 Y110.7 Z1.282 E.01662
+G1 X82.845 Y110.282 Z1.283 E.01662
+G1 X82.598 Y109.858 Z1.284 E.01662
+G1 X82.362 Y109.428 Z1.284 E.01662
+G1 X82.136 Y108.992 Z1.285 E.01662
+G1 X81.92 Y108.551 Z1.286 E.01662
+G1 X81.716 Y108.105 Z1.287 E.01662
+G1 X81.522 Y107.654 Z1.287 E.01662
+G1 X81.34 Y107.198 Z1.288 E.01662
+G1 X81.169 Y106.738 Z1.289 E.01662
+G1 X81.009 Y106.274 Z1.29 E.01662
+G1 X80.861 Y105.806 Z1.291 E.01662
+G1 X80.724 Y105.334 Z1.291 E.01662
+G1 X80.599 Y104.86 Z1.292 E.01662
+G1 X80.486 Y104.382 Z1.293 E.01662
+G1 X80.384 Y103.902 Z1.294 E.01662
+G1 X80.294 Y103.419 Z1.295 E.01662
+G1 X80.216 Y102.935 Z1.295 E.01662
+G1 X80.15 Y102.448 Z1.296 E.01662
+G1 X80.096 Y101.96 Z1.297 E.01662
+G1 X80.054 Y101.471 Z1.298 E.01662
+G1 X80.024 Y100.981 Z1.298 E.01662
+G1 X80.006 Y100.491 Z1.299 E.01662
+G1 X80 Y100 Z1.3 E.01662
+G1 X80.006 Y99.509 Z1.301 E.01662
+G1 X80.024 Y99.019 Z1.302 E.01662
+G1 X80.054 Y98.529 Z1.302 E.01662
+G1 X80.096 Y98.04 Z1.303 E.01662
+G1 X80.15 Y97.552 Z1.304 E.01662
+G1 X80.216 Y97.065 Z1.305 E.01662
+G1 X80.294 Y96.581 Z1.305 E.01662
+G1 X80.384 Y96.098 Z1.306 E.01662
+G1 X80.486 Y95.618 Z1.307 E.01662
+G1 X80.599 Y95.14 Z1.308 E.01662
+G1 X80.724 Y94.666 Z1.309 E.01662
+G1 X80.861 Y94.194 Z1.309 E.01662
+G1 X81.009 Y93.726 Z1.31 E.01662
+G1 X81.169 Y93.262 Z1.311 E.01662
+G1 X81.34 Y92.802 Z1.312 E.01662
+G1 X81.522 Y92.346 Z1.312 E.01662
+G1 X81.716 Y91.895 Z1.313 E.01662
+G1 X81.92 Y91.449 Z1.314 E.01662
+G1 X82.136 Y91.008 Z1.315 E.01662
+G1 X82.362 Y90.572 Z1.316 E.01662
+G1 X82.598 Y90.142 Z1.316 E.01662
+G1 X82.845 Y89.718 Z1.317 E.01662
+G1 X83.103 Y89.3 Z1.318 E.01662
+G1 X83.371 Y88.889 Z1.319 E.01662
+G1 X83.648 Y88.484 Z1.32 E.01662
+G1 X83.936 Y88.086 Z1.32 E.01662
+G1 X84.233 Y87.695 Z1.321 E.01662
+G1 X84.54 Y87.312 Z1.322 E.01662
+G1 X84.856 Y86.937 Z1.323 E.01662
+G1 X85.181 Y86.569 Z1.323 E.01662
+G1 X85.515 Y86.209 Z1.324 E.01662
+G1 X85.858 Y85.858 Z1.325 E.01662
+G1 X86.209 Y85.515 Z1.326 E.01662
+G1 X86.569 Y85.181 Z1.327 E.01662
+G1 X86.937 Y84.856 Z1.327 E.01662
+G1 X87.312 Y84.54 Z1.328 E.01662
+G1 X87.695 Y84.233 Z1.329 E.01662
+G1 X88.086 Y83.936 Z1.33 E.01662
+G1 X88.484 Y83.648 Z1.33 E.01662
+G1 X88.889 Y83.371 Z1.331 E.01662
+G1 X89.3 Y83.103 Z1.332 E.01662
+G1 X89.718 Y82.845 Z1.333 E.01662
+G1 X90.142 Y82.598 Z1.334 E.01662
+G1 X90.572 Y82.362 Z1.334 E.01662
+G1 X91.008 Y82.136 Z1.335 E.01662
+G1 X91.449 Y81.92 Z1.336 E.01662
+G1 X91.895 Y81.716 Z1.337 E.01662
+G1 X92.346 Y81.522 Z1.337 E.01662
+G1 X92.802 Y81.34 Z1.338 E.01662
+G1 X93.262 Y81.169 Z1.339 E.01662
+G1 X93.726 Y81.009 Z1.34 E.01662
+G1 X94.194 Y80.861 Z1.341 E.01662
+G1 X94.666 Y80.724 Z1.341 E.01662
+G1 X95.14 Y80.599 Z1.342 E.01662
+G1 X95.618 Y80.486 Z1.343 E.01662
+G1 X96.098 Y80.384 Z1.344 E.01662
+G1 X96.581 Y80.294 Z1.345 E.01662
+G1 X97.065 Y80.216 Z1.345 E.01662
+G1 X97.552 Y80.15 Z1.346 E.01662
+G1 X98.04 Y80.096 Z1.347 E.01662
+G1 X98.529 Y80.054 Z1.348 E.01662
+G1 X99.019 Y80.024 Z1.348 E.01662
+G1 X99.509 Y80.006 Z1.349 E.01662
+G1 X100 Y80 Z1.35 E.01662
+G1 X100.491 Y80.006 Z1.351 E.01662
+G1 X100.981 Y80.024 Z1.352 E.01662
+G1 X101.471 Y80.054 Z1.352 E.01662
+G1 X101.96 Y80.096 Z1.353 E.01662
+G1 X102.448 Y80.15 Z1.354 E.01662
+G1 X102.935 Y80.216 Z1.355 E.01662
+G1 X103.419 Y80.294 Z1.355 E.01662
+G1 X103.902 Y80.384 Z1.356 E.01662
+G1 X104.382 Y80.486 Z1.357 E.01662
+G1 X104.86 Y80.599 Z1.358 E.01662
+G1 X105.334 Y80.724 Z1.359 E.01662
+G1 X105.806 Y80.861 Z1.359 E.01662
+G1 X106.274 Y81.009 Z1.36 E.01662
+G1 X106.738 Y81.169 Z1.361 E.01662
+G1 X107.198 Y81.34 Z1.362 E.01662
+G1 X107.654 Y81.522 Z1.363 E.01662
+G1 X108.105 Y81.716 Z1.363 E.01662
+G1 X108.551 Y81.92 Z1.364 E.01662
+G1 X108.992 Y82.136 Z1.365 E.01662
+G1 X109.428 Y82.362 Z1.366 E.01662
+G1 X109.858 Y82.598 Z1.366 E.01662
+G1 X110.282 Y82.845 Z1.367 E.01662
+G1 X110.7 Y83.103 Z1.368 E.01662
+G1 X111.111 Y83.371 Z1.369 E.01662
+G1 X111.516 Y83.648 Z1.37 E.01662
+G1 X111.914 Y83.936 Z1.37 E.01662
+G1 X112.305 Y84.233 Z1.371 E.01662
+G1 X112.688 Y84.54 Z1.372 E.01662
+G1 X113.063 Y84.856 Z1.373 E.01662
+G1 X113.431 Y85.181 Z1.373 E.01662
+G1 X113.791 Y85.515 Z1.374 E.01662
+G1 X114.142 Y85.858 Z1.375 E.01662
+G1 X114.485 Y86.209 Z1.376 E.01662
+G1 X114.819 Y86.569 Z1.377 E.01662
+G1 X115.144 Y86.937 Z1.377 E.01662
+G1 X115.46 Y87.312 Z1.378 E.01662
+G1 X115.767 Y87.695 Z1.379 E.01662
+G1 X116.064 Y88.086 Z1.38 E.01662
+G1 X116.352 Y88.484 Z1.38 E.01662
+G1 X116.629 Y88.889 Z1.381 E.01662
+G1 X116.897 Y89.3 Z1.382 E.01662
+G1 X117.155 Y89.718 Z1.383 E.01662
+G1 X117.402 Y90.142 Z1.384 E.01662
+G1 X117.638 Y90.572 Z1.384 E.01662
+G1 X117.864 Y91.008 Z1.385 E.01662
+G1 X118.08 Y91.449 Z1.386 E.01662
+G1 X118.284 Y91.895 Z1.387 E.01662
+G1 X118.478 Y92.346 Z1.387 E.01662
+G1 X118.66 Y92.802 Z1.388 E.01662
+G1 X118.831 Y93.262 Z1.389 E.01662
+G1 X118.991 Y93.726 Z1.39 E.01662
+G1 X119.139 Y94.194 Z1.391 E.01662
+G1 X119.276 Y94.666 Z1.391 E.01662
+G1 X119.401 Y95.14 Z1.392 E.01662
+G1 X119.514 Y95.618 Z1.393 E.01662
+G1 X119.616 Y96.098 Z1.394 E.01662
+G1 X119.706 Y96.581 Z1.395 E.01662
+G1 X119.784 Y97.065 Z1.395 E.01662
+G1 X119.85 Y97.552 Z1.396 E.01662
+G1 X119.904 Y98.04 Z1.397 E.01662
+G1 X119.946 Y98.529 Z1.398 E.01662
+G1 X119.976 Y99.019 Z1.398 E.01662
+G1 X119.994 Y99.509 Z1.399 E.01662
+G1 X120 Y100 Z1.4 E.01662
+G1 X119.994 Y100.491 Z1.401 E.01662
+G1 X119.976 Y100.981 Z1.402 E.01662
+G1 X119.946 Y101.471 Z1.402 E.01662
+G1 X119.904 Y101.96 Z1.403 E.01662
+G1 X119.85 Y102.448 Z1.404 E.01662
+G1 X119.784 Y102.935 Z1.405 E.01662
+G1 X119.706 Y103.419 Z1.405 E.01662
+G1 X119.616 Y103.902 Z1.406 E.01662
+G1 X119.514 Y104.382 Z1.407 E.01662
+G1 X119.401 Y104.86 Z1.408 E.01662
+G1 X119.276 Y105.334 Z1.409 E.01662
+G1 X119.139 Y105.806 Z1.409 E.01662
+G1 X118.991 Y106.274 Z1.41 E.01662
+G1 X118.831 Y106.738 Z1.411 E.01662
+G1 X118.66 Y107.198 Z1.412 E.01662
+G1 X118.478 Y107.654 Z1.413 E.01662
+G1 X118.284 Y108.105 Z1.413 E.01662
+G1 X118.08 Y108.551 Z1.414 E.01662
+G1 X117.864 Y108.992 Z1.415 E.01662
+G1 X117.638 Y109.428 Z1.416 E.01662
+G1 X117.402 Y109.858 Z1.416 E.01662
+G1 X117.155 Y110.282 Z1.417 E.01662
+G1 X116.897 Y110.7 Z1.418 E.01662
+G1 X116.629 Y111.111 Z1.419 E.01662
+G1 X116.352 Y111.516 Z1.42 E.01662
+G1 X116.064 Y111.914 Z1.42 E.01662
+G1 X115.767 Y112.305 Z1.421 E.01662
+G1 X115.46 Y112.688 Z1.422 E.01662
+G1 X115.144 Y113.063 Z1.423 E.01662
+G1 X114.819 Y113.431 Z1.423 E.01662
+G1 X114.485 Y113.791 Z1.424 E.01662
+G1 X114.142 Y114.142 Z1.425 E.01662
+G1 X113.791 Y114.485 Z1.426 E.01662
+G1 X113.431 Y114.819 Z1.427 E.01662
+G1 X113.063 Y115.144 Z1.427 E.01662
+G1 X112.688 Y115.46 Z1.428 E.01662
+G1 X112.305 Y115.767 Z1.429 E.01662
+G1 X111.914 Y116.064 Z1.43 E.01662
+G1 X111.516 Y116.352 Z1.43 E.01662
+G1 X111.111 Y116.629 Z1.431 E.01662
+G1 X110.7 Y116.897 Z1.432 E.01662
+G1 X110.282 Y117.155 Z1.433 E.01662
+G1 X109.858 Y117.402 Z1.434 E.01662
+G1 X109.428 Y117.638 Z1.434 E.01662
+G1 X108.992 Y117.864 Z1.435 E.01662
+G1 X108.551 Y118.08 Z1.436 E.01662
+G1 X108.105 Y118.284 Z1.437 E.01662
+G1 X107.654 Y118.478 Z1.438 E.01662
+G1 X107.198 Y118.66 Z1.438 E.01662
+G1 X106.738 Y118.831 Z1.439 E.01662
+G1 X106.274 Y118.991 Z1.44 E.01662
+G1 X105.806 Y119.139 Z1.441 E.01662
+G1 X105.334 Y119.276 Z1.441 E.01662
+G1 X104.86 Y119.401 Z1.442 E.01662
+G1 X104.382 Y119.514 Z1.443 E.01662
+G1 X103.902 Y119.616 Z1.444 E.01662
+G1 X103.419 Y119.706 Z1.445 E.01662
+G1 X102.935 Y119.784 Z1.445 E.01662
+G1 X102.448 Y119.85 Z1.446 E.01662
+G1 X101.96 Y119.904 Z1.447 E.01662
+G1 X101.471 Y119.946 Z1.448 E.01662
+G1 X100.981 Y119.976 Z1.448 E.01662
+G1 X100.491 Y119.994 Z1.449 E.01662
+G1 X100 Y120 Z1.45 E.01662
+G1 X99.509 Y119.994 Z1.451 E.01662
+G1 X99.019 Y119.976 Z1.452 E.01662
+G1 X98.529 Y119.946 Z1.452 E.01662
+G1 X98.04 Y119.904 Z1.453 E.01662
+G1 X97.552 Y119.85 Z1.454 E.01662
+G1 X97.065 Y119.784 Z1.455 E.01662
+G1 X96.581 Y119.706 Z1.455 E.01662
+G1 X96.098 Y119.616 Z1.456 E.01662
+G1 X95.618 Y119.514 Z1.457 E.01662
+G1 X95.14 Y119.401 Z1.458 E.01662
+G1 X94.666 Y119.276 Z1.459 E.01662
+G1 X94.194 Y119.139 Z1.459 E.01662
+G1 X93.726 Y118.991 Z1.46 E.01662
+G1 X93.262 Y118.831 Z1.461 E.01662
+G1 X92.802 Y118.66 Z1.462 E.01662
+G1 X92.346 Y118.478 Z1.463 E.01662
+G1 X91.895 Y118.284 Z1.463 E.01662
+G1 X91.449 Y118.08 Z1.464 E.01662
+G1 X91.008 Y117.864 Z1.465 E.01662
+G1 X90.572 Y117.638 Z1.466 E.01662
+G1 X90.142 Y117.402 Z1.466 E.01662
+G1 X89.718 Y117.155 Z1.467 E.01662
+G1 X89.3 Y116.897 Z1.468 E.01662
+G1 X88.889 Y116.629 Z1.469 E.01662
+G1 X88.484 Y116.352 Z1.47 E.01662
+G1 X88.086 Y116.064 Z1.47 E.01662
+G1 X87.695 Y115.767 Z1.471 E.01662
+G1 X87.312 Y115.46 Z1.472 E.01662
+G1 X86.937 Y115.144 Z1.473 E.01662
+G1 X86.569 Y114.819 Z1.473 E.01662
+G1 X86.209 Y114.485 Z1.474 E.01662
+G1 X85.858 Y114.142 Z1.475 E.01662
+G1 X85.515 Y113.791 Z1.476 E.01662
+G1 X85.181 Y113.431 Z1.477 E.01662
+G1 X84.856 Y113.063 Z1.477 E.01662
+G1 X84.54 Y112.688 Z1.478 E.01662
+G1 X84.233 Y112.305 Z1.479 E.01662
+G1 X83.936 Y111.914 Z1.48 E.01662
+G1 X83.648 Y111.516 Z1.48 E.01662
+G1 X83.371 Y111.111 Z1.481 E.01662
+G1 X83.103 Y110.7 Z1.482 E.01662
+G1 X82.845 Y110.282 Z1.483 E.01662
+G1 X82.598 Y109.858 Z1.484 E.01662
+G1 X82.362 Y109.428 Z1.484 E.01662
+G1 X82.136 Y108.992 Z1.485 E.01662
+G1 X81.92 Y108.551 Z1.486 E.01662
+G1 X81.716 Y108.105 Z1.487 E.01662
+G1 X81.522 Y107.654 Z1.488 E.01662
+G1 X81.34 Y107.198 Z1.488 E.01662
+G1 X81.169 Y106.738 Z1.489 E.01662
+G1 X81.009 Y106.274 Z1.49 E.01662
+G1 X80.861 Y105.806 Z1.491 E.01662
+G1 X80.724 Y105.334 Z1.491 E.01662
+G1 X80.599 Y104.86 Z1.492 E.01662
+G1 X80.486 Y104.382 Z1.493 E.01662
+G1 X80.384 Y103.902 Z1.494 E.01662
+G1 X80.294 Y103.419 Z1.495 E.01662
+G1 X80.216 Y102.935 Z1.495 E.01662
+G1 X80.15 Y102.448 Z1.496 E.01662
+G1 X80.096 Y101.96 Z1.497 E.01662
+G1 X80.054 Y101.471 Z1.498 E.01662
+G1 X80.024 Y100.981 Z1.498 E.01662
+G1 X80.006 Y100.491 Z1.499 E.01662
+G1 X80 Y100 Z1.5 E.01662
+G1 X80.006 Y99.509 Z1.501 E.01662
+G1 X80.024 Y99.019 Z1.502 E.01662
+G1 X80.054 Y98.529 Z1.502 E.01662
+G1 X80.096 Y98.04 Z1.503 E.01662
+G1 X80.15 Y97.552 Z1.504 E.01662
+G1 X80.216 Y97.065 Z1.505 E.01662
+G1 X80.294 Y96.581 Z1.505 E.01662
+G1 X80.384 Y96.098 Z1.506 E.01662
+G1 X80.486 Y95.618 Z1.507 E.01662
+G1 X80.599 Y95.14 Z1.508 E.01662
+G1 X80.724 Y94.666 Z1.509 E.01662
+G1 X80.861 Y94.194 Z1.509 E.01662
+G1 X81.009 Y93.726 Z1.51 E.01662
+G1 X81.169 Y93.262 Z1.511 E.01662
+G1 X81.34 Y92.802 Z1.512 E.01662
+G1 X81.522 Y92.346 Z1.513 E.01662
+G1 X81.716 Y91.895 Z1.513 E.01662
+G1 X81.92 Y91.449 Z1.514 E.01662
+G1 X82.136 Y91.008 Z1.515 E.01662
+G1 X82.362 Y90.572 Z1.516 E.01662
+G1 X82.598 Y90.142 Z1.516 E.01662
+G1 X82.845 Y89.718 Z1.517 E.01662
+G1 X83.103 Y89.3 Z1.518 E.01662
+G1 X83.371 Y88.889 Z1.519 E.01662
+G1 X83.648 Y88.484 Z1.52 E.01662
+G1 X83.936 Y88.086 Z1.52 E.01662
+G1 X84.233 Y87.695 Z1.521 E.01662
+G1 X84.54 Y87.312 Z1.522 E.01662
+G1 X84.856 Y86.937 Z1.523 E.01662
+G1 X85.181 Y86.569 Z1.523 E.01662
+G1 X85.515 Y86.209 Z1.524 E.01662
+G1 X85.858 Y85.858 Z1.525 E.01662
+G1 X86.209 Y85.515 Z1.526 E.01662
+G1 X86.569 Y85.181 Z1.527 E.01662
+G1 X86.937 Y84.856 Z1.527 E.01662
+G1 X87.312 Y84.54 Z1.528 E.01662
+G1 X87.695 Y84.233 Z1.529 E.01662
+G1 X88.086 Y83.936 Z1.53 E.01662
+G1 X88.484 Y83.648 Z1.53 E.01662
+G1 X88.889 Y83.371 Z1.531 E.01662
+G1 X89.3 Y83.103 Z1.532 E.01662
+G1 X89.718 Y82.845 Z1.533 E.01662
+G1 X90.142 Y82.598 Z1.534 E.01662
+G1 X90.572 Y82.362 Z1.534 E.01662
+G1 X91.008 Y82.136 Z1.535 E.01662
+G1 X91.449 Y81.92 Z1.536 E.01662
+G1 X91.895 Y81.716 Z1.537 E.01662
+G1 X92.346 Y81.522 Z1.538 E.01662
+G1 X92.802 Y81.34 Z1.538 E.01662
+G1 X93.262 Y81.169 Z1.539 E.01662
+G1 X93.726 Y81.009 Z1.54 E.01662
+G1 X94.194 Y80.861 Z1.541 E.01662
+G1 X94.666 Y80.724 Z1.541 E.01662
+G1 X95.14 Y80.599 Z1.542 E.01662
+G1 X95.618 Y80.486 Z1.543 E.01662
+G1 X96.098 Y80.384 Z1.544 E.01662
+G1 X96.581 Y80.294 Z1.545 E.01662
+G1 X97.065 Y80.216 Z1.545 E.01662
+G1 X97.552 Y80.15 Z1.546 E.01662
+G1 X98.04 Y80.096 Z1.547 E.01662
+G1 X98.529 Y80.054 Z1.548 E.01662
+G1 X99.019 Y80.024 Z1.548 E.01662
+G1 X99.509 Y80.006 Z1.549 E.01662
+G1 X100 Y80 Z1.55 E.01662
+G1 X100.491 Y80.006 Z1.551 E.01662
+G1 X100.981 Y80.024 Z1.552 E.01662
+G1 X101.471 Y80.054 Z1.552 E.01662
+G1 X101.96 Y80.096 Z1.553 E.01662
+G1 X102.448 Y80.15 Z1.554 E.01662
+G1 X102.935 Y80.216 Z1.555 E.01662
+G1 X103.419 Y80.294 Z1.555 E.01662
+G1 X103.902 Y80.384 Z1.556 E.01662
+G1 X104.382 Y80.486 Z1.557 E.01662
+G1 X104.86 Y80.599 Z1.558 E.01662
+G1 X105.334 Y80.724 Z1.559 E.01662
+G1 X105.806 Y80.861 Z1.559 E.01662
+G1 X106.274 Y81.009 Z1.56 E.01662
+G1 X106.738 Y81.169 Z1.561 E.01662
+G1 X107.198 Y81.34 Z1.562 E.01662
+G1 X107.654 Y81.522 Z1.563 E.01662
+G1 X108.105 Y81.716 Z1.563 E.01662
+G1 X108.551 Y81.92 Z1.564 E.01662
+G1 X108.992 Y82.136 Z1.565 E.01662
+G1 X109.428 Y82.362 Z1.566 E.01662
+G1 X109.858 Y82.598 Z1.566 E.01662
+G1 X110.282 Y82.845 Z1.567 E.01662
+G1 X110.7 Y83.103 Z1.568 E.01662
+G1 X111.111 Y83.371 Z1.569 E.01662
+G1 X111.516 Y83.648 Z1.57 E.01662
+G1 X111.914 Y83.936 Z1.57 E.01662
+G1 X112.305 Y84.233 Z1.571 E.01662
+G1 X112.688 Y84.54 Z1.572 E.01662
+G1 X113.063 Y84.856 Z1.573 E.01662
+G1 X113.431 Y85.181 Z1.573 E.01662
+G1 X113.791 Y85.515 Z1.574 E.01662
+G1 X114.142 Y85.858 Z1.575 E.01662
+G1 X114.485 Y86.209 Z1.576 E.01662
+G1 X114.819 Y86.569 Z1.577 E.01662
+G1 X115.144 Y86.937 Z1.577 E.01662
+G1 X115.46 Y87.312 Z1.578 E.01662
+G1 X115.767 Y87.695 Z1.579 E.01662
+G1 X116.064 Y88.086 Z1.58 E.01662
+G1 X116.352 Y88.484 Z1.58 E.01662
+G1 X116.629 Y88.889 Z1.581 E.01662
+G1 X116.897 Y89.3 Z1.582 E.01662
+G1 X117.155 Y89.718 Z1.583 E.01662
+G1 X117.402 Y90.142 Z1.584 E.01662
+G1 X117.638 Y90.572 Z1.584 E.01662
+G1 X117.864 Y91.008 Z1.585 E.01662
+G1 X118.08 Y91.449 Z1.586 E.01662
+G1 X118.284 Y91.895 Z1.587 E.01662
+G1 X118.478 Y92.346 Z1.588 E.01662
+G1 X118.66 Y92.802 Z1.588 E.01662
+G1 X118.831 Y93.262 Z1.589 E.01662
+G1 X118.991 Y93.726 Z1.59 E.01662
+G1 X119.139 Y94.194 Z1.591 E.01662
+G1 X119.276 Y94.666 Z1.591 E.01662
+G1 X119.401 Y95.14 Z1.592 E.01662
+G1 X119.514 Y95.618 Z1.593 E.01662
+G1 X119.616 Y96.098 Z1.594 E.01662
+G1 X119.706 Y96.581 Z1.595 E.01662
+G1 X119.784 Y97.065 Z1.595 E.01662
+G1 X119.85 Y97.552 Z1.596 E.01662
+G1 X119.904 Y98.04 Z1.597 E.01662
+G1 X119.946 Y98.529 Z1.598 E.01662
+G1 X119.976 Y99.019 Z1.598 E.01662
+G1 X119.994 Y99.509 Z1.599 E.01662
+G1 X120 Y100 Z1.6 E.01662
+G1 X119.994 Y100.491 Z1.601 E.01662
+G1 X119.976 Y100.981 Z1.602 E.01662
+G1 X119.946 Y101.471 Z1.602 E.01662
+G1 X119.904 Y101.96 Z1.603 E.01662
+G1 X119.85 Y102.448 Z1.604 E.01662
+G1 X119.784 Y102.935 Z1.605 E.01662
+G1 X119.706 Y103.419 Z1.605 E.01662
+G1 X119.616 Y103.902 Z1.606 E.01662
+G1 X119.514 Y104.382 Z1.607 E.01662
+G1 X119.401 Y104.86 Z1.608 E.01662
+G1 X119.276 Y105.334 Z1.609 E.01662
+G1 X119.139 Y105.806 Z1.609 E.01662
+G1 X118.991 Y106.274 Z1.61 E.01662
+G1 X118.831 Y106.738 Z1.611 E.01662
+G1 X118.66 Y107.198 Z1.612 E.01662
+G1 X118.478 Y107.654 Z1.613 E.01662
+G1 X118.284 Y108.105 Z1.613 E.01662
+G1 X118.08 Y108.551 Z1.614 E.01662
+G1 X117.864 Y108.992 Z1.615 E.01662
+G1 X117.638 Y109.428 Z1.616 E.01662
+G1 X117.402 Y109.858 Z1.616 E.01662
+G1 X117.155 Y110.282 Z1.617 E.01662
+G1 X116.897 Y110.7 Z1.618 E.01662
+G1 X116.629 Y111.111 Z1.619 E.01662
+G1 X116.352 Y111.516 Z1.62 E.01662
+G1 X116.064 Y111.914 Z1.62 E.01662
+G1 X115.767 Y112.305 Z1.621 E.01662
+G1 X115.46 Y112.688 Z1.622 E.01662
+G1 X115.144 Y113.063 Z1.623 E.01662
+G1 X114.819 Y113.431 Z1.623 E.01662
+G1 X114.485 Y113.791 Z1.624 E.01662
+G1 X114.142 Y114.142 Z1.625 E.01662
+G1 X113.791 Y114.485 Z1.626 E.01662
+G1 X113.431 Y114.819 Z1.627 E.01662
+G1 X113.063 Y115.144 Z1.627 E.01662
+G1 X112.688 Y115.46 Z1.628 E.01662
+G1 X112.305 Y115.767 Z1.629 E.01662
+G1 X111.914 Y116.064 Z1.63 E.01662
+G1 X111.516 Y116.352 Z1.63 E.01662
+G1 X111.111 Y116.629 Z1.631 E.01662
+G1 X110.7 Y116.897 Z1.632 E.01662
+G1 X110.282 Y117.155 Z1.633 E.01662
+G1 X109.858 Y117.402 Z1.634 E.01662
+G1 X109.428 Y117.638 Z1.634 E.01662
+G1 X108.992 Y117.864 Z1.635 E.01662
+G1 X108.551 Y118.08 Z1.636 E.01662
+G1 X108.105 Y118.284 Z1.637 E.01662
+G1 X107.654 Y118.478 Z1.638 E.01662
+G1 X107.198 Y118.66 Z1.638 E.01662
+G1 X106.738 Y118.831 Z1.639 E.01662
+G1 X106.274 Y118.991 Z1.64 E.01662
+G1 X105.806 Y119.139 Z1.641 E.01662
+G1 X105.334 Y119.276 Z1.641 E.01662
+G1 X104.86 Y119.401 Z1.642 E.01662
+G1 X104.382 Y119.514 Z1.643 E.01662
+G1 X103.902 Y119.616 Z1.644 E.01662
+G1 X103.419 Y119.706 Z1.645 E.01662
+G1 X102.935 Y119.784 Z1.645 E.01662
+G1 X102.448 Y119.85 Z1.646 E.01662
+G1 X101.96 Y119.904 Z1.647 E.01662
+G1 X101.471 Y119.946 Z1.648 E.01662
+G1 X100.981 Y119.976 Z1.648 E.01662
+G1 X100.491 Y119.994 Z1.649 E.01662
+G1 X100 Y120 Z1.65 E.01662
+G1 X99.509 Y119.994 Z1.651 E.01662
+G1 X99.019 Y119.976 Z1.652 E.01662
+G1 X98.529 Y119.946 Z1.652 E.01662
+G1 X98.04 Y119.904 Z1.653 E.01662
+G1 X97.552 Y119.85 Z1.654 E.01662
+G1 X97.065 Y119.784 Z1.655 E.01662
+G1 X96.581 Y119.706 Z1.655 E.01662
+G1 X96.098 Y119.616 Z1.656 E.01662
+G1 X95.618 Y119.514 Z1.657 E.01662
+G1 X95.14 Y119.401 Z1.658 E.01662
+G1 X94.666 Y119.276 Z1.659 E.01662
+G1 X94.194 Y119.139 Z1.659 E.01662
+G1 X93.726 Y118.991 Z1.66 E.01662
+G1 X93.262 Y118.831 Z1.661 E.01662
+G1 X92.802 Y118.66 Z1.662 E.01662
+G1 X92.346 Y118.478 Z1.663 E.01662
+G1 X91.895 Y118.284 Z1.663 E.01662
+G1 X91.449 Y118.08 Z1.664 E.01662
+G1 X91.008 Y117.864 Z1.665 E.01662
+G1 X90.572 Y117.638 Z1.666 E.01662
+G1 X90.142 Y117.402 Z1.666 E.01662
+G1 X89.718 Y117.155 Z1.667 E.01662
+G1 X89.3 Y116.897 Z1.668 E.01662
+G1 X88.889 Y116.629 Z1.669 E.01662
+G1 X88.484 Y116.352 Z1.67 E.01662
+G1 X88.086 Y116.064 Z1.67 E.01662
+G1 X87.695 Y115.767 Z1.671 E.01662
+G1 X87.312 Y115.46 Z1.672 E.01662
+G1 X86.937 Y115.144 Z1.673 E.01662
+G1 X86.569 Y114.819 Z1.673 E.01662
+G1 X86.209 Y114.485 Z1.674 E.01662
+G1 X85.858 Y114.142 Z1.675 E.01662
+G1 X85.515 Y113.791 Z1.676 E.01662
+G1 X85.181 Y113.431 Z1.677 E.01662
+G1 X84.856 Y113.063 Z1.677 E.01662
+G1 X84.54 Y112.688 Z1.678 E.01662
+G1 X84.233 Y112.305 Z1.679 E.01662
+G1 X83.936 Y111.914 Z1.68 E.01662
+G1 X83.648 Y111.516 Z1.68 E.01662
+G1 X83.371 Y111.111 Z1.681 E.01662
+G1 X83.103 Y110.7 Z1.682 E.01662
+G1 X82.845 Y110.282 Z1.683 E.01662
+G1 X82.598 Y109.858 Z1.684 E.01662
+G1 X82.362 Y109.428 Z1.684 E.01662
+G1 X82.136 Y108.992 Z1.685 E.01662
+G1 X81.92 Y108.551 Z1.686 E.01662
+G1 X81.716 Y108.105 Z1.687 E.01662
+G1 X81.522 Y107.654 Z1.688 E.01662
+G1 X81.34 Y107.198 Z1.688 E.01662
+G1 X81.169 Y106.738 Z1.689 E.01662
+G1 X81.009 Y106.274 Z1.69 E.01662
+G1 X80.861 Y105.806 Z1.691 E.01662
+G1 X80.724 Y105.334 Z1.691 E.01662
+G1 X80.599 Y104.86 Z1.692 E.01662
+G1 X80.486 Y104.382 Z1.693 E.01662
+G1 X80.384 Y103.902 Z1.694 E.01662
+G1 X80.294 Y103.419 Z1.695 E.01662
+G1 X80.216 Y102.935 Z1.695 E.01662
+G1 X80.15 Y102.448 Z1.696 E.01662
+G1 X80.096 Y101.96 Z1.697 E.01662
+G1 X80.054 Y101.471 Z1.698 E.01662
+G1 X80.024 Y100.981 Z1.698 E.01662
+G1 X80.006 Y100.491 Z1.699 E.01662
+G1 X80 Y100 Z1.7 E.01662
+G1 X80.006 Y99.509 Z1.701 E.01662
+G1 X80.024 Y99.019 Z1.702 E.01662
+G1 X80.054 Y98.529 Z1.702 E.01662
+G1 X80.096 Y98.04 Z1.703 E.01662
+G1 X80.15 Y97.552 Z1.704 E.01662
+G1 X80.216 Y97.065 Z1.705 E.01662
+G1 X80.294 Y96.581 Z1.705 E.01662
+G1 X80.384 Y96.098 Z1.706 E.01662
+G1 X80.486 Y95.618 Z1.707 E.01662
+G1 X80.599 Y95.14 Z1.708 E.01662
+G1 X80.724 Y94.666 Z1.709 E.01662
+G1 X80.861 Y94.194 Z1.709 E.01662
+G1 X81.009 Y93.726 Z1.71 E.01662
+G1 X81.169 Y93.262 Z1.711 E.01662
+G1 X81.34 Y92.802 Z1.712 E.01662
+G1 X81.522 Y92.346 Z1.713 E.01662
+G1 X81.716 Y91.895 Z1.713 E.01662
+G1 X81.92 Y91.449 Z1.714 E.01662
+G1 X82.136 Y91.008 Z1.715 E.01662
+G1 X82.362 Y90.572 Z1.716 E.01662
+G1 X82.598 Y90.142 Z1.716 E.01662
+G1 X82.845 Y89.718 Z1.717 E.01662
+G1 X83.103 Y89.3 Z1.718 E.01662
+G1 X83.371 Y88.889 Z1.719 E.01662
+G1 X83.648 Y88.484 Z1.72 E.01662
+G1 X83.936 Y88.086 Z1.72 E.01662
+G1 X84.233 Y87.695 Z1.721 E.01662
+G1 X84.54 Y87.312 Z1.722 E.01662
+G1 X84.856 Y86.937 Z1.723 E.01662
+G1 X85.181 Y86.569 Z1.723 E.01662
+G1 X85.515 Y86.209 Z1.724 E.01662
+G1 X85.858 Y85.858 Z1.725 E.01662
+G1 X86.209 Y85.515 Z1.726 E.01662
+G1 X86.569 Y85.181 Z1.727 E.01662
+G1 X86.937 Y84.856 Z1.727 E.01662
+G1 X87.312 Y84.54 Z1.728 E.01662
+G1 X87.695 Y84.233 Z1.729 E.01662
+G1 X88.086 Y83.936 Z1.73 E.01662
+G1 X88.484 Y83.648 Z1.73 E.01662
+G1 X88.889 Y83.371 Z1.731 E.01662
+G1 X89.3 Y83.103 Z1.732 E.01662
+G1 X89.718 Y82.845 Z1.733 E.01662
+G1 X90.142 Y82.598 Z1.734 E.01662
+G1 X90.572 Y82.362 Z1.734 E.01662
+G1 X91.008 Y82.136 Z1.735 E.01662
+G1 X91.449 Y81.92 Z1.736 E.01662
+G1 X91.895 Y81.716 Z1.737 E.01662
+G1 X92.346 Y81.522 Z1.738 E.01662
+G1 X92.802 Y81.34 Z1.738 E.01662
+G1 X93.262 Y81.169 Z1.739 E.01662
+G1 X93.726 Y81.009 Z1.74 E.01662
+G1 X94.194 Y80.861 Z1.741 E.01662
+G1 X94.666 Y80.724 Z1.741 E.01662
+G1 X95.14 Y80.599 Z1.742 E.01662
+G1 X95.618 Y80.486 Z1.743 E.01662
+G1 X96.098 Y80.384 Z1.744 E.01662
+G1 X96.581 Y80.294 Z1.745 E.01662
+G1 X97.065 Y80.216 Z1.745 E.01662
+G1 X97.552 Y80.15 Z1.746 E.01662
+G1 X98.04 Y80.096 Z1.747 E.01662
+G1 X98.529 Y80.054 Z1.748 E.01662
+G1 X99.019 Y80.024 Z1.748 E.01662
+G1 X99.509 Y80.006 Z1.749 E.01662
+G1 X100 Y80 Z1.75 E.01662
+G1 X100.491 Y80.006 Z1.751 E.01662
+G1 X100.981 Y80.024 Z1.752 E.01662
+G1 X101.471 Y80.054 Z1.752 E.01662
+G1 X101.96 Y80.096 Z1.753 E.01662
+G1 X102.448 Y80.15 Z1.754 E.01662
+G1 X102.935 Y80.216 Z1.755 E.01662
+G1 X103.419 Y80.294 Z1.755 E.01662
+G1 X103.902 Y80.384 Z1.756 E.01662
+G1 X104.382 Y80.486 Z1.757 E.01662
+G1 X104.86 Y80.599 Z1.758 E.01662
+G1 X105.334 Y80.724 Z1.759 E.01662
+G1 X105.806 Y80.861 Z1.759 E.01662
+G1 X106.274 Y81.009 Z1.76 E.01662
+G1 X106.738 Y81.169 Z1.761 E.01662
+G1 X107.198 Y81.34 Z1.762 E.01662
+G1 X107.654 Y81.522 Z1.763 E.01662
+G1 X108.105 Y81.716 Z1.763 E.01662
+G1 X108.551 Y81.92 Z1.764 E.01662
+G1 X108.992 Y82.136 Z1.765 E.01662
+G1 X109.428 Y82.362 Z1.766 E.01662
+G1 X109.858 Y82.598 Z1.766 E.01662
+G1 X110.282 Y82.845 Z1.767 E.01662
+G1 X110.7 Y83.103 Z1.768 E.01662
+G1 X111.111 Y83.371 Z1.769 E.01662
+G1 X111.516 Y83.648 Z1.77 E.01662
+G1 X111.914 Y83.936 Z1.77 E.01662
+G1 X112.305 Y84.233 Z1.771 E.01662
+G1 X112.688 Y84.54 Z1.772 E.01662
+G1 X113.063 Y84.856 Z1.773 E.01662
+G1 X113.431 Y85.181 Z1.773 E.01662
+G1 X113.791 Y85.515 Z1.774 E.01662
+G1 X114.142 Y85.858 Z1.775 E.01662
+G1 X114.485 Y86.209 Z1.776 E.01662
+G1 X114.819 Y86.569 Z1.777 E.01662
+G1 X115.144 Y86.937 Z1.777 E.01662
+G1 X115.46 Y87.312 Z1.778 E.01662
+G1 X115.767 Y87.695 Z1.779 E.01662
+G1 X116.064 Y88.086 Z1.78 E.01662
+G1 X116.352 Y88.484 Z1.78 E.01662
+G1 X116.629 Y88.889 Z1.781 E.01662
+G1 X116.897 Y89.3 Z1.782 E.01662
+G1 X117.155 Y89.718 Z1.783 E.01662
+G1 X117.402 Y90.142 Z1.784 E.01662
+G1 X117.638 Y90.572 Z1.784 E.01662
+G1 X117.864 Y91.008 Z1.785 E.01662
+G1 X118.08 Y91.449 Z1.786 E.01662
+G1 X118.284 Y91.895 Z1.787 E.01662
+G1 X118.478 Y92.346 Z1.788 E.01662
+G1 X118.66 Y92.802 Z1.788 E.01662
+G1 X118.831 Y93.262 Z1.789 E.01662
+G1 X118.991 Y93.726 Z1.79 E.01662
+G1 X119.139 Y94.194 Z1.791 E.01662
+G1 X119.276 Y94.666 Z1.791 E.01662
+G1 X119.401 Y95.14 Z1.792 E.01662
+G1 X119.514 Y95.618 Z1.793 E.01662
+G1 X119.616 Y96.098 Z1.794 E.01662
+G1 X119.706 Y96.581 Z1.795 E.01662
+G1 X119.784 Y97.065 Z1.795 E.01662
+G1 X119.85 Y97.552 Z1.796 E.01662
+G1 X119.904 Y98.04 Z1.797 E.01662
+G1 X119.946 Y98.529 Z1.798 E.01662
+G1 X119.976 Y99.019 Z1.798 E.01662
+G1 X119.994 Y99.509 Z1.799 E.01662
+G1 X120 Y100 Z1.8 E.01662
+G1 E-.8 F2100
+M107
+G1 Z11.8 F720 ; Move print head up
+G1 X0 Y200 F3600 ; home X axis
+M104 S0 ; turn off temperature
+M140 S0 ; turn off heatbed
+M84 ; disable motors
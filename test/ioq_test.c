@@ -0,0 +1,394 @@
+/*
+ * ioq_test.c
+ *
+ *  Runs the request queue of ioq.c against a simulated card: a sector
+ *  array with a time cost per command like a real card, where a write
+ *  takes much longer than a read, and writes that fail on chosen sectors.
+ *  Time is in ms, the deadlines are those of iosched.h.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "ioq.h"
+#include "check.h"
+
+#define SIM_SECTORS     256
+#define SIM_LOG         64
+#define SIM_WRITE_MS    500         /* IOSCHED_WRITE_MS */
+
+typedef struct
+{
+	ioq_op_t op;
+	uint32_t sector;
+	uint32_t count;
+} sim_cmd_t;
+
+static uint8_t sim_card[SIM_SECTORS][IOQ_SECTOR_SIZE];
+static uint32_t sim_now;
+static uint32_t sim_fail = UINT32_MAX;     /* a write of this sector fails */
+static sim_cmd_t sim_log[SIM_LOG];
+static uint32_t sim_ncmd;
+
+static void _sim_log(ioq_op_t op, uint32_t sector, uint32_t count)
+{
+	if(sim_ncmd < SIM_LOG)
+	{
+		sim_log[sim_ncmd].op = op;
+		sim_log[sim_ncmd].sector = sector;
+		sim_log[sim_ncmd].count = count;
+	}
+	sim_ncmd++;
+}
+
+static bool sim_read(uint32_t sector, uint8_t *buf, uint32_t count)
+{
+	_sim_log(IOQ_READ, sector, count);
+	sim_now += 1 + count / 4;
+	if(sector + count > SIM_SECTORS)
+		return true;
+	memcpy(buf, sim_card[sector], count * IOQ_SECTOR_SIZE);
+	return false;
+}
+
+static bool sim_write(uint32_t sector, const uint8_t *buf, uint32_t count)
+{
+	_sim_log(IOQ_WRITE, sector, count);
+	sim_now += 20 + count;
+	if(sector + count > SIM_SECTORS ||
+		(sim_fail >= sector && sim_fail < sector + count))
+		return true;
+	memcpy(sim_card[sector], buf, count * IOQ_SECTOR_SIZE);
+	return false;
+}
+
+static const ioq_dev_t sim_dev = {sim_read, sim_write};
+static const uint32_t sim_deadline[IOQ_NCLASSES] =
+	{20, 100, SIM_WRITE_MS, 2000};
+static uint8_t sim_staging[IOQ_BURST * IOQ_SECTOR_SIZE];
+
+static ioq_t q;
+static ioq_req_t reqs[16];
+static uint8_t bufs[16][IOQ_SECTOR_SIZE];
+
+static void _reset(void)
+{
+	memset(sim_card, 0, sizeof(sim_card));
+	memset(reqs, 0, sizeof(reqs));
+	sim_now = 0;
+	sim_ncmd = 0;
+	sim_fail = UINT32_MAX;
+	ioq_init(&q, &sim_dev, sim_deadline, sim_staging);
+}
+
+/*
+ * Write-behind of one sector from slot i, filled with fill.
+ */
+static ioq_req_t *_write(int i, uint32_t sector, uint8_t fill)
+{
+	ioq_req_t *rp = &reqs[i];
+
+	memset(bufs[i], fill, IOQ_SECTOR_SIZE);
+	rp->buf = bufs[i];
+	rp->op = IOQ_WRITE;
+	rp->cls = IOQ_CLASS_WRITE;
+	rp->flags = IOQ_F_ASYNC;
+	rp->sector = sector;
+	rp->count = 1;
+	ioq_submit(&q, rp, sim_now);
+	return rp;
+}
+
+static ioq_req_t *_read(int i, ioq_class_t cls, uint32_t sector,
+	uint32_t count, uint8_t *buf)
+{
+	ioq_req_t *rp = &reqs[i];
+
+	memset(rp, 0, sizeof(*rp));
+	rp->buf = buf;
+	rp->op = IOQ_READ;
+	rp->cls = cls;
+	rp->sector = sector;
+	rp->count = count;
+	ioq_submit(&q, rp, sim_now);
+	return rp;
+}
+
+/*
+ * What the worker thread of iosched.c does for one command.
+ */
+static bool _step(void)
+{
+	if(!ioq_next(&q, sim_now))
+		return false;
+	ioq_complete(&q, ioq_run(&q));
+	return true;
+}
+
+static void _drain(void)
+{
+	while(_step())
+		;
+}
+
+static void test_preempt(void)
+{
+	uint8_t buf[IOQ_SECTOR_SIZE];
+	ioq_req_t *rp;
+
+	_reset();
+	_write(0, 100, 1);
+	_write(1, 120, 2);
+	_write(2, 140, 3);
+	sim_now = 1;
+	rp = _read(3, IOQ_CLASS_JOB, 10, 1, buf);
+	CHECK(ioq_next(&q, sim_now) == 1);
+	CHECK(q.batch[0] == rp);
+	ioq_complete(&q, ioq_run(&q));
+	CHECK(rp->state == IOQ_DONE && !rp->err);
+	CHECK(q.stats.preempted == 1);
+	CHECK(q.stats.cls[IOQ_CLASS_JOB].wait_max == 0);
+	_drain();
+	CHECK(sim_ncmd == 4);
+	CHECK(sim_card[140][0] == 3);
+}
+
+static void test_coalesce(void)
+{
+	uint32_t i;
+
+	_reset();
+	_write(0, 12, 12);
+	_write(1, 10, 10);
+	_write(2, 11, 11);
+	_write(3, 9, 9);
+	CHECK(ioq_next(&q, sim_now) == 4);
+	CHECK(q.bsector == 9 && q.bcount == 4);
+	ioq_complete(&q, ioq_run(&q));
+	CHECK(sim_ncmd == 1);
+	CHECK(sim_log[0].op == IOQ_WRITE && sim_log[0].sector == 9 &&
+		sim_log[0].count == 4);
+	for(i = 9; i <= 12; i++)
+		CHECK(sim_card[i][0] == i && sim_card[i][IOQ_SECTOR_SIZE - 1] == i);
+	CHECK(q.stats.coalesced == 1 && q.stats.merged == 3);
+	CHECK(q.stats.depth == 0);
+}
+
+static void test_burst(void)
+{
+	int i;
+
+	_reset();
+	for(i = 0; i < 10; i++)
+		_write(i, 40 + i, i + 1);
+	_drain();
+	CHECK(sim_ncmd == 2);
+	CHECK(sim_log[0].sector == 40 && sim_log[0].count == IOQ_BURST);
+	CHECK(sim_log[1].sector == 48 && sim_log[1].count == 2);
+	for(i = 0; i < 10; i++)
+		CHECK(sim_card[40 + i][0] == i + 1);
+}
+
+/*
+ * A write is put off for reads until its deadline, then goes first.
+ */
+static void test_deadline(void)
+{
+	uint8_t buf[IOQ_SECTOR_SIZE];
+	ioq_req_t *wp, *rp;
+
+	_reset();
+	wp = _write(0, 200, 7);
+	sim_now = SIM_WRITE_MS / 2;
+	rp = _read(1, IOQ_CLASS_JOB, 20, 1, buf);
+	_step();
+	CHECK(rp->state == IOQ_DONE && wp->state == IOQ_QUEUED);
+
+	sim_now = SIM_WRITE_MS + 1;
+	rp = _read(1, IOQ_CLASS_JOB, 21, 1, buf);
+	_step();
+	CHECK(wp->state == IOQ_DONE && rp->state == IOQ_QUEUED);
+	CHECK(q.stats.cls[IOQ_CLASS_WRITE].late == 1);
+	_drain();
+	CHECK(rp->state == IOQ_DONE);
+	CHECK(sim_card[200][0] == 7);
+}
+
+/*
+ * A read that overlaps a queued write waits for it and sees its data.
+ */
+static void test_overlap(void)
+{
+	uint8_t buf[3 * IOQ_SECTOR_SIZE];
+	ioq_req_t *wp, *rp;
+
+	_reset();
+	_write(0, 80, 1);
+	wp = _write(1, 5, 0xa5);
+	sim_now = 1;
+	rp = _read(2, IOQ_CLASS_JOB, 4, 3, buf);
+	CHECK(ioq_next(&q, sim_now) == 1);
+	CHECK(q.batch[0] == wp);
+	CHECK(q.stats.ordered == 1);
+	ioq_complete(&q, ioq_run(&q));
+	_step();
+	CHECK(rp->state == IOQ_DONE && !rp->err);
+	CHECK(buf[IOQ_SECTOR_SIZE] == 0xa5 && buf[0] == 0);
+	CHECK(reqs[0].state == IOQ_QUEUED);
+
+	/* newer data for a queued write goes out with it */
+	_reset();
+	wp = _write(0, 5, 1);
+	CHECK(ioq_find_write(&q, 5) == wp);
+	CHECK(ioq_find_write(&q, 6) == NULL);
+	memset(wp->buf, 2, IOQ_SECTOR_SIZE);
+	_drain();
+	CHECK(sim_ncmd == 1 && sim_card[5][0] == 2);
+}
+
+/*
+ * A failed command fails every request that rode in it, only those.
+ */
+static void test_error(void)
+{
+	uint8_t buf[IOQ_SECTOR_SIZE];
+	ioq_req_t *rp;
+
+	_reset();
+	sim_fail = 33;
+	_write(0, 32, 1);
+	_write(1, 33, 1);
+	_write(2, 34, 1);
+	_write(3, 60, 1);
+	rp = _read(4, IOQ_CLASS_FS, 33, 1, buf);
+	_drain();
+	CHECK(reqs[0].err && reqs[1].err && reqs[2].err);
+	CHECK(!reqs[3].err);
+	CHECK(rp->state == IOQ_DONE && !rp->err);
+	CHECK(sim_card[60][0] == 1 && sim_card[32][0] == 0);
+}
+
+/*
+ * Cancelling fails what is queued and leaves the running batch alone.
+ */
+static void test_cancel(void)
+{
+	uint8_t buf[IOQ_SECTOR_SIZE];
+	ioq_req_t *rp;
+
+	_reset();
+	_write(0, 10, 1);
+	_write(1, 11, 1);
+	_write(2, 50, 1);
+	rp = _read(3, IOQ_CLASS_JOB, 70, 1, buf);
+	CHECK(ioq_next(&q, sim_now) == 1 && q.batch[0] == rp);
+	CHECK(ioq_cancel(&q) == 3);
+	CHECK(q.head == NULL && q.stats.depth == 1);
+	ioq_complete(&q, ioq_run(&q));
+	CHECK(rp->state == IOQ_DONE && !rp->err);
+	CHECK(reqs[0].state == IOQ_DONE && reqs[0].err);
+	CHECK(reqs[2].state == IOQ_DONE && reqs[2].err);
+	CHECK(q.stats.depth == 0 && q.stats.cancelled == 3);
+	CHECK(!_step() && sim_ncmd == 1);
+	CHECK(sim_card[10][0] == 0 && sim_card[50][0] == 0);
+}
+
+/*
+ * Random mix of write-behind, waited for reads and idle time, checked
+ * against a copy of what the card should hold. Job reads must never see
+ * stale data and must wait less than the writes they overtake.
+ */
+#define RND_REQS        4096
+
+static uint8_t rnd_ref[SIM_SECTORS][IOQ_SECTOR_SIZE];
+static ioq_req_t rnd_req[RND_REQS];
+static uint8_t rnd_buf[RND_REQS][IOQ_SECTOR_SIZE];
+
+static void test_random(void)
+{
+	ioq_class_stats_t *jp, *wp;
+	ioq_req_t r, *rp;
+	uint8_t buf[4 * IOQ_SECTOR_SIZE];
+	uint32_t s, n, k, nr = 0, stale = 0;
+
+	_reset();
+	memset(rnd_ref, 0, sizeof(rnd_ref));
+	srand(1);
+	for(k = 0; k < 20000; k++)
+	{
+		switch(rand() % 10)
+		{
+		case 0: case 1: case 2: case 3: case 4:
+			s = rand() % SIM_SECTORS;
+			memset(rnd_ref[s], rand(), IOQ_SECTOR_SIZE);
+			rnd_ref[s][0] = k;
+			if((rp = ioq_find_write(&q, s)) != NULL)
+			{
+				memcpy(rp->buf, rnd_ref[s], IOQ_SECTOR_SIZE);
+				break;
+			}
+			rp = &rnd_req[nr];
+			rp->buf = rnd_buf[nr++];
+			memcpy(rp->buf, rnd_ref[s], IOQ_SECTOR_SIZE);
+			rp->op = IOQ_WRITE;
+			rp->cls = IOQ_CLASS_WRITE;
+			rp->flags = IOQ_F_ASYNC;
+			rp->sector = s;
+			rp->count = 1;
+			ioq_submit(&q, rp, sim_now);
+			break;
+		case 5: case 6: case 7:
+			n = 1 + rand() % 4;
+			s = rand() % (SIM_SECTORS - n);
+			memset(&r, 0, sizeof(r));
+			r.op = IOQ_READ;
+			r.cls = IOQ_CLASS_JOB;
+			r.sector = s;
+			r.count = n;
+			r.buf = buf;
+			ioq_submit(&q, &r, sim_now);
+			while(r.state != IOQ_DONE && _step())
+				;
+			CHECK(r.state == IOQ_DONE);
+			if(memcmp(buf, rnd_ref[s], n * IOQ_SECTOR_SIZE))
+				stale++;
+			break;
+		default:
+			if(!_step())
+				sim_now += 5;
+			break;
+		}
+		if(nr == RND_REQS)
+		{
+			_drain();
+			nr = 0;
+		}
+	}
+	_drain();
+	CHECK(stale == 0);
+	CHECK(memcmp(sim_card, rnd_ref, sizeof(sim_card)) == 0);
+	CHECK(q.stats.depth == 0);
+	CHECK(q.stats.coalesced > 0 && q.stats.preempted > 0);
+
+	jp = &q.stats.cls[IOQ_CLASS_JOB];
+	wp = &q.stats.cls[IOQ_CLASS_WRITE];
+	CHECK(jp->dispatched > 0 && wp->dispatched > 0);
+	CHECK(jp->wait_total / jp->dispatched < wp->wait_total / wp->dispatched);
+	printf("ioq random: %u commands, %u coalesced, job wait avg %u max %u ms, "
+		"write wait avg %u ms, %u late\n", q.stats.commands,
+		q.stats.coalesced, jp->wait_total / jp->dispatched, jp->wait_max,
+		wp->wait_total / wp->dispatched, wp->late);
+}
+
+int main(void)
+{
+	test_preempt();
+	test_coalesce();
+	test_burst();
+	test_deadline();
+	test_overlap();
+	test_error();
+	test_cancel();
+	test_random();
+	return check_done("ioq_test");
+}
@@ -0,0 +1,53 @@
+/*
+ * jobfile.c
+ *
+ *  Job file reader of the host tests. Lines are read in GCODE_LINE_MAX
+ *  pieces like jobstream_gets() hands them out and go through
+ *  gcode_line(), so the tests see what the firmware parser makes of a
+ *  job: its comment and checksum stripping, lexer and number reader.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "jobfile.h"
+
+/*
+ * Runs the file through cb, returns the number of lines or -1 when it
+ * cannot be read.
+ */
+long jobfile_run(const char *path, jobfile_cb_t cb, void *ctx)
+{
+	_param_t param;
+	char line[GCODE_LINE_MAX];
+	_gcode_error_t err;
+	bool skip = false;
+	long lines = 0;
+	size_t len;
+	FILE *fp;
+
+	if((fp = fopen(path, "r")) == NULL)
+		return -1;
+	memset(&param, 0, sizeof(param));
+	while(fgets(line, sizeof(line), fp) != NULL)
+	{
+		/* as gcode_run(), an overlong line is used when cut in a comment */
+		len = strlen(line);
+		if(skip)
+		{
+			skip = len > 0 && line[len - 1] != '\n' && !feof(fp);
+			continue;
+		}
+		if(len > 0 && line[len - 1] != '\n' && !feof(fp))
+		{
+			skip = true;
+			if(!strchr(line, ';'))
+				continue;
+		}
+		lines++;
+		err = gcode_line(line, &param);
+		cb(&param, err == GCODE_OK && param.move, ctx);
+	}
+	fclose(fp);
+	return lines;
+}
@@ -0,0 +1,22 @@
+/*
+ * jobfile.h
+ *
+ *  Runs a job file for the host tests through the line parser of
+ *  gcode_line.c, the way gcode_run() does on the card.
+ */
+
+#ifndef JOBFILE_H_
+#define JOBFILE_H_
+
+#include "gcode_line.h"
+
+/*
+ * Called for each line, move set when the line was a move. The others
+ * are passed on as analyze does with them, the position may have changed
+ * by G28 or G92.
+ */
+typedef void (*jobfile_cb_t)(const _param_t *param, bool move, void *ctx);
+
+long jobfile_run(const char *path, jobfile_cb_t cb, void *ctx);
+
+#endif /* JOBFILE_H_ */
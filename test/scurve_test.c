@@ -0,0 +1,180 @@
+/*
+ * scurve_test.c
+ *
+ *  Runs moves tick by tick through the Q16.16 S-curve of scurve.c and the
+ *  shapers of shaper.c. Each tick is compared with the same plan evaluated
+ *  in double, rounded phase times and shaper delays included, to within
+ *  1 um. Apart from that the deviation from the ideal profile, which
+ *  profref.c plans again without rounding, is bounded by the peak speed
+ *  times the ticks the rounding moves the phases by, plus 1 um.
+ */
+
+#include <string.h>
+#include <math.h>
+
+#include "scurve.h"
+#include "shaper.h"
+#include "profref.h"
+#include "check.h"
+
+#define RATE            10000       /* GCODE_PROFILE_RATE */
+#define DAMPING         0.1
+#define Q16_MM          (1.0 / 65536.0)
+#define PLAN_TOL        1e-3        /* mm, GCODE_PROFILE_TOL_NM */
+
+typedef struct
+{
+	float len;
+	float v_start;
+	float v_end;
+	float v_max;
+	float a_max;
+	float j_max;
+} move_t;
+
+static const move_t moves[] = {
+	{50.0f,  0.0f,   0.0f,   150.0f, 3000.0f,  100000.0f},   /* cmd_profile */
+	{200.0f, 0.0f,   0.0f,   300.0f, 3000.0f,  100000.0f},
+	{5.0f,   0.0f,   0.0f,   150.0f, 3000.0f,  100000.0f},   /* no cruise */
+	{0.5f,   0.0f,   0.0f,   150.0f, 3000.0f,  100000.0f},   /* no full accel */
+	{20.0f,  40.0f,  10.0f,  120.0f, 2000.0f,  50000.0f},
+	{10.0f,  80.0f,  80.0f,  100.0f, 5000.0f,  200000.0f},
+	{3.0f,   25.0f,  0.0f,   25.0f,  1000.0f,  20000.0f},    /* decelerate only */
+	{300.0f, 0.0f,   0.0f,   10.0f,  200.0f,   10000.0f},    /* Z like */
+	{0.01f,  0.0f,   0.0f,   150.0f, 3000.0f,  100000.0f},
+};
+
+/*
+ * Worst position error over the ticks and after them in mm, against the
+ * rounded plan in *plan and against the ideal profile in *ideal.
+ */
+static void _run(const move_t *m, shaper_type_t type, double freq,
+	double *plan, double *ideal)
+{
+	double amp[SHAPER_IMPULSES], delay[SHAPER_IMPULSES], ref, vref, err;
+	double tol, vmax = 0;
+	uint32_t n, i, k, ticks;
+	scurve_t s;
+	shaper_t sh;
+	profref_t r, c;
+	q16_t pos = 0, vel, prev = 0;
+
+	CHECK(scurve_plan(&s, m->len, m->v_start, m->v_end, m->v_max, m->a_max,
+		m->j_max, RATE));
+	CHECK(profref_plan(&r, m->len, m->v_start, m->v_end, m->v_max, m->a_max,
+		m->j_max));
+	profref_curve(&c, &s);
+	CHECK(s.ticks >= 1);
+	CHECK(fabs(s.ticks - r.total * RATE) <= PROFREF_ROUND_TICKS + 0.5);
+	CHECK(fabs(s.ticks - c.total * RATE) <= s.ticks * 1e-6);
+	CHECK(fabs(s.v_peak - r.v_peak) <= r.v_peak * 1e-4);
+	for(i = 0; i < SCURVE_PHASES; i++)
+	{
+		CHECK(fabsf(s.j[i]) <= m->j_max * 1.001f);
+		CHECK(fabsf(s.j[i]) * s.t[i] <= m->a_max * 1.001f);
+	}
+
+	k = profref_impulses(type, freq, DAMPING, amp, delay);
+	CHECK(shaper_init(&sh, type, (float)freq, (float)DAMPING, RATE, 0));
+	CHECK(sh.n == k);
+	tol = r.v_peak * (PROFREF_ROUND_TICKS + (k > 1 ? 0.5 : 0.0)) / RATE + PLAN_TOL;
+
+	*plan = 0;
+	*ideal = 0;
+	ticks = s.ticks + shaper_delay(&sh) + 1;
+	for(n = 0; n < ticks; n++)
+	{
+		pos = scurve_step(&s, &vel);
+		if(n < s.ticks)
+		{
+			ref = profref_pos(&c, (double)n / RATE, &vref);
+			CHECK(pos >= prev - 1);
+			if(Q16_TO_F(vel) > vmax)
+				vmax = Q16_TO_F(vel);
+			prev = pos;
+		}
+		pos = shaper_step(&sh, pos);
+
+		/* the shaper's own amplitudes and delays in ticks */
+		ref = 0;
+		for(i = 0; i < sh.n; i++)
+			ref += sh.amp[i] * Q16_MM * profref_pos(&c,
+				((double)n - sh.delay[i]) / RATE, NULL);
+		err = fabs(pos * Q16_MM - ref);
+		if(err > *plan)
+			*plan = err;
+
+		ref = 0;
+		for(i = 0; i < k; i++)
+			ref += amp[i] * profref_pos(&r, (double)n / RATE - delay[i], NULL);
+		err = fabs(pos * Q16_MM - ref);
+		if(err > *ideal)
+			*ideal = err;
+	}
+	CHECK(scurve_done(&s));
+	CHECK(fabs(pos * Q16_MM - m->len) <= 2 * Q16_MM);
+	CHECK(vmax <= m->v_max * 1.01 + 0.5);
+	CHECK(*plan <= PLAN_TOL);
+	CHECK(*ideal <= tol);
+}
+
+static void test_moves(void)
+{
+	uint32_t i;
+	double plan[3], ideal[3];
+	scurve_t s;
+
+	for(i = 0; i < sizeof(moves) / sizeof(moves[0]); i++)
+	{
+		_run(&moves[i], SHAPER_NONE, 40.0, &plan[0], &ideal[0]);
+		_run(&moves[i], SHAPER_ZV, 40.0, &plan[1], &ideal[1]);
+		_run(&moves[i], SHAPER_MZV, 60.0, &plan[2], &ideal[2]);
+		scurve_plan(&s, moves[i].len, moves[i].v_start, moves[i].v_end,
+			moves[i].v_max, moves[i].a_max, moves[i].j_max, RATE);
+		printf("%7.2f mm at %5.1f..%5.1f mm/s: %6u ticks, error %.3f/%.3f/%.3f um, "
+			"from ideal %.1f/%.1f/%.1f um\n", moves[i].len, moves[i].v_start,
+			moves[i].v_end, s.ticks, plan[0] * 1e3, plan[1] * 1e3, plan[2] * 1e3,
+			ideal[0] * 1e3, ideal[1] * 1e3, ideal[2] * 1e3);
+	}
+}
+
+/*
+ * Moves of no length and shorter than a tick, they used to divide by a
+ * phase time of zero.
+ */
+static void test_short(void)
+{
+	static const float lens[] = {0.0f, 1e-5f, 1e-4f, 0.002f};
+	scurve_t s;
+	q16_t pos = 0, vel;
+	uint32_t i, n;
+
+	for(i = 0; i < sizeof(lens) / sizeof(lens[0]); i++)
+	{
+		CHECK(scurve_plan(&s, lens[i], 0.0f, 0.0f, 150.0f, 3000.0f, 100000.0f, RATE));
+		if(lens[i] == 0.0f)
+		{
+			CHECK(s.ticks == 0 && scurve_done(&s));
+		}
+		else
+		{
+			CHECK(s.ticks >= 1);
+		}
+		for(n = 0; n < s.ticks + 1; n++)
+		{
+			pos = scurve_step(&s, &vel);
+			CHECK(pos >= 0 && pos <= Q16_FROM_F(lens[i]) + 1);
+		}
+		CHECK(scurve_done(&s));
+		CHECK(fabs(Q16_TO_F(pos) - lens[i]) <= Q16_MM);
+	}
+	/* v_end out of reach */
+	CHECK(!scurve_plan(&s, 0.1f, 0.0f, 100.0f, 150.0f, 3000.0f, 100000.0f, RATE));
+}
+
+int main(void)
+{
+	test_moves();
+	test_short();
+	return check_done("scurve_test");
+}
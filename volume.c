@@ -0,0 +1,575 @@
+/*
+ * volume.c
+ *
+ *  Volume state kept in the background so space queries never scan the
+ *  FAT. After a mount FatFs keeps free_clust up to date by itself, and
+ *  writes it to FSINFO on sync, as long as it starts out valid. A low
+ *  priority thread walks the FAT a few sectors at a time, holding the
+ *  volume lock only per chunk, to fill the free cluster map (clmap.c) and,
+ *  when the card has no valid FSINFO, the free count. FAT writes are seen
+ *  through volume_fat_write() so the part already walked stays exact.
+ *
+ *  The board has no card detect switch. The mount manager thread probes
+ *  for a card with backoff, keeps it mounted across jobs, and while the
+ *  card is idle checks it is still there with CMD13. Any recent transfer
+ *  already proves that, so a busy card is never polled.
+ */
+
+/*===========================================================================*/
+/* Volume state.                                                             */
+/*===========================================================================*/
+#include <string.h>
+
+#include "ch.h"
+#include "hal.h"
+
+#include "chprintf.h"
+
+#include "ff.h"
+#include "diskio.h"
+#include "fat.h"
+#include "volume.h"
+#include "clmap.h"
+#include "filetab.h"
+#include "sdcache.h"
+#include "sdmode.h"
+#include "sddev.h"
+#include "iosched.h"
+#include "config.h"
+#include "ffsync.h"
+#include "memmap.h"
+
+static volatile volume_state_t vol_state;
+static volatile uint32_t vol_gen;          /* bumped on every mount change */
+static uint32_t scan_next;                  /* FAT sectors walked so far */
+static uint32_t scan_free;
+static BSEMAPHORE_DECL(vol_sem, true);
+
+static uint8_t scan_buf[MMCSD_BLOCK_SIZE] CCM_DATA;
+static uint8_t hook_buf[MMCSD_BLOCK_SIZE] CCM_DATA;
+
+/*
+ * Free entries in a FAT sector, entries past the last cluster do not count.
+ * The two reserved entries at the start are never zero.
+ */
+static uint32_t _count_free(const FATFS *fs, uint32_t fsect, const uint8_t *p)
+{
+	uint32_t per, first, n, i, free = 0;
+
+	per = (fs->fs_type == FS_FAT32) ? MMCSD_BLOCK_SIZE / 4 : MMCSD_BLOCK_SIZE / 2;
+	first = fsect * per;
+	if(first >= fs->n_fatent)
+		return 0;
+	n = fs->n_fatent - first;
+	if(n > per)
+		n = per;
+	if(fs->fs_type == FS_FAT32)
+	{
+		for(i = 0; i < n; i++, p += 4)
+			free += ((LD_DWORD(p) & 0x0FFFFFFF) == 0);
+	}
+	else
+	{
+		for(i = 0; i < n; i++, p += 2)
+			free += (LD_WORD(p) == 0);
+	}
+	return free;
+}
+
+/*
+ * diskio.c calls this with the volume lock held, before a sector goes to
+ * the cache. A FAT sector the walk has already passed is diffed against
+ * its old contents.
+ */
+void volume_fat_write(uint32_t sector, const uint8_t *buff)
+{
+	FATFS *fs = &SDC_FS;
+	uint32_t fsect;
+	int32_t delta;
+
+	if(vol_state == VOL_UNMOUNTED || sector < fs->fatbase)
+		return;
+	fsect = sector - fs->fatbase;
+	if(fsect >= fs->fsize || fsect >= scan_next)
+		return;
+	if(disk_read(fs->drv, hook_buf, sector, 1) != RES_OK)
+		return;
+	delta = (int32_t)_count_free(fs, fsect, buff) -
+		(int32_t)_count_free(fs, fsect, hook_buf);
+	if(vol_state == VOL_COUNTING)
+		scan_free += delta;
+	clmap_add(fsect, delta);
+}
+
+static CCM_DATA THD_WORKING_AREA(waVolume, 1024);
+static THD_FUNCTION(volume_thread, arg)
+{
+	FATFS *fs = &SDC_FS;
+	DIR dir;
+	uint32_t gen, fsect, end, free;
+	DWORD clusters;
+	FATFS *fsp;
+	bool ok, counting;
+
+	(void)arg;
+	chRegSetThreadName("volume");
+	iosched_set_class(IOQ_CLASS_BG);
+	while(true)
+	{
+		chBSemWait(&vol_sem);
+		gen = vol_gen;
+
+		/* f_mount() is lazy, opening the root mounts without a scan */
+		if(f_opendir(&dir, "/") != FR_OK)
+		{
+			vol_state = VOL_UNMOUNTED;
+			continue;
+		}
+		f_closedir(&dir);
+
+		ff_req_grant(fs->sobj);
+		if(fs->fs_type == FS_FAT12)
+		{
+			/* small enough to count in one go, no map */
+			ff_rel_grant(fs->sobj);
+			vol_state = f_getfree("/", &clusters, &fsp) == FR_OK ?
+				VOL_READY : VOL_UNMOUNTED;
+			continue;
+		}
+		/* FSINFO was valid, the walk is only for the map */
+		counting = fs->free_clust > fs->n_fatent - 2;
+		scan_next = 0;
+		scan_free = 0;
+		clmap_reset(fs);
+		vol_state = counting ? VOL_COUNTING : VOL_READY;
+		ff_rel_grant(fs->sobj);
+
+		ok = true;
+		for(fsect = 0; ok; )
+		{
+			ff_req_grant(fs->sobj);
+			if(gen != vol_gen || fs->fs_type == 0)
+			{
+				ok = false;
+			}
+			else if(fsect >= fs->fsize)
+			{
+				/* hand the count over to FatFs, persisted on the next sync */
+				if(counting)
+				{
+					fs->free_clust = scan_free;
+					fs->fsi_flag |= 1;
+				}
+				vol_state = VOL_READY;
+				clmap_done();
+				ff_rel_grant(fs->sobj);
+				break;
+			}
+			end = fsect + VOLUME_SCAN_CHUNK;
+			for(; ok && fsect < end && fsect < fs->fsize; fsect++)
+			{
+				/* whoever waits for the volume waits on these reads too */
+				iosched_set_class((ioq_class_t)ffsync_waiter_class(fs->drv, IOQ_CLASS_BG));
+				if(disk_read(fs->drv, scan_buf, fs->fatbase + fsect, 1) != RES_OK)
+				{
+					ok = false;
+					break;
+				}
+				free = _count_free(fs, fsect, scan_buf);
+				scan_free += free;
+				clmap_add(fsect, (int32_t)free);
+				scan_next = fsect + 1;
+			}
+			iosched_set_class(IOQ_CLASS_BG);
+			ff_rel_grant(fs->sobj);
+		}
+		if(!ok && gen == vol_gen)
+			vol_state = VOL_UNMOUNTED;
+	}
+}
+
+/*===========================================================================*/
+/* Mount manager.                                                            */
+/*===========================================================================*/
+
+EVENTSOURCE_DECL(volume_events);
+
+static MUTEX_DECL(mnt_mtx);
+static BSEMAPHORE_DECL(mnt_sem, true);
+static volatile bool vol_mounted;
+static volatile bool vol_auto = true;
+static bool vol_prefetch = true;
+static bool vol_deferred;                   /* lazy mount, scan and config not done */
+static uint32_t mnt_count, mnt_polls, mnt_probes;
+static uint32_t mnt_ms, mnt_connect_ms, mnt_prefetch_ms;
+static uint8_t boot_buf[MMCSD_BLOCK_SIZE] CCM_DATA;
+
+/*
+ * CMD13, the card answers with its status while it is in transfer state.
+ */
+static bool _card_present(void)
+{
+	uint32_t resp[1];
+	bool ok;
+
+	sdcache_acquire();
+	ok = !sdc_lld_send_cmd_short_crc(&SDCD1, MMCSD_CMD_SEND_STATUS, SDCD1.rca, resp) &&
+		!(resp[0] & MMCSD_R1_ERROR_MASK) && MMCSD_R1_STS(resp[0]) == MMCSD_STS_TRAN;
+	sdcache_release();
+	return ok;
+}
+
+static bool _is_vbr(const uint8_t *p)
+{
+	return LD_WORD(p + 510) == 0xAA55 && (!memcmp(p + 54, "FAT", 3) ||
+		!memcmp(p + 82, "FAT32", 5));
+}
+
+/*
+ * Loads what f_mount() and the first open need into the sector cache: the
+ * MBR, then the boot sector with FSINFO, the start of the FAT and the root
+ * directory, each region in one multi block read. Same checks as FatFs,
+ * only the first partition of physical drive 0. Failures are left for
+ * f_mount() to report.
+ */
+static void _prefetch_volume(void)
+{
+	uint32_t vbr = 0, rsvd, nfats, fatsz, fatbase, rootsect, rootlen;
+	uint32_t spc, totsec, n;
+
+	if(disk_read(0, boot_buf, 0, 1) != RES_OK)
+		return;
+	if(!_is_vbr(boot_buf))
+	{
+		if(LD_WORD(boot_buf + 510) != 0xAA55)
+			return;
+		vbr = LD_DWORD(boot_buf + 446 + 8);
+		sdcache_prefetch(vbr, 2);
+		if(disk_read(0, boot_buf, vbr, 1) != RES_OK || !_is_vbr(boot_buf))
+			return;
+	}
+	else
+	{
+		sdcache_prefetch(1, 1);
+	}
+
+	spc = boot_buf[13];
+	rsvd = LD_WORD(boot_buf + 14);
+	nfats = boot_buf[16];
+	fatsz = LD_WORD(boot_buf + 22);
+	if(fatsz == 0)
+		fatsz = LD_DWORD(boot_buf + 36);
+	fatbase = vbr + rsvd;
+	n = fatsz < SDCACHE_READAHEAD ? fatsz : SDCACHE_READAHEAD;
+	sdcache_prefetch(fatbase, n);
+
+	totsec = LD_WORD(boot_buf + 19);
+	if(totsec == 0)
+		totsec = LD_DWORD(boot_buf + 32);
+	if(LD_WORD(boot_buf + 17) == 0)
+	{
+		/* FAT32, the root is a cluster chain, its first cluster */
+		rootsect = fatbase + nfats * fatsz + (LD_DWORD(boot_buf + 44) - 2) * spc;
+		rootlen = spc;
+	}
+	else
+	{
+		rootsect = fatbase + nfats * fatsz;
+		rootlen = LD_WORD(boot_buf + 17) * 32 / MMCSD_BLOCK_SIZE;
+	}
+	if(rootlen > SDCACHE_READAHEAD)
+		rootlen = SDCACHE_READAHEAD;
+	if(spc && rootsect < vbr + totsec)
+		sdcache_prefetch(rootsect, rootlen);
+}
+
+/*
+ * Nothing queued may reach the card once it is disconnected, or the next
+ * card after it. The worker is held while the driver goes down.
+ */
+static void _disconnect(void)
+{
+	sdcache_acquire();
+	iosched_cancel();
+	sdcDisconnect(&SDCD1);
+	sdcache_release();
+}
+
+/*
+ * Lazy mounts defer reading the volume to the first access, prefetch
+ * mounts read it up front so the first job starts in a known time.
+ */
+void volume_set_prefetch(bool enable)
+{
+	vol_prefetch = enable;
+}
+
+/*
+ * Connects and mounts unless already mounted. The card is identified and
+ * the volume read once here, not per job. After unmount the card is left
+ * alone and this returns FR_NOT_READY until the mount command turns auto
+ * mount back on.
+ *
+ * A lazy mount reads nothing past what f_mount() needs. The free cluster
+ * scan and config.ini wait for the first user that comes through here on a
+ * mounted volume, a job or a command.
+ */
+FRESULT volume_mount(void)
+{
+	systime_t start;
+	FRESULT fr = FR_OK;
+
+	chMtxLock(&mnt_mtx);
+	if(vol_mounted)
+	{
+		if(vol_deferred)
+		{
+			vol_deferred = false;
+			volume_mounted();
+			config_load();
+		}
+		goto out;
+	}
+	if(!vol_auto)
+	{
+		fr = FR_NOT_READY;
+		goto out;
+	}
+	start = chVTGetSystemTimeX();
+	if(blkGetDriverState(&SDCD1) != BLK_READY && sdcConnect(&SDCD1))
+	{
+		fr = FR_NOT_READY;
+		goto out;
+	}
+	/* high speed when the card has it */
+	sdcache_acquire();
+	sdmode_negotiate();
+	sdcache_release();
+	/* maybe another card, nothing cached is valid */
+	sdcache_invalidate();
+	mnt_connect_ms = ST2MS(chVTGetSystemTimeX() - start);
+	filetab_flush();
+	if(vol_prefetch)
+		_prefetch_volume();
+	mnt_prefetch_ms = ST2MS(chVTGetSystemTimeX() - start) - mnt_connect_ms;
+	fr = f_mount(&SDC_FS, "", vol_prefetch ? 1 : 0);
+	if(fr != FR_OK)
+	{
+		f_mount(0, "", 0);
+		_disconnect();
+		goto out;
+	}
+	vol_mounted = true;
+	mnt_count++;
+	mnt_ms = ST2MS(chVTGetSystemTimeX() - start);
+	palSetPad(GPIOD, GPIOD_LED6);
+	vol_deferred = !vol_prefetch;
+	if(!vol_deferred)
+	{
+		volume_mounted();
+		config_load();
+	}
+	chEvtBroadcastFlags(&volume_events, VOL_EVT_MOUNTED);
+out:
+	chMtxUnlock(&mnt_mtx);
+	return fr;
+}
+
+/*
+ * Dirty sectors are only written back when the card is still there. A card
+ * that is gone is unmounted under open files, they fail from then on.
+ */
+static void _unmount_locked(bool sync)
+{
+	if(!vol_mounted)
+		return;
+	vol_deferred = false;
+	volume_unmounted();
+	filetab_flush();
+	if(sync)
+		sdcache_sync();
+	f_mount(0, "", 0);
+	_disconnect();
+	palClearPad(GPIOD, GPIOD_LED6);
+	vol_mounted = false;
+	chEvtBroadcastFlags(&volume_events, VOL_EVT_UNMOUNTED);
+}
+
+static void _unmount(bool sync)
+{
+	chMtxLock(&mnt_mtx);
+	_unmount_locked(sync);
+	chMtxUnlock(&mnt_mtx);
+}
+
+/*
+ * Unmount for removal, refused with FR_LOCKED while files are open. Auto
+ * mount is turned off so nothing mounts the card again until the mount
+ * command.
+ */
+FRESULT volume_unmount(void)
+{
+	chMtxLock(&mnt_mtx);
+	if(filetab_busy())
+	{
+		chMtxUnlock(&mnt_mtx);
+		return FR_LOCKED;
+	}
+	vol_auto = false;
+	_unmount_locked(true);
+	chMtxUnlock(&mnt_mtx);
+	return FR_OK;
+}
+
+/*
+ * With auto mount off the manager leaves the card alone, for the mount
+ * command.
+ */
+void volume_set_auto(bool enable)
+{
+	chSysLock();
+	vol_auto = enable;
+	chBSemSignalI(&mnt_sem);
+	chSchRescheduleS();
+	chSysUnlock();
+}
+
+bool volume_is_mounted(void)
+{
+	return vol_mounted;
+}
+
+void volume_print(BaseSequentialStream *chp)
+{
+	static const char * const names[] = {"unmounted", "counting", "ready"};
+
+	chprintf(chp, "FS: %s, %s, auto mount %s\r\n",
+		vol_mounted ? "mounted" : "no card",
+		vol_deferred ? "scan on first use" : names[vol_state],
+		vol_auto ? "on" : "off");
+	chprintf(chp, "FS: %s mount ready in %lu ms (connect %lu, prefetch %lu)\r\n",
+		vol_prefetch ? "prefetch" : "lazy", mnt_ms, mnt_connect_ms, mnt_prefetch_ms);
+	chprintf(chp, "FS: %lu mounts, %lu probes, %lu polls\r\n",
+		mnt_count, mnt_probes, mnt_polls);
+	if(vol_mounted)
+		chprintf(chp, "SD: %d bit bus at %lu kHz, high speed %s, %lu fallbacks\r\n",
+			sdmode_bus_width(), sdmode_clock_khz(),
+			sdmode.hs ? "on" : (sdmode.hs_capable ? "off" : "n/a"),
+			sdmode.fallbacks);
+}
+
+static CCM_DATA THD_WORKING_AREA(waMount, 1024);
+static THD_FUNCTION(mount_thread, arg)
+{
+	uint32_t probe_ms = VOLUME_PROBE_MIN_MS;
+	systime_t wait = TIME_IMMEDIATE, last;
+
+	(void)arg;
+	chRegSetThreadName("mount");
+	while(true)
+	{
+		if(wait != TIME_IMMEDIATE)
+			chBSemWaitTimeout(&mnt_sem, wait);
+		if(!vol_mounted)
+		{
+			if(!vol_auto)
+			{
+				wait = TIME_INFINITE;
+				continue;
+			}
+			mnt_probes++;
+			if(volume_mount() == FR_OK)
+			{
+				probe_ms = VOLUME_PROBE_MIN_MS;
+				wait = MS2ST(VOLUME_POLL_MS);
+			}
+			else
+			{
+				wait = MS2ST(probe_ms);
+				if(probe_ms < VOLUME_PROBE_MAX_MS)
+					probe_ms *= 2;
+			}
+			continue;
+		}
+		wait = MS2ST(VOLUME_POLL_MS);
+		last = sddev_last_io;
+		if(chVTIsSystemTimeWithinX(last, last + MS2ST(VOLUME_POLL_MS)))
+			continue;
+		mnt_polls++;
+		if(!_card_present())
+		{
+			_unmount(false);
+			wait = MS2ST(VOLUME_PROBE_MIN_MS);
+		}
+	}
+}
+
+void volume_init(void)
+{
+	chDbgAssert(MEM_IS_DMA_SAFE(SDC_FS.win), "volume window not DMA safe");
+	chThdCreateStatic(waVolume, sizeof(waVolume), LOWPRIO, volume_thread, NULL);
+	chThdCreateStatic(waMount, sizeof(waMount), NORMALPRIO - 1, mount_thread, NULL);
+}
+
+/*
+ * Call after f_mount(), or after anything that rewrites the FAT behind
+ * FatFs like f_mkfs().
+ */
+void volume_mounted(void)
+{
+	chSysLock();
+	vol_gen++;
+	scan_next = 0;
+	clmap_invalidate();
+	vol_state = VOL_COUNTING;
+	chBSemSignalI(&vol_sem);
+	chSchRescheduleS();
+	chSysUnlock();
+}
+
+void volume_unmounted(void)
+{
+	chSysLock();
+	vol_gen++;
+	scan_next = 0;
+	clmap_invalidate();
+	vol_state = VOL_UNMOUNTED;
+	chSysUnlock();
+}
+
+volume_state_t volume_state(void)
+{
+	return vol_state;
+}
+
+/*
+ * O(1), false while the free count is not known yet.
+ */
+bool volume_free_clusters(uint32_t *clusters)
+{
+	FATFS *fs = &SDC_FS;
+	uint32_t n;
+
+	if(vol_state != VOL_READY || fs->fs_type == 0)
+		return false;
+	n = fs->free_clust;
+	if(n > fs->n_fatent - 2)
+		return false;
+	*clusters = n;
+	return true;
+}
+
+/*
+ * Space check before an upload or a log is started. FR_NOT_READY while
+ * the count is running, FR_DENIED when bytes do not fit.
+ */
+FRESULT volume_check_space(uint32_t bytes)
+{
+	uint32_t clusters, need;
+
+	if(!volume_free_clusters(&clusters))
+		return FR_NOT_READY;
+	need = (bytes + SDC_FS.csize * MMCSD_BLOCK_SIZE - 1) /
+		(SDC_FS.csize * MMCSD_BLOCK_SIZE);
+	return need <= clusters ? FR_OK : FR_DENIED;
+}
@@ -0,0 +1,45 @@
+/*
+ * volume.h
+ *
+ *  Volume state kept in the background so space queries never scan the
+ *  FAT.
+ */
+
+#ifndef VOLUME_H_
+#define VOLUME_H_
+
+#include "ff.h"
+
+#define VOLUME_SCAN_CHUNK   8       /* FAT sectors per volume lock */
+#define VOLUME_POLL_MS      1000    /* status poll of a mounted card */
+#define VOLUME_PROBE_MIN_MS 250     /* first retry when no card answers */
+#define VOLUME_PROBE_MAX_MS 4000
+
+/* volume_events flags */
+#define VOL_EVT_MOUNTED     1
+#define VOL_EVT_UNMOUNTED   2
+
+typedef enum
+{
+	VOL_UNMOUNTED = 0,
+	VOL_COUNTING,
+	VOL_READY
+} volume_state_t;
+
+extern event_source_t volume_events;
+
+void volume_init(void);
+FRESULT volume_mount(void);
+FRESULT volume_unmount(void);
+void volume_set_auto(bool enable);
+void volume_set_prefetch(bool enable);
+bool volume_is_mounted(void);
+void volume_print(BaseSequentialStream *chp);
+void volume_mounted(void);
+void volume_unmounted(void);
+volume_state_t volume_state(void);
+bool volume_free_clusters(uint32_t *clusters);
+FRESULT volume_check_space(uint32_t bytes);
+void volume_fat_write(uint32_t sector, const uint8_t *buff);
+
+#endif /* VOLUME_H_ */